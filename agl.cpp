@@ -0,0 +1,1425 @@
+// agl.cpp : Adobe Glyph List lookup through a minimal perfect hash
+//
+// The tables are generated from the Adobe Glyph List 2.0 (glyphlist.txt, 4281 names) with a
+// hash-and-displace search: a name's bucket seed picks its slot, so a lookup is two hashes
+// and one string compare.
+//
+// Copyright 2002-2019 Adobe (http://www.adobe.com/).
+//
+// Redistribution and use in source and binary forms, with or
+// without modification, are permitted provided that the
+// following conditions are met:
+//
+// Redistributions of source code must retain the above
+// copyright notice, this list of conditions and the following
+// disclaimer.
+//
+// Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following
+// disclaimer in the documentation and/or other materials
+// provided with the distribution.
+//
+// Neither the name of Adobe nor the names of its contributors
+// may be used to endorse or promote products derived from this
+// software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+// CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+// INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+// NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+// LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "agl.h"
+
+namespace
+{
+    constexpr uint32_t kAglBucketCount = 1071;
+    constexpr uint32_t kAglSlotCount = 4281;
+
+    constexpr uint16_t kAglSeeds[] = {
+        9, 5, 19, 78, 144, 14, 5, 3, 4, 34, 56, 13, 81, 134, 1, 27,
+        53, 1, 49, 11, 1, 1, 1, 153, 2, 262, 191, 109, 30, 2, 9, 21,
+        17, 12, 191, 25, 11, 24, 178, 101, 8, 6, 1, 21, 33, 2, 0, 112,
+        136, 3, 37, 131, 135, 234, 13, 55, 52, 156, 1, 9, 54, 1, 64, 148,
+        7, 3, 22, 83, 36, 2, 9, 66, 104, 85, 9, 243, 116, 27, 53, 2,
+        5, 217, 115, 1, 93, 8, 68, 121, 0, 7, 50, 16, 2, 54, 22, 1,
+        26, 48, 1, 20, 2, 48, 14, 53, 2, 3, 4, 82, 8, 38, 82, 18,
+        2, 23, 117, 8, 17, 21, 6, 1, 64, 8, 6, 74, 9, 27, 49, 38,
+        3, 9, 8, 5, 16, 55, 39, 49, 11, 6, 86, 8, 18, 2, 4, 20,
+        173, 120, 2, 83, 199, 37, 1, 186, 64, 154, 43, 442, 381, 21, 11, 11,
+        6, 15, 7, 62, 0, 1, 4, 58, 12, 384, 116, 277, 56, 5, 55, 185,
+        5, 4, 6, 11, 4, 2, 3, 41, 1, 3, 43, 56, 2, 15, 4, 7,
+        7, 5, 12, 4, 0, 128, 28, 28, 2, 15, 21, 126, 295, 3, 19, 105,
+        70, 1, 596, 67, 7, 258, 17, 6, 333, 2, 50, 25, 7, 20, 103, 1,
+        3, 71, 1, 122, 39, 9, 73, 1, 1, 5, 44, 21, 51, 6, 438, 231,
+        2, 12, 156, 57, 91, 67, 3, 129, 32, 140, 11, 6, 4, 20, 20, 1,
+        27, 69, 2, 513, 31, 34, 149, 9, 88, 41, 1, 255, 4, 280, 21, 172,
+        56, 3, 333, 3, 52, 6, 26, 618, 263, 49, 170, 19, 1, 15, 19, 1,
+        92, 116, 104, 56, 53, 212, 163, 1, 69, 33, 16, 1, 10, 623, 121, 1,
+        12, 9, 116, 2, 9, 1, 171, 1, 108, 5, 17, 225, 216, 630, 208, 8,
+        10, 162, 598, 3, 115, 73, 621, 350, 404, 4, 6, 335, 14, 1, 159, 21,
+        3, 289, 116, 6, 70, 9, 11, 12, 8, 119, 328, 17, 337, 3, 1, 22,
+        66, 49, 44, 2, 133, 132, 85, 797, 19, 2, 35, 94, 26, 21, 62, 301,
+        18, 21, 685, 7, 14, 85, 165, 8, 8, 44, 84, 594, 1, 39, 523, 187,
+        20, 3, 1131, 66, 153, 33, 247, 77, 133, 169, 94, 2, 0, 11, 167, 53,
+        270, 37, 14, 6, 224, 23, 61, 48, 13, 60, 84, 171, 239, 61, 2, 37,
+        17, 1, 617, 10, 160, 168, 126, 100, 145, 433, 1, 17, 301, 0, 8, 2,
+        50, 1, 22, 125, 84, 37, 44, 129, 33, 67, 4, 189, 172, 284, 2, 5,
+        96, 42, 81, 864, 49, 52, 0, 30, 38, 102, 25, 27, 502, 226, 1, 10,
+        72, 3, 11, 18, 8, 7, 153, 4, 46, 442, 4, 67, 26, 5, 78, 258,
+        602, 22, 28, 131, 393, 196, 581, 374, 855, 47, 53, 31, 27, 45, 14, 157,
+        156, 397, 28, 84, 61, 23, 128, 467, 4, 15, 212, 12, 14, 167, 1, 14,
+        26, 7, 360, 425, 5, 1164, 28, 406, 171, 1, 177, 1, 1, 1, 1367, 1331,
+        44, 245, 75, 57, 69, 296, 18, 1, 97, 2, 3, 101, 242, 1, 109, 20,
+        65, 217, 206, 147, 129, 503, 122, 30, 45, 3, 2, 224, 494, 91, 436, 6,
+        3, 41, 1, 37, 188, 14, 0, 3, 120, 0, 508, 266, 24, 83, 83, 200,
+        1050, 0, 1248, 11, 4, 507, 1360, 162, 119, 76, 115, 1, 13, 44, 12, 21,
+        0, 259, 20, 0, 4, 14, 32, 78, 16, 24, 3, 184, 7, 18, 202, 62,
+        29, 53, 1, 52, 181, 804, 6, 350, 353, 256, 136, 121, 35, 1545, 5, 4,
+        570, 56, 108, 69, 23, 1, 136, 638, 47, 2, 4, 432, 40, 31, 397, 108,
+        1, 2, 363, 13, 17, 2, 305, 543, 173, 181, 83, 11, 273, 487, 30, 17,
+        53, 2, 60, 96, 24, 146, 197, 628, 3, 17, 364, 110, 150, 60, 1, 13,
+        867, 31, 68, 137, 69, 79, 38, 49, 1, 28, 63, 357, 2, 62, 57, 220,
+        41, 75, 1, 15, 69, 396, 8, 687, 197, 731, 90, 74, 14, 98, 38, 0,
+        5, 732, 164, 274, 189, 374, 108, 167, 318, 321, 15, 88, 235, 34, 276, 657,
+        7, 3, 32, 5, 202, 205, 98, 44, 373, 20, 318, 0, 70, 196, 996, 160,
+        13, 5, 273, 1, 497, 278, 391, 1, 664, 67, 488, 72, 13, 1, 90, 28,
+        102, 51, 44, 693, 62, 176, 152, 199, 245, 0, 143, 256, 15, 3, 10, 68,
+        19, 1251, 17, 60, 35, 1128, 695, 9, 41, 233, 12, 5, 455, 2793, 12, 172,
+        300, 303, 180, 406, 29, 140, 1, 444, 13, 1, 2102, 3303, 45, 2, 144, 5,
+        113, 37, 1, 310, 133, 172, 26, 2, 11, 38, 14, 466, 1, 245, 1305, 215,
+        2, 39, 52, 94, 231, 0, 1374, 169, 13, 1085, 21, 484, 860, 2, 397, 388,
+        14, 289, 180, 1, 121, 61, 148, 160, 0, 2, 0, 53, 54, 574, 226, 2,
+        1679, 68, 4, 1, 1728, 1217, 6, 129, 550, 213, 2, 4, 6, 889, 203, 1070,
+        671, 210, 495, 1, 125, 335, 156, 621, 11, 39, 1218, 0, 1953, 62, 46, 1016,
+        1, 3, 706, 11, 314, 95, 176, 34, 423, 3, 8, 9, 1003, 276, 103, 1479,
+        6, 203, 2, 1, 77, 26, 8, 1, 1, 8, 586, 38, 518, 1339, 101, 17,
+        1, 65, 3, 520, 571, 0, 283, 84, 238, 12, 918, 55, 67, 1917, 2172, 2458,
+        173, 372, 20, 6, 1, 1775, 284, 60, 12, 302, 23, 35, 703, 61, 268, 44,
+        402, 37, 810, 0, 1703, 442, 1868, 1425, 843, 35, 29, 3, 37, 99, 1122, 24,
+        213, 7, 189, 211, 5, 33, 1990, 796, 249, 99, 1379, 39, 1467, 295, 81, 3,
+        700, 1, 8, 15, 5, 18, 65, 635, 14, 8, 1, 1209, 747, 1722, 254, 188,
+        739, 11, 4, 32, 49, 6, 105, 296, 61, 390, 1663, 2329, 149, 469, 0, 32,
+        748, 98, 650, 16, 178, 788, 1281, 569, 2774, 365, 1, 1, 16, 413, 3531, 48,
+        155, 1298, 288, 327, 3, 1, 282, 636, 547, 25, 1395, 1449, 569, 26, 1700, 101,
+        155, 162, 2112, 705, 229, 1650, 6669, 229, 183, 7, 173, 1102, 34, 3, 13, 684,
+        1, 55, 1043, 27, 0, 30, 5, 2726, 9, 101, 494, 118, 2, 3537, 370,
+    };
+
+    struct AglEntry
+    {
+        uint16_t nameOffset;  // Into kAglNames
+        uint8_t nameLength;
+        uint8_t count;        // Code points; more than one are stored in kAglSequences
+        uint16_t value;       // The code point, or the first index into kAglSequences
+    };
+
+    constexpr AglEntry kAglEntries[] = {
+        { 0, 15, 1, 0x317B }, { 15, 9, 1, 0x2478 }, { 24, 10, 1, 0x06F1 }, { 34, 7, 1, 0x039F }, { 41, 19, 1, 0xFF8E }, { 60, 7, 1, 0x0113 },
+        { 67, 12, 1, 0x0E4E }, { 79, 14, 1, 0xFF18 }, { 93, 7, 1, 0x24BB }, { 100, 11, 1, 0x01C0 }, { 111, 2, 1, 0x01C9 }, { 113, 15, 1, 0xFE98 },
+        { 128, 10, 1, 0xFF36 }, { 138, 13, 1, 0xF8EE }, { 151, 11, 1, 0x3139 }, { 162, 12, 1, 0x246A }, { 174, 14, 1, 0x2664 }, { 188, 9, 1, 0x00EF },
+        { 197, 15, 1, 0xFECC }, { 212, 11, 1, 0x248A }, { 223, 6, 1, 0x0154 }, { 229, 18, 1, 0x047A }, { 247, 9, 1, 0x042D }, { 256, 9, 1, 0x3118 },
+        { 265, 10, 1, 0x0411 }, { 275, 11, 1, 0x0531 }, { 286, 2, 1, 0x01A2 }, { 288, 10, 1, 0x0665 }, { 298, 17, 1, 0xFB46 }, { 315, 10, 1, 0x0A10 },
+        { 325, 13, 1, 0x1EF1 }, { 338, 23, 1, 0x3233 }, { 361, 16, 1, 0xF7EE }, { 377, 10, 1, 0x2463 }, { 387, 15, 1, 0x30C3 }, { 402, 11, 1, 0x1E2D },
+        { 413, 9, 1, 0x33AD }, { 422, 10, 1, 0x0566 }, { 432, 19, 1, 0xFF80 }, { 451, 14, 1, 0x201A }, { 465, 8, 1, 0x0959 }, { 473, 10, 1, 0x305A },
+        { 483, 8, 1, 0x3160 }, { 491, 18, 1, 0xF88E }, { 509, 6, 1, 0x00FD }, { 515, 6, 1, 0x0939 }, { 521, 2, 1, 0x01C7 }, { 523, 15, 1, 0x033C },
+        { 538, 8, 1, 0x315B }, { 546, 14, 1, 0x05A4 }, { 560, 14, 1, 0x0217 }, { 574, 8, 1, 0x01EF }, { 582, 10, 1, 0x30CC }, { 592, 16, 1, 0xFB2B },
+        { 608, 10, 1, 0x30EA }, { 618, 16, 1, 0xFB20 }, { 634, 10, 1, 0x0541 }, { 644, 15, 1, 0xFB6D }, { 659, 15, 1, 0xFEF4 }, { 674, 14, 1, 0x2499 },
+        { 688, 9, 1, 0x2193 }, { 697, 7, 1, 0x24BA }, { 704, 12, 1, 0x211E }, { 716, 9, 1, 0x0644 }, { 725, 12, 1, 0x0138 }, { 737, 10, 1, 0x056E },
+        { 747, 24, 1, 0xFE86 }, { 771, 13, 1, 0x1E1D }, { 784, 9, 1, 0xF6C5 }, { 793, 9, 1, 0x05E1 }, { 802, 12, 1, 0x33BF }, { 814, 12, 1, 0x2473 },
+        { 826, 6, 1, 0x24A2 }, { 832, 7, 1, 0x25BC }, { 839, 16, 1, 0xFEA0 }, { 855, 19, 1, 0x04F5 }, { 874, 9, 1, 0x045E }, { 883, 12, 1, 0x093D },
+        { 895, 9, 1, 0x093C }, { 904, 6, 1, 0x24A3 }, { 910, 8, 1, 0x0993 }, { 918, 20, 1, 0x05B1 }, { 938, 6, 1, 0x1E3F }, { 944, 10, 1, 0x1EE9 },
+        { 954, 9, 1, 0x00B1 }, { 963, 9, 1, 0x2168 }, { 972, 15, 1, 0x01DE }, { 987, 11, 1, 0x3322 }, { 998, 6, 1, 0x0165 }, { 1004, 11, 1, 0x0305 },
+        { 1015, 10, 1, 0xFF4D }, { 1025, 22, 1, 0x300E }, { 1047, 14, 1, 0x332B }, { 1061, 5, 1, 0x0186 }, { 1066, 22, 1, 0x261C }, { 1088, 13, 1, 0x2077 },
+        { 1101, 8, 1, 0x3398 }, { 1109, 5, 1, 0x026C }, { 1114, 10, 1, 0x1E23 }, { 1124, 9, 1, 0x2461 }, { 1133, 17, 1, 0x326D }, { 1150, 14, 1, 0x0ACD },
+        { 1164, 17, 2, 0x0000 }, { 1181, 11, 1, 0x054D }, { 1192, 9, 1, 0x044A }, { 1201, 9, 1, 0x3327 }, { 1210, 14, 1, 0x30A5 }, { 1224, 10, 1, 0x30BF },
+        { 1234, 9, 1, 0x1E7E }, { 1243, 1, 1, 0x0043 }, { 1244, 10, 1, 0x0AAC }, { 1254, 8, 1, 0x2563 }, { 1262, 5, 1, 0x2592 }, { 1267, 9, 1, 0x04D9 },
+        { 1276, 11, 1, 0x03DA }, { 1287, 10, 1, 0x1E0F }, { 1297, 10, 1, 0x03AC }, { 1307, 10, 1, 0x0420 }, { 1317, 22, 1, 0x05B2 }, { 1339, 9, 1, 0x310D },
+        { 1348, 11, 1, 0x054A }, { 1359, 8, 1, 0x33B8 }, { 1367, 11, 1, 0x00CA }, { 1378, 5, 1, 0x0253 }, { 1383, 13, 1, 0xF885 }, { 1396, 15, 1, 0xFF61 },
+        { 1411, 18, 1, 0x3177 }, { 1429, 33, 1, 0xFE3A }, { 1462, 14, 2, 0x0002 }, { 1476, 14, 1, 0x026D }, { 1490, 21, 1, 0x322F }, { 1511, 9, 1, 0x304A },
+        { 1520, 15, 1, 0x279E }, { 1535, 8, 1, 0x33C9 }, { 1543, 11, 1, 0x02BA }, { 1554, 14, 1, 0x0E12 }, { 1568, 19, 1, 0x3269 }, { 1587, 11, 1, 0xF7E8 },
+        { 1598, 18, 1, 0x3290 }, { 1616, 19, 1, 0x300A }, { 1635, 3, 1, 0x03A7 }, { 1638, 9, 1, 0x0627 }, { 1647, 16, 2, 0x0004 }, { 1663, 6, 1, 0x0143 },
+        { 1669, 9, 1, 0x0641 }, { 1678, 9, 1, 0x0626 }, { 1687, 7, 1, 0x24C1 }, { 1694, 8, 1, 0x0E54 }, { 1702, 13, 1, 0x0385 }, { 1715, 9, 1, 0x09A4 },
+        { 1724, 16, 1, 0x320D }, { 1740, 7, 1, 0x01FD }, { 1747, 8, 1, 0x3385 }, { 1755, 5, 1, 0x2212 }, { 1760, 9, 1, 0x05D5 }, { 1769, 12, 1, 0x2080 },
+        { 1781, 12, 1, 0x0AA0 }, { 1793, 21, 1, 0x3226 }, { 1814, 9, 1, 0x0429 }, { 1823, 17, 1, 0xFE9B }, { 1840, 9, 1, 0x05D6 }, { 1849, 10, 1, 0x30F9 },
+        { 1859, 16, 1, 0x1ED6 }, { 1875, 16, 1, 0x25AB }, { 1891, 9, 1, 0x0990 }, { 1900, 8, 1, 0x2260 }, { 1908, 11, 1, 0x0425 }, { 1919, 5, 1, 0x2588 },
+        { 1924, 13, 1, 0xFF14 }, { 1937, 13, 1, 0x2496 }, { 1950, 12, 1, 0x2084 }, { 1962, 19, 1, 0x1ED8 }, { 1981, 9, 1, 0x05B4 }, { 1990, 17, 1, 0x0649 },
+        { 2007, 6, 1, 0x01CE }, { 2013, 7, 1, 0x3154 }, { 2020, 17, 1, 0x04E6 }, { 2037, 20, 1, 0xFF3E }, { 2057, 8, 1, 0x05D4 }, { 2065, 11, 1, 0x247F },
+        { 2076, 16, 1, 0x09E1 }, { 2092, 10, 1, 0x0413 }, { 2102, 18, 1, 0xFE4A }, { 2120, 7, 1, 0xFE6B }, { 2127, 22, 1, 0x3298 }, { 2149, 10, 1, 0x0005 },
+        { 2159, 10, 1, 0x3349 }, { 2169, 8, 1, 0x0E50 }, { 2177, 6, 1, 0x011F }, { 2183, 10, 1, 0x30B1 }, { 2193, 30, 1, 0x3237 }, { 2223, 9, 1, 0x05DE },
+        { 2232, 10, 1, 0x306D }, { 2242, 11, 1, 0x1EB1 }, { 2253, 14, 1, 0x2198 }, { 2267, 11, 1, 0xF7EC }, { 2278, 24, 1, 0xFF6C }, { 2302, 8, 1, 0x05B8 },
+        { 2310, 11, 1, 0x00F4 }, { 2321, 11, 1, 0x318D }, { 2332, 9, 1, 0x2164 }, { 2341, 8, 1, 0x0300 }, { 2349, 7, 1, 0x02D6 }, { 2356, 14, 1, 0xFE4F },
+        { 2370, 18, 1, 0x207E }, { 2388, 18, 1, 0xF884 }, { 2406, 8, 1, 0x1E28 }, { 2414, 5, 1, 0x02D8 }, { 2419, 9, 1, 0x00A9 }, { 2428, 9, 1, 0x00B6 },
+        { 2437, 8, 1, 0x33A9 }, { 2445, 8, 1, 0x02A3 }, { 2453, 15, 1, 0x3087 }, { 2468, 9, 1, 0x0414 }, { 2477, 9, 1, 0x045B }, { 2486, 5, 1, 0x002F },
+        { 2491, 22, 1, 0x32A8 }, { 2513, 31, 1, 0xFEF9 }, { 2544, 12, 1, 0x2493 }, { 2556, 17, 1, 0x0591 }, { 2573, 9, 1, 0x1E33 }, { 2582, 9, 1, 0xF6F1 },
+        { 2591, 8, 1, 0x3161 }, { 2599, 9, 1, 0x05DD }, { 2608, 11, 1, 0x05AE }, { 2619, 11, 1, 0x0E2C }, { 2630, 7, 1, 0x028C }, { 2637, 1, 1, 0x006D },
+        { 2638, 7, 1, 0x200D }, { 2645, 13, 1, 0x0591 }, { 2658, 14, 1, 0x0E31 }, { 2672, 12, 1, 0x0341 }, { 2684, 14, 1, 0x1E72 }, { 2698, 16, 1, 0x044C },
+        { 2714, 12, 1, 0x0307 }, { 2726, 23, 1, 0x05B1 }, { 2749, 10, 1, 0x0AB5 }, { 2759, 7, 1, 0x05B0 }, { 2766, 7, 1, 0x0025 }, { 2773, 9, 1, 0x099C },
+        { 2782, 16, 1, 0x02C5 }, { 2798, 11, 1, 0x09EF }, { 2809, 12, 1, 0x0A6B }, { 2821, 8, 1, 0x095A }, { 2829, 10, 1, 0x03E7 }, { 2839, 9, 1, 0xF6C7 },
+        { 2848, 12, 1, 0x0E09 }, { 2860, 10, 1, 0x1ECF }, { 2870, 10, 1, 0x30F2 }, { 2880, 11, 1, 0x0109 }, { 2891, 8, 1, 0x2555 }, { 2899, 9, 1, 0x0641 },
+        { 2908, 7, 1, 0x0172 }, { 2915, 9, 1, 0x05BB }, { 2924, 10, 1, 0x1E41 }, { 2934, 9, 1, 0x0387 }, { 2943, 11, 1, 0x056B }, { 2954, 9, 1, 0x05E7 },
+        { 2963, 14, 1, 0x0947 }, { 2977, 18, 1, 0x02D0 }, { 2995, 13, 1, 0x21E3 }, { 3008, 9, 1, 0x061F }, { 3017, 10, 2, 0x0006 }, { 3027, 18, 1, 0xFC73 },
+        { 3045, 10, 1, 0xFF30 }, { 3055, 8, 1, 0x338A }, { 3063, 9, 1, 0x0688 }, { 3072, 2, 1, 0x01F1 }, { 3074, 8, 1, 0x01E3 }, { 3082, 12, 1, 0xFE6A },
+        { 3094, 10, 1, 0x0343 }, { 3104, 14, 2, 0x0008 }, { 3118, 10, 1, 0x017B }, { 3128, 12, 1, 0x0122 }, { 3140, 12, 1, 0x2197 }, { 3152, 23, 1, 0x05B8 },
+        { 3175, 9, 1, 0x05E0 }, { 3184, 8, 1, 0x2283 }, { 3192, 10, 1, 0x33C0 }, { 3202, 8, 1, 0x33C8 }, { 3210, 11, 1, 0x2592 }, { 3221, 14, 1, 0x05C4 },
+        { 3235, 14, 1, 0x337E }, { 3249, 14, 1, 0xFEBA }, { 3263, 10, 1, 0x308F }, { 3273, 12, 1, 0x028A }, { 3285, 13, 1, 0x2286 }, { 3298, 9, 1, 0x0423 },
+        { 3307, 11, 1, 0x0A68 }, { 3318, 16, 1, 0x04C1 }, { 3334, 11, 1, 0x0A1E }, { 3345, 24, 1, 0xFBA5 }, { 3369, 14, 1, 0x0983 }, { 3383, 18, 1, 0x22DA },
+        { 3401, 5, 1, 0x0905 }, { 3406, 11, 1, 0x0A18 }, { 3417, 17, 1, 0x3316 }, { 3434, 15, 2, 0x000A }, { 3449, 20, 1, 0x328C }, { 3469, 9, 1, 0xF6EE },
+        { 3478, 10, 1, 0x3123 }, { 3488, 11, 1, 0x3134 }, { 3499, 19, 1, 0x326B }, { 3518, 6, 1, 0x05E1 }, { 3524, 16, 1, 0x1ED1 }, { 3540, 9, 1, 0x0632 },
+        { 3549, 23, 1, 0xFF67 }, { 3572, 16, 1, 0x033E }, { 3588, 19, 1, 0xFF8B }, { 3607, 8, 1, 0x315E }, { 3615, 9, 1, 0x00AF }, { 3624, 27, 1, 0x3017 },
+        { 3651, 15, 1, 0x05F4 }, { 3666, 7, 1, 0x00A0 }, { 3673, 17, 1, 0x320F }, { 3690, 15, 2, 0x000C }, { 3705, 9, 1, 0x062D }, { 3714, 10, 1, 0x3070 },
+        { 3724, 10, 1, 0x043D }, { 3734, 23, 1, 0xFF68 }, { 3757, 10, 1, 0x1EDA }, { 3767, 12, 1, 0x1E16 }, { 3779, 9, 1, 0x05C0 }, { 3788, 16, 2, 0x000E },
+        { 3804, 9, 1, 0x05D3 }, { 3813, 12, 1, 0x03EB }, { 3825, 19, 1, 0xFF7C }, { 3844, 16, 1, 0x263B }, { 3860, 9, 1, 0x060C }, { 3869, 11, 1, 0x220C },
+        { 3880, 8, 1, 0x2299 }, { 3888, 23, 1, 0x25E5 }, { 3911, 10, 1, 0x30CA }, { 3921, 11, 1, 0x2467 }, { 3932, 9, 1, 0x3388 }, { 3941, 6, 1, 0x012D },
+        { 3947, 2, 1, 0xFB00 }, { 3949, 10, 1, 0x0AB8 }, { 3959, 5, 1, 0x018A }, { 3964, 10, 1, 0x01E1 }, { 3974, 10, 1, 0x307C }, { 3984, 19, 1, 0x05B8 },
+        { 4003, 10, 1, 0x007D }, { 4013, 11, 1, 0x0AB3 }, { 4024, 15, 1, 0xFB35 }, { 4039, 10, 1, 0x05B1 }, { 4049, 12, 1, 0x06F8 }, { 4061, 14, 1, 0x1E4F },
+        { 4075, 9, 1, 0x00A6 }, { 4084, 12, 1, 0x019B }, { 4096, 8, 1, 0x33B0 }, { 4104, 18, 1, 0xF891 }, { 4122, 9, 1, 0x0433 }, { 4131, 10, 1, 0xFF2A },
+        { 4141, 20, 1, 0x3278 }, { 4161, 13, 1, 0xF7A8 }, { 4174, 9, 1, 0x001D }, { 4183, 12, 1, 0x05F0 }, { 4195, 10, 1, 0x007E }, { 4205, 15, 1, 0x05BD },
+        { 4220, 7, 1, 0x24B6 }, { 4227, 19, 1, 0x3294 }, { 4246, 11, 1, 0xFE63 }, { 4257, 16, 1, 0x02C9 }, { 4273, 10, 1, 0x30EB }, { 4283, 10, 1, 0x2019 },
+        { 4293, 18, 1, 0xFF75 }, { 4311, 17, 1, 0x321B }, { 4328, 12, 1, 0x1E50 }, { 4340, 26, 1, 0xFE42 }, { 4366, 15, 1, 0x0263 }, { 4381, 4, 1, 0x2663 },
+        { 4385, 10, 1, 0x0121 }, { 4395, 14, 1, 0x0E5A }, { 4409, 14, 1, 0x032A }, { 4423, 19, 2, 0x0010 }, { 4442, 9, 1, 0x3392 }, { 4451, 30, 1, 0x03D4 },
+        { 4481, 10, 1, 0x30B9 }, { 4491, 19, 1, 0xF890 }, { 4510, 5, 1, 0x018F }, { 4515, 6, 1, 0x2013 }, { 4521, 7, 1, 0x258C }, { 4528, 16, 1, 0x3201 },
+        { 4544, 11, 1, 0x0AAD }, { 4555, 9, 1, 0x2021 }, { 4564, 14, 1, 0x2024 }, { 4578, 9, 1, 0x0416 }, { 4587, 8, 1, 0x013B }, { 4595, 9, 1, 0x1E25 },
+        { 4604, 13, 1, 0x0460 }, { 4617, 9, 1, 0x043D }, { 4626, 10, 1, 0x30F4 }, { 4636, 12, 1, 0x0219 }, { 4648, 16, 1, 0x0593 }, { 4664, 12, 1, 0x25C6 },
+        { 4676, 15, 1, 0xFE4C }, { 4691, 12, 1, 0x05B8 }, { 4703, 11, 1, 0x05DC }, { 4714, 20, 1, 0x322D }, { 4734, 11, 1, 0x0445 }, { 4745, 12, 1, 0x05A5 },
+        { 4757, 7, 1, 0x0933 }, { 4764, 6, 1, 0xF76A }, { 4770, 15, 1, 0x2270 }, { 4785, 17, 1, 0x0492 }, { 4802, 10, 1, 0x30ED }, { 4812, 17, 1, 0xFB7D },
+        { 4829, 17, 1, 0xFC60 }, { 4846, 13, 1, 0x0316 }, { 4859, 12, 1, 0x05C2 }, { 4871, 22, 1, 0x329E }, { 4893, 7, 1, 0x25B2 }, { 4900, 11, 1, 0x0AAB },
+        { 4911, 7, 1, 0x091E }, { 4918, 18, 1, 0x1E68 }, { 4936, 3, 1, 0x2312 }, { 4939, 17, 1, 0xFEB8 }, { 4956, 9, 1, 0x1ECC }, { 4965, 10, 1, 0x1E06 },
+        { 4975, 10, 1, 0x3314 }, { 4985, 7, 1, 0x2113 }, { 4992, 6, 1, 0x1E81 }, { 4998, 11, 1, 0xF7FD }, { 5009, 13, 1, 0x2078 }, { 5022, 19, 1, 0xFF5E },
+        { 5041, 6, 1, 0x0924 }, { 5047, 9, 1, 0x1E47 }, { 5056, 10, 1, 0xF6F4 }, { 5066, 9, 1, 0x3391 }, { 5075, 1, 1, 0x0066 }, { 5076, 13, 1, 0x0E2F },
+        { 5089, 7, 1, 0x05B9 }, { 5096, 10, 1, 0xFF2E }, { 5106, 13, 1, 0x0E17 }, { 5119, 10, 1, 0x2668 }, { 5129, 1, 1, 0x0053 }, { 5130, 5, 1, 0x03C3 },
+        { 5135, 12, 1, 0x05B2 }, { 5147, 10, 1, 0x30B5 }, { 5157, 9, 1, 0xF6F3 }, { 5166, 6, 1, 0x01E8 }, { 5172, 10, 1, 0xFF21 }, { 5182, 11, 1, 0x266A },
+        { 5193, 10, 1, 0x06F6 }, { 5203, 15, 1, 0x30F6 }, { 5218, 9, 1, 0x0650 }, { 5227, 18, 1, 0x2310 }, { 5245, 10, 1, 0x1E40 }, { 5255, 10, 1, 0x30D4 },
+        { 5265, 2, 1, 0x0132 }, { 5267, 11, 1, 0x216A }, { 5278, 11, 1, 0x3141 }, { 5289, 16, 1, 0x3149 }, { 5305, 21, 1, 0x0962 }, { 5326, 6, 1, 0x0155 },
+        { 5332, 15, 1, 0x0419 }, { 5347, 13, 1, 0x2310 }, { 5360, 23, 1, 0x05B2 }, { 5383, 15, 1, 0x3085 }, { 5398, 15, 1, 0x1E66 }, { 5413, 11, 1, 0x05D2 },
+        { 5424, 16, 1, 0x02C2 }, { 5440, 12, 1, 0x054F }, { 5452, 14, 1, 0x0665 }, { 5466, 9, 1, 0x1E5B }, { 5475, 13, 1, 0xF8EF }, { 5488, 4, 1, 0x02DC },
+        { 5492, 10, 1, 0x00DF }, { 5502, 11, 1, 0x3142 }, { 5513, 9, 1, 0x2213 }, { 5522, 12, 1, 0x2075 }, { 5534, 15, 1, 0x094C }, { 5549, 10, 1, 0x0432 },
+        { 5559, 5, 1, 0x0393 }, { 5564, 9, 1, 0x064B }, { 5573, 18, 1, 0xFE33 }, { 5591, 5, 1, 0x025B }, { 5596, 10, 1, 0x304B }, { 5606, 8, 1, 0x25CE },
+        { 5614, 9, 1, 0xFB39 }, { 5623, 19, 1, 0x04B3 }, { 5642, 12, 1, 0xF8FE }, { 5654, 8, 1, 0x01EE }, { 5662, 19, 2, 0x0012 }, { 5681, 10, 1, 0x1E57 },
+        { 5691, 6, 1, 0x00D8 }, { 5697, 23, 1, 0x3235 }, { 5720, 17, 1, 0xFE4E }, { 5737, 18, 1, 0x032D }, { 5755, 11, 1, 0x0535 }, { 5766, 9, 1, 0x2015 },
+        { 5775, 6, 1, 0x00CC }, { 5781, 14, 1, 0xFEAA }, { 5795, 9, 1, 0x2010 }, { 5804, 14, 1, 0x01DB }, { 5818, 15, 1, 0xFEEC }, { 5833, 13, 1, 0x037A },
+        { 5846, 19, 1, 0x3220 }, { 5865, 9, 1, 0x3046 }, { 5874, 9, 1, 0x1EB8 }, { 5883, 14, 1, 0xF7F6 }, { 5897, 7, 1, 0x24BF }, { 5904, 9, 1, 0x040E },
+        { 5913, 15, 1, 0x05B6 }, { 5928, 10, 1, 0x308B }, { 5938, 3, 1, 0x263C }, { 5941, 2, 1, 0x0152 }, { 5943, 21, 2, 0x0014 }, { 5964, 17, 1, 0x0344 },
+        { 5981, 6, 1, 0x0958 }, { 5987, 12, 1, 0x0552 }, { 5999, 12, 1, 0xF7B8 }, { 6011, 13, 1, 0x207C }, { 6024, 11, 1, 0x0402 }, { 6035, 17, 1, 0x321C },
+        { 6052, 9, 1, 0x05B1 }, { 6061, 11, 1, 0xF731 }, { 6072, 13, 1, 0x0330 }, { 6085, 10, 1, 0xF6FE }, { 6095, 3, 1, 0x03C1 }, { 6098, 15, 1, 0xFB4F },
+        { 6113, 10, 1, 0x307F }, { 6123, 5, 1, 0x0259 }, { 6128, 15, 1, 0xF7A1 }, { 6143, 9, 1, 0x001C }, { 6152, 12, 1, 0x21D4 }, { 6164, 7, 1, 0x05B7 },
+        { 6171, 14, 1, 0x025F }, { 6185, 3, 1, 0x20A9 }, { 6188, 10, 1, 0x306C }, { 6198, 3, 1, 0x05D9 }, { 6201, 20, 1, 0xFB1F }, { 6221, 8, 1, 0xFB34 },
+        { 6229, 25, 1, 0xFE8C }, { 6254, 11, 1, 0xF7E1 }, { 6265, 1, 1, 0x004A }, { 6266, 5, 1, 0x0038 }, { 6271, 15, 1, 0x1E65 }, { 6286, 19, 1, 0xFF81 },
+        { 6305, 13, 1, 0x201D }, { 6318, 11, 1, 0x0AA1 }, { 6329, 10, 1, 0x0130 }, { 6339, 9, 1, 0x05B5 }, { 6348, 23, 1, 0xFF6B }, { 6371, 10, 1, 0x0438 },
+        { 6381, 8, 1, 0x2475 }, { 6389, 10, 1, 0x305D }, { 6399, 10, 1, 0x005F }, { 6409, 12, 1, 0x0A6F }, { 6421, 13, 2, 0x0016 }, { 6434, 9, 1, 0x043E },
+        { 6443, 7, 1, 0x0180 }, { 6450, 6, 1, 0xF767 }, { 6456, 6, 1, 0x0114 }, { 6462, 8, 1, 0x0136 }, { 6470, 11, 1, 0xF7F9 }, { 6481, 23, 1, 0xFEF4 },
+        { 6504, 10, 1, 0x30C5 }, { 6514, 9, 1, 0x0440 }, { 6523, 8, 1, 0x2042 }, { 6531, 8, 1, 0x2564 }, { 6539, 12, 1, 0x0A22 }, { 6551, 9, 1, 0x0454 },
+        { 6560, 10, 1, 0x30E4 }, { 6570, 9, 1, 0x0643 }, { 6579, 11, 1, 0x059B }, { 6590, 23, 1, 0x066B }, { 6613, 16, 1, 0xFE97 }, { 6629, 9, 1, 0x067E },
+        { 6638, 16, 1, 0x05E5 }, { 6654, 9, 1, 0x2154 }, { 6663, 21, 1, 0x32A4 }, { 6684, 11, 1, 0x0459 }, { 6695, 6, 1, 0x0129 }, { 6701, 6, 1, 0x091A },
+        { 6707, 13, 1, 0x3027 }, { 6720, 15, 1, 0xFB89 }, { 6735, 9, 1, 0x05F0 }, { 6744, 10, 1, 0xFF47 }, { 6754, 12, 1, 0x21D4 }, { 6766, 7, 1, 0x24C6 },
+        { 6773, 9, 1, 0x3189 }, { 6782, 24, 1, 0x3005 }, { 6806, 21, 1, 0x3183 }, { 6827, 11, 1, 0x1E1B }, { 6838, 7, 1, 0x24D0 }, { 6845, 8, 1, 0x3158 },
+        { 6853, 11, 1, 0x03EC }, { 6864, 10, 1, 0x3064 }, { 6874, 8, 1, 0x0E0B }, { 6882, 7, 1, 0x0925 }, { 6889, 20, 1, 0xFEEA }, { 6909, 10, 1, 0x043C },
+        { 6919, 24, 1, 0x3014 }, { 6943, 14, 1, 0xFB6B }, { 6957, 7, 1, 0x095F }, { 6964, 14, 1, 0xFB44 }, { 6978, 10, 1, 0x013F }, { 6988, 22, 2, 0x0018 },
+        { 7010, 10, 1, 0x0688 }, { 7020, 12, 1, 0xF8E8 }, { 7032, 5, 1, 0x0181 }, { 7037, 11, 1, 0x2296 }, { 7048, 13, 1, 0xFF19 }, { 7061, 19, 1, 0x1EC7 },
+        { 7080, 6, 1, 0x24B1 }, { 7086, 8, 1, 0x02D7 }, { 7094, 5, 1, 0xF6CA }, { 7099, 18, 1, 0x059C }, { 7117, 9, 1, 0x2113 }, { 7126, 20, 2, 0x001A },
+        { 7146, 10, 1, 0x0437 }, { 7156, 2, 1, 0x03C0 }, { 7158, 11, 1, 0xF8E6 }, { 7169, 10, 1, 0x0A2F }, { 7179, 7, 1, 0x0182 }, { 7186, 35, 1, 0x09F8 },
+        { 7221, 12, 1, 0x0472 }, { 7233, 9, 2, 0x001C }, { 7242, 10, 1, 0x0538 }, { 7252, 9, 1, 0x0453 }, { 7261, 9, 1, 0x310B }, { 7270, 16, 1, 0xFEBB },
+        { 7286, 9, 1, 0x0651 }, { 7295, 9, 1, 0x1E04 }, { 7304, 9, 1, 0x2593 }, { 7313, 19, 1, 0x321A }, { 7332, 18, 1, 0x320B }, { 7350, 9, 1, 0x0204 },
+        { 7359, 9, 1, 0x033D }, { 7368, 20, 1, 0xFC9F }, { 7388, 9, 1, 0x0663 }, { 7397, 11, 1, 0xF7E3 }, { 7408, 4, 1, 0x003C }, { 7412, 15, 1, 0x3167 },
+        { 7427, 12, 1, 0x21D0 }, { 7439, 10, 1, 0x0011 }, { 7449, 13, 1, 0x04D9 }, { 7462, 20, 1, 0x064C }, { 7482, 11, 1, 0x0A16 }, { 7493, 10, 1, 0x3129 },
+        { 7503, 8, 1, 0x0137 }, { 7511, 1, 1, 0x0065 }, { 7512, 12, 1, 0xF6DF }, { 7524, 14, 1, 0x064B }, { 7538, 8, 1, 0x2562 }, { 7546, 16, 1, 0x1E19 },
+        { 7562, 9, 1, 0x0434 }, { 7571, 9, 1, 0x0E01 }, { 7580, 13, 1, 0xF8F0 }, { 7593, 3, 1, 0x00A5 }, { 7596, 8, 1, 0x05B0 }, { 7604, 10, 1, 0x1E6B },
+        { 7614, 14, 1, 0x2016 }, { 7628, 10, 1, 0x2591 }, { 7638, 7, 1, 0x24C0 }, { 7645, 9, 1, 0xFB3E }, { 7654, 19, 1, 0x09F4 }, { 7673, 6, 1, 0x0930 },
+        { 7679, 14, 1, 0x06C1 }, { 7693, 7, 1, 0x25CA }, { 7700, 19, 1, 0x04AD }, { 7719, 10, 1, 0x1EBB }, { 7729, 11, 1, 0xF7FA }, { 7740, 7, 1, 0x0275 },
+        { 7747, 9, 1, 0x2264 }, { 7756, 9, 1, 0x0409 }, { 7765, 19, 1, 0x0312 }, { 7784, 17, 1, 0x3173 }, { 7801, 8, 1, 0x227A }, { 7809, 10, 1, 0x017C },
+        { 7819, 4, 1, 0x02A7 }, { 7823, 18, 1, 0xFE38 }, { 7841, 10, 1, 0x0A97 }, { 7851, 8, 1, 0x315F }, { 7859, 5, 1, 0x03C9 }, { 7864, 10, 1, 0x099B },
+        { 7874, 5, 1, 0x00B4 }, { 7879, 6, 1, 0x0164 }, { 7885, 9, 1, 0x06D5 }, { 7894, 14, 1, 0x249A }, { 7908, 9, 1, 0x0E1F }, { 7917, 5, 1, 0x00FE },
+        { 7922, 11, 1, 0xFB32 }, { 7933, 8, 1, 0x2553 }, { 7941, 14, 1, 0xFF0F }, { 7955, 16, 1, 0x1EA5 }, { 7971, 8, 1, 0x3397 }, { 7979, 8, 1, 0x21EA },
+        { 7987, 9, 2, 0x001E }, { 7996, 6, 1, 0x00E3 }, { 8002, 16, 1, 0x3180 }, { 8018, 5, 1, 0x20A3 }, { 8023, 8, 1, 0x211C }, { 8031, 19, 1, 0xFF9A },
+        { 8050, 28, 1, 0x25B4 }, { 8078, 9, 1, 0x2178 }, { 8087, 17, 1, 0xFED0 }, { 8104, 8, 1, 0x3384 }, { 8112, 16, 1, 0xFB6C }, { 8128, 24, 1, 0x05B8 },
+        { 8152, 16, 1, 0xFECB }, { 8168, 10, 1, 0x0003 }, { 8178, 20, 2, 0x0020 }, { 8198, 2, 1, 0x01A6 }, { 8200, 11, 1, 0x1EAF }, { 8211, 14, 1, 0x0A3F },
+        { 8225, 12, 1, 0x0325 }, { 8237, 11, 1, 0x0AB6 }, { 8248, 24, 1, 0xF893 }, { 8272, 20, 1, 0x316B }, { 8292, 10, 1, 0xFF4A }, { 8302, 14, 1, 0x0A41 },
+        { 8316, 9, 1, 0x05E9 }, { 8325, 7, 1, 0x0118 }, { 8332, 8, 1, 0x33D8 }, { 8340, 14, 1, 0xFB34 }, { 8354, 9, 1, 0x0649 }, { 8363, 9, 1, 0x043F },
+        { 8372, 5, 1, 0x0193 }, { 8377, 17, 1, 0x04F0 }, { 8394, 11, 1, 0x0E4F }, { 8405, 11, 1, 0x0586 }, { 8416, 6, 1, 0x03BB }, { 8422, 9, 1, 0x0170 },
+        { 8431, 9, 1, 0x005C }, { 8440, 21, 1, 0x0345 }, { 8461, 6, 1, 0x0115 }, { 8467, 7, 1, 0x01E5 }, { 8474, 13, 1, 0x00B3 }, { 8487, 11, 1, 0x0427 },
+        { 8498, 9, 1, 0x05C2 }, { 8507, 9, 1, 0x1E8C }, { 8516, 10, 1, 0x2017 }, { 8526, 15, 1, 0xFE9E }, { 8541, 11, 1, 0x247E }, { 8552, 16, 1, 0x3006 },
+        { 8568, 10, 1, 0x0581 }, { 8578, 19, 1, 0x3270 }, { 8597, 10, 1, 0x0A39 }, { 8607, 7, 1, 0x22CE }, { 8614, 13, 1, 0xF738 }, { 8627, 9, 1, 0x01BB },
+        { 8636, 10, 1, 0x1E0E }, { 8646, 10, 1, 0x2468 }, { 8656, 9, 1, 0x310A }, { 8665, 23, 1, 0x300F }, { 8688, 6, 1, 0x0142 }, { 8694, 7, 1, 0x0112 },
+        { 8701, 10, 1, 0x3126 }, { 8711, 22, 1, 0x0591 }, { 8733, 9, 1, 0x0E22 }, { 8742, 10, 1, 0xFF49 }, { 8752, 5, 1, 0x02A0 }, { 8757, 11, 1, 0xF7F1 },
+        { 8768, 27, 1, 0xFF9F }, { 8795, 10, 1, 0x0A08 }, { 8805, 10, 1, 0x043F }, { 8815, 7, 1, 0x092B }, { 8822, 21, 1, 0x0495 }, { 8843, 9, 1, 0x0A05 },
+        { 8852, 8, 1, 0x33D3 }, { 8860, 10, 1, 0x09AD }, { 8870, 23, 1, 0xFF9E }, { 8893, 10, 1, 0x308D }, { 8903, 13, 1, 0x0A71 }, { 8916, 10, 1, 0x0117 },
+        { 8926, 10, 1, 0x0332 }, { 8936, 18, 1, 0x05BB }, { 8954, 18, 1, 0x05B0 }, { 8972, 17, 1, 0xFEA7 }, { 8989, 10, 1, 0x1EEE }, { 8999, 5, 1, 0x0199 },
+        { 9004, 9, 1, 0x0151 }, { 9013, 10, 1, 0x0A26 }, { 9023, 7, 1, 0x01C5 }, { 9030, 6, 1, 0x010F }, { 9036, 24, 1, 0x3179 }, { 9060, 10, 1, 0x30D5 },
+        { 9070, 10, 1, 0x0A32 }, { 9080, 10, 1, 0x30F7 }, { 9090, 26, 1, 0x2792 }, { 9116, 9, 1, 0x0490 }, { 9125, 1, 1, 0x0079 }, { 9126, 17, 1, 0x03D2 },
+        { 9143, 8, 1, 0x33BA }, { 9151, 15, 1, 0xFF01 }, { 9166, 19, 1, 0xFF82 }, { 9185, 16, 1, 0x1EAA }, { 9201, 11, 1, 0x0470 }, { 9212, 8, 1, 0x0146 },
+        { 9220, 12, 1, 0x0651 }, { 9232, 10, 1, 0x30C1 }, { 9242, 13, 1, 0x01ED }, { 9255, 11, 1, 0x248E }, { 9266, 15, 1, 0x30E7 }, { 9281, 9, 1, 0x02B7 },
+        { 9290, 26, 1, 0x0AC4 }, { 9316, 12, 1, 0xF8F6 }, { 9328, 24, 1, 0x049C }, { 9352, 1, 1, 0x0078 }, { 9353, 6, 1, 0x20AA }, { 9359, 5, 1, 0x016F },
+        { 9364, 9, 1, 0x06BA }, { 9373, 7, 1, 0x24D8 }, { 9380, 16, 1, 0x1E12 }, { 9396, 16, 2, 0x0022 }, { 9412, 14, 1, 0x04D0 }, { 9426, 17, 1, 0x0493 },
+        { 9443, 9, 1, 0x0407 }, { 9452, 8, 1, 0x339E }, { 9460, 6, 1, 0x095B }, { 9466, 9, 1, 0x0435 }, { 9475, 13, 1, 0x0302 }, { 9488, 9, 1, 0x2606 },
+        { 9497, 11, 1, 0x0175 }, { 9508, 9, 1, 0x042F }, { 9517, 7, 1, 0x031B }, { 9524, 6, 1, 0x0914 }, { 9530, 13, 1, 0xF6CD }, { 9543, 9, 1, 0x043C },
+        { 9552, 19, 1, 0x1ED9 }, { 9571, 8, 1, 0x05B8 }, { 9579, 18, 1, 0x05B8 }, { 9597, 10, 1, 0x2109 }, { 9607, 11, 1, 0x053B }, { 9618, 15, 1, 0xFEAC },
+        { 9633, 22, 1, 0xFD3F }, { 9655, 17, 1, 0x02C3 }, { 9672, 6, 1, 0x0926 }, { 9678, 13, 1, 0x0317 }, { 9691, 9, 1, 0x1E5A }, { 9700, 20, 1, 0x0970 },
+        { 9720, 10, 1, 0x1E22 }, { 9730, 11, 1, 0x0AE7 }, { 9741, 18, 1, 0x3209 }, { 9759, 21, 1, 0x3174 }, { 9780, 16, 1, 0x05BB }, { 9796, 9, 1, 0x05DA },
+        { 9805, 8, 1, 0x222B }, { 9813, 12, 1, 0x2209 }, { 9825, 16, 1, 0x3315 }, { 9841, 9, 1, 0x0698 }, { 9850, 7, 1, 0x01EB }, { 9857, 12, 1, 0x02CD },
+        { 9869, 10, 1, 0x0E32 }, { 9879, 9, 1, 0x05D1 }, { 9888, 9, 1, 0x0269 }, { 9897, 10, 1, 0x3079 }, { 9907, 14, 1, 0xF8F9 }, { 9921, 11, 1, 0x217B },
+        { 9932, 13, 1, 0x0960 }, { 9945, 18, 1, 0x21CD }, { 9963, 8, 1, 0x05B8 }, { 9971, 22, 1, 0xFEF0 }, { 9993, 14, 1, 0x020F }, { 10007, 14, 1, 0x05C3 },
+        { 10021, 20, 1, 0x3232 }, { 10041, 10, 1, 0x0645 }, { 10051, 13, 1, 0x30FC }, { 10064, 8, 1, 0x3396 }, { 10072, 6, 1, 0x0024 }, { 10078, 16, 1, 0x0595 },
+        { 10094, 13, 1, 0x314A }, { 10107, 14, 1, 0x05DF }, { 10121, 14, 1, 0x1E9A }, { 10135, 10, 1, 0x1EE1 }, { 10145, 18, 1, 0x309C }, { 10163, 10, 1, 0x30AB },
+        { 10173, 8, 1, 0x2171 }, { 10181, 19, 1, 0x3219 }, { 10200, 15, 1, 0x02C8 }, { 10215, 13, 1, 0x09CD }, { 10228, 9, 1, 0x30A8 }, { 10237, 14, 1, 0xF6E7 },
+        { 10251, 9, 1, 0x3395 }, { 10260, 8, 1, 0x2160 }, { 10268, 17, 1, 0xFF0A }, { 10285, 8, 1, 0x0267 }, { 10293, 10, 1, 0xFE66 }, { 10303, 9, 1, 0x062A },
+        { 10312, 11, 1, 0x2226 }, { 10323, 1, 1, 0x0062 }, { 10324, 6, 1, 0xF773 }, { 10330, 7, 1, 0x24E1 }, { 10337, 14, 1, 0x0270 }, { 10351, 10, 1, 0x30DB },
+        { 10361, 17, 1, 0xFEB3 }, { 10378, 11, 1, 0x05B0 }, { 10389, 10, 1, 0x3071 }, { 10399, 11, 1, 0x0A25 }, { 10410, 13, 1, 0x0480 }, { 10423, 10, 1, 0x1E61 },
+        { 10433, 15, 1, 0x0439 }, { 10448, 12, 1, 0x0E2E }, { 10460, 16, 1, 0x09E0 }, { 10476, 7, 1, 0x05B0 }, { 10483, 11, 1, 0x053D }, { 10494, 4, 1, 0x0126 },
+        { 10498, 12, 1, 0x0137 }, { 10510, 14, 1, 0x01D7 }, { 10524, 8, 1, 0x33DB }, { 10532, 16, 1, 0x044A }, { 10548, 16, 1, 0x3135 }, { 10564, 9, 1, 0x05B9 },
+        { 10573, 6, 1, 0x25AB }, { 10579, 11, 1, 0x09E6 }, { 10590, 9, 1, 0x05DF }, { 10599, 16, 1, 0x1E71 }, { 10615, 25, 1, 0x278A }, { 10640, 9, 1, 0x0413 },
+        { 10649, 9, 1, 0x1ECA }, { 10658, 22, 1, 0x05B1 }, { 10680, 1, 1, 0x0047 }, { 10681, 7, 1, 0x2303 }, { 10688, 10, 1, 0x0A2C }, { 10698, 21, 1, 0x322E },
+        { 10719, 14, 1, 0x2297 }, { 10733, 10, 1, 0xFF55 }, { 10743, 11, 1, 0x0A1B }, { 10754, 25, 1, 0xFE41 }, { 10779, 19, 1, 0x04DD }, { 10798, 14, 1, 0x1E2F },
+        { 10812, 15, 1, 0x1E5C }, { 10827, 14, 1, 0x1E2E }, { 10841, 7, 1, 0xF6D2 }, { 10848, 20, 2, 0x0024 }, { 10868, 10, 1, 0xFF4F }, { 10878, 6, 1, 0x0110 },
+        { 10884, 9, 1, 0x2122 }, { 10893, 12, 1, 0x263B }, { 10905, 35, 1, 0xFE3C }, { 10940, 10, 1, 0x044E }, { 10950, 11, 1, 0x2203 }, { 10961, 9, 1, 0x044F },
+        { 10970, 21, 1, 0xFF3D }, { 10991, 9, 1, 0x041D }, { 11000, 7, 1, 0x3157 }, { 11007, 14, 1, 0xFEDA }, { 11021, 11, 1, 0x0448 }, { 11032, 14, 1, 0x064F },
+        { 11046, 8, 1, 0x3387 }, { 11054, 10, 1, 0x0E49 }, { 11064, 15, 1, 0x33CE }, { 11079, 11, 1, 0x2326 }, { 11090, 3, 1, 0x05EA }, { 11093, 15, 2, 0x0026 },
+        { 11108, 15, 1, 0xFEA4 }, { 11123, 9, 1, 0x05D7 }, { 11132, 20, 1, 0xFCCB }, { 11152, 9, 1, 0x1E37 }, { 11161, 15, 1, 0xFEB2 }, { 11176, 9, 1, 0x000A },
+        { 11185, 12, 1, 0x013C }, { 11197, 6, 1, 0x0106 }, { 11203, 6, 1, 0x1EF2 }, { 11209, 33, 1, 0x09F9 }, { 11242, 11, 1, 0x0667 }, { 11253, 19, 1, 0xFF9C },
+        { 11272, 14, 1, 0xFECA }, { 11286, 7, 1, 0x314F }, { 11293, 12, 1, 0x05B1 }, { 11305, 14, 1, 0xF6DB }, { 11319, 16, 1, 0x0277 }, { 11335, 18, 1, 0x047D },
+        { 11353, 9, 1, 0x0638 }, { 11362, 9, 1, 0x0412 }, { 11371, 7, 1, 0x0916 }, { 11378, 10, 1, 0x0004 }, { 11388, 6, 1, 0xF776 }, { 11394, 8, 1, 0x05DD },
+        { 11402, 25, 1, 0x278B }, { 11427, 11, 1, 0x0124 }, { 11438, 16, 1, 0xFEBF }, { 11454, 5, 1, 0x003D }, { 11459, 9, 1, 0x0411 }, { 11468, 8, 1, 0x3399 },
+        { 11476, 10, 1, 0x0E07 }, { 11486, 7, 1, 0x24C2 }, { 11493, 4, 1, 0x017C }, { 11497, 8, 1, 0x22A3 }, { 11505, 10, 1, 0x1E0A }, { 11515, 9, 1, 0x0328 },
+        { 11524, 9, 1, 0x00D6 }, { 11533, 11, 1, 0x0446 }, { 11544, 10, 1, 0x3056 }, { 11554, 1, 1, 0x0064 }, { 11555, 7, 1, 0x091F }, { 11562, 17, 1, 0x044D },
+        { 11579, 8, 1, 0x3013 }, { 11587, 11, 1, 0x05B4 }, { 11598, 5, 1, 0x01AC }, { 11603, 31, 1, 0x25B9 }, { 11634, 9, 1, 0x0150 }, { 11643, 9, 1, 0x0419 },
+        { 11652, 17, 1, 0x3166 }, { 11669, 19, 1, 0x02E5 }, { 11688, 9, 1, 0x0648 }, { 11697, 8, 1, 0x255C }, { 11705, 14, 1, 0x228A }, { 11719, 9, 1, 0x064A },
+        { 11728, 8, 1, 0x3386 }, { 11736, 7, 1, 0x0927 }, { 11743, 5, 1, 0x01A1 }, { 11748, 9, 1, 0x3106 }, { 11757, 3, 1, 0x01A9 }, { 11760, 19, 2, 0x0028 },
+        { 11779, 10, 1, 0x1E8B }, { 11789, 19, 1, 0x025E }, { 11808, 10, 1, 0x0A8A }, { 11818, 10, 1, 0x09DF }, { 11828, 7, 1, 0x0923 }, { 11835, 3, 1, 0x014B },
+        { 11838, 11, 1, 0x007C }, { 11849, 9, 1, 0x003B }, { 11858, 10, 1, 0x00AC }, { 11868, 15, 1, 0x0940 }, { 11883, 13, 1, 0xFFE0 }, { 11896, 6, 1, 0x1E30 },
+        { 11902, 10, 1, 0x0421 }, { 11912, 10, 1, 0x3058 }, { 11922, 7, 1, 0x012F }, { 11929, 13, 1, 0x01EC }, { 11942, 16, 1, 0x263A }, { 11958, 16, 1, 0xFEB4 },
+        { 11974, 15, 1, 0x0668 }, { 11989, 22, 1, 0x316D }, { 12011, 11, 1, 0x046F }, { 12022, 17, 1, 0x05B0 }, { 12039, 16, 1, 0x0285 }, { 12055, 8, 1, 0x221E },
+        { 12063, 16, 2, 0x002A }, { 12079, 11, 1, 0x0561 }, { 12090, 15, 1, 0x0A4C }, { 12105, 9, 1, 0x1E93 }, { 12114, 18, 1, 0x0284 }, { 12132, 15, 1, 0xFB95 },
+        { 12147, 11, 1, 0x1E2C }, { 12158, 10, 1, 0x30B4 }, { 12168, 1, 1, 0x0058 }, { 12169, 13, 1, 0x2083 }, { 12182, 25, 1, 0x0469 }, { 12207, 9, 1, 0x05AB },
+        { 12216, 20, 1, 0x0945 }, { 12236, 10, 1, 0x0585 }, { 12246, 14, 1, 0xFEC6 }, { 12260, 15, 1, 0x337C }, { 12275, 9, 1, 0x03EF }, { 12284, 9, 1, 0x0666 },
+        { 12293, 13, 1, 0x0A3C }, { 12306, 8, 1, 0x0145 }, { 12314, 11, 1, 0x1E4C }, { 12325, 9, 1, 0x020D }, { 12334, 8, 1, 0x247D }, { 12342, 9, 1, 0x0621 },
+        { 12351, 11, 1, 0x226B }, { 12362, 14, 2, 0x002C }, { 12376, 6, 1, 0x249C }, { 12382, 8, 1, 0x0E3F }, { 12390, 12, 1, 0xF730 }, { 12402, 11, 1, 0x0A96 },
+        { 12413, 2, 1, 0x01F2 }, { 12415, 19, 1, 0xFF87 }, { 12434, 5, 1, 0x0255 }, { 12439, 19, 1, 0xFF96 }, { 12458, 14, 1, 0x21E9 }, { 12472, 10, 1, 0x1E6F },
+        { 12482, 13, 1, 0x0666 }, { 12495, 11, 1, 0x0294 }, { 12506, 4, 1, 0x20AC }, { 12510, 17, 1, 0xFC62 }, { 12527, 19, 1, 0xFF7A }, { 12546, 4, 1, 0x0117 },
+        { 12550, 20, 1, 0x0949 }, { 12570, 2, 1, 0x039D }, { 12572, 10, 1, 0x099F }, { 12582, 11, 1, 0x054E }, { 12593, 12, 1, 0x05F3 }, { 12605, 6, 1, 0x1EF8 },
+        { 12611, 3, 1, 0x014A }, { 12614, 7, 1, 0x24C7 }, { 12621, 18, 1, 0xF88A }, { 12639, 13, 1, 0x20A1 }, { 12652, 18, 1, 0x313E }, { 12670, 9, 1, 0x027E },
+        { 12679, 18, 1, 0x09C8 }, { 12697, 9, 1, 0x0449 }, { 12706, 15, 1, 0x05B7 }, { 12721, 19, 1, 0xFF91 }, { 12740, 9, 1, 0x3108 }, { 12749, 1, 1, 0x0041 },
+        { 12750, 9, 1, 0x203C }, { 12759, 2, 1, 0x00B5 }, { 12761, 16, 1, 0x1EA6 }, { 12777, 23, 1, 0x0321 }, { 12800, 12, 1, 0x215C }, { 12812, 15, 1, 0xFB59 },
+        { 12827, 6, 1, 0xF774 }, { 12833, 14, 1, 0x1EDE }, { 12847, 9, 1, 0x062D }, { 12856, 18, 1, 0x0ACB }, { 12874, 15, 1, 0x2287 }, { 12889, 13, 1, 0xF737 },
+        { 12902, 10, 1, 0x05AD }, { 12912, 12, 1, 0x3137 }, { 12924, 19, 1, 0x0295 }, { 12943, 14, 1, 0x02E6 }, { 12957, 19, 1, 0x049B }, { 12976, 10, 1, 0x1EA2 },
+        { 12986, 20, 1, 0x0623 }, { 13006, 12, 1, 0x0E4D }, { 13018, 6, 1, 0x25AA }, { 13024, 8, 2, 0x002E }, { 13032, 9, 1, 0x0A89 }, { 13041, 8, 1, 0x20A2 },
+        { 13049, 16, 1, 0xFEEB }, { 13065, 6, 1, 0x01CD }, { 13071, 31, 1, 0xFDFA }, { 13102, 9, 1, 0x0640 }, { 13111, 13, 1, 0x0481 }, { 13124, 10, 1, 0x00AD },
+        { 13134, 5, 1, 0x0964 }, { 13139, 17, 1, 0x3267 }, { 13156, 10, 1, 0x2162 }, { 13166, 9, 1, 0x3119 }, { 13175, 13, 1, 0x33A4 }, { 13188, 9, 1, 0x0491 },
+        { 13197, 10, 1, 0x0013 }, { 13207, 6, 1, 0x0938 }, { 13213, 16, 1, 0x1E18 }, { 13229, 9, 1, 0x0474 }, { 13238, 11, 1, 0xF7F5 }, { 13249, 10, 1, 0x2166 },
+        { 13259, 5, 1, 0x01B4 }, { 13264, 10, 1, 0x1EEA }, { 13274, 11, 1, 0x015C }, { 13285, 5, 1, 0x2236 }, { 13290, 9, 1, 0x062F }, { 13299, 14, 1, 0x260E },
+        { 13313, 9, 1, 0x0643 }, { 13322, 11, 1, 0x0597 }, { 13333, 9, 1, 0x062F }, { 13342, 10, 1, 0x0023 }, { 13352, 8, 1, 0x096B }, { 13360, 11, 1, 0x0556 },
+        { 13371, 10, 1, 0x044F }, { 13381, 6, 1, 0x010C }, { 13387, 11, 1, 0x02CF }, { 13398, 1, 1, 0x0057 }, { 13399, 10, 1, 0x03CE }, { 13409, 11, 1, 0x2196 },
+        { 13420, 15, 1, 0x3206 }, { 13435, 8, 1, 0x01BC }, { 13443, 9, 1, 0x06A4 }, { 13452, 13, 1, 0x21E0 }, { 13465, 6, 1, 0x00AF }, { 13471, 6, 1, 0xF76F },
+        { 13477, 7, 1, 0x220F }, { 13484, 5, 1, 0x03B8 }, { 13489, 19, 1, 0x0AC2 }, { 13508, 9, 1, 0x0622 }, { 13517, 11, 1, 0x0577 }, { 13528, 13, 1, 0x1EE3 },
+        { 13541, 11, 1, 0x00C2 }, { 13552, 11, 1, 0x05BD }, { 13563, 9, 1, 0x0638 }, { 13572, 8, 1, 0x2558 }, { 13580, 6, 1, 0x091C }, { 13586, 10, 1, 0x304E },
+        { 13596, 17, 1, 0x0467 }, { 13613, 9, 1, 0x0623 }, { 13622, 12, 1, 0x201C }, { 13634, 12, 1, 0x2089 }, { 13646, 19, 1, 0x3218 }, { 13665, 17, 1, 0xFF1F },
+        { 13682, 9, 1, 0x30AA }, { 13691, 9, 1, 0x1E43 }, { 13700, 2, 1, 0x02A6 }, { 13702, 14, 1, 0xFB8B }, { 13716, 14, 1, 0x25AC }, { 13730, 10, 1, 0x1E07 },
+        { 13740, 15, 1, 0x1E67 }, { 13755, 21, 1, 0x04CB }, { 13776, 7, 1, 0x24C8 }, { 13783, 12, 1, 0x0323 }, { 13795, 16, 1, 0x03D1 }, { 13811, 9, 1, 0x0405 },
+        { 13820, 21, 1, 0x3231 }, { 13841, 18, 1, 0x208E }, { 13859, 3, 1, 0x03A8 }, { 13862, 11, 1, 0x0E0F }, { 13873, 5, 1, 0x017F }, { 13878, 9, 1, 0x0629 },
+        { 13887, 15, 1, 0x098C }, { 13902, 7, 1, 0x2590 }, { 13909, 9, 1, 0x0272 }, { 13918, 17, 1, 0x04E5 }, { 13935, 30, 1, 0xFE43 }, { 13965, 9, 1, 0x0E15 },
+        { 13974, 8, 1, 0x33CB }, { 13982, 11, 1, 0x0E05 }, { 13993, 9, 1, 0x1E8D }, { 14002, 10, 1, 0x0537 }, { 14012, 9, 1, 0x2190 }, { 14021, 3, 1, 0x03C6 },
+        { 14024, 19, 1, 0xFF95 }, { 14043, 1, 1, 0x006C }, { 14044, 7, 1, 0x0185 }, { 14051, 19, 1, 0xFB43 }, { 14070, 9, 1, 0x1E27 }, { 14079, 13, 1, 0x334D },
+        { 14092, 10, 1, 0x00A1 }, { 14102, 14, 1, 0x246D }, { 14116, 9, 1, 0x0422 }, { 14125, 14, 1, 0x33A1 }, { 14139, 12, 1, 0x01FF }, { 14151, 14, 1, 0x21E6 },
+        { 14165, 9, 1, 0xF6DC }, { 14174, 10, 1, 0x0578 }, { 14184, 3, 1, 0xFB03 }, { 14187, 13, 1, 0x0A6D }, { 14200, 9, 1, 0x0436 }, { 14209, 9, 1, 0x045A },
+        { 14218, 22, 1, 0xF895 }, { 14240, 3, 1, 0x05E0 }, { 14243, 15, 1, 0x01DF }, { 14258, 10, 1, 0x308C }, { 14268, 9, 1, 0x041B }, { 14277, 11, 1, 0x06F4 },
+        { 14288, 11, 1, 0x0533 }, { 14299, 11, 1, 0x0565 }, { 14310, 10, 1, 0x30DC }, { 14320, 13, 1, 0x01C2 }, { 14333, 5, 1, 0x05D6 }, { 14338, 15, 1, 0xFB4A },
+        { 14353, 23, 1, 0x25B3 }, { 14376, 8, 1, 0x2170 }, { 14384, 24, 1, 0x25C4 }, { 14408, 9, 1, 0x0215 }, { 14417, 8, 1, 0x05B8 }, { 14425, 3, 1, 0x0292 },
+        { 14428, 17, 1, 0x031A }, { 14445, 19, 1, 0x3229 }, { 14464, 8, 1, 0x0123 }, { 14472, 9, 1, 0x05DB }, { 14481, 8, 1, 0x00E7 }, { 14489, 12, 1, 0x2483 },
+        { 14501, 14, 1, 0xFB4B }, { 14515, 6, 1, 0x0148 }, { 14521, 12, 1, 0x042B }, { 14533, 20, 1, 0x0559 }, { 14553, 10, 1, 0x0646 }, { 14563, 9, 1, 0x043B },
+        { 14572, 10, 1, 0x0691 }, { 14582, 10, 1, 0x3076 }, { 14592, 6, 1, 0xF765 }, { 14598, 19, 1, 0xFF9B }, { 14617, 21, 1, 0x02D2 }, { 14638, 10, 1, 0x047E },
+        { 14648, 20, 1, 0xFBAF }, { 14668, 7, 1, 0x095D }, { 14675, 10, 1, 0x0555 }, { 14685, 10, 1, 0x311D }, { 14695, 14, 1, 0x02C4 }, { 14709, 15, 1, 0xFF0E },
+        { 14724, 1, 1, 0x0072 }, { 14725, 18, 1, 0x313F }, { 14743, 9, 1, 0x0669 }, { 14752, 14, 1, 0x30A1 }, { 14766, 4, 1, 0x02DA }, { 14770, 6, 1, 0xF772 },
+        { 14776, 7, 1, 0x01FC }, { 14783, 7, 1, 0x01B6 }, { 14790, 8, 1, 0x2479 }, { 14798, 9, 1, 0x0662 }, { 14807, 10, 1, 0x3088 }, { 14817, 13, 1, 0x09FA },
+        { 14830, 10, 1, 0xFF59 }, { 14840, 9, 1, 0x2245 }, { 14849, 20, 1, 0x0625 }, { 14869, 11, 1, 0x0471 }, { 14880, 10, 1, 0x0440 }, { 14890, 9, 1, 0x09B0 },
+        { 14899, 17, 1, 0x09CB }, { 14916, 6, 1, 0x24A7 }, { 14922, 10, 1, 0x05B2 }, { 14932, 5, 1, 0x2135 }, { 14937, 12, 1, 0x02DD }, { 14949, 9, 1, 0x2200 },
+        { 14958, 4, 1, 0x0030 }, { 14962, 16, 1, 0xFB69 }, { 14978, 11, 1, 0x015D }, { 14989, 9, 1, 0x0401 }, { 14998, 9, 1, 0x05E0 }, { 15007, 9, 1, 0x0442 },
+        { 15016, 20, 1, 0x1EA8 }, { 15036, 10, 1, 0x30E6 }, { 15046, 10, 1, 0x3092 }, { 15056, 7, 1, 0x014D }, { 15063, 18, 1, 0x09BE }, { 15081, 24, 1, 0xFEF3 },
+        { 15105, 9, 1, 0x038A }, { 15114, 17, 1, 0x02CB }, { 15131, 12, 1, 0x21E7 }, { 15143, 10, 1, 0x0444 }, { 15153, 14, 1, 0x031D }, { 15167, 8, 1, 0x0131 },
+        { 15175, 26, 1, 0x323D }, { 15201, 12, 1, 0xFE4B }, { 15213, 11, 1, 0x0462 }, { 15224, 14, 1, 0x0E20 }, { 15238, 17, 1, 0x0464 }, { 15255, 9, 1, 0x311A },
+        { 15264, 26, 1, 0x3296 }, { 15290, 10, 1, 0x1E6E }, { 15300, 6, 1, 0x05B8 }, { 15306, 19, 1, 0x0AC8 }, { 15325, 17, 1, 0x3172 }, { 15342, 14, 1, 0x246C },
+        { 15356, 9, 1, 0x2284 }, { 15365, 12, 1, 0xF8E7 }, { 15377, 12, 1, 0x03CA }, { 15389, 9, 1, 0x0E42 }, { 15398, 9, 1, 0x041C }, { 15407, 9, 1, 0xFB4B },
+        { 15416, 1, 1, 0x004B }, { 15417, 7, 1, 0x226E }, { 15424, 9, 1, 0x00CB }, { 15433, 14, 1, 0xFEBE }, { 15447, 8, 1, 0x212B }, { 15455, 21, 1, 0x032F },
+        { 15476, 11, 1, 0x0A73 }, { 15487, 14, 1, 0x21E2 }, { 15501, 9, 1, 0x1E89 }, { 15510, 9, 1, 0x3159 }, { 15519, 14, 1, 0xFEC2 }, { 15533, 5, 1, 0x0191 },
+        { 15538, 17, 1, 0x21BC }, { 15555, 11, 1, 0xFB46 }, { 15566, 11, 1, 0x0463 }, { 15577, 10, 1, 0x0912 }, { 15587, 7, 1, 0x1E20 }, { 15594, 15, 1, 0x2498 },
+        { 15609, 5, 1, 0x028B }, { 15614, 8, 1, 0x33D4 }, { 15622, 9, 1, 0x0452 }, { 15631, 11, 1, 0x05D3 }, { 15642, 13, 1, 0x0461 }, { 15655, 29, 1, 0x04BF },
+        { 15684, 12, 1, 0x2217 }, { 15696, 9, 1, 0x2460 }, { 15705, 6, 1, 0x0E24 }, { 15711, 20, 1, 0xFE30 }, { 15731, 7, 1, 0x2002 }, { 15738, 6, 1, 0x2325 },
+        { 15744, 11, 1, 0xF6C3 }, { 15755, 14, 1, 0x0288 }, { 15769, 6, 1, 0x2020 }, { 15775, 10, 1, 0x1E02 }, { 15785, 6, 1, 0x05BB }, { 15791, 7, 1, 0x0279 },
+        { 15798, 8, 1, 0xFB4B }, { 15806, 14, 1, 0xFE59 }, { 15820, 11, 1, 0x25E6 }, { 15831, 11, 1, 0x0135 }, { 15842, 19, 1, 0x0296 }, { 15861, 16, 1, 0x337D },
+        { 15877, 8, 1, 0x05BB }, { 15885, 10, 1, 0x30C7 }, { 15895, 10, 1, 0x03C2 }, { 15905, 9, 1, 0x3110 }, { 15914, 10, 1, 0x1E00 }, { 15924, 8, 1, 0x0022 },
+        { 15932, 9, 1, 0x1E7F }, { 15941, 17, 1, 0x207D }, { 15958, 31, 1, 0xFEF5 }, { 15989, 12, 1, 0xF735 }, { 16001, 15, 1, 0xFFE3 }, { 16016, 12, 1, 0xF8FC },
+        { 16028, 7, 1, 0x24E5 }, { 16035, 9, 1, 0x2228 }, { 16044, 16, 1, 0xFEA8 }, { 16060, 7, 1, 0x200F }, { 16067, 11, 1, 0x25EF }, { 16078, 10, 1, 0x1E96 },
+        { 16088, 9, 1, 0x041E }, { 16097, 10, 1, 0x311F }, { 16107, 14, 1, 0x061F }, { 16121, 19, 1, 0xFF03 }, { 16140, 10, 1, 0x0A9A }, { 16150, 7, 1, 0xF7E6 },
+        { 16157, 14, 1, 0x01D9 }, { 16171, 18, 1, 0xFF1B }, { 16189, 15, 1, 0x04E2 }, { 16204, 20, 1, 0x3242 }, { 16224, 10, 1, 0x306E }, { 16234, 20, 1, 0x04BC },
+        { 16254, 17, 1, 0xFEE3 }, { 16271, 19, 1, 0x1EAC }, { 16290, 9, 1, 0x05D0 }, { 16299, 9, 1, 0x2488 }, { 16308, 9, 1, 0xFB35 }, { 16317, 6, 1, 0x0169 },
+        { 16323, 9, 1, 0x0026 }, { 16332, 7, 1, 0x0395 }, { 16339, 8, 1, 0x33D0 }, { 16347, 20, 1, 0x04B7 }, { 16367, 11, 1, 0x0125 }, { 16378, 11, 1, 0x2320 },
+        { 16389, 5, 1, 0x0257 }, { 16394, 10, 1, 0x3062 }, { 16404, 6, 1, 0x015A }, { 16410, 10, 1, 0xFF41 }, { 16420, 10, 1, 0x1EDC }, { 16430, 10, 1, 0xFB49 },
+        { 16440, 20, 1, 0x0496 }, { 16460, 19, 1, 0xFF09 }, { 16479, 10, 1, 0x1E01 }, { 16489, 12, 1, 0x090B }, { 16501, 9, 1, 0xFB38 }, { 16510, 1, 1, 0x0074 },
+        { 16511, 2, 1, 0x039E }, { 16513, 23, 1, 0x0477 }, { 16536, 20, 2, 0x0030 }, { 16556, 7, 1, 0x24E0 }, { 16563, 9, 1, 0x0205 }, { 16572, 11, 1, 0x2076 },
+        { 16583, 9, 1, 0x0628 }, { 16592, 3, 1, 0x007C }, { 16595, 13, 1, 0x0171 }, { 16608, 11, 1, 0x056D }, { 16619, 12, 1, 0x21D0 }, { 16631, 16, 1, 0xFB30 },
+        { 16647, 10, 1, 0x30C2 }, { 16657, 10, 1, 0x09AB }, { 16667, 12, 1, 0xFF16 }, { 16679, 14, 1, 0x21B5 }, { 16693, 10, 1, 0x3059 }, { 16703, 9, 1, 0x0639 },
+        { 16712, 6, 1, 0x02A5 }, { 16718, 21, 1, 0xFE94 }, { 16739, 15, 1, 0x061B }, { 16754, 15, 1, 0x30E3 }, { 16769, 9, 1, 0xF6C4 }, { 16778, 8, 1, 0x027C },
+        { 16786, 18, 1, 0x055A }, { 16804, 9, 1, 0x0E48 }, { 16813, 10, 1, 0x00AE }, { 16823, 13, 1, 0x2035 }, { 16836, 12, 1, 0xF6E0 }, { 16848, 7, 1, 0x24DD },
+        { 16855, 9, 1, 0x20A4 }, { 16864, 10, 1, 0x30BC }, { 16874, 6, 1, 0x1E7C }, { 16880, 8, 1, 0xF6D3 }, { 16888, 10, 1, 0x0E29 }, { 16898, 15, 1, 0x30F5 },
+        { 16913, 14, 2, 0x0032 }, { 16927, 9, 1, 0x0009 }, { 16936, 9, 1, 0x3112 }, { 16945, 8, 1, 0x0162 }, { 16953, 10, 1, 0x307A }, { 16963, 9, 1, 0x33AA },
+        { 16972, 8, 1, 0x250C }, { 16980, 7, 1, 0x24E6 }, { 16987, 9, 1, 0x05B7 }, { 16996, 9, 1, 0x0447 }, { 17005, 10, 1, 0x0007 }, { 17015, 20, 1, 0x1ED5 },
+        { 17035, 17, 1, 0x0490 }, { 17052, 9, 1, 0x02B8 }, { 17061, 14, 1, 0x33AE }, { 17075, 15, 1, 0xFEFF }, { 17090, 9, 1, 0x00FF }, { 17099, 22, 1, 0x046D },
+        { 17121, 13, 1, 0x0429 }, { 17134, 10, 1, 0x0A35 }, { 17144, 10, 1, 0x21D1 }, { 17154, 17, 1, 0x3138 }, { 17171, 13, 1, 0x223D }, { 17184, 14, 1, 0x0385 },
+        { 17198, 16, 1, 0x049F }, { 17214, 14, 1, 0xF6E6 }, { 17228, 21, 1, 0x323B }, { 17249, 13, 1, 0x2039 }, { 17262, 15, 1, 0x0901 }, { 17277, 10, 1, 0x30D0 },
+        { 17287, 22, 1, 0x09F1 }, { 17309, 5, 1, 0x017F }, { 17314, 9, 1, 0x0642 }, { 17323, 18, 1, 0x3272 }, { 17341, 10, 2, 0x0034 }, { 17351, 17, 1, 0x300C },
+        { 17368, 10, 1, 0x3073 }, { 17378, 11, 1, 0x0AA3 }, { 17389, 12, 1, 0x031F }, { 17401, 7, 1, 0x0937 }, { 17408, 21, 1, 0x059E }, { 17429, 30, 1, 0x25A6 },
+        { 17459, 16, 1, 0x317A }, { 17475, 10, 1, 0x001A }, { 17485, 12, 1, 0x221D }, { 17497, 11, 1, 0x02CE }, { 17508, 21, 1, 0x09F6 }, { 17529, 13, 1, 0x05B3 },
+        { 17542, 10, 1, 0x03E0 }, { 17552, 10, 1, 0x0415 }, { 17562, 7, 1, 0x0119 }, { 17569, 18, 1, 0x0AC7 }, { 17587, 8, 1, 0x0301 }, { 17595, 6, 1, 0x24AA },
+        { 17601, 17, 1, 0x04A0 }, { 17618, 13, 1, 0x019E }, { 17631, 6, 1, 0xF770 }, { 17637, 9, 1, 0x1E92 }, { 17646, 23, 1, 0xFF69 }, { 17669, 17, 1, 0x3202 },
+        { 17686, 14, 1, 0x2283 }, { 17700, 10, 1, 0x0570 }, { 17710, 16, 1, 0x1EA4 }, { 17726, 17, 1, 0xFB2C }, { 17743, 9, 1, 0x05D7 }, { 17752, 19, 1, 0x3221 },
+        { 17771, 13, 1, 0x2497 }, { 17784, 30, 1, 0x0640 }, { 17814, 9, 1, 0x000F }, { 17823, 16, 1, 0xFB2D }, { 17839, 8, 1, 0xFB4A }, { 17847, 14, 1, 0x0664 },
+        { 17861, 5, 1, 0x2665 }, { 17866, 10, 1, 0x25AC }, { 17876, 19, 1, 0xFF8F }, { 17895, 7, 1, 0x0293 }, { 17902, 22, 1, 0xFBA8 }, { 17924, 20, 1, 0x04A7 },
+        { 17944, 9, 1, 0x263A }, { 17953, 2, 1, 0x01CA }, { 17955, 7, 1, 0x014C }, { 17962, 12, 1, 0x20AA }, { 17974, 10, 1, 0x0632 }, { 17984, 15, 1, 0x222E },
+        { 17999, 7, 1, 0x05E3 }, { 18006, 8, 1, 0x2565 }, { 18014, 10, 1, 0x0014 }, { 18024, 9, 1, 0x202C }, { 18033, 9, 1, 0x0668 }, { 18042, 7, 1, 0x01C4 },
+        { 18049, 8, 1, 0x2514 }, { 18057, 7, 1, 0x01DD }, { 18064, 10, 1, 0x0442 }, { 18074, 9, 1, 0x0954 }, { 18083, 12, 1, 0x054B }, { 18095, 10, 1, 0x0A9C },
+        { 18105, 11, 1, 0x04D5 }, { 18116, 21, 1, 0x0494 }, { 18137, 6, 1, 0x017A }, { 18143, 28, 1, 0xFE3E }, { 18171, 13, 1, 0xFF15 }, { 18184, 15, 1, 0x04EF },
+        { 18199, 13, 1, 0x00AB }, { 18212, 3, 1, 0x00F0 }, { 18215, 6, 1, 0x012C }, { 18221, 9, 1, 0x02B0 }, { 18230, 8, 1, 0x03D2 }, { 18238, 24, 1, 0x055F },
+        { 18262, 4, 1, 0x026E }, { 18266, 27, 1, 0x03D3 }, { 18293, 10, 1, 0x30B3 }, { 18303, 9, 1, 0x06A4 }, { 18312, 14, 1, 0x3181 }, { 18326, 5, 1, 0x2660 },
+        { 18331, 7, 1, 0x24E2 }, { 18338, 3, 1, 0x03B7 }, { 18341, 18, 1, 0xFEB7 }, { 18359, 8, 1, 0xF6BE }, { 18367, 14, 1, 0x0216 }, { 18381, 11, 1, 0x0A9E },
+        { 18392, 9, 1, 0xF6EC }, { 18401, 20, 1, 0x25A4 }, { 18421, 10, 1, 0x09A1 }, { 18431, 8, 1, 0x2207 }, { 18439, 6, 1, 0x249F }, { 18445, 2, 1, 0x0133 },
+        { 18447, 18, 1, 0x3276 }, { 18465, 6, 1, 0x01F4 }, { 18471, 10, 1, 0x01FB }, { 18481, 5, 1, 0xF6CE }, { 18486, 12, 1, 0xF8F8 }, { 18498, 4, 1, 0x0289 },
+        { 18502, 10, 1, 0x311E }, { 18512, 12, 1, 0x038C }, { 18524, 6, 1, 0x002D }, { 18530, 10, 1, 0x30AD }, { 18540, 23, 1, 0x05B3 }, { 18563, 18, 1, 0x05B7 },
+        { 18581, 9, 1, 0x3382 }, { 18590, 15, 1, 0x0E4C }, { 18605, 16, 1, 0x1EC1 }, { 18621, 25, 1, 0x066C }, { 18646, 10, 1, 0x062E }, { 18656, 16, 1, 0x05B2 },
+        { 18672, 24, 3, 0x0036 }, { 18696, 14, 1, 0xFE32 }, { 18710, 13, 1, 0x1E08 }, { 18723, 8, 1, 0x2561 }, { 18731, 10, 1, 0x3113 }, { 18741, 16, 1, 0x317C },
+        { 18757, 19, 1, 0xFF97 }, { 18776, 9, 1, 0x040B }, { 18785, 16, 1, 0x25AA }, { 18801, 8, 1, 0x05B8 }, { 18809, 9, 1, 0xF6C8 }, { 18818, 14, 1, 0xF724 },
+        { 18832, 12, 1, 0xFB41 }, { 18844, 6, 1, 0x00F5 }, { 18850, 6, 1, 0x010D }, { 18856, 10, 1, 0xF7E5 }, { 18866, 8, 1, 0x0929 }, { 18874, 13, 1, 0x02BC },
+        { 18887, 6, 1, 0x011B }, { 18893, 16, 1, 0x3008 }, { 18909, 1, 1, 0x0052 }, { 18910, 8, 1, 0x22CF }, { 18918, 5, 1, 0x02C7 }, { 18923, 9, 1, 0x318C },
+        { 18932, 6, 1, 0x014F }, { 18938, 20, 1, 0x1ED4 }, { 18958, 11, 1, 0x0A98 }, { 18969, 23, 1, 0x04EA }, { 18992, 13, 1, 0x0A02 }, { 19005, 26, 1, 0xFF62 },
+        { 19031, 9, 1, 0x095C }, { 19040, 6, 1, 0x1E82 }, { 19046, 13, 1, 0x0640 }, { 19059, 17, 1, 0xF892 }, { 19076, 11, 1, 0x0149 }, { 19087, 16, 1, 0xFB48 },
+        { 19103, 14, 1, 0xFEF2 }, { 19117, 16, 1, 0x0A8B }, { 19133, 6, 1, 0x01D0 }, { 19139, 21, 1, 0xFC0B }, { 19160, 14, 1, 0x055C }, { 19174, 9, 1, 0x3093 },
+        { 19183, 18, 1, 0x05B6 }, { 19201, 11, 1, 0x1E2B }, { 19212, 14, 1, 0xFED2 }, { 19226, 7, 1, 0x05B6 }, { 19233, 13, 1, 0x055D }, { 19246, 8, 1, 0x0E2D },
+        { 19254, 11, 1, 0x1E74 }, { 19265, 5, 1, 0x00E5 }, { 19270, 16, 1, 0x1E3C }, { 19286, 9, 1, 0x3117 }, { 19295, 14, 1, 0xFEEA }, { 19309, 10, 1, 0x3094 },
+        { 19319, 9, 1, 0x0427 }, { 19328, 10, 1, 0x2177 }, { 19338, 12, 1, 0x1E17 }, { 19350, 4, 1, 0x0396 }, { 19354, 17, 1, 0x027F }, { 19371, 9, 1, 0x1E63 },
+        { 19380, 20, 1, 0x32A6 }, { 19400, 12, 1, 0x3333 }, { 19412, 8, 1, 0xF7F0 }, { 19420, 15, 1, 0x01D6 }, { 19435, 9, 1, 0x2465 }, { 19444, 11, 1, 0xF8F3 },
+        { 19455, 11, 1, 0x0579 }, { 19466, 18, 1, 0x0315 }, { 19484, 15, 1, 0xFB31 }, { 19499, 18, 1, 0x21C0 }, { 19517, 5, 1, 0x0020 }, { 19522, 4, 1, 0x05BF },
+        { 19526, 13, 1, 0x3028 }, { 19539, 7, 1, 0xF6FA }, { 19546, 10, 1, 0x30EC }, { 19556, 10, 1, 0xFF22 }, { 19566, 23, 1, 0xFB2C }, { 19589, 8, 1, 0x256C },
+        { 19597, 10, 1, 0x0140 }, { 19607, 8, 2, 0x0039 }, { 19615, 10, 1, 0x062B }, { 19625, 9, 1, 0x040F }, { 19634, 22, 1, 0x0963 }, { 19656, 10, 1, 0x054C },
+        { 19666, 10, 1, 0x0441 }, { 19676, 7, 1, 0x24CB }, { 19683, 10, 1, 0x0996 }, { 19693, 9, 1, 0x020C }, { 19702, 14, 1, 0x020E }, { 19716, 14, 1, 0x0360 },
+        { 19730, 27, 1, 0xFE3D }, { 19757, 9, 1, 0x30F3 }, { 19766, 6, 1, 0x24A4 }, { 19772, 12, 1, 0x3339 }, { 19784, 13, 1, 0x2215 }, { 19797, 7, 1, 0x012B },
+        { 19804, 15, 2, 0x003B }, { 19819, 9, 1, 0x05DB }, { 19828, 5, 1, 0x090F }, { 19833, 16, 1, 0xF7F4 }, { 19849, 15, 1, 0x0A8D }, { 19864, 2, 1, 0x0040 },
+        { 19866, 15, 2, 0x003D }, { 19881, 12, 1, 0x05E1 }, { 19893, 7, 1, 0x012A }, { 19900, 9, 1, 0x0403 }, { 19909, 6, 1, 0x00E9 }, { 19915, 24, 1, 0x25D1 },
+        { 19939, 9, 1, 0x05F2 }, { 19948, 11, 1, 0x0532 }, { 19959, 3, 1, 0x05D8 }, { 19962, 7, 1, 0x03C5 }, { 19969, 13, 1, 0x02BE }, { 19982, 5, 1, 0x0271 },
+        { 19987, 10, 1, 0x043A }, { 19997, 16, 1, 0xFEDB }, { 20013, 6, 1, 0x00F1 }, { 20019, 9, 1, 0xF6EA }, { 20028, 10, 1, 0x30C9 }, { 20038, 14, 1, 0xF6E3 },
+        { 20052, 10, 1, 0x09EC }, { 20062, 8, 1, 0x00C7 }, { 20070, 10, 1, 0xF760 }, { 20080, 11, 1, 0x248F }, { 20091, 5, 1, 0xF6C9 }, { 20096, 15, 1, 0x098B },
+        { 20111, 14, 1, 0x04C7 }, { 20125, 9, 1, 0x212E }, { 20134, 6, 1, 0x013D }, { 20140, 9, 1, 0x0628 }, { 20149, 19, 1, 0xFF66 }, { 20168, 9, 1, 0x0008 },
+        { 20177, 1, 1, 0x0068 }, { 20178, 9, 1, 0x05E3 }, { 20187, 5, 1, 0x05E6 }, { 20192, 9, 1, 0x0E1B }, { 20201, 19, 1, 0xFF76 }, { 20220, 5, 1, 0x0187 },
+        { 20225, 14, 1, 0x05DD }, { 20239, 10, 1, 0x010A }, { 20249, 8, 1, 0x2169 }, { 20257, 9, 1, 0x05D2 }, { 20266, 8, 1, 0x2179 }, { 20274, 23, 1, 0x09F0 },
+        { 20297, 21, 1, 0x3169 }, { 20318, 3, 1, 0x03C7 }, { 20321, 17, 1, 0x0465 }, { 20338, 19, 1, 0x3230 }, { 20357, 9, 1, 0x098A }, { 20366, 4, 1, 0x0166 },
+        { 20370, 11, 1, 0x0409 }, { 20381, 12, 1, 0x09BC }, { 20393, 13, 1, 0xF733 }, { 20406, 7, 1, 0x016A }, { 20413, 16, 1, 0xFEA3 }, { 20429, 9, 1, 0x1E05 },
+        { 20438, 12, 1, 0x045B }, { 20450, 9, 1, 0x06AF }, { 20459, 3, 1, 0x05D7 }, { 20462, 19, 1, 0x0ABE }, { 20481, 8, 1, 0xF6CB }, { 20489, 10, 1, 0x007F },
+        { 20499, 9, 1, 0xFB47 }, { 20508, 15, 1, 0x0334 }, { 20523, 9, 1, 0xF8E5 }, { 20532, 19, 1, 0xFF84 }, { 20551, 14, 1, 0x01DA }, { 20565, 15, 1, 0x313D },
+        { 20580, 11, 1, 0x0196 }, { 20591, 10, 1, 0xFE55 }, { 20601, 11, 1, 0x2466 }, { 20612, 10, 1, 0x2209 }, { 20622, 19, 1, 0xFF90 }, { 20641, 13, 1, 0x00BE },
+        { 20654, 15, 1, 0x1EB2 }, { 20669, 13, 1, 0x02E8 }, { 20682, 20, 1, 0x3223 }, { 20702, 14, 1, 0xFE54 }, { 20716, 1, 1, 0x006A }, { 20717, 7, 1, 0x2223 },
+        { 20724, 7, 1, 0x05B6 }, { 20731, 6, 1, 0x03D6 }, { 20737, 11, 1, 0x0A2D }, { 20748, 14, 1, 0x1EB7 }, { 20762, 6, 1, 0x0910 }, { 20768, 18, 1, 0x02E9 },
+        { 20786, 9, 1, 0x09AE }, { 20795, 4, 1, 0x013F }, { 20799, 10, 1, 0x0A1A }, { 20809, 12, 1, 0x0A66 }, { 20821, 15, 1, 0x308E }, { 20836, 10, 1, 0x0016 },
+        { 20846, 8, 2, 0x003F }, { 20854, 9, 1, 0x00AD }, { 20863, 16, 1, 0x22EE }, { 20879, 11, 1, 0x029A }, { 20890, 11, 1, 0x005E }, { 20901, 10, 1, 0x2176 },
+        { 20911, 6, 1, 0x24A9 }, { 20917, 13, 1, 0x0ABC }, { 20930, 3, 1, 0x03A6 }, { 20933, 27, 1, 0xFF63 }, { 20960, 8, 1, 0x0189 }, { 20968, 11, 1, 0x3026 },
+        { 20979, 11, 1, 0x05B9 }, { 20990, 8, 1, 0x2205 }, { 20998, 10, 1, 0x1E5F }, { 21008, 6, 1, 0x039B }, { 21014, 20, 1, 0xFC5E }, { 21034, 4, 1, 0x0140 },
+        { 21038, 20, 1, 0x04A6 }, { 21058, 10, 1, 0x3331 }, { 21068, 9, 1, 0x2318 }, { 21077, 11, 1, 0x0650 }, { 21088, 9, 1, 0x0630 }, { 21097, 11, 1, 0x0134 },
+        { 21108, 16, 1, 0xFEE8 }, { 21124, 5, 1, 0x003A }, { 21129, 11, 1, 0x0668 }, { 21140, 15, 1, 0x0A74 }, { 21155, 13, 1, 0x0298 }, { 21168, 9, 1, 0x0200 },
+        { 21177, 10, 1, 0x0AAA }, { 21187, 2, 1, 0x0153 }, { 21189, 3, 1, 0x3004 }, { 21192, 16, 1, 0x266B }, { 21208, 9, 1, 0x0642 }, { 21217, 5, 1, 0x01B0 },
+        { 21222, 6, 1, 0x00C3 }, { 21228, 11, 1, 0x0176 }, { 21239, 10, 1, 0x30BE }, { 21249, 10, 1, 0x05E8 }, { 21259, 9, 1, 0x1E62 }, { 21268, 16, 1, 0x05B1 },
+        { 21284, 9, 1, 0x0211 }, { 21293, 6, 1, 0x0128 }, { 21299, 11, 1, 0xFB33 }, { 21310, 6, 1, 0x01E7 }, { 21316, 9, 1, 0x0664 }, { 21325, 10, 1, 0x3055 },
+        { 21335, 9, 1, 0x1EA1 }, { 21344, 10, 1, 0x3050 }, { 21354, 6, 1, 0x2014 }, { 21360, 15, 1, 0xFB3E }, { 21375, 11, 1, 0x2281 }, { 21386, 13, 1, 0x330D },
+        { 21399, 1, 1, 0x0076 }, { 21400, 9, 1, 0x0443 }, { 21409, 11, 1, 0x1EAE }, { 21420, 10, 1, 0x307D }, { 21430, 25, 1, 0x3015 }, { 21455, 7, 1, 0x315C },
+        { 21462, 22, 1, 0x033A }, { 21484, 9, 1, 0x007B }, { 21493, 10, 1, 0x038F }, { 21503, 10, 1, 0x3084 }, { 21513, 3, 1, 0x0036 }, { 21516, 8, 1, 0x255A },
+        { 21524, 7, 1, 0x00B8 }, { 21531, 5, 1, 0x03B4 }, { 21536, 15, 1, 0x0020 }, { 21551, 8, 2, 0x0041 }, { 21559, 23, 1, 0xFF6A }, { 21582, 10, 1, 0xFF58 },
+        { 21592, 6, 1, 0x00DA }, { 21598, 12, 1, 0x03CC }, { 21610, 4, 1, 0x0039 }, { 21614, 7, 1, 0x05B9 }, { 21621, 11, 1, 0x0428 }, { 21632, 16, 1, 0x3185 },
+        { 21648, 8, 1, 0x338E }, { 21656, 7, 1, 0x0931 }, { 21663, 25, 1, 0x04B9 }, { 21688, 14, 1, 0xFB3A }, { 21702, 25, 1, 0x02A2 }, { 21727, 21, 1, 0x322C },
+        { 21748, 10, 1, 0x3187 }, { 21758, 8, 1, 0x0156 }, { 21766, 7, 1, 0x2580 }, { 21773, 8, 1, 0x2502 }, { 21781, 10, 1, 0x3068 }, { 21791, 10, 1, 0x30AE },
+        { 21801, 19, 1, 0x04B2 }, { 21820, 6, 1, 0x0107 }, { 21826, 23, 1, 0x04EB }, { 21849, 4, 1, 0x2642 }, { 21853, 17, 1, 0x0E11 }, { 21870, 13, 1, 0x20AA },
+        { 21883, 12, 1, 0x09E9 }, { 21895, 6, 1, 0x013A }, { 21901, 10, 1, 0x3115 }, { 21911, 17, 1, 0x04AE }, { 21928, 9, 1, 0x0019 }, { 21937, 17, 1, 0x09C7 },
+        { 21954, 9, 1, 0x1EE5 }, { 21963, 5, 1, 0x0291 }, { 21968, 5, 1, 0x05DC }, { 21973, 6, 1, 0x24B4 }, { 21979, 6, 1, 0x1EF9 }, { 21985, 11, 1, 0x0547 },
+        { 21996, 15, 1, 0x30EE }, { 22011, 7, 1, 0x24CE }, { 22018, 9, 1, 0x062B }, { 22027, 9, 1, 0x066D }, { 22036, 15, 1, 0xFEA6 }, { 22051, 13, 1, 0x032C },
+        { 22064, 10, 1, 0x305C }, { 22074, 10, 1, 0xFF24 }, { 22084, 12, 1, 0x057F }, { 22096, 19, 1, 0xFF78 }, { 22115, 7, 1, 0x0104 }, { 22122, 11, 1, 0xFE52 },
+        { 22133, 14, 1, 0x0203 }, { 22147, 15, 1, 0x06D2 }, { 22162, 2, 1, 0xF6BF }, { 22164, 17, 1, 0xFFE1 }, { 22181, 20, 1, 0xFCA4 }, { 22201, 9, 1, 0x0631 },
+        { 22210, 10, 1, 0x0E39 }, { 22220, 6, 1, 0x0144 }, { 22226, 21, 1, 0x3243 }, { 22247, 7, 1, 0x0173 }, { 22254, 6, 1, 0x015B }, { 22260, 10, 1, 0x1ECE },
+        { 22270, 12, 1, 0xFE65 }, { 22282, 13, 1, 0xFF10 }, { 22295, 14, 1, 0x2495 }, { 22309, 13, 1, 0xF6DA }, { 22322, 13, 1, 0x05B3 }, { 22335, 10, 1, 0x1E35 },
+        { 22345, 10, 1, 0x05AC }, { 22355, 9, 1, 0x0443 }, { 22364, 11, 1, 0x02D5 }, { 22375, 13, 1, 0x301E }, { 22388, 11, 1, 0xFB2A }, { 22399, 16, 1, 0xF7E2 },
+        { 22415, 9, 1, 0x02E3 }, { 22424, 13, 1, 0x0449 }, { 22437, 15, 1, 0x33A0 }, { 22452, 14, 1, 0x0621 }, { 22466, 27, 1, 0x2790 }, { 22493, 19, 1, 0xFF79 },
+        { 22512, 21, 1, 0x04CC }, { 22533, 12, 1, 0x2492 }, { 22545, 19, 1, 0xFF94 }, { 22564, 4, 1, 0x01BF }, { 22568, 10, 1, 0x30AF }, { 22578, 12, 1, 0x21D3 },
+        { 22590, 2, 1, 0x03BE }, { 22592, 11, 1, 0x0447 }, { 22603, 9, 1, 0x0473 }, { 22612, 21, 1, 0xFCD1 }, { 22633, 2, 1, 0x05D4 }, { 22635, 19, 1, 0xFF7E },
+        { 22654, 10, 1, 0x0A30 }, { 22664, 14, 1, 0xF6D9 }, { 22678, 11, 1, 0x1E2A }, { 22689, 9, 1, 0x0E14 }, { 22698, 7, 1, 0x01A8 }, { 22705, 19, 1, 0xFF7B },
+        { 22724, 9, 1, 0x25D8 }, { 22733, 16, 1, 0x3203 }, { 22749, 14, 1, 0x0273 }, { 22763, 14, 1, 0x01C3 }, { 22777, 10, 1, 0x305E }, { 22787, 15, 1, 0xFB8D },
+        { 22802, 13, 1, 0xF6E2 }, { 22815, 12, 1, 0x25C7 }, { 22827, 7, 1, 0x05B5 }, { 22834, 20, 1, 0x04F9 }, { 22854, 7, 1, 0x200E }, { 22861, 14, 1, 0x3045 },
+        { 22875, 8, 1, 0x0989 }, { 22883, 7, 1, 0x0E56 }, { 22890, 15, 1, 0x04E9 }, { 22905, 10, 1, 0xFF35 }, { 22915, 8, 1, 0x2534 }, { 22923, 15, 1, 0x05A3 },
+        { 22938, 16, 1, 0xFEC3 }, { 22954, 26, 1, 0xFF65 }, { 22980, 15, 1, 0xFEE0 }, { 22995, 10, 1, 0x0660 }, { 23005, 22, 1, 0xFB2D }, { 23027, 24, 1, 0x0AC9 },
+        { 23051, 6, 1, 0x2640 }, { 23057, 14, 1, 0x3043 }, { 23071, 8, 1, 0x0163 }, { 23079, 14, 1, 0x033B }, { 23093, 10, 1, 0x1EE6 }, { 23103, 6, 1, 0x2105 },
+        { 23109, 10, 1, 0xF7B4 }, { 23119, 9, 1, 0x05DC }, { 23128, 3, 1, 0x03A4 }, { 23131, 1, 1, 0x0059 }, { 23132, 8, 1, 0x338F }, { 23140, 9, 1, 0x20A1 },
+        { 23149, 11, 1, 0x25CB }, { 23160, 10, 1, 0x30BB }, { 23170, 10, 1, 0x0478 }, { 23180, 8, 1, 0x33CF }, { 23188, 9, 1, 0x310C }, { 23197, 18, 1, 0x0591 },
+        { 23215, 8, 1, 0x0E55 }, { 23223, 6, 1, 0x02DB }, { 23229, 14, 1, 0xFEAE }, { 23243, 7, 1, 0x05B6 }, { 23250, 10, 1, 0x30DA }, { 23260, 8, 1, 0x33C2 },
+        { 23268, 6, 1, 0x00F9 }, { 23274, 11, 1, 0xF736 }, { 23285, 9, 1, 0x06AF }, { 23294, 11, 1, 0x0652 }, { 23305, 5, 1, 0x0037 }, { 23310, 6, 1, 0x05BC },
+        { 23316, 9, 1, 0x063A }, { 23325, 18, 1, 0x200C }, { 23343, 13, 1, 0xF6E1 }, { 23356, 14, 1, 0x2472 }, { 23370, 8, 1, 0x2500 }, { 23378, 16, 2, 0x0043 },
+        { 23394, 9, 1, 0x0666 }, { 23403, 9, 1, 0x09AC }, { 23412, 10, 1, 0x0A94 }, { 23422, 14, 2, 0x0045 }, { 23436, 10, 1, 0x0327 }, { 23446, 11, 1, 0x0A1F },
+        { 23457, 6, 1, 0x090A }, { 23463, 4, 1, 0x0120 }, { 23467, 11, 1, 0x2487 }, { 23478, 16, 1, 0x0318 }, { 23494, 20, 1, 0x1EA9 }, { 23514, 20, 1, 0x030D },
+        { 23534, 6, 1, 0x01F5 }, { 23540, 6, 1, 0x0021 }, { 23546, 9, 1, 0x018E }, { 23555, 17, 1, 0xFE35 }, { 23572, 7, 1, 0x03B5 }, { 23579, 15, 1, 0x334A },
+        { 23594, 10, 1, 0x3078 }, { 23604, 8, 1, 0x096F }, { 23612, 10, 1, 0xFF57 }, { 23622, 9, 1, 0x000D }, { 23631, 15, 1, 0xFEDC }, { 23646, 12, 1, 0x05F2 },
+        { 23658, 22, 1, 0xFC48 }, { 23680, 24, 1, 0xFE3F }, { 23704, 6, 1, 0x1E3E }, { 23710, 13, 1, 0x02E7 }, { 23723, 11, 1, 0x3125 }, { 23734, 20, 1, 0x03B0 },
+        { 23754, 10, 1, 0xF8F5 }, { 23764, 19, 1, 0xFF85 }, { 23783, 11, 1, 0x05B7 }, { 23794, 8, 2, 0x0047 }, { 23802, 20, 1, 0x3277 }, { 23822, 11, 1, 0x0A67 },
+        { 23833, 11, 1, 0x2669 }, { 23844, 14, 1, 0x1EEC }, { 23858, 10, 1, 0xFF3A }, { 23868, 11, 1, 0x1EB4 }, { 23879, 11, 1, 0x215D }, { 23890, 12, 1, 0x0A59 },
+        { 23902, 9, 1, 0x0A93 }, { 23911, 17, 1, 0x04A1 }, { 23928, 11, 1, 0x0453 }, { 23939, 10, 1, 0x043B }, { 23949, 9, 1, 0x0667 }, { 23958, 2, 1, 0x01C8 },
+        { 23960, 18, 1, 0x059D }, { 23978, 18, 1, 0x316C }, { 23996, 11, 1, 0xF6FD }, { 24007, 9, 1, 0x1E0D }, { 24016, 21, 1, 0xFD3E }, { 24037, 10, 1, 0x1EC8 },
+        { 24047, 13, 1, 0x2277 }, { 24060, 10, 1, 0x09A7 }, { 24070, 11, 1, 0xF732 }, { 24081, 10, 1, 0xFF50 }, { 24091, 14, 1, 0x0202 }, { 24105, 9, 1, 0x3105 },
+        { 24114, 8, 1, 0x33BD }, { 24122, 21, 1, 0x3238 }, { 24143, 14, 1, 0xF8FA }, { 24157, 14, 1, 0x0331 }, { 24171, 18, 1, 0x320A }, { 24189, 12, 1, 0xFF11 },
+        { 24201, 9, 1, 0x247C }, { 24210, 15, 1, 0x01D5 }, { 24225, 11, 1, 0x030F }, { 24236, 13, 1, 0x314B }, { 24249, 10, 1, 0x0567 }, { 24259, 11, 1, 0x06F0 },
+        { 24270, 11, 1, 0x00B2 }, { 24281, 20, 1, 0x05B2 }, { 24301, 6, 1, 0x24A0 }, { 24307, 10, 1, 0x01E0 }, { 24317, 10, 1, 0xFF38 }, { 24327, 17, 1, 0x3132 },
+        { 24344, 10, 1, 0x2464 }, { 24354, 16, 1, 0xFEB6 }, { 24370, 9, 1, 0x044D }, { 24379, 5, 1, 0x0913 }, { 24384, 10, 1, 0x03E2 }, { 24394, 9, 1, 0x05E6 },
+        { 24403, 16, 1, 0x055E }, { 24419, 24, 1, 0x0AC5 }, { 24443, 17, 1, 0x3009 }, { 24460, 17, 1, 0xF6F8 }, { 24477, 8, 1, 0x253C }, { 24485, 15, 1, 0x3007 },
+        { 24500, 17, 1, 0x3002 }, { 24517, 20, 1, 0x0497 }, { 24537, 16, 1, 0x3176 }, { 24553, 10, 1, 0xFF5A }, { 24563, 10, 1, 0x00BC }, { 24573, 5, 1, 0x0190 },
+        { 24578, 10, 1, 0x0669 }, { 24588, 16, 1, 0x1E77 }, { 24604, 6, 1, 0xF769 }, { 24610, 9, 1, 0x0E30 }, { 24619, 11, 1, 0x0403 }, { 24630, 11, 1, 0x318A },
+        { 24641, 18, 1, 0x3170 }, { 24659, 9, 1, 0x207F }, { 24668, 11, 1, 0x0AEC }, { 24679, 5, 1, 0x05B5 }, { 24684, 1, 1, 0x0055 }, { 24685, 10, 1, 0x0002 },
+        { 24695, 6, 1, 0x011A }, { 24701, 18, 1, 0x320E }, { 24719, 6, 1, 0x0950 }, { 24725, 5, 1, 0x01AD }, { 24730, 18, 1, 0x21C4 }, { 24748, 9, 1, 0x062C },
+        { 24757, 15, 1, 0x02B4 }, { 24772, 11, 1, 0x2261 }, { 24783, 9, 1, 0xFB2A }, { 24792, 11, 1, 0x3147 }, { 24803, 25, 1, 0x0AC3 }, { 24828, 17, 1, 0x3265 },
+        { 24845, 19, 1, 0xFF8A }, { 24864, 10, 1, 0x1E86 }, { 24874, 10, 1, 0x041F }, { 24884, 1, 1, 0x0054 }, { 24885, 23, 1, 0xF897 }, { 24908, 10, 1, 0x1EA3 },
+        { 24918, 25, 1, 0xFE82 }, { 24943, 7, 1, 0x24D5 }, { 24950, 10, 1, 0x3012 }, { 24960, 6, 1, 0x1E54 }, { 24966, 10, 1, 0x0AA6 }, { 24976, 13, 1, 0x04B5 },
+        { 24989, 7, 1, 0x029E }, { 24996, 16, 1, 0x3208 }, { 25012, 21, 1, 0x0375 }, { 25033, 5, 1, 0x002C }, { 25038, 14, 1, 0x05DA }, { 25052, 9, 1, 0x025A },
+        { 25061, 10, 1, 0x1EDB }, { 25071, 1, 1, 0x0071 }, { 25072, 10, 1, 0x30E1 }, { 25082, 15, 1, 0x21A8 }, { 25097, 18, 1, 0x05AA }, { 25115, 6, 1, 0x24AD },
+        { 25121, 3, 1, 0x05E7 }, { 25124, 10, 1, 0x1EF7 }, { 25134, 8, 1, 0xF6D6 }, { 25142, 11, 1, 0x0E02 }, { 25153, 10, 1, 0x318B }, { 25163, 7, 1, 0x028D },
+        { 25170, 10, 1, 0x05D0 }, { 25180, 11, 1, 0xF7E0 }, { 25191, 11, 1, 0x0A9D }, { 25202, 10, 1, 0xFB2B }, { 25212, 14, 1, 0x309B }, { 25226, 6, 1, 0x0141 },
+        { 25232, 9, 1, 0x1E85 }, { 25241, 10, 1, 0x0E35 }, { 25251, 16, 1, 0x1EBE }, { 25267, 9, 1, 0x0430 }, { 25276, 16, 1, 0x04C2 }, { 25292, 9, 1, 0x0662 },
+        { 25301, 10, 1, 0x0551 }, { 25311, 11, 1, 0x2248 }, { 25322, 10, 1, 0x053E }, { 25332, 9, 1, 0x0446 }, { 25341, 4, 1, 0x0116 }, { 25345, 6, 1, 0x017D },
+        { 25351, 9, 1, 0x310F }, { 25360, 9, 1, 0x040C }, { 25369, 6, 1, 0x0928 }, { 25375, 10, 1, 0x0A5B }, { 25385, 7, 1, 0x030A }, { 25392, 10, 1, 0x0029 },
+        { 25402, 10, 1, 0x3080 }, { 25412, 17, 1, 0xF889 }, { 25429, 7, 1, 0x0E52 }, { 25436, 13, 1, 0x33A3 }, { 25449, 12, 1, 0x01FE }, { 25461, 6, 1, 0x01CF },
+        { 25467, 13, 1, 0xF8EA }, { 25480, 12, 1, 0x2074 }, { 25492, 15, 1, 0x03CB }, { 25507, 10, 1, 0x09A3 }, { 25517, 3, 1, 0x03C8 }, { 25520, 13, 1, 0x21D2 },
+        { 25533, 14, 1, 0x0A4D }, { 25547, 9, 1, 0x0432 }, { 25556, 9, 1, 0x0639 }, { 25565, 6, 1, 0x00DD }, { 25571, 10, 1, 0x0627 }, { 25581, 11, 1, 0x0455 },
+        { 25592, 11, 1, 0x064F }, { 25603, 1, 1, 0x0051 }, { 25604, 13, 1, 0xF73F }, { 25617, 12, 1, 0x0A20 }, { 25629, 6, 1, 0x01D3 }, { 25635, 8, 1, 0x2161 },
+        { 25643, 9, 1, 0x0028 }, { 25652, 31, 1, 0x25A8 }, { 25683, 15, 1, 0xFED4 }, { 25698, 12, 1, 0x0952 }, { 25710, 12, 1, 0x044B }, { 25722, 9, 1, 0x02D4 },
+        { 25731, 16, 1, 0x0594 }, { 25747, 6, 1, 0x1EF3 }, { 25753, 13, 1, 0x33C6 }, { 25766, 13, 1, 0x2667 }, { 25779, 8, 1, 0x2518 }, { 25787, 8, 1, 0x2153 },
+        { 25795, 8, 1, 0x3390 }, { 25803, 13, 1, 0x317F }, { 25816, 18, 1, 0x05A6 }, { 25834, 9, 1, 0x30A6 }, { 25843, 12, 1, 0x25CC }, { 25855, 10, 1, 0x3114 },
+        { 25865, 21, 1, 0x0943 }, { 25886, 10, 1, 0x1E5E }, { 25896, 17, 1, 0x0319 }, { 25913, 11, 1, 0x2280 }, { 25924, 9, 2, 0x0049 }, { 25933, 10, 1, 0x30D2 },
+        { 25943, 9, 1, 0xFB40 }, { 25952, 1, 1, 0x0046 }, { 25953, 4, 1, 0x017B }, { 25957, 6, 1, 0x00C1 }, { 25963, 9, 1, 0x041A }, { 25972, 23, 1, 0x030E },
+        { 25995, 6, 1, 0x24A8 }, { 26001, 23, 1, 0x0476 }, { 26024, 8, 1, 0x2552 }, { 26032, 7, 1, 0x24BE }, { 26039, 7, 1, 0x2593 }, { 26046, 19, 1, 0x0AC0 },
+        { 26065, 22, 1, 0x066B }, { 26087, 6, 1, 0x013E }, { 26093, 13, 1, 0x314C }, { 26106, 8, 1, 0x05E4 }, { 26114, 16, 1, 0x0311 }, { 26130, 1, 1, 0x005A },
+        { 26131, 15, 1, 0xFE5F }, { 26146, 10, 1, 0x232B }, { 26156, 9, 1, 0x2018 }, { 26165, 8, 1, 0x0E21 }, { 26173, 4, 1, 0x03B2 }, { 26177, 7, 1, 0x24E9 },
+        { 26184, 11, 1, 0xF7ED }, { 26195, 8, 1, 0x33B4 }, { 26203, 11, 1, 0x046E }, { 26214, 10, 1, 0x0386 }, { 26224, 7, 1, 0x0918 }, { 26231, 6, 1, 0x24B3 },
+        { 26237, 14, 1, 0x30A7 }, { 26251, 21, 1, 0x0314 }, { 26272, 7, 1, 0x24CF }, { 26279, 8, 1, 0x339A }, { 26287, 8, 1, 0x1E11 }, { 26295, 10, 1, 0x03E3 },
+        { 26305, 9, 1, 0x33D2 }, { 26314, 13, 1, 0x203B }, { 26327, 14, 1, 0x066D }, { 26341, 5, 1, 0x222A }, { 26346, 14, 1, 0xF7FF }, { 26360, 10, 1, 0x0012 },
+        { 26370, 10, 1, 0x099E }, { 26380, 7, 1, 0xF8F4 }, { 26387, 8, 1, 0x2554 }, { 26395, 10, 1, 0x1E1E }, { 26405, 16, 1, 0x1ED0 }, { 26421, 6, 1, 0x0160 },
+        { 26427, 10, 1, 0x0458 }, { 26437, 5, 1, 0x03A3 }, { 26442, 17, 1, 0xFB32 }, { 26459, 10, 1, 0x248C }, { 26469, 8, 1, 0x0157 }, { 26477, 15, 1, 0xFEBC },
+        { 26492, 23, 1, 0x309E }, { 26515, 13, 1, 0xF7E7 }, { 26528, 11, 1, 0x334E }, { 26539, 10, 1, 0x042F }, { 26549, 9, 1, 0x315D }, { 26558, 16, 1, 0x3165 },
+        { 26574, 11, 1, 0x053F }, { 26585, 10, 1, 0x30D6 }, { 26595, 23, 1, 0x3299 }, { 26618, 8, 1, 0x2111 }, { 26626, 9, 1, 0x3116 }, { 26635, 11, 1, 0x0580 },
+        { 26646, 9, 1, 0x0303 }, { 26655, 14, 1, 0x2661 }, { 26669, 12, 1, 0x00BA }, { 26681, 11, 1, 0xF721 }, { 26692, 7, 1, 0x0968 }, { 26699, 10, 1, 0x1E3B },
+        { 26709, 10, 1, 0x1EF6 }, { 26719, 10, 1, 0xFF39 }, { 26729, 11, 1, 0x0598 }, { 26740, 20, 1, 0x3279 }, { 26760, 7, 1, 0x028E }, { 26767, 6, 1, 0x03D1 },
+        { 26773, 20, 1, 0xFCA1 }, { 26793, 11, 1, 0x0A72 }, { 26804, 13, 1, 0xFF0B }, { 26817, 17, 1, 0xFE9F }, { 26834, 11, 1, 0xF8EC }, { 26845, 12, 1, 0x0553 },
+        { 26857, 12, 1, 0x2482 }, { 26869, 11, 1, 0x063A }, { 26880, 14, 1, 0xFE31 }, { 26894, 9, 1, 0x2329 }, { 26903, 13, 1, 0x0320 }, { 26916, 12, 1, 0x2079 },
+        { 26928, 10, 1, 0x0536 }, { 26938, 8, 1, 0x256B }, { 26946, 11, 1, 0x0436 }, { 26957, 6, 1, 0x249E }, { 26963, 11, 1, 0x00EE }, { 26974, 14, 1, 0xF726 },
+        { 26988, 20, 1, 0xFCCC }, { 27008, 22, 1, 0x05AA }, { 27030, 12, 1, 0x013B }, { 27042, 13, 1, 0x33A6 }, { 27055, 14, 2, 0x004B }, { 27069, 18, 1, 0x0ABF },
+        { 27087, 16, 1, 0x05A5 }, { 27103, 24, 1, 0x05B3 }, { 27127, 15, 1, 0x1E5D }, { 27142, 1, 1, 0x007A }, { 27143, 11, 1, 0x0A23 }, { 27154, 8, 1, 0x05DF },
+        { 27162, 12, 1, 0x2025 }, { 27174, 17, 2, 0x004D }, { 27191, 6, 1, 0x0179 }, { 27197, 9, 1, 0x0171 }, { 27206, 15, 1, 0x337B }, { 27221, 9, 1, 0x0415 },
+        { 27230, 3, 1, 0x0283 }, { 27233, 11, 1, 0x3022 }, { 27244, 7, 1, 0x24DF }, { 27251, 17, 1, 0x3213 }, { 27268, 11, 1, 0x06F9 }, { 27279, 14, 1, 0x0281 },
+        { 27293, 6, 1, 0x24A6 }, { 27299, 31, 1, 0x25A7 }, { 27330, 14, 1, 0x0E06 }, { 27344, 9, 1, 0x310E }, { 27353, 4, 1, 0x2642 }, { 27357, 4, 1, 0x0121 },
+        { 27361, 8, 1, 0x255B }, { 27369, 16, 1, 0x06BA }, { 27385, 11, 1, 0x056A }, { 27396, 10, 1, 0x3052 }, { 27406, 16, 1, 0x2267 }, { 27422, 22, 2, 0x004F },
+        { 27444, 12, 1, 0x09ED }, { 27456, 9, 1, 0x0454 }, { 27465, 12, 1, 0x02BF }, { 27477, 1, 1, 0x0061 }, { 27478, 20, 1, 0xFF64 }, { 27498, 8, 1, 0x3156 },
+        { 27506, 12, 1, 0x09EE }, { 27518, 7, 1, 0x0261 }, { 27525, 11, 1, 0x0AB7 }, { 27536, 14, 1, 0xFB1F }, { 27550, 10, 1, 0xFF25 }, { 27560, 21, 1, 0x0322 },
+        { 27581, 10, 1, 0x3326 }, { 27591, 17, 1, 0x04AF }, { 27608, 2, 1, 0x01A3 }, { 27610, 13, 1, 0x223C }, { 27623, 16, 1, 0xFB58 }, { 27639, 17, 1, 0x3211 },
+        { 27656, 10, 1, 0x01FA }, { 27666, 18, 1, 0x300D }, { 27684, 5, 1, 0x03B3 }, { 27689, 19, 1, 0xFF5D }, { 27708, 19, 1, 0x2273 }, { 27727, 18, 1, 0x0E44 },
+        { 27745, 16, 1, 0x2272 }, { 27761, 10, 2, 0x0051 }, { 27771, 19, 1, 0xF88D }, { 27790, 18, 1, 0x22DB }, { 27808, 10, 1, 0x1E03 }, { 27818, 23, 1, 0x04B1 },
+        { 27841, 17, 1, 0x0466 }, { 27858, 12, 1, 0x090C }, { 27870, 8, 2, 0x0053 }, { 27878, 10, 1, 0x0AAF }, { 27888, 9, 1, 0x0E53 }, { 27897, 11, 1, 0x06F5 },
+        { 27908, 17, 1, 0x09BF }, { 27925, 7, 1, 0x24CC }, { 27932, 8, 1, 0x227B }, { 27940, 9, 1, 0xF6C6 }, { 27949, 5, 1, 0x027D }, { 27954, 6, 1, 0x00CD },
+        { 27960, 12, 1, 0xFFE6 }, { 27972, 4, 1, 0x0034 }, { 27976, 3, 1, 0x2126 }, { 27979, 6, 1, 0x00C9 }, { 27985, 25, 1, 0x323C }, { 28010, 10, 1, 0xFF46 },
+        { 28020, 17, 1, 0xFB2A }, { 28037, 10, 1, 0x0E5B }, { 28047, 10, 1, 0x0569 }, { 28057, 12, 1, 0x05BB }, { 28069, 5, 1, 0x1E98 }, { 28074, 8, 1, 0x0934 },
+        { 28082, 9, 1, 0x0439 }, { 28091, 20, 2, 0x0055 }, { 28111, 11, 1, 0x21E1 }, { 28122, 6, 1, 0x016D }, { 28128, 10, 1, 0x0401 }, { 28138, 7, 1, 0x24DE },
+        { 28145, 10, 1, 0x0AB9 }, { 28155, 15, 1, 0xFE5C }, { 28170, 10, 1, 0x3054 }, { 28180, 5, 1, 0x0384 }, { 28185, 19, 1, 0x0A81 }, { 28204, 8, 1, 0x05B8 },
+        { 28212, 13, 1, 0x1EE2 }, { 28225, 6, 1, 0xF76B }, { 28231, 10, 1, 0x0434 }, { 28241, 15, 1, 0xFE9A }, { 28256, 7, 1, 0x03BF }, { 28263, 7, 1, 0x05B5 },
+        { 28270, 12, 1, 0x05B2 }, { 28282, 10, 1, 0xFF28 }, { 28292, 22, 1, 0xFE34 }, { 28314, 10, 1, 0x0AA4 }, { 28324, 17, 1, 0x3216 }, { 28341, 10, 1, 0xFF44 },
+        { 28351, 9, 1, 0x1EF4 }, { 28360, 18, 1, 0x0AC1 }, { 28378, 9, 1, 0x0462 }, { 28387, 18, 1, 0x2251 }, { 28405, 6, 1, 0x01E6 }, { 28411, 22, 1, 0xF898 },
+        { 28433, 12, 1, 0x03CD }, { 28445, 9, 1, 0x1E6D }, { 28454, 16, 1, 0x3204 }, { 28470, 7, 1, 0x2208 }, { 28477, 10, 1, 0x304F }, { 28487, 9, 1, 0x05BC },
+        { 28496, 9, 1, 0x202E }, { 28505, 16, 2, 0x0057 }, { 28521, 9, 1, 0x096D }, { 28530, 23, 1, 0x32A5 }, { 28553, 6, 1, 0x2022 }, { 28559, 18, 1, 0x3275 },
+        { 28577, 11, 1, 0x0576 }, { 28588, 17, 1, 0x02CA }, { 28605, 8, 1, 0x03F3 }, { 28613, 12, 1, 0xF6CF }, { 28625, 9, 1, 0x0E58 }, { 28634, 14, 1, 0xF8FB },
+        { 28648, 16, 1, 0xFF05 }, { 28664, 10, 1, 0x0679 }, { 28674, 16, 1, 0x03F0 }, { 28690, 19, 1, 0xFC8D }, { 28709, 10, 1, 0x30F0 }, { 28719, 13, 1, 0x0AED },
+        { 28732, 15, 1, 0x1E7B }, { 28747, 24, 1, 0x32A3 }, { 28771, 12, 1, 0x026B }, { 28783, 10, 1, 0x0417 }, { 28793, 9, 1, 0x0661 }, { 28802, 6, 1, 0xF775 },
+        { 28808, 11, 1, 0xF8F1 }, { 28819, 10, 1, 0x0545 }, { 28829, 9, 1, 0x0441 }, { 28838, 11, 1, 0xF7E9 }, { 28849, 13, 1, 0x2485 }, { 28862, 14, 1, 0x04C3 },
+        { 28876, 11, 1, 0x0549 }, { 28887, 18, 1, 0x3271 }, { 28905, 9, 1, 0x0698 }, { 28914, 10, 1, 0x30E0 }, { 28924, 9, 1, 0x0635 }, { 28933, 9, 1, 0x33BC },
+        { 28942, 15, 1, 0x0E4B }, { 28957, 14, 1, 0xFED6 }, { 28971, 19, 1, 0xFF8D }, { 28990, 11, 1, 0x332A }, { 29001, 2, 1, 0x01CB }, { 29003, 9, 1, 0x338C },
+        { 29012, 9, 1, 0x045C }, { 29021, 6, 1, 0x00E8 }, { 29027, 14, 1, 0x03D5 }, { 29041, 8, 1, 0x33BB }, { 29049, 15, 1, 0x0E45 }, { 29064, 1, 1, 0x0077 },
+        { 29065, 8, 1, 0x33B7 }, { 29073, 13, 1, 0xF8E9 }, { 29086, 9, 1, 0xFB4A }, { 29095, 14, 1, 0x0290 }, { 29109, 15, 1, 0x2470 }, { 29124, 10, 1, 0x3120 },
+        { 29134, 19, 1, 0xFF92 }, { 29153, 18, 1, 0x0597 }, { 29171, 19, 1, 0xFCCA }, { 29190, 12, 1, 0xFB4E }, { 29202, 17, 1, 0x05B7 }, { 29219, 19, 1, 0x05A0 },
+        { 29238, 20, 1, 0x04E1 }, { 29258, 7, 1, 0x2584 }, { 29265, 9, 1, 0x0635 }, { 29274, 12, 1, 0x0E16 }, { 29286, 14, 1, 0x046A }, { 29300, 19, 1, 0x05BB },
+        { 29319, 11, 1, 0x3323 }, { 29330, 10, 1, 0x30C6 }, { 29340, 7, 1, 0x24DC }, { 29347, 10, 1, 0x0E41 }, { 29357, 28, 1, 0xFEF6 }, { 29385, 17, 1, 0x3263 },
+        { 29402, 11, 1, 0x05E6 }, { 29413, 25, 1, 0x3239 }, { 29438, 9, 1, 0x311C }, { 29447, 8, 1, 0x0278 }, { 29455, 14, 1, 0x0660 }, { 29469, 11, 1, 0x0A27 },
+        { 29480, 5, 1, 0x2206 }, { 29485, 11, 1, 0x0621 }, { 29496, 12, 1, 0xF734 }, { 29508, 24, 1, 0x323E }, { 29532, 19, 2, 0x0059 }, { 29551, 8, 1, 0x3151 },
+        { 29559, 6, 1, 0xF778 }, { 29565, 9, 1, 0x2173 }, { 29574, 10, 1, 0xFF48 }, { 29584, 9, 1, 0x09AF }, { 29593, 5, 1, 0xF8FF }, { 29598, 6, 1, 0x0103 },
+        { 29604, 16, 3, 0x005B }, { 29620, 7, 1, 0x05B0 }, { 29627, 9, 1, 0x0E38 }, { 29636, 10, 1, 0x03E8 }, { 29646, 16, 1, 0x1ED7 }, { 29662, 7, 1, 0x24D1 },
+        { 29669, 14, 1, 0x0941 }, { 29683, 12, 1, 0x05B2 }, { 29695, 20, 1, 0x1EC2 }, { 29715, 10, 1, 0x0006 }, { 29725, 13, 1, 0xF6D7 }, { 29738, 10, 1, 0x0A86 },
+        { 29748, 10, 1, 0xFF52 }, { 29758, 11, 1, 0x01B9 }, { 29769, 14, 1, 0xF6E8 }, { 29783, 6, 1, 0xF771 }, { 29789, 9, 1, 0x045F }, { 29798, 11, 1, 0x0108 },
+        { 29809, 13, 1, 0x2663 }, { 29822, 18, 1, 0x09CC }, { 29840, 12, 1, 0x0163 }, { 29852, 9, 1, 0x02D9 }, { 29861, 14, 1, 0x094B }, { 29875, 9, 1, 0x0986 },
+        { 29884, 10, 1, 0x3089 }, { 29894, 13, 1, 0xFE4D }, { 29907, 19, 1, 0x0ACC }, { 29926, 11, 1, 0x05A7 }, { 29937, 15, 1, 0xFEE2 }, { 29952, 11, 1, 0x1E79 },
+        { 29963, 28, 1, 0xFEFA }, { 29991, 11, 1, 0x0E3A }, { 30002, 10, 2, 0x005E }, { 30012, 16, 1, 0x04C0 }, { 30028, 6, 1, 0x092E }, { 30034, 11, 1, 0xF8ED },
+        { 30045, 13, 1, 0x0333 }, { 30058, 20, 1, 0x323A }, { 30078, 6, 1, 0x01E9 }, { 30084, 9, 1, 0x2491 }, { 30093, 11, 1, 0x0A5C }, { 30104, 9, 1, 0x0423 },
+        { 30113, 16, 1, 0x1EC4 }, { 30129, 21, 1, 0x04F3 }, { 30150, 22, 1, 0x05A6 }, { 30172, 8, 1, 0x2175 }, { 30180, 10, 1, 0xFF2F }, { 30190, 16, 1, 0x1E3D },
+        { 30206, 17, 1, 0x05B6 }, { 30223, 11, 1, 0x3124 }, { 30234, 12, 1, 0x0583 }, { 30246, 17, 1, 0x3186 }, { 30263, 10, 1, 0x042E }, { 30273, 9, 1, 0x043E },
+        { 30282, 8, 1, 0x33CA }, { 30290, 29, 1, 0x3018 }, { 30319, 9, 1, 0x0994 }, { 30328, 19, 1, 0x326A }, { 30347, 9, 1, 0xFB35 }, { 30356, 9, 1, 0x05B6 },
+        { 30365, 16, 2, 0x0060 }, { 30381, 12, 1, 0x0340 }, { 30393, 13, 1, 0x032E }, { 30406, 26, 1, 0x278D }, { 30432, 10, 1, 0x2237 }, { 30442, 8, 1, 0x002A },
+        { 30450, 23, 1, 0x032B }, { 30473, 8, 1, 0x21DF }, { 30481, 7, 1, 0x0921 }, { 30488, 17, 1, 0x3261 }, { 30505, 8, 1, 0x05DA }, { 30513, 9, 1, 0x05BF },
+        { 30522, 10, 1, 0x010B }, { 30532, 8, 1, 0x33B3 }, { 30540, 11, 1, 0x1EB5 }, { 30551, 10, 1, 0xF7FE }, { 30561, 6, 1, 0x00D2 }, { 30567, 10, 1, 0x30EF },
+        { 30577, 14, 1, 0x3049 }, { 30591, 10, 1, 0x1EC9 }, { 30601, 19, 1, 0x049A }, { 30620, 9, 1, 0x0A09 }, { 30629, 11, 1, 0x1E4D }, { 30640, 19, 1, 0xFF8C },
+        { 30659, 9, 1, 0x0691 }, { 30668, 10, 1, 0x0116 }, { 30678, 14, 1, 0x04C4 }, { 30692, 1, 1, 0x006E }, { 30693, 18, 1, 0x05B9 }, { 30711, 9, 1, 0x00F6 },
+        { 30720, 11, 1, 0x057E }, { 30731, 11, 1, 0xF6F9 }, { 30742, 10, 1, 0x0A88 }, { 30752, 23, 1, 0x06D1 }, { 30775, 9, 1, 0x0418 }, { 30784, 6, 1, 0xF763 },
+        { 30790, 19, 1, 0xF6DE }, { 30809, 1, 1, 0x004C }, { 30810, 10, 1, 0x1E44 }, { 30820, 21, 1, 0xFC08 }, { 30841, 6, 1, 0x00F2 }, { 30847, 6, 1, 0x00B0 },
+        { 30853, 9, 1, 0x064E }, { 30862, 18, 1, 0x02CC }, { 30880, 25, 1, 0x278F }, { 30905, 10, 1, 0x30B7 }, { 30915, 18, 1, 0x3210 }, { 30933, 9, 1, 0x02BD },
+        { 30942, 17, 1, 0xFF02 }, { 30959, 12, 1, 0x01AB }, { 30971, 14, 1, 0x2025 }, { 30985, 7, 1, 0x3163 }, { 30992, 10, 1, 0x247B }, { 31002, 6, 1, 0x092A },
+        { 31008, 9, 1, 0x0463 }, { 31017, 12, 1, 0x06F7 }, { 31029, 14, 1, 0xFF1A }, { 31043, 9, 1, 0x0631 }, { 31052, 9, 1, 0x30A4 }, { 31061, 10, 1, 0x0A15 },
+        { 31071, 16, 1, 0x1E4B }, { 31087, 19, 1, 0xFF86 }, { 31106, 9, 1, 0x00EB }, { 31115, 30, 1, 0x25BF }, { 31145, 8, 1, 0x05B8 }, { 31153, 13, 1, 0x2481 },
+        { 31166, 10, 1, 0x05E5 }, { 31176, 9, 1, 0x05DE }, { 31185, 9, 1, 0x05EA }, { 31194, 27, 1, 0x02E4 }, { 31221, 2, 1, 0x01CC }, { 31223, 11, 1, 0x05BE },
+        { 31234, 14, 1, 0x2219 }, { 31248, 9, 1, 0x0995 }, { 31257, 11, 1, 0x0AA5 }, { 31268, 13, 1, 0x05C1 }, { 31281, 9, 1, 0x202D }, { 31290, 12, 1, 0x0543 },
+        { 31302, 12, 1, 0x2229 }, { 31314, 9, 1, 0x1EA0 }, { 31323, 8, 1, 0xF6D4 }, { 31331, 8, 1, 0x2225 }, { 31339, 6, 1, 0x002E }, { 31345, 6, 1, 0x00E1 },
+        { 31351, 7, 1, 0x01E4 }, { 31358, 17, 1, 0x04E7 }, { 31375, 10, 1, 0x099D }, { 31385, 19, 2, 0x0062 }, { 31404, 14, 1, 0xFF1D }, { 31418, 26, 1, 0x329D },
+        { 31444, 13, 1, 0xF6D8 }, { 31457, 15, 1, 0x030B }, { 31472, 10, 1, 0x304D }, { 31482, 6, 1, 0xF76E }, { 31488, 10, 1, 0x0A38 }, { 31498, 14, 1, 0xF6E5 },
+        { 31512, 5, 1, 0x0060 }, { 31517, 13, 1, 0x0A6E }, { 31530, 10, 1, 0x0540 }, { 31540, 1, 1, 0x0073 }, { 31541, 12, 1, 0x0E04 }, { 31553, 12, 1, 0x0136 },
+        { 31565, 10, 1, 0x0AD0 }, { 31575, 10, 1, 0x1E0B }, { 31585, 10, 1, 0xFF4E }, { 31595, 19, 1, 0x328D }, { 31614, 20, 1, 0x02D3 }, { 31634, 10, 1, 0x0575 },
+        { 31644, 14, 1, 0x064D }, { 31658, 1, 1, 0x0070 }, { 31659, 15, 1, 0x0942 }, { 31674, 10, 1, 0x30BD }, { 31684, 8, 1, 0x251C }, { 31692, 11, 1, 0x30FB },
+        { 31703, 11, 1, 0x09A2 }, { 31714, 13, 1, 0x0961 }, { 31727, 12, 1, 0x0A5A }, { 31739, 10, 1, 0x30CB }, { 31749, 18, 1, 0xFECF }, { 31767, 10, 1, 0x03E9 },
+        { 31777, 19, 1, 0x04A8 }, { 31796, 12, 1, 0x045F }, { 31808, 19, 1, 0x09F5 }, { 31827, 12, 1, 0x0E0A }, { 31839, 7, 1, 0x01A7 }, { 31846, 6, 1, 0x01D1 },
+        { 31852, 2, 1, 0xFB02 }, { 31854, 16, 1, 0x1EC5 }, { 31870, 12, 1, 0x04BB }, { 31882, 3, 1, 0x05DB }, { 31885, 15, 1, 0xFE8E }, { 31900, 25, 1, 0x2253 },
+        { 31925, 9, 1, 0x0424 }, { 31934, 23, 1, 0xFD88 }, { 31957, 11, 1, 0x25A0 }, { 31968, 12, 1, 0x318E }, { 31980, 14, 1, 0x0207 }, { 31994, 25, 1, 0x3236 },
+        { 32019, 11, 1, 0x0E0E }, { 32030, 13, 1, 0x246E }, { 32043, 20, 1, 0xFC0C }, { 32063, 10, 1, 0x0479 }, { 32073, 25, 1, 0x32A9 }, { 32098, 9, 1, 0x05B2 },
+        { 32107, 7, 1, 0x2235 }, { 32114, 15, 1, 0x21E8 }, { 32129, 9, 1, 0x215B }, { 32138, 10, 1, 0x3077 }, { 32148, 5, 1, 0x01B2 }, { 32153, 8, 1, 0x2568 },
+        { 32161, 14, 1, 0x0212 }, { 32175, 9, 1, 0x041E }, { 32184, 15, 1, 0x317D }, { 32199, 6, 1, 0xF77A }, { 32205, 14, 1, 0x01B1 }, { 32219, 14, 1, 0x2494 },
+        { 32233, 15, 1, 0xFE92 }, { 32248, 9, 1, 0x0258 }, { 32257, 6, 1, 0x095E }, { 32263, 11, 1, 0x005B }, { 32274, 10, 1, 0xFF31 }, { 32284, 12, 1, 0xFF5C },
+        { 32296, 11, 1, 0x2082 }, { 32307, 21, 1, 0xFCD5 }, { 32328, 8, 1, 0xFB44 }, { 32336, 15, 1, 0xFB38 }, { 32351, 10, 1, 0x30D7 }, { 32361, 15, 1, 0x0663 },
+        { 32376, 14, 1, 0x1E9B }, { 32390, 14, 1, 0x0310 }, { 32404, 9, 1, 0x09A6 }, { 32413, 5, 1, 0x1E99 }, { 32418, 13, 1, 0x1EF0 }, { 32431, 10, 1, 0x0120 },
+        { 32441, 10, 1, 0x041D }, { 32451, 12, 1, 0x05B1 }, { 32463, 12, 1, 0x207A }, { 32475, 14, 1, 0xF887 }, { 32489, 14, 1, 0xFB57 }, { 32503, 10, 1, 0x09DC },
+        { 32513, 10, 1, 0x0564 }, { 32523, 12, 1, 0xF8F7 }, { 32535, 4, 1, 0x20AB }, { 32539, 17, 1, 0x21C5 }, { 32556, 8, 1, 0x2560 }, { 32564, 15, 1, 0xFEB0 },
+        { 32579, 9, 1, 0xF6FC }, { 32588, 9, 1, 0x0404 }, { 32597, 12, 1, 0x0E46 }, { 32609, 11, 1, 0xFF20 }, { 32620, 4, 1, 0x03B6 }, { 32624, 19, 1, 0xFF77 },
+        { 32643, 11, 1, 0x0550 }, { 32654, 9, 1, 0x0404 }, { 32663, 1, 1, 0x006B }, { 32664, 5, 1, 0x05B7 }, { 32669, 6, 1, 0x02A8 }, { 32675, 6, 1, 0x0935 },
+        { 32681, 15, 2, 0x0064 }, { 32696, 9, 1, 0x0410 }, { 32705, 10, 1, 0x3072 }, { 32715, 16, 2, 0x0066 }, { 32731, 13, 1, 0xFF1C }, { 32744, 6, 1, 0x016C },
+        { 32750, 28, 1, 0x25A9 }, { 32778, 10, 1, 0xFF26 }, { 32788, 15, 1, 0xFE5A }, { 32803, 9, 1, 0x05B8 }, { 32812, 4, 1, 0x03B9 }, { 32816, 5, 1, 0x05B6 },
+        { 32821, 9, 1, 0x062E }, { 32830, 12, 1, 0x06F3 }, { 32842, 8, 1, 0x00A3 }, { 32850, 11, 1, 0x09EA }, { 32861, 19, 1, 0x0626 }, { 32880, 7, 1, 0x018B },
+        { 32887, 7, 1, 0x223C }, { 32894, 15, 1, 0x0587 }, { 32909, 21, 1, 0x33AF }, { 32930, 6, 1, 0x0168 }, { 32936, 6, 1, 0x1E55 }, { 32942, 9, 1, 0x061B },
+        { 32951, 28, 1, 0x25B5 }, { 32979, 9, 1, 0x1E6C }, { 32988, 14, 1, 0x200B }, { 33002, 9, 1, 0x3127 }, { 33011, 11, 1, 0x05C0 }, { 33022, 27, 1, 0x3011 },
+        { 33049, 13, 1, 0x04A5 }, { 33062, 5, 1, 0x05D3 }, { 33067, 21, 2, 0x0068 }, { 33088, 14, 1, 0x30A3 }, { 33102, 12, 1, 0x33A5 }, { 33114, 6, 1, 0x21DE },
+        { 33120, 1, 1, 0x004F }, { 33121, 11, 1, 0x1E91 }, { 33132, 17, 1, 0x0E43 }, { 33149, 5, 1, 0x0260 }, { 33154, 10, 1, 0x05E9 }, { 33164, 11, 1, 0x0562 },
+        { 33175, 3, 1, 0x0032 }, { 33178, 12, 1, 0x0473 }, { 33190, 12, 1, 0x2286 }, { 33202, 12, 1, 0x029D }, { 33214, 11, 1, 0x0416 }, { 33225, 9, 1, 0x2195 },
+        { 33234, 10, 1, 0x09A5 }, { 33244, 16, 1, 0x2662 }, { 33260, 9, 1, 0x064F }, { 33269, 17, 1, 0x04D2 }, { 33286, 9, 1, 0x33B6 }, { 33295, 10, 1, 0x0408 },
+        { 33305, 4, 1, 0x05E9 }, { 33309, 8, 1, 0x33BE }, { 33317, 16, 1, 0xF7EA }, { 33333, 11, 1, 0x01FE }, { 33344, 7, 1, 0x0309 }, { 33351, 9, 1, 0x000B },
+        { 33360, 15, 1, 0x04E3 }, { 33375, 11, 1, 0x05B6 }, { 33386, 13, 1, 0x2017 }, { 33399, 6, 1, 0x00E0 }, { 33405, 4, 1, 0x0399 }, { 33409, 16, 1, 0xFE91 },
+        { 33425, 10, 2, 0x006A }, { 33435, 10, 1, 0x1E6A }, { 33445, 9, 1, 0x0648 }, { 33454, 10, 1, 0x09B7 }, { 33464, 10, 1, 0x0A0A }, { 33474, 11, 1, 0x0911 },
+        { 33485, 8, 1, 0x2559 }, { 33493, 11, 1, 0x1E1A }, { 33504, 11, 1, 0x0546 }, { 33515, 6, 1, 0x010E }, { 33521, 9, 1, 0x09B2 }, { 33530, 15, 1, 0x04EE },
+        { 33545, 10, 1, 0x248B }, { 33555, 15, 1, 0x3144 }, { 33570, 19, 1, 0xFF99 }, { 33589, 24, 1, 0x0485 }, { 33613, 9, 1, 0x0417 }, { 33622, 20, 1, 0xFB3A },
+        { 33642, 6, 1, 0x0E26 }, { 33648, 6, 1, 0x00C0 }, { 33654, 8, 1, 0x3162 }, { 33662, 9, 1, 0xFB1F }, { 33671, 9, 1, 0x0647 }, { 33680, 7, 1, 0x01C6 },
+        { 33687, 14, 1, 0x019F }, { 33701, 18, 1, 0xFC6D }, { 33719, 24, 1, 0x09C3 }, { 33743, 14, 2, 0x006C }, { 33757, 9, 1, 0x3044 }, { 33766, 7, 1, 0x0184 },
+        { 33773, 8, 1, 0x0122 }, { 33781, 11, 1, 0xF7AF }, { 33792, 13, 1, 0x04D8 }, { 33805, 17, 1, 0x30FD }, { 33822, 11, 1, 0xF7F8 }, { 33833, 18, 1, 0xFF08 },
+        { 33851, 10, 1, 0x0431 }, { 33861, 13, 1, 0x3023 }, { 33874, 3, 1, 0xFB04 }, { 33877, 9, 1, 0x0178 }, { 33886, 10, 1, 0x09E8 }, { 33896, 7, 1, 0x00A7 },
+        { 33903, 9, 1, 0x0953 }, { 33912, 8, 1, 0x33D1 }, { 33920, 8, 1, 0x2566 }, { 33928, 11, 1, 0x0A21 }, { 33939, 12, 1, 0x03EA }, { 33951, 18, 1, 0x326F },
+        { 33969, 10, 1, 0x1E95 }, { 33979, 24, 1, 0x049D }, { 34003, 9, 1, 0x043A }, { 34012, 13, 1, 0x2087 }, { 34025, 18, 1, 0x1E69 }, { 34043, 18, 1, 0x05A4 },
+        { 34061, 19, 1, 0x04A9 }, { 34080, 10, 1, 0x0E36 }, { 34090, 28, 1, 0xFF70 }, { 34118, 8, 1, 0x01E2 }, { 34126, 10, 1, 0x2172 }, { 34136, 5, 1, 0x0266 },
+        { 34141, 19, 1, 0x2243 }, { 34160, 9, 1, 0x042C }, { 34169, 6, 1, 0xF76D }, { 34175, 19, 1, 0x02B5 }, { 34194, 8, 1, 0x33C5 }, { 34202, 8, 1, 0x252C },
+        { 34210, 11, 1, 0xF6FB }, { 34221, 12, 1, 0x0E03 }, { 34233, 21, 1, 0xFEFB }, { 34254, 9, 1, 0x0472 }, { 34263, 6, 1, 0x24B0 }, { 34269, 10, 1, 0x1E60 },
+        { 34279, 13, 2, 0x006E }, { 34292, 3, 1, 0x03C4 }, { 34295, 18, 1, 0x047B }, { 34313, 5, 1, 0x0254 }, { 34318, 10, 1, 0x3074 }, { 34328, 5, 1, 0x01A5 },
+        { 34333, 9, 1, 0x1ECD }, { 34342, 9, 1, 0x03E4 }, { 34351, 9, 1, 0x33D5 }, { 34360, 12, 1, 0x1E14 }, { 34372, 10, 1, 0x30F1 }, { 34382, 7, 1, 0x01EA },
+        { 34389, 1, 1, 0x0067 }, { 34390, 9, 1, 0x05BE }, { 34399, 7, 1, 0x003E }, { 34406, 17, 1, 0x0AE0 }, { 34423, 18, 1, 0x21C6 }, { 34441, 13, 1, 0x0170 },
+        { 34454, 14, 1, 0x02BB }, { 34468, 9, 1, 0x33B2 }, { 34477, 3, 1, 0x05D1 }, { 34480, 10, 1, 0x03DE }, { 34490, 7, 1, 0x24BC }, { 34497, 16, 1, 0x1ED3 },
+        { 34513, 11, 1, 0x059A }, { 34524, 22, 1, 0x0944 }, { 34546, 12, 1, 0x0157 }, { 34558, 3, 1, 0x00B5 }, { 34561, 13, 1, 0x066A }, { 34574, 16, 1, 0x0A82 },
+        { 34590, 16, 1, 0xFEDF }, { 34606, 12, 1, 0xF8F2 }, { 34618, 13, 1, 0xFB4C }, { 34631, 6, 1, 0x0161 }, { 34637, 11, 1, 0x2030 }, { 34648, 11, 1, 0x040A },
+        { 34659, 14, 1, 0xFEA2 }, { 34673, 11, 1, 0x00DB }, { 34684, 11, 1, 0x0323 }, { 34695, 16, 1, 0x1E13 }, { 34711, 14, 1, 0xFF13 }, { 34725, 6, 1, 0x24AE },
+        { 34731, 1, 1, 0x006F }, { 34732, 9, 2, 0x0070 }, { 34741, 9, 1, 0x05BD }, { 34750, 7, 1, 0x092D }, { 34757, 21, 1, 0xFB9F }, { 34778, 6, 1, 0x0139 },
+        { 34784, 9, 1, 0x3393 }, { 34793, 10, 1, 0x3065 }, { 34803, 9, 1, 0x05D9 }, { 34812, 1, 1, 0x0045 }, { 34813, 12, 1, 0x3029 }, { 34825, 11, 1, 0x09EB },
+        { 34836, 10, 1, 0x05BF }, { 34846, 12, 1, 0x056C }, { 34858, 20, 1, 0x261D }, { 34878, 15, 1, 0x05B5 }, { 34893, 7, 1, 0x24CD }, { 34900, 7, 1, 0x026F },
+        { 34907, 9, 1, 0x05D1 }, { 34916, 8, 1, 0x2551 }, { 34924, 16, 1, 0x049E }, { 34940, 20, 1, 0x04B6 }, { 34960, 11, 1, 0x0563 }, { 34971, 12, 1, 0x0E1C },
+        { 34983, 19, 1, 0xFF7F }, { 35002, 10, 2, 0x0072 }, { 35012, 9, 1, 0x0633 }, { 35021, 9, 1, 0x338D }, { 35030, 16, 1, 0x3136 }, { 35046, 9, 1, 0x0444 },
+        { 35055, 9, 1, 0x0647 }, { 35064, 9, 1, 0x001E }, { 35073, 10, 1, 0x2295 }, { 35083, 12, 1, 0x0146 }, { 35095, 22, 1, 0xFC4E }, { 35117, 9, 1, 0x3109 },
+        { 35126, 10, 1, 0x1EEB }, { 35136, 5, 1, 0x01A4 }, { 35141, 9, 1, 0x0455 }, { 35150, 14, 1, 0x00B7 }, { 35164, 18, 1, 0x3182 }, { 35182, 13, 1, 0xF6CC },
+        { 35195, 13, 1, 0x025C }, { 35208, 11, 1, 0x3188 }, { 35219, 10, 1, 0x001B }, { 35229, 8, 1, 0x3150 }, { 35237, 10, 1, 0x0630 }, { 35247, 10, 1, 0x2320 },
+        { 35257, 11, 1, 0x2081 }, { 35268, 14, 1, 0x0206 }, { 35282, 14, 1, 0x02C0 }, { 35296, 10, 1, 0x30DD }, { 35306, 5, 1, 0x2126 }, { 35311, 15, 1, 0x05B4 },
+        { 35326, 8, 1, 0x3381 }, { 35334, 12, 1, 0x0AEA }, { 35346, 10, 1, 0x30C8 }, { 35356, 16, 1, 0x3207 }, { 35372, 10, 1, 0x1E59 }, { 35382, 11, 1, 0x217A },
+        { 35393, 8, 1, 0x33C4 }, { 35401, 8, 1, 0x1E10 }, { 35409, 6, 1, 0x00D9 }, { 35415, 10, 1, 0x30E8 }, { 35425, 8, 1, 0x05BB }, { 35433, 15, 1, 0xF6F6 },
+        { 35448, 10, 1, 0x0015 }, { 35458, 13, 2, 0x0074 }, { 35471, 11, 1, 0xF6FF }, { 35482, 8, 1, 0x0920 }, { 35490, 13, 1, 0x3351 }, { 35503, 11, 1, 0x05B5 },
+        { 35514, 5, 1, 0x2423 }, { 35519, 21, 1, 0xFC58 }, { 35540, 24, 1, 0xF896 }, { 35564, 9, 1, 0x066A }, { 35573, 9, 1, 0x0E2A }, { 35582, 20, 1, 0x04E0 },
+        { 35602, 11, 1, 0x05D6 }, { 35613, 9, 1, 0x1E97 }, { 35622, 19, 1, 0x04AA }, { 35641, 6, 1, 0x00D1 }, { 35647, 5, 1, 0x0198 }, { 35652, 22, 1, 0x046C },
+        { 35674, 13, 1, 0x0661 }, { 35687, 11, 1, 0x0E1E }, { 35698, 8, 1, 0x2550 }, { 35706, 10, 1, 0x30D9 }, { 35716, 9, 2, 0x0076 }, { 35725, 11, 1, 0xF7F2 },
+        { 35736, 10, 1, 0x0A17 }, { 35746, 9, 1, 0x0A07 }, { 35755, 7, 1, 0x24D7 }, { 35762, 14, 1, 0x2321 }, { 35776, 1, 1, 0x0049 }, { 35777, 27, 1, 0x2791 },
+        { 35804, 11, 1, 0x333B }, { 35815, 15, 1, 0xF888 }, { 35830, 7, 1, 0x0105 }, { 35837, 8, 1, 0x2524 }, { 35845, 8, 1, 0x2165 }, { 35853, 22, 1, 0x03F2 },
+        { 35875, 10, 1, 0x0A28 }, { 35885, 12, 1, 0x0AA2 }, { 35897, 16, 1, 0x3266 }, { 35913, 19, 1, 0xFCA2 }, { 35932, 24, 1, 0x09E2 }, { 35956, 17, 1, 0xF7BF },
+        { 35973, 4, 1, 0x002B }, { 35977, 14, 1, 0x2287 }, { 35991, 15, 1, 0x0475 }, { 36006, 9, 1, 0x0644 }, { 36015, 12, 1, 0x0E1A }, { 36027, 10, 1, 0x2250 },
+        { 36037, 12, 1, 0x3131 }, { 36049, 16, 1, 0x042C }, { 36065, 1, 1, 0x004D }, { 36066, 14, 1, 0x203A }, { 36080, 12, 1, 0x2265 }, { 36092, 10, 1, 0x0568 },
+        { 36102, 16, 1, 0x0324 }, { 36118, 7, 1, 0x25BA }, { 36125, 18, 1, 0x2245 }, { 36143, 2, 1, 0x05E4 }, { 36145, 22, 1, 0x02D1 }, { 36167, 5, 1, 0x0282 },
+        { 36172, 9, 1, 0x1E0C }, { 36181, 9, 1, 0xF6EB }, { 36190, 6, 1, 0x0111 }, { 36196, 9, 1, 0x3128 }, { 36205, 9, 1, 0x001F }, { 36214, 14, 1, 0x2660 },
+        { 36228, 6, 1, 0x00C8 }, { 36234, 9, 1, 0x0214 }, { 36243, 16, 1, 0x1EC0 }, { 36259, 17, 1, 0x0640 }, { 36276, 10, 1, 0x33C1 }, { 36286, 9, 1, 0x05B0 },
+        { 36295, 25, 1, 0x0484 }, { 36320, 10, 1, 0x221F }, { 36330, 10, 1, 0x1EE8 }, { 36340, 10, 1, 0x0418 }, { 36350, 20, 1, 0xFCC9 }, { 36370, 14, 1, 0x3041 },
+        { 36384, 5, 1, 0x05B0 }, { 36389, 16, 1, 0x0482 }, { 36405, 17, 1, 0x337F }, { 36422, 12, 1, 0x00BF }, { 36434, 15, 1, 0x0A48 }, { 36449, 9, 1, 0x0A87 },
+        { 36458, 16, 1, 0xFB2F }, { 36474, 4, 1, 0x02A4 }, { 36478, 18, 1, 0x04DF }, { 36496, 9, 1, 0x2105 }, { 36505, 12, 1, 0x3024 }, { 36517, 12, 1, 0x1E15 },
+        { 36529, 12, 1, 0x1E53 }, { 36541, 15, 1, 0x059B }, { 36556, 13, 1, 0x037E }, { 36569, 8, 1, 0x203E }, { 36577, 11, 1, 0x057A }, { 36588, 3, 1, 0x05DE },
+        { 36591, 13, 1, 0x05E3 }, { 36604, 5, 1, 0x01AF }, { 36609, 6, 1, 0x1E83 }, { 36615, 7, 1, 0x0251 }, { 36622, 8, 1, 0x226A }, { 36630, 25, 1, 0x25C0 },
+        { 36655, 18, 1, 0x320C }, { 36673, 14, 1, 0x04D1 }, { 36687, 1, 1, 0x0042 }, { 36688, 9, 1, 0x0E57 }, { 36697, 5, 1, 0x2640 }, { 36702, 8, 1, 0x255E },
+        { 36710, 9, 1, 0x05C3 }, { 36719, 6, 1, 0x1E80 }, { 36725, 6, 1, 0x00EC }, { 36731, 11, 1, 0x056F }, { 36742, 9, 1, 0xFB31 }, { 36751, 11, 1, 0x0686 },
+        { 36762, 16, 1, 0x3140 }, { 36778, 19, 1, 0x328A }, { 36797, 8, 1, 0x015E }, { 36805, 6, 1, 0x1E7D }, { 36811, 15, 1, 0x0667 }, { 36826, 10, 1, 0x221F },
+        { 36836, 13, 1, 0x3347 }, { 36849, 10, 1, 0xFF53 }, { 36859, 9, 1, 0x099A }, { 36868, 19, 1, 0xFF88 }, { 36887, 2, 1, 0x0195 }, { 36889, 10, 1, 0x3069 },
+        { 36899, 9, 1, 0xFB3B }, { 36908, 11, 1, 0x0177 }, { 36919, 21, 1, 0x3184 }, { 36940, 16, 1, 0x3000 }, { 36956, 8, 1, 0x0389 }, { 36964, 10, 1, 0x0539 },
+        { 36974, 12, 1, 0x0123 }, { 36986, 10, 1, 0x0A2E }, { 36996, 10, 1, 0xFE50 }, { 37006, 9, 1, 0x30A2 }, { 37015, 10, 1, 0x30CE }, { 37025, 15, 1, 0x30E5 },
+        { 37040, 10, 1, 0x30D1 }, { 37050, 7, 1, 0x24CA }, { 37057, 12, 1, 0x2070 }, { 37069, 12, 1, 0x1E52 }, { 37081, 5, 1, 0x2327 }, { 37086, 16, 1, 0x1E4A },
+        { 37102, 10, 1, 0x0998 }, { 37112, 18, 1, 0x2252 }, { 37130, 9, 1, 0x06D2 }, { 37139, 6, 1, 0x0908 }, { 37145, 10, 1, 0x1E45 }, { 37155, 15, 1, 0x0A47 },
+        { 37170, 27, 1, 0x278C }, { 37197, 7, 1, 0x05B4 }, { 37204, 9, 1, 0x019D }, { 37213, 7, 1, 0x0197 }, { 37220, 10, 1, 0x1EDD }, { 37230, 9, 1, 0x0210 },
+        { 37239, 21, 1, 0x32A7 }, { 37260, 11, 1, 0x011D }, { 37271, 12, 1, 0x0162 }, { 37283, 16, 1, 0x0483 }, { 37299, 22, 1, 0xFC4B }, { 37321, 8, 1, 0x015F },
+        { 37329, 16, 1, 0x0596 }, { 37345, 11, 1, 0x04D4 }, { 37356, 9, 1, 0xFB2B }, { 37365, 15, 1, 0xFEE6 }, { 37380, 12, 1, 0x0388 }, { 37392, 10, 1, 0x3305 },
+        { 37402, 10, 1, 0xFF56 }, { 37412, 11, 1, 0x0A2B }, { 37423, 12, 1, 0x03AD }, { 37435, 10, 1, 0x1E8A }, { 37445, 11, 1, 0x0405 }, { 37456, 18, 1, 0x05B5 },
+        { 37474, 9, 1, 0x0637 }, { 37483, 16, 1, 0xFB49 }, { 37499, 10, 1, 0x047F }, { 37509, 12, 1, 0x3380 }, { 37521, 10, 1, 0xFF34 }, { 37531, 4, 1, 0x05D0 },
+        { 37535, 8, 1, 0x0922 }, { 37543, 12, 1, 0x0542 }, { 37555, 11, 1, 0x00FB }, { 37566, 23, 1, 0x04B0 }, { 37589, 10, 1, 0x30B8 }, { 37599, 10, 1, 0x30C0 },
+        { 37609, 18, 1, 0xFF06 }, { 37627, 9, 1, 0x05C1 }, { 37636, 7, 1, 0x24B7 }, { 37643, 15, 1, 0x0A91 }, { 37658, 9, 1, 0x09AA }, { 37667, 7, 1, 0x2191 },
+        { 37674, 16, 1, 0x031E }, { 37690, 16, 1, 0xFB94 }, { 37706, 9, 1, 0x03AF }, { 37715, 20, 1, 0x322A }, { 37735, 9, 1, 0x0406 }, { 37744, 9, 1, 0x0636 },
+        { 37753, 7, 1, 0x0183 }, { 37760, 19, 1, 0xFF98 }, { 37779, 7, 1, 0x0250 }, { 37786, 12, 1, 0x005D }, { 37798, 13, 1, 0x2276 }, { 37811, 6, 1, 0x2032 },
+        { 37817, 10, 1, 0x25E6 }, { 37827, 10, 1, 0x06F2 }, { 37837, 9, 2, 0x0078 }, { 37846, 6, 1, 0x25A1 }, { 37852, 9, 1, 0x0997 }, { 37861, 34, 1, 0xFE3B },
+        { 37895, 14, 1, 0x266F }, { 37909, 9, 1, 0x062A }, { 37918, 9, 1, 0x0665 }, { 37927, 19, 1, 0x094A }, { 37946, 16, 1, 0x3214 }, { 37962, 17, 1, 0x09C1 },
+        { 37979, 17, 1, 0xFB68 }, { 37996, 14, 1, 0x01AE }, { 38010, 9, 1, 0x3394 }, { 38019, 11, 1, 0x018D }, { 38030, 10, 1, 0xFF37 }, { 38040, 14, 1, 0x266B },
+        { 38054, 15, 1, 0xFB40 }, { 38069, 7, 1, 0x25C4 }, { 38076, 20, 1, 0xFC5F }, { 38096, 18, 1, 0x3273 }, { 38114, 8, 1, 0x0264 }, { 38122, 12, 1, 0xF7A2 },
+        { 38134, 3, 1, 0x00D0 }, { 38137, 8, 1, 0x2556 }, { 38145, 9, 1, 0x3107 }, { 38154, 10, 1, 0x0414 }, { 38164, 14, 2, 0x007A }, { 38178, 12, 1, 0x0194 },
+        { 38190, 3, 1, 0x03A1 }, { 38193, 7, 1, 0x0111 }, { 38200, 11, 1, 0x2203 }, { 38211, 8, 1, 0x2569 }, { 38219, 5, 1, 0x2302 }, { 38224, 21, 1, 0x0338 },
+        { 38245, 9, 1, 0x09B8 }, { 38254, 10, 1, 0x0017 }, { 38264, 15, 1, 0xFEC4 }, { 38279, 6, 1, 0xF6DD }, { 38285, 9, 1, 0x064A }, { 38294, 15, 1, 0x1E64 },
+        { 38309, 8, 1, 0x2567 }, { 38317, 9, 1, 0x1E88 }, { 38326, 9, 1, 0x05F1 }, { 38335, 10, 1, 0x30FA }, { 38345, 25, 1, 0x09C4 }, { 38370, 9, 1, 0x05E4 },
+        { 38379, 8, 1, 0x098F }, { 38387, 7, 1, 0x24D6 }, { 38394, 24, 1, 0x323F }, { 38418, 20, 1, 0x300B }, { 38438, 8, 1, 0x339D }, { 38446, 13, 1, 0x0313 },
+        { 38459, 18, 1, 0xFB41 }, { 38477, 9, 1, 0x0679 }, { 38486, 13, 1, 0x0151 }, { 38499, 9, 1, 0x0475 }, { 38508, 6, 1, 0x00FA }, { 38514, 16, 2, 0x007C },
+        { 38530, 5, 1, 0x2641 }, { 38535, 10, 1, 0x30DF }, { 38545, 10, 1, 0x1E8E }, { 38555, 10, 1, 0xFF4C }, { 38565, 10, 1, 0xFF2B }, { 38575, 9, 1, 0x1E26 },
+        { 38584, 7, 1, 0x01BA }, { 38591, 18, 1, 0xFF72 }, { 38609, 25, 1, 0x09E3 }, { 38634, 6, 1, 0xF768 }, { 38640, 25, 1, 0xFE88 }, { 38665, 23, 1, 0xF894 },
+        { 38688, 12, 1, 0x1E51 }, { 38700, 4, 1, 0x0035 }, { 38704, 20, 1, 0x031C }, { 38724, 5, 1, 0x01A0 }, { 38729, 12, 1, 0x0E18 }, { 38741, 16, 1, 0xF899 },
+        { 38757, 15, 1, 0x0A83 }, { 38772, 10, 1, 0xFF43 }, { 38782, 10, 1, 0x30CD }, { 38792, 9, 1, 0x0E23 }, { 38801, 13, 1, 0x0AEE }, { 38814, 12, 1, 0x2282 },
+        { 38826, 23, 1, 0x30FE }, { 38849, 25, 1, 0x25BC }, { 38874, 9, 1, 0x096E }, { 38883, 9, 1, 0x05D8 }, { 38892, 11, 1, 0x027B }, { 38903, 13, 1, 0xF8FD },
+        { 38916, 10, 1, 0x062C }, { 38926, 12, 1, 0x33B9 }, { 38938, 5, 1, 0x2207 }, { 38943, 9, 1, 0x05D5 }, { 38952, 18, 1, 0x3262 }, { 38970, 17, 1, 0x0491 },
+        { 38987, 6, 1, 0x1EBD }, { 38993, 13, 1, 0x2266 }, { 39006, 10, 1, 0x1E34 }, { 39016, 7, 1, 0x24D4 }, { 39023, 15, 1, 0x03D0 }, { 39038, 2, 1, 0x00E6 },
+        { 39040, 15, 1, 0x1EB3 }, { 39055, 8, 1, 0x0965 }, { 39063, 6, 1, 0x01D4 }, { 39069, 16, 2, 0x007E }, { 39085, 18, 1, 0x3168 }, { 39103, 20, 1, 0x266C },
+        { 39123, 13, 1, 0x02DE }, { 39136, 9, 1, 0x0438 }, { 39145, 7, 1, 0x24DA }, { 39152, 16, 1, 0x316E }, { 39168, 13, 1, 0x1E09 }, { 39181, 9, 1, 0x0E13 },
+        { 39190, 13, 1, 0x0AE9 }, { 39203, 11, 1, 0xF8EB }, { 39214, 10, 1, 0x3389 }, { 39224, 24, 1, 0xFF6E }, { 39248, 11, 1, 0x00B9 }, { 39259, 20, 1, 0x322B },
+        { 39279, 9, 1, 0xFE62 }, { 39288, 7, 1, 0x24DB }, { 39295, 13, 1, 0x03D6 }, { 39308, 17, 1, 0x05B4 }, { 39325, 16, 1, 0xFEF3 }, { 39341, 10, 1, 0x0407 },
+        { 39351, 10, 1, 0x09E7 }, { 39361, 9, 1, 0x0456 }, { 39370, 19, 1, 0x0946 }, { 39389, 6, 1, 0x0915 }, { 39395, 8, 1, 0x2474 }, { 39403, 10, 1, 0x1EE0 },
+        { 39413, 4, 1, 0x20AC }, { 39417, 9, 1, 0x044C }, { 39426, 10, 1, 0x2321 }, { 39436, 16, 1, 0x1E76 }, { 39452, 6, 1, 0x2282 }, { 39458, 22, 1, 0x02B6 },
+        { 39480, 11, 1, 0xF7F3 }, { 39491, 9, 1, 0x0988 }, { 39500, 12, 1, 0x05F1 }, { 39512, 17, 1, 0xFC61 }, { 39529, 10, 1, 0x0A06 }, { 39539, 8, 1, 0xF6D1 },
+        { 39547, 10, 1, 0x0A0F }, { 39557, 10, 1, 0x0A95 }, { 39567, 9, 1, 0x2469 }, { 39576, 10, 1, 0x0534 }, { 39586, 10, 1, 0x0A90 }, { 39596, 13, 1, 0x0662 },
+        { 39609, 7, 1, 0x00BD }, { 39616, 14, 1, 0x064E }, { 39630, 19, 1, 0x3217 }, { 39649, 10, 1, 0x3053 }, { 39659, 15, 2, 0x0080 }, { 39674, 10, 1, 0x3066 },
+        { 39684, 10, 1, 0x0633 }, { 39694, 10, 1, 0x03E6 }, { 39704, 7, 1, 0x2666 }, { 39711, 9, 1, 0x0426 }, { 39720, 17, 1, 0x3215 }, { 39737, 16, 1, 0x3001 },
+        { 39753, 9, 1, 0x00E4 }, { 39762, 11, 1, 0x064E }, { 39773, 19, 1, 0x09D7 }, { 39792, 11, 1, 0x0663 }, { 39803, 6, 1, 0x25CF }, { 39809, 8, 1, 0x00A8 },
+        { 39817, 8, 1, 0x003F }, { 39825, 10, 1, 0x0AAE }, { 39835, 6, 1, 0xF777 }, { 39841, 10, 1, 0xFF2C }, { 39851, 16, 1, 0x313C }, { 39867, 13, 1, 0x0E47 },
+        { 39880, 9, 1, 0x0420 }, { 39889, 25, 1, 0x25A3 }, { 39914, 6, 1, 0x2200 }, { 39920, 8, 1, 0x0E59 }, { 39928, 11, 1, 0xFB36 }, { 39939, 14, 1, 0x033F },
+        { 39953, 20, 1, 0x327A }, { 39973, 8, 1, 0x013C }, { 39981, 10, 1, 0x3086 }, { 39991, 19, 1, 0x0499 }, { 40010, 20, 1, 0x0336 }, { 40030, 10, 1, 0x3057 },
+        { 40040, 13, 1, 0x0592 }, { 40053, 11, 1, 0x2118 }, { 40064, 5, 1, 0x01B3 }, { 40069, 13, 1, 0x2486 }, { 40082, 8, 1, 0x255D }, { 40090, 10, 1, 0x0433 },
+        { 40100, 8, 1, 0x2044 }, { 40108, 21, 1, 0x04DB }, { 40129, 9, 1, 0x0459 }, { 40138, 1, 1, 0x0044 }, { 40139, 20, 1, 0x328E }, { 40159, 9, 1, 0x042B },
+        { 40168, 17, 1, 0xF88F }, { 40185, 9, 1, 0x0A85 }, { 40194, 14, 1, 0xF7EF }, { 40208, 10, 1, 0x1E94 }, { 40218, 10, 2, 0x0082 }, { 40228, 6, 1, 0x0159 },
+        { 40234, 12, 1, 0x053C }, { 40246, 16, 1, 0x1EAB }, { 40262, 9, 1, 0x0624 }, { 40271, 22, 1, 0x25E3 }, { 40293, 13, 1, 0x2199 }, { 40306, 12, 1, 0x3025 },
+        { 40318, 13, 1, 0x04A4 }, { 40331, 18, 1, 0xFF5B }, { 40349, 7, 1, 0x24E8 }, { 40356, 6, 1, 0xF6D0 }, { 40362, 27, 1, 0xFBA4 }, { 40389, 8, 1, 0x05BB },
+        { 40397, 15, 1, 0x0A40 }, { 40412, 18, 1, 0x09C0 }, { 40430, 8, 1, 0x33DC }, { 40438, 10, 1, 0x1EE7 }, { 40448, 11, 1, 0x045C }, { 40459, 10, 1, 0x1EBA },
+        { 40469, 25, 1, 0x04B8 }, { 40494, 5, 1, 0x00DE }, { 40499, 4, 1, 0x010B }, { 40503, 20, 1, 0x3234 }, { 40523, 11, 1, 0x1E75 }, { 40534, 18, 1, 0x05B4 },
+        { 40552, 14, 1, 0x00BB }, { 40566, 8, 1, 0x00D7 }, { 40574, 11, 1, 0x0426 }, { 40585, 14, 1, 0x2471 }, { 40599, 7, 1, 0x24D3 }, { 40606, 8, 1, 0x338B },
+        { 40614, 10, 1, 0x041C }, { 40624, 9, 1, 0x311B }, { 40633, 9, 1, 0x05D4 }, { 40642, 18, 1, 0x3260 }, { 40660, 17, 1, 0xFB33 }, { 40677, 11, 1, 0x2297 },
+        { 40688, 14, 1, 0x01D8 }, { 40702, 8, 1, 0x3153 }, { 40710, 14, 1, 0xFE5B }, { 40724, 8, 1, 0x33B1 }, { 40732, 11, 1, 0x2285 }, { 40743, 6, 1, 0xF779 },
+        { 40749, 10, 1, 0x0571 }, { 40759, 18, 1, 0xFF3C }, { 40777, 15, 1, 0xFF04 }, { 40792, 13, 1, 0x246F }, { 40805, 11, 1, 0x00EA }, { 40816, 25, 1, 0x0468 },
+        { 40841, 16, 1, 0x3143 }, { 40857, 16, 1, 0xFECE }, { 40873, 26, 1, 0x3016 }, { 40899, 9, 1, 0x248D }, { 40908, 10, 1, 0x2103 }, { 40918, 20, 1, 0xFF3B },
+        { 40938, 19, 1, 0x04F4 }, { 40957, 8, 1, 0x33B5 }, { 40965, 16, 1, 0x02BD }, { 40981, 9, 1, 0x3111 }, { 40990, 10, 1, 0xFF23 }, { 41000, 9, 1, 0x067E },
+        { 41009, 2, 1, 0x03A0 }, { 41011, 12, 1, 0x04BA }, { 41023, 9, 1, 0x1EF5 }, { 41032, 9, 1, 0x00FC }, { 41041, 6, 1, 0x24AB }, { 41047, 11, 1, 0x2462 },
+        { 41058, 6, 1, 0x1E31 }, { 41064, 10, 1, 0x306A }, { 41074, 7, 1, 0x24C9 }, { 41081, 9, 1, 0x0209 }, { 41090, 19, 1, 0x33A8 }, { 41109, 19, 1, 0x04AC },
+        { 41128, 2, 1, 0xF6C0 }, { 41130, 15, 1, 0x06C1 }, { 41145, 7, 1, 0x24BD }, { 41152, 9, 1, 0x3155 }, { 41161, 6, 1, 0x2033 }, { 41167, 20, 1, 0xFF07 },
+        { 41187, 9, 1, 0x0300 }, { 41196, 10, 1, 0x0E25 }, { 41206, 26, 1, 0x3010 }, { 41232, 9, 1, 0x044E }, { 41241, 15, 1, 0x01AA }, { 41256, 10, 1, 0x0451 },
+        { 41266, 20, 1, 0x0622 }, { 41286, 25, 1, 0x25BD }, { 41311, 29, 1, 0xFE5D }, { 41340, 13, 1, 0x0A69 }, { 41353, 10, 1, 0xFF45 }, { 41363, 16, 1, 0x1ED2 },
+        { 41379, 2, 1, 0xFB01 }, { 41381, 24, 1, 0xFE8A }, { 41405, 11, 1, 0x0308 }, { 41416, 11, 1, 0x1EB0 }, { 41427, 15, 1, 0x093E }, { 41442, 15, 1, 0x05B9 },
+        { 41457, 15, 1, 0x0A4B }, { 41472, 6, 1, 0x24B5 }, { 41478, 6, 1, 0x014E }, { 41484, 10, 1, 0x306B }, { 41494, 4, 1, 0x20A4 }, { 41498, 9, 1, 0x064D },
+        { 41507, 7, 1, 0x05B5 }, { 41514, 10, 1, 0x0664 }, { 41524, 12, 1, 0x01C1 }, { 41536, 14, 1, 0x03F1 }, { 41550, 7, 1, 0x262F }, { 41557, 5, 1, 0x00C5 },
+        { 41562, 17, 1, 0x05B5 }, { 41579, 1, 1, 0x0075 }, { 41580, 9, 1, 0x1ECB }, { 41589, 19, 4, 0x0084 }, { 41608, 15, 1, 0xFB67 }, { 41623, 16, 1, 0x0629 },
+        { 41639, 19, 1, 0xFF93 }, { 41658, 5, 1, 0x0909 }, { 41663, 10, 1, 0x0A2A }, { 41673, 11, 1, 0x0A6C }, { 41684, 13, 1, 0x0A70 }, { 41697, 19, 1, 0x04AB },
+        { 41716, 19, 1, 0x3178 }, { 41735, 9, 1, 0xF6ED }, { 41744, 10, 1, 0x029B }, { 41754, 11, 1, 0x0A9F }, { 41765, 17, 1, 0x201B }, { 41782, 16, 1, 0x3205 },
+        { 41798, 8, 1, 0x0E1D }, { 41806, 6, 1, 0x00ED }, { 41812, 2, 1, 0x039C }, { 41814, 8, 1, 0x00A4 }, { 41822, 6, 1, 0x0917 }, { 41828, 3, 1, 0x05D5 },
+        { 41831, 8, 1, 0x0985 }, { 41839, 13, 1, 0x0252 }, { 41852, 23, 1, 0x25D0 }, { 41875, 9, 1, 0x042A }, { 41884, 15, 2, 0x0088 }, { 41899, 18, 1, 0x05AF },
+        { 41917, 12, 1, 0x21E4 }, { 41929, 2, 1, 0x00C6 }, { 41931, 9, 1, 0x2174 }, { 41940, 15, 1, 0x04D6 }, { 41955, 12, 1, 0x0AEF }, { 41967, 5, 1, 0x05B4 },
+        { 41972, 15, 1, 0x05B0 }, { 41987, 9, 1, 0x1E42 }, { 41996, 7, 1, 0x24D2 }, { 42003, 14, 1, 0xF6F7 }, { 42017, 10, 1, 0x02C6 }, { 42027, 9, 1, 0x0448 },
+        { 42036, 22, 1, 0x0361 }, { 42058, 9, 1, 0x00CF }, { 42067, 9, 1, 0x0406 }, { 42076, 13, 1, 0x2088 }, { 42089, 6, 1, 0x249D }, { 42095, 10, 1, 0x2227 },
+        { 42105, 17, 1, 0x309D }, { 42122, 1, 1, 0x004E }, { 42123, 15, 1, 0x0A42 }, { 42138, 10, 1, 0x0548 }, { 42148, 6, 1, 0x00B7 }, { 42154, 16, 1, 0x3133 },
+        { 42170, 19, 1, 0x326C }, { 42189, 9, 1, 0x05E2 }, { 42198, 14, 1, 0xFEEE }, { 42212, 10, 1, 0x3122 }, { 42222, 15, 1, 0x3336 }, { 42237, 11, 1, 0x0452 },
+        { 42248, 10, 1, 0x0A1C }, { 42258, 1, 1, 0x0063 }, { 42259, 14, 1, 0x046B }, { 42273, 8, 1, 0x301C }, { 42281, 10, 1, 0x0422 }, { 42291, 13, 1, 0x2480 },
+        { 42304, 5, 1, 0x03BA }, { 42309, 12, 1, 0x3318 }, { 42321, 17, 1, 0x025D }, { 42338, 14, 1, 0x020A }, { 42352, 14, 1, 0x020B }, { 42366, 10, 1, 0x094D },
+        { 42376, 17, 1, 0xFB3C }, { 42393, 6, 1, 0x01D2 }, { 42399, 22, 1, 0x25E4 }, { 42421, 10, 1, 0x0E0D }, { 42431, 14, 1, 0x1E4E }, { 42445, 15, 1, 0xFB3B },
+        { 42460, 15, 1, 0xFB2E }, { 42475, 17, 1, 0x2279 }, { 42492, 9, 1, 0x064C }, { 42501, 9, 1, 0x09B9 }, { 42510, 12, 1, 0x057B }, { 42522, 10, 1, 0x2476 },
+        { 42532, 8, 1, 0x33DD }, { 42540, 14, 1, 0xFEDE }, { 42554, 9, 1, 0x2605 }, { 42563, 12, 1, 0x038E }, { 42575, 13, 1, 0x314D }, { 42588, 6, 1, 0x092C },
+        { 42594, 14, 1, 0x2665 }, { 42608, 14, 1, 0xF6E4 }, { 42622, 10, 1, 0x05E2 }, { 42632, 15, 1, 0x0982 }, { 42647, 10, 1, 0x30F8 }, { 42657, 1, 1, 0x0050 },
+        { 42658, 12, 1, 0x215E }, { 42670, 11, 1, 0x0149 }, { 42681, 8, 1, 0x2510 }, { 42689, 6, 1, 0xF766 }, { 42695, 10, 1, 0x30CF }, { 42705, 20, 1, 0x3228 },
+        { 42725, 15, 2, 0x008A }, { 42740, 14, 1, 0x2484 }, { 42754, 9, 1, 0x0445 }, { 42763, 10, 1, 0x3060 }, { 42773, 9, 1, 0x05EA }, { 42782, 6, 1, 0x00D5 },
+        { 42788, 14, 1, 0x0213 }, { 42802, 4, 1, 0x00A2 }, { 42806, 10, 1, 0x0E4A }, { 42816, 20, 1, 0x066D }, { 42836, 11, 1, 0x1E90 }, { 42847, 11, 1, 0x0574 },
+        { 42858, 32, 1, 0xFE39 }, { 42890, 18, 1, 0xFF9D }, { 42908, 9, 1, 0x0636 }, { 42917, 11, 1, 0x00AA }, { 42928, 11, 1, 0x060C }, { 42939, 11, 1, 0x040C },
+        { 42950, 10, 1, 0xFF2D }, { 42960, 11, 1, 0x0584 }, { 42971, 12, 1, 0x0AEB }, { 42983, 9, 1, 0x3042 }, { 42992, 5, 1, 0x0398 }, { 42997, 1, 1, 0x0048 },
+        { 42998, 22, 3, 0x008C }, { 43020, 11, 1, 0x25CF }, { 43031, 17, 1, 0x05B3 }, { 43048, 15, 1, 0x04E8 }, { 43063, 14, 1, 0x30A9 }, { 43077, 4, 1, 0x0167 },
+        { 43081, 21, 1, 0x3227 }, { 43102, 22, 1, 0x02C1 }, { 43124, 7, 1, 0x05B9 }, { 43131, 18, 1, 0xFF73 }, { 43149, 10, 1, 0x2490 }, { 43159, 15, 1, 0x317E },
+        { 43174, 4, 1, 0x010A }, { 43178, 7, 1, 0x24C4 }, { 43185, 7, 1, 0x24E4 }, { 43192, 17, 1, 0xFE37 }, { 43209, 11, 1, 0x0A1D }, { 43220, 6, 1, 0x24AF },
+        { 43226, 7, 1, 0x0E51 }, { 43233, 5, 1, 0x0033 }, { 43238, 10, 1, 0x0A24 }, { 43248, 9, 1, 0x0625 }, { 43257, 8, 1, 0x2557 }, { 43265, 8, 1, 0x02B9 },
+        { 43273, 11, 1, 0x05B3 }, { 43284, 10, 1, 0x307E }, { 43294, 9, 1, 0x0645 }, { 43303, 10, 1, 0x041A }, { 43313, 10, 1, 0x1E48 }, { 43323, 24, 1, 0x0486 },
+        { 43347, 19, 1, 0x328B }, { 43366, 11, 1, 0x0634 }, { 43377, 21, 1, 0xFC0E }, { 43398, 20, 1, 0x328F }, { 43418, 15, 1, 0x33A2 }, { 43433, 16, 1, 0x313B },
+        { 43449, 19, 1, 0x1EAD }, { 43468, 17, 1, 0x208D }, { 43485, 20, 1, 0xFCDD }, { 43505, 7, 1, 0x24B8 }, { 43512, 20, 1, 0x055B }, { 43532, 17, 1, 0xFEE7 },
+        { 43549, 9, 1, 0x1EB9 }, { 43558, 11, 1, 0x3021 }, { 43569, 9, 1, 0x03E5 }, { 43578, 11, 1, 0x0A99 }, { 43589, 10, 1, 0x304C }, { 43599, 28, 1, 0xFEF8 },
+        { 43627, 7, 1, 0x0967 }, { 43634, 30, 1, 0x3019 }, { 43664, 11, 1, 0x0544 }, { 43675, 7, 1, 0x263C }, { 43682, 10, 2, 0x008F }, { 43692, 6, 1, 0x24B2 },
+        { 43698, 7, 1, 0x24C5 }, { 43705, 9, 1, 0x02BC }, { 43714, 9, 1, 0x0457 }, { 43723, 9, 1, 0x1E24 }, { 43732, 7, 1, 0x0268 }, { 43739, 8, 1, 0x2026 },
+        { 43747, 8, 1, 0x220B }, { 43755, 9, 1, 0x0201 }, { 43764, 11, 1, 0x05A8 }, { 43775, 10, 1, 0x0457 }, { 43785, 10, 1, 0xFF51 }, { 43795, 11, 1, 0x3148 },
+        { 43806, 5, 1, 0x05B9 }, { 43811, 31, 1, 0xFE44 }, { 43842, 23, 1, 0x261E }, { 43865, 30, 1, 0x25C3 }, { 43895, 14, 1, 0xFF17 }, { 43909, 9, 1, 0x2163 },
+        { 43918, 8, 1, 0x256A }, { 43926, 7, 1, 0x0286 }, { 43933, 10, 1, 0x0A5E }, { 43943, 3, 1, 0x0031 }, { 43946, 9, 1, 0x041F }, { 43955, 13, 1, 0x201B },
+        { 43968, 7, 1, 0x019C }, { 43975, 21, 1, 0x01BE }, { 43996, 9, 1, 0x0451 }, { 44005, 12, 1, 0xFF12 }, { 44017, 9, 1, 0x0E40 }, { 44026, 9, 1, 0x0637 },
+        { 44035, 4, 1, 0x0392 }, { 44039, 8, 1, 0x0306 }, { 44047, 10, 1, 0x1EEF }, { 44057, 15, 1, 0x0A3E }, { 44072, 10, 1, 0x057C }, { 44082, 9, 1, 0x0686 },
+        { 44091, 11, 1, 0x0554 }, { 44102, 10, 1, 0x3121 }, { 44112, 9, 1, 0x3152 }, { 44121, 16, 1, 0x228B }, { 44137, 11, 1, 0x05A3 }, { 44148, 13, 1, 0x2015 },
+        { 44161, 16, 1, 0xFED3 }, { 44177, 14, 1, 0x093F }, { 44191, 16, 1, 0x1EBF }, { 44207, 11, 1, 0x090D }, { 44218, 9, 1, 0x0301 }, { 44227, 6, 1, 0xF761 },
+        { 44233, 17, 1, 0x3200 }, { 44250, 9, 1, 0x2194 }, { 44259, 10, 1, 0x1E56 }, { 44269, 7, 1, 0x091D }, { 44276, 9, 1, 0x000E }, { 44285, 21, 1, 0x04F2 },
+        { 44306, 7, 1, 0x016B }, { 44313, 8, 1, 0x0E19 }, { 44321, 18, 1, 0x09C2 }, { 44339, 10, 1, 0x0A13 }, { 44349, 22, 1, 0x261F }, { 44371, 15, 1, 0x3083 },
+        { 44386, 4, 1, 0x05E8 }, { 44390, 10, 1, 0x0999 }, { 44400, 18, 1, 0xFB7C }, { 44418, 7, 1, 0x22C5 }, { 44425, 10, 1, 0x1E8F }, { 44435, 10, 1, 0x305B },
+        { 44445, 10, 1, 0x1E1F }, { 44455, 17, 1, 0x04F1 }, { 44472, 9, 1, 0x0646 }, { 44481, 2, 1, 0x01F3 }, { 44483, 9, 1, 0x0208 }, { 44492, 14, 1, 0x045E },
+        { 44506, 2, 1, 0x03BD }, { 44508, 12, 1, 0x0218 }, { 44520, 13, 1, 0x02E0 }, { 44533, 17, 1, 0x3274 }, { 44550, 15, 1, 0x04D7 }, { 44565, 7, 1, 0x24E7 },
+        { 44572, 9, 2, 0x0091 }, { 44581, 10, 1, 0x0435 }, { 44591, 5, 1, 0x039A }, { 44596, 20, 1, 0x327F }, { 44616, 12, 1, 0x03AA }, { 44628, 10, 1, 0xFF29 },
+        { 44638, 15, 1, 0x316F }, { 44653, 24, 1, 0xFF6D }, { 44677, 7, 1, 0x0100 }, { 44684, 21, 1, 0x04DA }, { 44705, 7, 1, 0x2591 }, { 44712, 9, 1, 0x03EE },
+        { 44721, 5, 1, 0x2220 }, { 44726, 21, 1, 0xFCD2 }, { 44747, 9, 1, 0x044B }, { 44756, 10, 1, 0x3342 }, { 44766, 16, 1, 0x1EA7 }, { 44782, 7, 1, 0x03A5 },
+        { 44789, 7, 1, 0x05B7 }, { 44796, 21, 1, 0x05B8 }, { 44817, 19, 1, 0x326E }, { 44836, 19, 1, 0x21CF }, { 44855, 17, 1, 0x04D3 }, { 44872, 14, 1, 0x5344 },
+        { 44886, 16, 1, 0xFE9C }, { 44902, 10, 1, 0xFF32 }, { 44912, 4, 1, 0x03D5 }, { 44916, 14, 1, 0xF7EB }, { 44930, 18, 1, 0x04DE }, { 44948, 9, 1, 0x2206 },
+        { 44957, 11, 1, 0x3357 }, { 44968, 14, 1, 0xF7E4 }, { 44982, 11, 2, 0x0093 }, { 44993, 13, 1, 0x22BF }, { 45006, 14, 1, 0x1E73 }, { 45020, 11, 1, 0x0E37 },
+        { 45031, 14, 1, 0x027A }, { 45045, 12, 1, 0x249B }, { 45057, 11, 1, 0x222C }, { 45068, 10, 1, 0x306F }, { 45078, 9, 1, 0x05E7 }, { 45087, 24, 1, 0xFF6F },
+        { 45111, 9, 1, 0x0431 }, { 45120, 7, 1, 0x05B4 }, { 45127, 9, 1, 0x0456 }, { 45136, 10, 1, 0x226F }, { 45146, 6, 1, 0x20A7 }, { 45152, 9, 1, 0xF6F0 },
+        { 45161, 14, 1, 0x0669 }, { 45175, 16, 1, 0xFB7B }, { 45191, 14, 1, 0x0589 }, { 45205, 18, 1, 0xFF74 }, { 45223, 24, 3, 0x0095 }, { 45247, 17, 1, 0x0390 },
+        { 45264, 8, 1, 0x03AE }, { 45272, 6, 1, 0x0102 }, { 45278, 22, 1, 0x0337 }, { 45300, 19, 1, 0x3171 }, { 45319, 8, 1, 0x1E29 }, { 45327, 11, 1, 0x1E78 },
+        { 45338, 19, 1, 0x04A2 }, { 45357, 9, 1, 0x0E34 }, { 45366, 23, 1, 0x25E2 }, { 45389, 10, 1, 0x30D3 }, { 45399, 9, 1, 0x2116 }, { 45408, 9, 1, 0x25D9 },
+        { 45417, 12, 1, 0x0573 }, { 45429, 10, 1, 0x0424 }, { 45439, 15, 1, 0x0948 }, { 45454, 9, 1, 0x0425 }, { 45463, 9, 1, 0x0A8F }, { 45472, 10, 1, 0xFF27 },
+        { 45482, 9, 1, 0xF6F2 }, { 45491, 10, 1, 0x2295 }, { 45501, 11, 1, 0x00D4 }, { 45512, 11, 1, 0x00E2 }, { 45523, 7, 1, 0x24B9 }, { 45530, 16, 1, 0x09F2 },
+        { 45546, 12, 1, 0x03DC }, { 45558, 6, 1, 0x00F7 }, { 45564, 10, 1, 0x247A }, { 45574, 10, 1, 0x3075 }, { 45584, 8, 1, 0x33C3 }, { 45592, 9, 1, 0x000C },
+        { 45601, 12, 1, 0x0902 }, { 45613, 8, 1, 0x315A }, { 45621, 7, 1, 0x24E3 }, { 45628, 9, 1, 0x00DC }, { 45637, 7, 1, 0x25C9 }, { 45644, 10, 1, 0x2192 },
+        { 45654, 9, 1, 0x0634 }, { 45663, 9, 1, 0x2713 }, { 45672, 17, 1, 0x05B9 }, { 45689, 7, 1, 0x0265 }, { 45696, 20, 1, 0x1EC3 }, { 45716, 10, 1, 0x3082 },
+        { 45726, 9, 1, 0x3003 }, { 45735, 9, 1, 0x05D9 }, { 45744, 8, 1, 0x22A4 }, { 45752, 9, 2, 0x0098 }, { 45761, 8, 1, 0x030C }, { 45769, 10, 1, 0x30B6 },
+        { 45779, 10, 1, 0x1E87 }, { 45789, 5, 1, 0x0391 }, { 45794, 10, 1, 0x30DE }, { 45804, 7, 1, 0x018C }, { 45811, 4, 1, 0x019A }, { 45815, 17, 1, 0x3212 },
+        { 45832, 6, 1, 0xF762 }, { 45838, 14, 1, 0xF7FC }, { 45852, 10, 1, 0xF6F5 }, { 45862, 10, 1, 0x09B6 }, { 45872, 18, 1, 0x047C }, { 45890, 19, 1, 0x04DC },
+        { 45909, 26, 1, 0x278E }, { 45935, 4, 1, 0x0130 }, { 45939, 10, 1, 0x041B }, { 45949, 9, 1, 0x00C4 }, { 45958, 20, 1, 0x04BD }, { 45978, 10, 1, 0x0E27 },
+        { 45988, 13, 1, 0x1E1C }, { 46001, 18, 1, 0xFEFC }, { 46019, 17, 1, 0xF88B }, { 46036, 9, 1, 0x05E5 }, { 46045, 11, 1, 0x057D }, { 46056, 21, 1, 0x05B3 },
+        { 46077, 10, 2, 0x009A }, { 46087, 6, 1, 0x00F8 }, { 46093, 5, 1, 0x0256 }, { 46098, 7, 1, 0x0101 }, { 46105, 25, 1, 0x25BA }, { 46130, 19, 1, 0xFF3F },
+        { 46149, 11, 1, 0x0E08 }, { 46160, 21, 1, 0x3222 }, { 46181, 10, 1, 0x0AB2 }, { 46191, 21, 1, 0xFBA9 }, { 46212, 10, 1, 0x3090 }, { 46222, 10, 1, 0x3145 },
+        { 46232, 10, 1, 0x1E3A }, { 46242, 14, 1, 0x01DC }, { 46256, 17, 1, 0x042D }, { 46273, 10, 1, 0x1E49 }, { 46283, 12, 1, 0xFFE5 }, { 46295, 12, 1, 0x33A7 },
+        { 46307, 14, 1, 0x040E }, { 46321, 10, 1, 0x3303 }, { 46331, 6, 1, 0x0110 }, { 46337, 6, 1, 0x00D3 }, { 46343, 12, 1, 0x2085 }, { 46355, 13, 1, 0x04B4 },
+        { 46368, 13, 1, 0x0309 }, { 46381, 6, 1, 0xF76C }, { 46387, 12, 1, 0x0596 }, { 46399, 20, 1, 0x3224 }, { 46419, 10, 1, 0x3091 }, { 46429, 7, 1, 0x096C },
+        { 46436, 11, 1, 0x011C }, { 46447, 11, 1, 0x0AE8 }, { 46458, 16, 1, 0x05B8 }, { 46474, 6, 1, 0x0158 }, { 46480, 7, 1, 0x0936 }, { 46487, 10, 1, 0x2012 },
+        { 46497, 14, 1, 0x1EDF }, { 46511, 10, 1, 0x0A14 }, { 46521, 11, 1, 0xFB35 }, { 46532, 9, 1, 0x0E2B }, { 46541, 9, 1, 0x1EE4 }, { 46550, 7, 1, 0x05B7 },
+        { 46557, 11, 1, 0x2202 }, { 46568, 8, 1, 0x33C7 }, { 46576, 9, 1, 0x3048 }, { 46585, 10, 1, 0xFF4B }, { 46595, 16, 1, 0xF88C }, { 46611, 11, 1, 0x0AA7 },
+        { 46622, 16, 1, 0x0374 }, { 46638, 12, 1, 0x05BC }, { 46650, 14, 1, 0x3047 }, { 46664, 18, 1, 0xFE36 }, { 46682, 9, 1, 0x05D8 }, { 46691, 4, 1, 0x0127 },
+        { 46695, 11, 1, 0x314E }, { 46706, 11, 1, 0x01FF }, { 46717, 15, 1, 0x1E38 }, { 46732, 12, 1, 0x0156 }, { 46744, 6, 1, 0x24A1 }, { 46750, 15, 1, 0xFEC8 },
+        { 46765, 19, 1, 0x0342 }, { 46784, 11, 1, 0x09A0 }, { 46795, 10, 1, 0x30BA }, { 46805, 16, 1, 0x042A }, { 46821, 9, 1, 0x200C }, { 46830, 21, 1, 0x0339 },
+        { 46851, 16, 1, 0xFED7 }, { 46867, 14, 2, 0x009C }, { 46881, 19, 1, 0x1EC6 }, { 46900, 13, 1, 0x21E5 }, { 46913, 14, 1, 0xFF0C }, { 46927, 9, 1, 0x2477 },
+        { 46936, 10, 1, 0x232A }, { 46946, 6, 1, 0x0906 }, { 46952, 8, 1, 0x224C }, { 46960, 13, 1, 0x05B3 }, { 46973, 9, 1, 0x040A }, { 46982, 23, 1, 0xFDF2 },
+        { 47005, 10, 1, 0x305F }, { 47015, 9, 1, 0x20AA }, { 47024, 21, 1, 0x0335 }, { 47045, 6, 1, 0x24AC }, { 47051, 10, 1, 0x03A9 }, { 47061, 13, 1, 0x25D8 },
+        { 47074, 19, 1, 0x3225 }, { 47093, 9, 1, 0x1E36 }, { 47102, 3, 1, 0x01B7 }, { 47105, 12, 1, 0x0145 }, { 47117, 1, 1, 0x0069 }, { 47118, 16, 1, 0x00A0 },
+        { 47134, 9, 1, 0x33AB }, { 47143, 15, 1, 0xFED8 }, { 47158, 11, 1, 0x045A }, { 47169, 6, 1, 0x1EBC }, { 47175, 9, 1, 0x1E46 }, { 47184, 14, 1, 0x1EB6 },
+        { 47198, 18, 1, 0x0981 }, { 47216, 15, 1, 0x3063 }, { 47231, 6, 1, 0x01F0 }, { 47237, 10, 1, 0x0001 }, { 47247, 10, 1, 0x0010 }, { 47257, 8, 1, 0x255F },
+        { 47265, 7, 1, 0x01B5 }, { 47272, 13, 1, 0x266D }, { 47285, 26, 1, 0xFE8B }, { 47311, 15, 1, 0x3146 }, { 47326, 17, 1, 0x3268 }, { 47343, 14, 1, 0x1EED },
+        { 47357, 11, 1, 0x2086 }, { 47368, 16, 1, 0xFEE4 }, { 47384, 12, 1, 0x2262 }, { 47396, 10, 1, 0x30AC }, { 47406, 14, 1, 0xFE49 }, { 47420, 11, 1, 0x0174 },
+        { 47431, 12, 1, 0x0582 }, { 47443, 12, 1, 0x3164 }, { 47455, 10, 1, 0x2167 }, { 47465, 15, 1, 0x1E7A }, { 47480, 12, 1, 0x040B }, { 47492, 14, 1, 0xF886 },
+        { 47506, 39, 1, 0x25C8 }, { 47545, 12, 1, 0x0572 }, { 47557, 8, 1, 0x339C }, { 47565, 7, 1, 0x221A }, { 47572, 17, 1, 0x05B8 }, { 47589, 8, 1, 0x3383 },
+        { 47597, 12, 1, 0x0A6A }, { 47609, 20, 1, 0x04F8 }, { 47629, 11, 1, 0x0027 }, { 47640, 6, 1, 0xF764 }, { 47646, 10, 1, 0x30B0 }, { 47656, 9, 1, 0x0661 },
+        { 47665, 12, 1, 0x201E }, { 47677, 18, 1, 0xFC94 }, { 47695, 7, 1, 0x1E21 }, { 47702, 9, 1, 0x0408 }, { 47711, 11, 1, 0x0A36 }, { 47722, 6, 1, 0x017E },
+        { 47728, 10, 1, 0x0412 }, { 47738, 10, 1, 0x09DD }, { 47748, 11, 1, 0x0E0C }, { 47759, 11, 1, 0x03ED }, { 47770, 7, 1, 0xF6D5 }, { 47777, 6, 1, 0x011E },
+        { 47783, 6, 1, 0x0147 }, { 47789, 9, 1, 0x33D6 }, { 47798, 9, 1, 0x0402 }, { 47807, 17, 1, 0x3264 }, { 47824, 17, 1, 0x04E4 }, { 47841, 15, 1, 0xFB47 },
+        { 47856, 15, 1, 0x05A7 }, { 47871, 6, 1, 0x24A5 }, { 47877, 11, 1, 0x05A1 }, { 47888, 9, 1, 0x2211 }, { 47897, 19, 1, 0xFF83 }, { 47916, 9, 1, 0x05B3 },
+        { 47925, 20, 1, 0x0329 }, { 47945, 3, 1, 0x0397 }, { 47948, 9, 1, 0x0437 }, { 47957, 16, 2, 0x009E }, { 47973, 25, 1, 0xFE84 }, { 47998, 30, 1, 0xFE5E },
+        { 48028, 10, 1, 0x0E33 }, { 48038, 7, 1, 0x05B4 }, { 48045, 5, 1, 0x05D2 }, { 48050, 10, 1, 0x3051 }, { 48060, 10, 1, 0x0AA8 }, { 48070, 18, 1, 0xFF71 },
+        { 48088, 10, 1, 0x0394 }, { 48098, 11, 1, 0x25A1 }, { 48109, 10, 1, 0x0297 }, { 48119, 12, 1, 0x05B1 }, { 48131, 11, 1, 0x01B8 }, { 48142, 9, 1, 0x339B },
+        { 48151, 13, 1, 0x0150 }, { 48164, 1, 1, 0x0056 }, { 48165, 10, 1, 0x307B }, { 48175, 9, 1, 0xF6EF }, { 48184, 7, 1, 0x091B }, { 48191, 16, 1, 0x09F3 },
+        { 48207, 14, 1, 0xFF40 }, { 48221, 19, 1, 0xFF89 }, { 48240, 7, 1, 0x24D9 }, { 48247, 19, 1, 0x0624 }, { 48266, 25, 1, 0x25C1 }, { 48291, 10, 1, 0x0E28 },
+        { 48301, 10, 1, 0x30E2 }, { 48311, 5, 1, 0x0907 }, { 48316, 8, 1, 0x0966 }, { 48324, 9, 1, 0x0410 }, { 48333, 11, 2, 0x00A0 }, { 48344, 14, 1, 0xFB93 },
+        { 48358, 11, 1, 0x331E }, { 48369, 8, 1, 0x0987 }, { 48377, 29, 1, 0x04BE }, { 48406, 9, 1, 0x09A8 }, { 48415, 17, 1, 0x313A }, { 48432, 9, 1, 0x33AC },
+        { 48441, 9, 1, 0x02B2 }, { 48450, 17, 1, 0x02A1 }, { 48467, 15, 1, 0xFB39 }, { 48482, 17, 1, 0xFB36 }, { 48499, 21, 1, 0x301D }, { 48520, 18, 1, 0x25A5 },
+        { 48538, 5, 1, 0x0188 }, { 48543, 12, 1, 0xF739 }, { 48555, 16, 1, 0xFEC7 }, { 48571, 20, 1, 0x09F7 }, { 48591, 6, 1, 0x25CB }, { 48597, 16, 1, 0xF7FB },
+        { 48613, 9, 1, 0x2489 }, { 48622, 9, 1, 0x25A0 }, { 48631, 11, 1, 0xFE69 }, { 48642, 10, 1, 0x1E58 }, { 48652, 16, 2, 0x00A2 }, { 48668, 8, 1, 0x33CD },
+        { 48676, 12, 1, 0x0599 }, { 48688, 11, 1, 0x0A19 }, { 48699, 15, 1, 0xFEC0 }, { 48714, 10, 1, 0x0951 }, { 48724, 23, 1, 0x25B2 }, { 48747, 12, 1, 0x246B },
+        { 48759, 7, 1, 0x0919 }, { 48766, 19, 2, 0x00A4 }, { 48785, 10, 1, 0x3067 }, { 48795, 16, 1, 0x059F }, { 48811, 8, 1, 0x096A }, { 48819, 9, 1, 0x0660 },
+        { 48828, 9, 1, 0x1E32 }, { 48837, 15, 1, 0xFF0D }, { 48852, 5, 1, 0x016E }, { 48857, 16, 1, 0xFF1E }, { 48873, 7, 1, 0x012E }, { 48880, 10, 1, 0x30B2 },
+        { 48890, 10, 1, 0x3081 }, { 48900, 12, 1, 0x0AE6 }, { 48912, 26, 1, 0x25B7 }, { 48938, 15, 1, 0x03AB }, { 48953, 13, 1, 0x22A5 }, { 48966, 15, 1, 0x339F },
+        { 48981, 15, 1, 0x0474 }, { 48996, 10, 1, 0x30E9 }, { 49006, 24, 1, 0x066C }, { 49030, 9, 1, 0x042E }, { 49039, 10, 1, 0x30D8 }, { 49049, 6, 1, 0x092F },
+        { 49055, 11, 1, 0x216B }, { 49066, 11, 1, 0x053A }, { 49077, 15, 2, 0x00A6 }, { 49092, 9, 1, 0xFE64 }, { 49101, 10, 1, 0xFF42 }, { 49111, 12, 1, 0x21A8 },
+        { 49123, 7, 1, 0x0287 }, { 49130, 19, 1, 0xFF7D }, { 49149, 10, 1, 0x3061 }, { 49159, 14, 1, 0xFE90 }, { 49173, 9, 1, 0x0421 }, { 49182, 14, 1, 0x04C8 },
+        { 49196, 13, 1, 0x21D2 }, { 49209, 5, 1, 0x03B1 }, { 49214, 9, 1, 0x0652 }, { 49223, 10, 1, 0x308A }, { 49233, 10, 1, 0x30C4 }, { 49243, 16, 1, 0x3036 },
+        { 49259, 10, 1, 0xFF33 }, { 49269, 14, 1, 0x3020 }, { 49283, 16, 1, 0x1E70 }, { 49299, 8, 1, 0x0303 }, { 49307, 13, 1, 0xFB4D }, { 49320, 5, 1, 0x02DC },
+        { 49325, 7, 1, 0x03BC }, { 49332, 10, 1, 0x0AB0 }, { 49342, 12, 1, 0x040F }, { 49354, 11, 1, 0x0A9B }, { 49365, 9, 1, 0x1E84 }, { 49374, 25, 1, 0xFE40 },
+        { 49399, 14, 1, 0x260F }, { 49413, 6, 1, 0x03C2 }, { 49419, 9, 1, 0x0304 }, { 49428, 9, 1, 0x0458 }, { 49437, 31, 1, 0xFEF7 }, { 49468, 10, 1, 0xFF54 },
+        { 49478, 14, 1, 0xFE96 }, { 49492, 21, 1, 0x3175 }, { 49513, 20, 1, 0xFBA7 }, { 49533, 18, 1, 0x25D9 }, { 49551, 14, 1, 0x064C }, { 49565, 9, 1, 0xF6E9 },
+        { 49574, 9, 1, 0x2234 }, { 49583, 9, 1, 0x0969 }, { 49592, 13, 1, 0xFE61 }, { 49605, 18, 1, 0x327B }, { 49623, 26, 1, 0x25B6 }, { 49649, 9, 1, 0x05E8 },
+        { 49658, 4, 1, 0x05E2 }, { 49662, 11, 1, 0x0903 }, { 49673, 8, 1, 0x01BD }, { 49681, 17, 1, 0x316A }, { 49698, 19, 1, 0x0498 }, { 49717, 11, 1, 0xFB3C },
+        { 49728, 6, 1, 0x2116 }, { 49734, 9, 1, 0x2121 }, { 49743, 6, 1, 0x0932 }, { 49749, 10, 1, 0x090E }, { 49759, 6, 1, 0x00F3 }, { 49765, 19, 1, 0x05A9 },
+        { 49784, 7, 1, 0x24C3 }, { 49791, 10, 1, 0x0018 }, { 49801, 19, 1, 0x04A3 }, { 49820, 12, 1, 0x3300 }, { 49832, 11, 1, 0x00CE }, { 49843, 10, 1, 0x2305 },
+        { 49853, 9, 1, 0x0428 }, { 49862, 9, 1, 0x0430 }, { 49871, 6, 1, 0x0192 }, { 49877, 18, 1, 0x2271 }, { 49895, 13, 1, 0x02B1 }, { 49908, 24, 1, 0x3240 },
+        { 49932, 11, 1, 0x0E10 }, { 49943, 15, 1, 0x1E39 }, { 49958, 17, 1, 0xFB1F },
+    };
+
+    constexpr uint16_t kAglSequences[] = {
+        0x05D3, 0x05BB, 0x05E8, 0x05B2, 0x05E8, 0x05BB, 0x05E8, 0x05BB, 0x05E7, 0x05B6, 0x05E7, 0x05B8,
+        0x05E7, 0x05BB, 0x0621, 0x0652, 0x05DA, 0x05B0, 0x0621, 0x064B, 0x05D3, 0x05B2, 0x05E7, 0x05B1,
+        0x0621, 0x064D, 0x05E8, 0x05B2, 0x05E8, 0x05B0, 0x05E8, 0x05B9, 0x0651, 0x064B, 0x05E8, 0x05B8,
+        0x05DA, 0x05B8, 0x05E8, 0x05B5, 0x0621, 0x064C, 0x05D3, 0x05B6, 0x05E7, 0x05B9, 0x05E7, 0x05B7,
+        0x05E8, 0x05B1, 0x05E7, 0x05B4, 0x05D3, 0x05B7, 0xFEDF, 0xFEE4, 0xFEA0, 0x05E7, 0x05B5, 0x05E8,
+        0x05B4, 0x05E8, 0x05B9, 0x05E7, 0x05B9, 0x05E7, 0x05B6, 0x05DC, 0x05B9, 0x05E7, 0x05B0, 0x05E7,
+        0x05B4, 0x05E7, 0x05BB, 0x05DA, 0x05B8, 0x05D3, 0x05B8, 0xFB7C, 0xFEE4, 0x05E8, 0x05B8, 0x05E7,
+        0x05B0, 0xFEE7, 0xFEEC, 0x0621, 0x064F, 0x0621, 0x0650, 0x05DC, 0x05B9, 0x05BC, 0x05D3, 0x05B0,
+        0x05D3, 0x05B5, 0x05E7, 0x05B2, 0x05E8, 0x05B6, 0x05D3, 0x05B9, 0x05D3, 0x05B1, 0x05DC, 0x05B9,
+        0x05E8, 0x05B1, 0x05E7, 0x05B2, 0x05E7, 0x05B8, 0x05D3, 0x05B4, 0x05DA, 0x05B0, 0x05E8, 0x05B7,
+        0x05E8, 0x05B4, 0x05E7, 0x05B7, 0x05D3, 0x05B0, 0x0621, 0x064E, 0x05D3, 0x05B1, 0x05D3, 0x05B9,
+        0x0631, 0xFEF3, 0xFE8E, 0x0644, 0x05E8, 0x05B7, 0x05D3, 0x05B2, 0x05DC, 0x05B9, 0x05BC, 0x05D3,
+        0x05B6, 0x05E8, 0x05B5, 0x05D3, 0x05BB, 0xFEDF, 0xFEE4, 0xFEA8, 0x05E8, 0x05B6, 0x05D3, 0x05B5,
+        0x05E7, 0x05B5, 0x05D3, 0x05B4, 0x05D3, 0x05B8, 0x05D3, 0x05B7, 0x05E7, 0x05B1, 0x05E8, 0x05B0,
+    };
+
+    constexpr char kAglNames[] =
+        "siosnieunkoreanfiveparenonepersianOmicronhokatakanahalfwidthemacronyamakkanthaieightmonospaceFci"
+        "rcleclickdentalljtehmedialarabicVmonospacebracketlefttprieulkoreanelevencirclespadesuitwhiteidie"
+        "resisainmedialarabicthreeperiodRacuteOmegaroundcyrillicafii10047cbopomofoBecyrillicAybarmenianOi"
+        "fivearabictsadidageshhebrewaigurmukhiuhorndotbelowideographicsocietyparenIcircumflexsmallfourcir"
+        "cletusmallkatakanaitildebelowradsquarezaarmeniantakatakanahalfwidthquotesinglbasekhhadevazuhirag"
+        "anayukoreanmaitholowrightthaiyacutehadevaLJseagullbelowcmbyokoreanmahapakhhebrewuinvertedbreveez"
+        "hcaronnukatakanashinsindothebrewrikatakanaayinaltonehebrewJaarmenianvehmedialarabicyehmedialarab"
+        "iceighteenperiodarrowdownEcircleprescriptionlamarabickgreenlandiccaarmenianwawhamzaabovefinalara"
+        "bicecedillabreveafii10064afii57681mwmegasquaretwentycirclegparentriagdnjeemmedialarabicchedieres"
+        "iscyrillicafii10110avagrahadevanuktadevahparenobengalihatafsegolwidehebrewmacuteuhornacuteplusmi"
+        "nusNineromanAdieresismacronsentisquaretcaronoverlinecmbmmonospacewhitecornerbracketleftpaasentos"
+        "quareOopenpointingindexleftwhitesevensuperiorklsquarelbelthdotaccenttwocirclehieuhcirclekoreanvi"
+        "ramagujaratidaletqubutshebrewSeharmenianafii10092tonsquareusmallkatakanatakatakanaVdotbelowCbagu"
+        "jaratiSF230000shadeafii10846StigmagreekdlinebelowalphatonosErcyrillichatafpatahnarrowhebrewgbopo"
+        "mofoPeharmeniankvsquareEcircumflexbhooksaraileftthaiperiodhalfwidthpieupthieuthkoreantortoiseshe"
+        "llbracketrightverticalreshhatafpatahlhookretroflexideographicearthparenohiraganaarrowrightheavyg"
+        "ysquaredblprimemodthophuthaothaichieuchcirclekoreanEgravesmallideographsuncircledblanglebracketl"
+        "eftChiafii57415reshqubutshebrewNacutefeharabicafii57414Lcirclefourthaidieresistonostabengalihieu"
+        "hparenkoreanaeacuteKBsquareminusvavhebrewzeroinferiortthagujaratisevenideographicparenafii10043t"
+        "hehinitialarabicafii57670vekatakanaOcircumflextildewhitesmallsquareaibengalinotequalKhacyrillicb"
+        "lockfourmonospacefifteenperiodfourinferiorOcircumflexdotbelowafii57793alefmaksuraarabicacaroneko"
+        "reanOdieresiscyrillicasciicircummonospacehehebrewtwelveparenllvocalicbengaliGecyrillicoverlinece"
+        "nterlineatsmallideographiclaborcirclecontrolENQmirisquarezerothaigbrevekekatakanaideographiccong"
+        "ratulationparenafii57678nehiraganaabrevegravearrowdownrightIgravesmallyasmallkatakanahalfwidthqa"
+        "mats29ocircumflexaraeakoreanFiveromangravecmbplusmodunderscorewavyparenrightsuperiormaihanakatle"
+        "ftthaiHcedillabrevecopyrightparagraphpasquaredzaltoneyosmallhiraganaafii10021afii10108slashideog"
+        "raphicrightcirclelamalefhamzabelowisolatedarabictwelveperiodetnahtalefthebrewkdotbelowrsuperiore"
+        "ukoreanafii57677zinorhebrewlochulathaivturnedmafii301etnahtahebrewmaihanakatthaiacutetonecmbUdie"
+        "resisbelowsoftsigncyrillicdotaccentcmbhatafsegolquarterhebrewvagujaratisheva15percentjabengaliar"
+        "rowheaddownmodninebengalifivegurmukhighhadevakheicopticafii10831chochingthaiohookabovewokatakana"
+        "ccircumflexSF220000afii57441Uogonekafii57796mdotaccentanoteleiainiarmenianqofhebrewevowelsigndev"
+        "acolontriangularmodarrowdashdownafii57407reshqubutstehnoonfinalarabicPmonospacepfsquareafii57512"
+        "DZaemacronpercentsmallkoroniscmbqofsegolhebrewZdotaccentGcommaaccentarrowuprightqamatsqatannarro"
+        "whebrewafii57680supersetkohmsquaredbsquareshademediumupperdothebrewmeizierasquaresadfinalarabicw"
+        "ahiraganaupsilonlatinsubsetorequalafii10037twogurmukhiZhebrevecyrillicnyagurmukhihehhamzaabovefi"
+        "nalarabicvisargabengalilessequalorgreateradevaghagurmukhikiromeetorusquareqofqamatshebrewideogra"
+        "phwatercirclelsuperiorenbopomofonieunkoreanthieuthcirclekoreansamekhocircumflexacuteafii57426asm"
+        "allkatakanahalfwidthtildeverticalcmbhikatakanahalfwidthwekoreanoverscorewhitelenticularbracketri"
+        "ghtgershayimhebrewnbspacenieunaparenkoreanqofqubutshebrewafii57421bahiraganaencyrillicismallkata"
+        "kanahalfwidthOhornacuteEmacronacuteafii57842hamzasukunarabicafii57667gangiacopticsikatakanahalfw"
+        "idthblacksmilingfaceafii57388notcontainscircleotblackupperrighttrianglenakatakanaeightcirclecals"
+        "quareibreveffsagujaratiDhookadotmacronbohiraganaqamatsquarterhebrewbracerightllagujarativavdages"
+        "hhebrewhatafsegoleightpersianotildedieresisbrokenbarlambdastrokepssquaremaitrilowrightthaiafii10"
+        "068JmonospacekhieukhacirclekoreanDieresissmallcontrolGSvavvavhebrewasciitildesiluqlefthebrewAcir"
+        "cleideographnamecirclehyphensmallfirsttonechineserukatakanaquoterightokatakanahalfwidthhieuhapar"
+        "enkoreanOmacrongravecornerbracketrightverticalgammalatinsmallclubgdotaccentangkhankhuthaibridgeb"
+        "elowcmbfinalkafshevahebrewmhzsquareUpsilondieresishooksymbolgreeksukatakanamaitriupperleftthaiSc"
+        "hwaendashlfblocknieunparenkoreanbhagujaratidaggerdblonedotenleaderafii10024LcedillahdotbelowOmeg"
+        "acyrillicafii10079vukatakanascommaaccentshalshelethebrewblackdiamondoverlinedblwavyqamatshebrewl"
+        "amedhebrewideographicwoodparenkhacyrillicmerkhahebrewlladevaJsmallnotlessnorequalGhestrokecyrill"
+        "icrokatakanatchehmedialarabicshaddafathaarabicgravebelowcmbsindothebrewideographicprintcircletri"
+        "agupphagujaratinyadevaSdotbelowdotaccentarcsheenmedialarabicOdotbelowBlinebelowkirosquarelsquare"
+        "wgraveYacutesmalleightsuperiorasciitildemonospacetadevandotbelowBrevesmallkhzsquarefpaiyannoitha"
+        "iholam19NmonospacethothahanthaihotspringsSsigmahatafpatah23sakatakanatsuperiorKcaronAmonospacemu"
+        "sicalnotesixpersiankesmallkatakanaafii57456logicalnotreversedMdotaccentpikatakanaIJElevenromanmi"
+        "eumkoreanssangcieuckoreanlvocalicvowelsigndevaracuteIishortcyrillicrevlogicalnothatafpatahquarte"
+        "rhebrewyusmallhiraganaScarondotaccentgimelhebrewarrowheadleftmodTiwnarmenianfivehackarabicrdotbe"
+        "lowbracketleftexildegermandblspieupkoreanminusplusfivesuperiorauvowelsigndevavecyrillicGammaafii"
+        "57451underscoreverticaleopenkahiraganabullseyeyoddageshhadescendercyrillicbracerightbtEzhcaronha"
+        "mzafathatanarabicpdotaccentOslashideographicspecialparenlowlinecenterlinecircumflexbelowcmbEchar"
+        "menianafii00208IgravedalfinalarabichyphentwoUdieresisgravehehmedialarabicypogegrammenioneideogra"
+        "phicparenuhiraganaEdotbelowOdieresissmallJcircleafii10062segolwidehebrewruhiraganasunOEdalethata"
+        "fpatahhebrewdialytikatonoscmbqadevaYiwnarmenianCedillasmallequalsuperiorDjecyrilliccieucuparenko"
+        "reanafii57801oneoldstyletildebelowcmbTildesmallrhoaleflamedhebrewmihiraganaschwaexclamdownsmallc"
+        "ontrolFSarrowdblbothpatah1djdotlessstrokewonnuhiraganayoddoubleyodpatahhebrewhedageshyehhamzaabo"
+        "vemedialarabicAacutesmallJeightsacutedotaccenttikatakanahalfwidthquotedblrightddagujaratiIdotacc"
+        "entafii57794osmallkatakanahalfwidthiicyrillictwoparensohiraganaunderscoreninegurmukhiqofhatafseg"
+        "olocyrillicbstrokeGsmallEbreveKcedillaUgravesmallalefmaksuramedialarabicdukatakanaafii10082aster"
+        "ismSF470000ddhagurmukhiafii10101yakatakanakafarabictevirhebrewdecimalseparatorpersiantehinitiala"
+        "rabicpeharabicfinaltsadihebrewtwothirdsideographichighcircleljecyrillicitildecadevasevenhangzhou"
+        "ddalfinalarabicafii57716gmonospacedblarrowleftQcircleyoikoreanideographiciterationmarkyesieungpa"
+        "nsioskoreanetildebelowacirclewakoreanShimacoptictuhiraganasosothaithadevahehfinalalttwoarabicemc"
+        "yrillictortoiseshellbracketleftvehfinalarabicyyadevapedageshhebrewLdotaccenthamzalowkasratanarab"
+        "icddalarabicregistersansBhookminuscircleninemonospaceecircumflexdotbelowvparenminusmodCarongeres"
+        "haccenthebrewafii61289reshhatafpatahhebrewzecyrillicpiarrowvertexyagurmukhiBtopbardenominatormin"
+        "usonenumeratorbengaliFitacyrillicreshshevaEtarmenianafii10100nbopomofosadinitialarabicafii57457B"
+        "dotbelowshadedarkphieuphaparenkoreanthieuthparenkoreanEdblgravexabovecmbbehmeeminitialarabicafii"
+        "57395AtildesmalllessnieunsioskoreanarrowleftdblcontrolDC1schwacyrillicdammatanaltonearabickhagur"
+        "mukhiiubopomofokcedillaecentinferiorfathatanarabicSF200000ecircumflexbelowafii10069kokaithaibrac"
+        "ketleftbtyensheva115tdotaccentdblverticalbarshadelightKcirclememdageshonenumeratorbengaliradevah"
+        "aaltonearabiclozengetedescendercyrillicehookaboveUacutesmallobarredlessequalafii10058commaturned"
+        "abovecmbpieuptikeutkoreanprecedeszdotaccentteshbracerightverticalgagujaratiwikoreanomegachabenga"
+        "liacuteTcaronafii57534nineteenperiodfofanthaithorngimeldageshSF520000slashmonospaceacircumflexac"
+        "utedlsquarecapslockreshholamatildessangieungkoreanfrancRfrakturrekatakanahalfwidthblackuppointin"
+        "gsmalltrianglenineromanghainmedialarabickasquarevehinitialarabicqamatsqatanquarterhebrewaininiti"
+        "alarabiccontrolETXshaddafathatanarabicyrabreveacuteimatragurmukhiringbelowcmbshagujaratimaichatt"
+        "awaupperleftthairieulpieupsioskoreanjmonospaceumatragurmukhiafii57689Eogonekpmsquarehedageshhebr"
+        "ewafii57449afii10081GhookUdieresiscyrillicfongmanthaifeharmenianlambdaUdblacutebackslashypogegra"
+        "mmenigreekcmbebrevegstrokethreesuperiorChecyrillicafii57803Xdieresisdbllowlinejeemfinalarabicele"
+        "venparenideographicclosecoarmeniantikeutacirclekoreanhagurmukhicurlyoreightoldstyletwostrokeDlin"
+        "ebelowninecircletbopomofowhitecornerbracketrightlslashEmacronerbopomofoetnahtafoukhlefthebrewyoy"
+        "akthaiimonospaceqhookNtildesmallsemivoicedmarkkanahalfwidthiigurmukhipecyrillicphadevaghemiddleh"
+        "ookcyrillicagurmukhilxsquarebhabengalivoicedmarkkanahalfwidthrohiraganaaddakgurmukhiedotaccentlo"
+        "wlinecmbqubutsnarrowhebrewshevaquarterhebrewkhahinitialarabicUhorntildekhookodblacutedagurmukhiD"
+        "zcarondcaronkapyeounssangpieupkoreanhukatakanalagurmukhivakatakananinecircleinversesansserifafii"
+        "10050yUpsilonhooksymbolpwsquareexclammonospacetukatakanahalfwidthAcircumflextildePsicyrillicnced"
+        "illashaddaarabictikatakanaoogonekmacronsevenperiodyosmallkatakanawsuperiorrrvocalicvowelsignguja"
+        "ratiparenrighttpKaverticalstrokecyrillicxsheqeluringafii57514icircleDcircumflexbelowreshqamatshe"
+        "brewAbrevecyrillicghestrokecyrillicafii10056squarekmzadevaafii10070circumflexcmbwhitestarwcircum"
+        "flexafii10049horncmbaudevaDieresisGraveafii10078ocircumflexdotbelowqamats1cqamatsnarrowhebrewfah"
+        "renheitIniarmenianthalfinalarabicparenrightaltonearabicarrowheadrightmoddadevaacutebelowcmbRdotb"
+        "elowabbreviationsigndevaHdotaccentonegujaratichieuchparenkoreanpieupsioskiyeokkoreanqubutswidehe"
+        "brewafii57674integralnotelementofkiroguramusquareafii57508oogonekmacronlowmodsaraaathaiafii57665"
+        "iotalatinbehiraganabracketrighttptwelveromanrrvocalicdevaarrowleftdblstrokeqamatsdealefmaksurafi"
+        "nalarabicoinvertedbrevesofpasuqhebrewideographichaveparenmeemarabicprolongedkanamlsquaredollarza"
+        "qefgadolhebrewchieuchkoreanfinalnunhebrewarighthalfringohorntildesemivoicedmarkkanakakatakanatwo"
+        "romanthieuthaparenkoreanverticallinemodviramabengaliekatakanaperiodinferiormulsquareOneromanaste"
+        "riskmonospacehenghookequalsmallteharabicnotparallelbSsmallrcirclemlonglegturnedhokatakanaseenini"
+        "tialarabicshevahebrewpahiraganathagurmukhiKoppacyrillicsdotaccentiishortcyrillichonokhukthairrvo"
+        "calicbengalisheva2eXeharmenianHbarkcommaaccentUdieresisacutesrsquarehardsigncyrillicnieuncieucko"
+        "reanafii57806H18551zerobengaliafii57679tcircumflexbelowonecircleinversesansserifafii10020Idotbel"
+        "owhatafsegolnarrowhebrewGcontrolbagurmukhiideographicmetalparencirclemultiplyumonospacechagurmuk"
+        "hicornerbracketleftverticalzhedieresiscyrillicidieresisacuteRdotbelowmacronIdieresisacutecyrFlex"
+        "finalkafqamatshebrewomonospaceDslashtrademarkinvsmilefaceblacklenticularbracketrightverticaliucy"
+        "rillicthereexistsafii10097bracketrightmonospaceafii10031okoreankaffinalarabicshacyrillicdammalow"
+        "arabicGBsquaremaithothaisquarekmcapitaldeleterighttavreshtserehebrewhahmedialarabicafii57671lamk"
+        "hahinitialarabicldotbelowseenfinalarabiccontrolLFlcommaaccentCacuteYgravesixteencurrencydenomina"
+        "torbengalisevenarabicwakatakanahalfwidthainfinalarabicakoreanhatafsegol30trademarkserifomegalati"
+        "nclosedomegatitlocyrilliczaharabicafii10019khadevacontrolEOTVsmallfinalmemtwocircleinversesansse"
+        "rifHcircumflexdadinitialarabicequalafii10018fmsquarengonguthaiMcirclezdottackleftDdotaccentogone"
+        "kcmbOdieresistsecyrilliczahiraganadttadevaereversedcyrillicgetamarkhiriqhebrewThookwhiterightpoi"
+        "ntingsmalltriangleOdblacuteafii10027nieuntikeutkoreantonebarextrahighmodwawarabicSF270000subsetn"
+        "otequalyeharabicMBsquaredhadevaohornpbopomofoEshhamzadammatanarabicxdotaccenteopenreversedclosed"
+        "uugujaratiyyabengalinnadevaengverticalbarsemicolonlogicalnotiivowelsigndevacentmonospaceKacuteEs"
+        "cyrilliczihiraganaiogonekOogonekmacronwhitesmilingfaceseenmedialarabiceighthackarabicrieulyeorin"
+        "hieuhkoreanksicyrillicshevanarrowhebreweshsquatreversedinfinitydaletsegolhebrewaybarmenianaumatr"
+        "agurmukhizdotbelowdotlessjstrokehookgafmedialarabicItildebelowgokatakanaXthreeinferioryuslittlei"
+        "otifiedcyrillicolehebrewecandravowelsigndevaoharmenianzahfinalarabicsyouwaerasquaredeicopticsixa"
+        "rabicnuktagurmukhiNcedillaOtildeacuteodblgravetenparenafii57409muchgreaterqofholamhebrewaparenba"
+        "htthaizerooldstylekhagujaratiDznukatakanahalfwidthccurlyokatakanahalfwidtharrowdownwhitetlinebel"
+        "owsixhackarabicglottalstopEuroshaddakasraarabickokatakanahalfwidthedotocandravowelsigndevaNuttab"
+        "engaliVewarmeniangereshhebrewYtildeEngRcirclemaiekupperleftthaicolonmonetaryrieulthieuthkoreanrf"
+        "ishhookaivowelsignbengaliafii10091patahwidehebrewmukatakanahalfwidthfbopomofoAexclamdblmuAcircum"
+        "flexgravehookpalatalizedbelowcmbthreeeighthspehmedialarabicTsmallOhornhookabovehaharabicovowelsi"
+        "gngujaratisupersetorequalsevenoldstyledehihebrewtikeutkoreanglottalstopreversedtonebarhighmodkad"
+        "escendercyrillicAhookabovealefhamzaabovearabicnikhahitthaiH18543qofpatahugujaraticruzeirohehinit"
+        "ialarabicAcaronsallallahoualayhewasallamarabicafii57440koppacyrillicsofthyphendandaieungcircleko"
+        "reanThreeromansbopomofocmcubedsquareafii10098controlDC3sadevaEcircumflexbelowafii10148Otildesmal"
+        "lSevenromanyhookUhorngraveScircumflexratioafii57423telephoneblackafii57443reviahebrewdalarabicnu"
+        "mbersignfivedevaFeharmenianiacyrillicCcaronacutelowmodWomegatonosarrowupleftsiosparenkoreanTonef"
+        "iveveharabicarrowdashleftmacronOsmallproductthetauuvowelsigngujaratiafii57410shaarmenianohorndot"
+        "belowAcircumflexsiluqhebrewafii57432SF500000jadevagihiraganayuslittlecyrillicafii57411quotedblle"
+        "ftnineinferiorkhieukhaparenkoreanquestionmonospaceokatakanamdotbelowtsjehfinalarabicblackrectang"
+        "leblinebelowscarondotaccentChekhakassiancyrillicScircledotbelowcombthetasymbolgreekafii10054ideo"
+        "graphicstockparenparenrightinferiorPsitopatakthailongsafii57417lvocalicbengalirtblocknhookleftid"
+        "ieresiscyrillicwhitecornerbracketleftverticaltotaothaiHPsquarekhokhonthaixdieresisEharmenianarro"
+        "wleftphiyukatakanahalfwidthltonesixpefinaldageshhebrewhdieresismeetorusquareexclamdownfourteenci"
+        "rcleafii10036squaremsquaredostrokeacutearrowleftwhiteonefittedvoarmenianffisevengurmukhiafii1007"
+        "2afii10107maichattawalowleftthainunadieresismacronrehiraganaafii10029fourpersianGimarmenianechar"
+        "menianbokatakanaclickalveolarzayintavdageshhebrewwhiteuppointingtriangleoneromanblackleftpointin"
+        "gpointerudblgraveqamats27ezhleftangleabovecmbtenideographicparengcedillakafhebrewccedillasixteen"
+        "parenvavholamhebrewncaronYericyrillicringhalfleftarmeniannoonarabicafii10077rreharabicbuhiragana"
+        "EsmallrokatakanahalfwidthringhalfrightcenteredOtcyrillicyehbarreefinalarabicrhadevaOharmenianehb"
+        "opomofoarrowheadupmodperiodmonospacerrieulphieuphkoreanafii57401asmallkatakanaringRsmallAEacutez"
+        "strokesixparentwoarabicyohiraganaissharbengaliymonospacecongruentalefhamzabelowarabicpsicyrillic"
+        "ercyrillicrabengaliovowelsignbengalilparenhatafpatahalephhungarumlautuniversalzerottehmedialarab"
+        "icscircumflexafii10023nunhebrewafii10084Acircumflexhookaboveyukatakanawohiraganaomacronaavowelsi"
+        "gnbengalialefmaksurainitialarabicIotatonosfourthtonechinesearrowupwhiteefcyrillicuptackbelowcmbd"
+        "otlessiideographicenterpriseparenoverlinewavyYatcyrillicphosamphaothaiEiotifiedcyrillicabopomofo"
+        "ideographicfinancialcircleTlinebelowqamatsaivowelsigngujaratipieupkiyeokkoreanthirteencirclenots"
+        "ubsetarrowhorizexiotadieresissaraothaiafii10030afii57700KnotlessEdieresisdadfinalarabicangstromb"
+        "reveinvertedbelowcmburagurmukhiarrowdashrightwdotbelowwaekoreantahfinalarabicFhookharpoonleftbar"
+        "buptsadidageshyatcyrillicoshortdevaGmacronseventeenperiodvhookmbsquareafii10099dalethebrewomegac"
+        "yrillicchedescenderabkhasiancyrillicasteriskmathonecircleruthaitwodotleaderverticalenspaceoption"
+        "commaaccenttretroflexhookdaggerBdotaccentqubutsrturnedvavholamparenleftsmallwhitebulletjcircumfl"
+        "exglottalstopinvertedtaisyouerasquarequbuts31dekatakanasigmafinaljbopomofoAringbelowquotedblvdot"
+        "belowparenleftsuperiorlamalefmaddaaboveisolatedarabicfiveoldstylemacronmonospacebracerighttpvcir"
+        "clelogicalorkhahmedialarabicafii300largecirclehlinebelowOcyrilliceibopomofoquestionarabicnumbers"
+        "ignmonospacecagujaratiAEsmallUdieresiscaronsemicolonmonospaceImacroncyrillicideographicselfparen"
+        "nohiraganaCheabkhasiancyrillicmeeminitialarabicAcircumflexdotbelowafii57664oneperiodafii57723uti"
+        "ldeampersandEpsilonlmsquarechedescendercyrillichcircumflexintegraltopdhookdihiraganaSacuteamonos"
+        "paceOhorngraveshindageshZhedescendercyrillicparenrightmonospacearingbelowrvocalicdevatetdageshtX"
+        "iizhitsadblgravecyrillicreshhatafsegolhebrewqcircleedblgravesixsuperiorbeharabicbaruhungarumlaut"
+        "xeharmenianarrowdblleftalefdageshhebrewdikatakanaphabengalisixmonospacecarriagereturnsuhiraganaa"
+        "inarabicdzcurltehmarbutafinalarabicsemicolonarabicyasmallkatakanaafii10063rlonglegapostrophearme"
+        "nianmaiekthairegisteredprimereversedcentsuperiorncircleafii08941zekatakanaVtildedblGravesorusith"
+        "aikasmallkatakanaqofhiriqhebrewcontrolHTxbopomofoTcedillapehiraganakpasquareSF010000wcircleafii5"
+        "7798afii10089controlBELocircumflexhookaboveGheupturncyrillicysuperiorradoverssquarezerowidthjoin"
+        "erydieresisyusbigiotifiedcyrillicShchacyrillicvagurmukhiarrowdblupssangtikeutkoreanreversedtilde"
+        "dialytikatonoskastrokecyrillichyphensuperiorideographicstudyparenguilsinglleftcandrabindudevabak"
+        "atakanaralowerdiagonalbengalislongqafarabicmieumacirclekoreandaletpatahcornerbracketleftbihiraga"
+        "nannagujaratiplusbelowcmbssadevagershayimaccenthebrewsquareorthogonalcrosshatchfillsioskiyeokkor"
+        "eancontrolSUBproportionalgravelowmodthreenumeratorbengalihatafqamats1bSampigreekIecyrilliceogone"
+        "kevowelsigngujaratiacutecmboparenKabashkircyrillicnlegrightlongPsmallZdotbelowusmallkatakanahalf"
+        "widthtikeutparenkoreanpropersupersethoarmenianAcircumflexacuteshindageshshindothethebrewtwoideog"
+        "raphicparensixteenperiodkashidaautonosidebearingarabiccontrolSIshindageshsindottavdagesfourhacka"
+        "rabicheartfilledrectmakatakanahalfwidthezhcurlhehinitialaltonearabicpemiddlehookcyrillicsmilefac"
+        "eNJOmacronsheqelhebrewzainarabiccontourintegralfinalpeSF480000controlDC4afii61573afii57400DZcaro"
+        "nSF020000eturnedtecyrillicacutedevaJheharmenianjagujaratiaiecyrillicGhemiddlehookcyrilliczacuted"
+        "blanglebracketrightverticalfivemonospaceumacroncyrillicguillemotleftethIbrevehsuperiorUpsilon1ab"
+        "breviationmarkarmenianlezhUpsilonacutehooksymbolgreekkokatakanaafii57505yesieungkoreanspadescirc"
+        "leetasheeninitialarabicdotlessjUinvertedbrevenyagujaratiesuperiorsquarehorizontalfillddabengalig"
+        "radientdparenijcieucacirclekoreanGacutearingacuteGraveparenrightbtubaraibopomofoOmicrontonoshyph"
+        "enkikatakanahatafqamatsnarrowhebrewpatahquarterhebrewmuasquarethanthakhatthaiecircumflexgravetho"
+        "usandsseparatorpersiankhaharabichatafpatahhebrewlammeemjeeminitialarabicendashverticalCcedillaac"
+        "uteSF190000zhbopomofosiostikeutkoreanrakatakanahalfwidthafii10060blacksmallsquareqamats33afii108"
+        "32dollaroldstylesamekhdageshotildeccaronAringsmallnnnadevaapostrophemodecaronanglebracketleftRcu"
+        "rlyandcaronyuikoreanobreveOcircumflexhookaboveghagujaratiObarreddieresiscyrillicbindigurmukhicor"
+        "nerbracketlefthalfwidthdddhadevaWacutetatweelarabicmaitrilowleftthaiquoterightnreshdageshhebrewy"
+        "ehfinalarabicrvocalicgujaratiicarontehjeemisolatedarabicexclamarmeniannhiraganasegolquarterhebre"
+        "whbrevebelowfehfinalarabicsegol1fcommaarmenianoangthaiUtildebelowaringLcircumflexbelowzbopomofoh"
+        "ehfinalarabicvuhiraganaafii10041eightromanemacronacuteZetarfishhookreversedsdotbelowideographicl"
+        "owcirclehuiitosquareEthsmalludieresismacronsixcirclebraceleftbtchaarmeniancommaaboverightcmbbetd"
+        "ageshhebrewharpoonrightbarbupspacerafeeighthangzhouOEsmallrekatakanaBmonospaceshindageshshindoth"
+        "ebrewSF440000ldotaccentqoftseretheharabicafii10145llvocalicvowelsigndevaRaarmenianescyrillicVcir"
+        "clekhabengaliOdblgraveOinvertedbrevetildedoublecmbdblanglebracketleftverticalnkatakanaiparenheru"
+        "tusquaredivisionslashimacronreshhiriqhebrewafii57675edevaOcircumflexsmallecandragujaratiatreshho"
+        "lamhebrewsamekhhebrewImacronafii10052eacutecirclewithrighthalfblackafii57718Benarmeniantetupsilo"
+        "nringhalfrightmhookkacyrillickafinitialarabicntildebsuperiordokatakanadollarinferiorsixbengaliCc"
+        "edillaGravesmalleightperiodAcutervocalicbengaliEnhookcyrillicestimatedLcaronafii57416wokatakanah"
+        "alfwidthcontrolBShafii57683tsadipoplathaikakatakanahalfwidthChookfinalmemhebrewCdotaccentTenroma"
+        "nafii57666tenromanramiddlediagonalbengalirieulkiyeoksioskoreanchieiotifiedcyrillicideographicsun"
+        "parenuubengaliTbarLjecyrillicnuktabengalithreeoldstyleUmacronhahinitialarabicbdotbelowtshecyrill"
+        "icafii57509hetaavowelsigngujaratiDieresiscontrolDELqofdageshtildeoverlaycmbradicalextokatakanaha"
+        "lfwidthudieresiscaronrieulsioskoreanIotaafricancolonsmallsevencirclenotelementmikatakanahalfwidt"
+        "hthreequartersAbrevehookabovetonebarlowmodfourideographicparensemicolonsmalljdividessegol2comega"
+        "1bhagurmukhiabrevedotbelowaidevatonebarextralowmodmabengaliLdotcagurmukhizerogurmukhiwasmallhira"
+        "ganacontrolSYNqofholamsfthyphenellipsisverticaleopenclosedasciicircumsevenromannparennuktagujara"
+        "tiPhicornerbracketrighthalfwidthDafricansixhangzhouholamhebrewemptysetrlinebelowLambdashaddadamm"
+        "atanarabicldotPemiddlehookcyrillicbirusquarepropellorkasraarabicafii57424Jcircumflexnoonmedialar"
+        "abiccoloneightarabicekonkargurmukhibilabialclickAdblgravepagujaratioejiseighthnotebeamedafii5744"
+        "2uhornAtildeYcircumflexzokatakanareshhebrewSdotbelowhatafsegolhebrewrdblgraveItildedaletdageshgc"
+        "aronafii57396sahiraganaadotbelowguhiraganaemdashmemdageshhebrewnotsucceedskaroriisquarevucyrilli"
+        "cAbreveacutepohiraganatortoiseshellbracketrightukoreanbridgeinvertedbelowcmbbraceleftOmegatonosy"
+        "ahiraganasixSF380000cedilladeltaspacehackarabicqofsegolesmallkatakanahalfwidthxmonospaceUacuteom"
+        "icrontonosnineholam32Shacyrillicssanghieuhkoreansquaremgrradevacheverticalstrokecyrillicfinalkaf"
+        "dageshglottalstopstrokereversedideographicwaterparenyoyakoreanRcedillaupblockSF110000tohiraganag"
+        "ikatakanaHadescendercyrilliccacuteobarreddieresiscyrillicmarsthonangmonthothainewsheqelsignthree"
+        "bengalilacuteshbopomofoUstraightcyrilliccontrolEMevowelsignbengaliudotbelowzcurllamedyparenytild"
+        "eShaarmenianwasmallkatakanaYcircleafii57419afii63167khahfinalarabiccaronbelowcmbzehiraganaDmonos"
+        "pacetiwnarmeniankukatakanahalfwidthAogonekperiodsmallainvertedbreveyehbarreearabicLLsterlingmono"
+        "spacetehmeeminitialarabicreharabicsarauuthainacuteideographicreachparenuogoneksacuteOhookabovegr"
+        "eatersmallzeromonospacefourteenperiodregisterserifhatafqamats34klinebelowiluyhebrewafii10085down"
+        "tackmodquotedblprimeshinshindotAcircumflexsmallxsuperiorshchacyrilliccmsquaredsquarehamzalowarab"
+        "icsevencircleinversesansserifkekatakanahalfwidthchekhakassiancyrillicelevenperiodyakatakanahalfw"
+        "idthwynnkukatakanaarrowdbldownxichecyrillicafii10195meemmeeminitialarabichesekatakanahalfwidthra"
+        "gurmukhicopyrightserifHbrevebelowdodekthaitonetwosakatakanahalfwidthinvbulletrieulparenkoreannho"
+        "okretroflexclickretroflexzohiraganarrehfinalarabiccommasuperiorwhitediamondtsere12yerudieresiscy"
+        "rillicafii299usmallhiraganaubengalisixthaiobarredcyrillicUmonospaceSF070000munahlefthebrewtahini"
+        "tialarabicmiddledotkatakanahalfwidthlammedialarabiczeroarabicshindageshsindothebrewocandravowels"
+        "igngujaratifemaleismallhiraganatcedillasquarebelowcmbUhookabovecareofAcutesmallafii57676TauYsqua"
+        "rekgcolonsignwhitecirclesekatakanaUkcyrillicktsquarelbopomofoetnahtafoukhhebrewfivethaiogonekreh"
+        "finalarabicsegol13pekatakanaamsquareugravesixoldstylegafarabicsukunarabicsevendageshafii57434zer"
+        "owidthnonjoinercommainferiornineteencircleSF100000lamedholamhebrewafii57398babengaliaugujaratiqo"
+        "fshevahebrewcedillacmbttagurmukhiuudevaGdottwentyparenlefttackbelowcmbacircumflexhookabovevertic"
+        "allineabovecmbgacuteexclamEreversedparenleftverticalepsilonmiribaarusquarehehiragananinedevawmon"
+        "ospacecontrolCRkafmedialarabicyodyodhebrewmeemmeemisolatedarabicanglebracketleftverticalMacuteto"
+        "nebarmidmodengbopomofoupsilondieresistonosintegralexnakatakanahalfwidthpatahhebrewqofhiriqchieuc"
+        "hacirclekoreanonegurmukhiquarternoteUhornhookaboveZmonospaceAbrevetildefiveeighthskhhagurmukhiog"
+        "ujaratikabashkircyrillicgjecyrillicelcyrillicafii57399LjgereshmuqdamhebrewrieulpansioskoreanScar"
+        "onsmallddotbelowparenleftaltonearabicIhookabovegreaterorlessdhabengalitwooldstylepmonospaceAinve"
+        "rtedbrevebbopomofomwsquareideographiclaborparenbracketrightexmacronbelowcmbkhieukhparenkoreanone"
+        "monospacenineparenUdieresismacrondblgravecmbkhieukhkoreaneharmenianzeropersiantwosuperiorhatafpa"
+        "tahwidehebreweparenAdotmacronXmonospacessangkiyeokkoreanfivecirclesheenfinalarabicafii10095odeva"
+        "Sheicopticafii57686questionarmenianecandravowelsigngujaratianglebracketrightHungarumlautsmallSF0"
+        "50000ideographiczeroideographicperiodzhedescendercyrillicpieupcieuckoreanzmonospaceonequarterEop"
+        "enninearabicucircumflexbelowIsmallsaraathaiGjecyrillicyuyeokoreanmieumpansioskoreannsuperiorsixg"
+        "ujaratitsereUcontrolSOTEcaronkiyeokaparenkoreanomdevathookarrowrightoverleftafii57420rturnedsupe"
+        "riorequivalenceafii57694ieungkoreanrvocalicvowelsigngujaratipieupcirclekoreanhakatakanahalfwidth"
+        "WdotaccentPecyrillicTthanthakhatlowrightthaiahookabovealefmaddaabovefinalarabicfcirclepostalmark"
+        "Pacutedagujaratitetsecyrillickturnedcieucparenkoreannumeralsignlowergreekcommafinalkafhebrewschw"
+        "ahookohornacuteqmekatakanaarrowupdownbaseyerahbenyomohebrewrparenqofyhookabovedblgravekhokhaitha"
+        "iyuyekoreanwturnedalefhebrewAgravesmalljhagujaratishinsindotvoicedmarkkanaLslashwdieresissaraiit"
+        "haiEcircumflexacuteafii10065zhebrevecyrillicafii57394CoarmenianapproxequalCaarmenianafii10088Edo"
+        "tZcaronhbopomofoafii10061nadevazagurmukhiringcmbparenrightmuhiraganamaitaikhuleftthaitwothaimmcu"
+        "bedsquareOstrokeacuteIcarontrademarksansfoursuperiorupsilondieresisnnabengalipsiarrowdblrighthal"
+        "antgurmukhiafii10067afii57433YacutealefarabicdzecyrillicdammaarabicQquestionsmalltthagurmukhiUca"
+        "ronTworomanparenleftsquareupperrighttolowerleftfillfehmedialarabicanudattadevayericyrillicuptack"
+        "modzaqefqatanhebrewygravecoverkgsquareclubsuitwhiteSF040000onethirdHzsquarepansioskoreanmerkhake"
+        "fulahebrewukatakanadottedcirclechbopomoforvocalicvowelsigndevaRlinebelowrighttackbelowcmbnotprec"
+        "edesqofqubutshikatakananundageshFZdotAacuteafii10028dblverticallineabovecmbmparenIzhitsadblgrave"
+        "cyrillicSF510000Icircledkshadeiivowelsigngujaratidecimalseparatorarabiclcaronthieuthkoreanpehebr"
+        "ewbreveinvertedcmbZnumbersignsmalldeleteleftquoteleftmomathaibetazcircleIacutesmallpvsquareKsicy"
+        "rillicAlphatonosghadevaxparenesmallkatakanacommareversedabovecmbZcirclenmsquaredcedillasheicopti"
+        "csquarelogreferencemarkasteriskarabicunionYdieresissmallcontrolDC2nyabengalibraceexSF390000Fdota"
+        "ccentOcircumflexacuteScaronjecyrillicSigmagimeldageshhebrewfiveperiodrcedillasadmedialarabicvoic"
+        "editerationhiraganaCcedillasmallyaadosquareIAcyrillicweokoreanssangnieunkoreanKenarmenianbukatak"
+        "anaideographicsecretcircleIfrakturrbopomoforeharmeniantildecombheartsuitwhiteordmasculineexclams"
+        "malltwodevallinebelowYhookaboveYmonospacezarqahebrewthieuthacirclekoreanyturnedtheta1tehjeeminit"
+        "ialarabicirigurmukhiplusmonospacejeeminitialarabicparenleftexPiwrarmenianfifteenparenghainarabic"
+        "emdashverticalangleleftminusbelowcmbninesuperiorZaarmenianSF530000zhecyrilliccparenicircumflexam"
+        "persandsmalllammeeminitialarabicyerahbenyomolefthebrewLcommaaccentkmcubedsquarefinalkafqamatsivo"
+        "welsigngujaratimerkhalefthebrewhatafqamatsquarterhebrewrdotbelowmacronznnagurmukhifinalnuntwodot"
+        "leaderdaletqamatshebrewZacuteudblacuteheiseierasquareafii10022eshtwohangzhoupcirclepieupaparenko"
+        "reanninepersianRsmallinvertedkparensquareupperlefttolowerrightfillkhorakhangthaikbopomofomalegdo"
+        "tSF280000noonghunnaarabiczhearmeniangehiraganagreateroverequaltchehmeeminitialarabicsevenbengali"
+        "ecyrillicringhalfleftaideographiccommaleftyekoreaneightbengaligscriptssagujaratidoubleyodpatahEm"
+        "onospacehookretroflexbelowcmbdorusquareustraightcyrillicoitildeoperatorpehinitialarabicrieulapar"
+        "enkoreanAringacutecornerbracketrightgammabracerightmonospacegreaterorequivalentsaraaimaimalaitha"
+        "ilessorequivalentreshqamatsmaithoupperleftthaigreaterequalorlessbdotaccentustraightstrokecyrilli"
+        "cYuslittlecyrilliclvocalicdevaqofshevayagujaratithreethaifivepersianivowelsignbengaliWcirclesucc"
+        "eedsafii10192rhookIacutewonmonospacefourOhmEacuteideographicsuperviseparenfmonospaceshinshindoth"
+        "ebrewkhomutthaitoarmenianqubutshebrewwringllladevaafii10075noonhehinitialarabicarrowdashupubreve"
+        "Iocyrillicocirclehagujaratibracerightsmallgohiraganatonoscandrabindugujaratiqamats10Ohorndotbelo"
+        "wKsmalldecyrillicthehfinalarabicomicrontsere1ehatafpatah16Hmonospacewavyunderscoreverticaltaguja"
+        "raticieucaparenkoreandmonospaceYdotbelowuvowelsigngujaratiafii10146geometricallyequalGcaronthant"
+        "hakhatlowleftthaiupsilontonostdotbelowmieumparenkoreanelementkuhiraganaafii57807afii61575hamzada"
+        "mmaarabicsevendevaideographiccentrecirclebulletieungacirclekoreannowarmeniansecondtonechineseyot"
+        "greekHungarumlauteightthaibracketrightbtpercentmonospacetteharabickappasymbolgreeknoonnoonfinala"
+        "rabicwikatakanasevengujaratiumacrondieresisideographiccorrectcirclelmiddletildeZecyrilliconearab"
+        "icUsmallbracelefttpYiarmenianafii10083EacutesmalleighteenparenKahookcyrillicChaarmenianrieulacir"
+        "clekoreanjeharabicmukatakanaafii57429muwsquaremaichattawathaiqaffinalarabichekatakanahalfwidthha"
+        "itusquareNjmufsquareafii10109egravephisymbolgreeknwsquarelakkhangyaothaiwmvsquarecopyrightsansta"
+        "vdageshzretroflexhookseventeencircleaubopomofomekatakanahalfwidthreviamugrashhebrewlamhahinitial"
+        "arabicperafehebrewpatahnarrowhebrewtelishagedolahebrewdzeabkhasiancyrillicdnblocksadarabicthothu"
+        "ngthaiYusbigcyrillicqubutsquarterhebrewsentosquaretekatakanamcirclesaraaethailamalefmaddaabovefi"
+        "nalarabicrieulcirclekoreantsadihebrewideographicrepresentparenebopomofophilatinzerohackarabicdha"
+        "gurmukhiDeltahamzaarabicfouroldstyleideographicresourceparenhamzalowkasraarabicyakoreanXsmallfou"
+        "rromanhmonospaceyabengaliappleabrevelamedholamdageshsheva22sarauthaiHoricopticocircumflextildebc"
+        "ircleuvowelsigndevahatafpatah2fEcircumflexhookabovecontrolACKdieresisacuteaagujaratirmonospaceez"
+        "hreversedperiodsuperiorQsmallafii10193Ccircumflexclubsuitblackauvowelsignbengalitcommaaccentdota"
+        "ccentovowelsigndevaaabengalirahiraganalowlinedashedauvowelsigngujaratidargahebrewmeemfinalarabic"
+        "utildeacutelamalefhamzabelowfinalarabicphinthuthaidaletshevapalochkacyrillicmadevaparenleftbtdbl"
+        "lowlinecmbideographiccallparenkcarontenperiodrragurmukhiUcyrillicEcircumflextildeuhungarumlautcy"
+        "rillicmerkhakefulalefthebrewsixromanOmonospacelcircumflexbelowsegolnarrowhebrewangbopomofopiwrar"
+        "menianyeorinhieuhkoreanIUcyrillicafii10080hasquarewhitetortoiseshellbracketleftaubengalikhieukhc"
+        "irclekoreanvavdageshafii57795dalettserehebrewgravetonecmbbrevebelowcmbfourcircleinversesansserif"
+        "proportionasteriskdblarchinvertedbelowcmbpagedownddadevanieuncirclekoreanfinalkafafii57841cdotac"
+        "centmssquareabrevetildeThornsmallOgravewakatakanaosmallhiraganaihookaboveKadescendercyrillicugur"
+        "mukhiotildeacutehukatakanahalfwidthafii57513Edotaccentkahookcyrillicnholamquarterhebrewodieresis"
+        "vewarmenianLslashsmalliigujaratiyehthreedotsbelowarabicafii10026CsmallthreequartersemdashLNdotac"
+        "centbehmeemisolatedarabicogravedegreeafii57454verticallinelowmodsixcircleinversesansserifsikatak"
+        "anatikeutaparenkoreanafii64937quotedblmonospacetpalatalhooktwodotenleaderikoreaneightparenpadeva"
+        "afii10194sevenpersiancolonmonospaceafii57425ikatakanakagurmukhincircumflexbelownikatakanahalfwid"
+        "thedieresiswhitedownpointingsmalltriangleqamats1afourteenparenfinaltsadimemhebrewtavhebrewglotta"
+        "lstopreversedsuperiornjmaqafhebrewbulletoperatorkabengalithagujaratishindothebrewafii61574Chehar"
+        "menianintersectionAdotbelowcyrbreveparallelperiodaacuteGstrokeodieresiscyrillicjhabengaliqofhata"
+        "fpatahhebrewequalmonospaceideographicexcellentcircledieresisgravehungarumlautcmbkihiraganaNsmall"
+        "sagurmukhihypheninferiorgraveeightgurmukhiHoarmenianskhokhwaithaiKcommaaccentomgujaratiddotaccen"
+        "tnmonospaceideographwoodcircleringhalfleftcenteredyiarmeniankasratanarabicpuuvowelsigndevasokata"
+        "kanaSF080000dotkatakanaddhabengalillvocalicdevaghhagurmukhinikatakanaghaininitialarabichoricopti"
+        "cHaabkhasiancyrillicdzhecyrillictwonumeratorbengalichochangthaiTonetwoOcaronflecircumflextildesh"
+        "hacyrillickafaleffinalarabicimageorapproximatelyequalafii10038lammeemhahinitialarabicblacksquare"
+        "araeaekoreaneinvertedbreveideographicfinancialparendochadathaififteencircletehhahisolatedarabicu"
+        "kcyrillicideographicmedicinecircleafii57800becausearrowrightwhiteoneeighthpuhiraganaVhookSF46000"
+        "0Rinvertedbreveafii10032siospieupkoreanZsmallUpsilonafricanthirteenperiodbehmedialarabicereverse"
+        "dfadevabracketleftQmonospacebarmonospacetwoinferiornoonmeeminitialarabicpedageshtetdageshhebrewp"
+        "ukatakanathreehackarabicslongdotaccentcandrabinducmbdabengaliyringUhorndotbelowGdotaccentEncyril"
+        "lichatafsegol17plussuperiorsaraueleftthaipehfinalarabicrrabengalidaarmenianparenrightexdongarrow"
+        "upleftofdownSF420000zainfinalarabicRingsmallEcyrillicmaiyamokthaiatmonospacezetakikatakanahalfwi"
+        "dthReharmenianafii10053kpatahtccurlvadevareshsegolhebrewafii10017hihiraganadaletholamhebrewlessm"
+        "onospaceUbrevesquarediagonalcrosshatchfillFmonospaceparenrightsmallafii57797iotasegolafii57422th"
+        "reepersiansterlingfourbengaliyehhamzaabovearabicDtopbarsimilarechyiwnarmenianradoverssquaredsqua"
+        "reUtildepacuteafii57403whiteuppointingsmalltriangleTdotbelowzerowidthspaceibopomofopaseqhebrewbl"
+        "acklenticularbracketrightenghecyrillicdaletdalethatafsegolhebrewismallkatakanamcubedsquarepageup"
+        "OzcircumflexsaraaimaimuanthaighookshinhebrewbenarmeniantwofitacyrillicreflexsubsetjcrossedtailZh"
+        "ecyrillicarrowupdnthabengalidiamondsuitwhiteafii57455AdieresiscyrillicmuvsquareJecyrillicshinkws"
+        "quareEcircumflexsmallOslashacutehookcmbcontrolVTimacroncyrillicsegolhebrewunderscoredblagraveIot"
+        "abehinitialarabiclamedholamTdotaccentafii57448ssabengaliuugurmukhiocandradevaSF490000Etildebelow"
+        "NowarmenianDcaronlabengaliUmacroncyrillicfourperiodpieupsioskoreanrukatakanahalfwidthdasiapneuma"
+        "tacyrilliccmbafii10025finalkafdageshhebrewluthaiAgraveyikoreanafii57705heharabicdzcaronOcentered"
+        "tildebehnoonfinalarabicrvocalicvowelsignbengalireshhatafsegolihiraganaTonesixGcedillaMacronsmall"
+        "SchwacyrilliciterationkatakanaOslashsmallparenleftmonospacebecyrillicthreehangzhoufflYdieresistw"
+        "obengalisectiongravedevasquarelnSF410000ddagurmukhiGangiacopticnieunacirclekoreanzlinebelowkaver"
+        "ticalstrokecyrillicafii10076seveninferiorsdotbelowdotaccentmahapakhlefthebrewhaabkhasiancyrillic"
+        "sarauethaikatahiraprolongmarkhalfwidthAEmacronthreeromanhhookasymptoticallyequalafii10046Msmallr"
+        "hookturnedsuperiorcdsquareSF060000Ogoneksmallkhokhuatthailamalefisolatedarabicafii10147uparenSdo"
+        "taccentqofhatafpatahtauomegaroundcyrillicoopenpihiraganaphookodotbelowFeicopticsquaremilEmacrong"
+        "ravewekatakanaOogonekgafii57645greaterrrvocalicgujaratiarrowleftoverrightUhungarumlautcommaturne"
+        "dmodmussquarebetKoppagreekGcircleocircumflexgraveyetivhebrewrrvocalicvowelsigndevarcommaaccentmu"
+        "1percentarabicanusvaragujaratilaminitialarabicbraceleftmidbetrafehebrewscaronperthousandNjecyril"
+        "lichahfinalarabicUcircumflexdotbelowcmbdcircumflexbelowthreemonospacesparenoqofqamatsafii57839bh"
+        "adevanoonghunnafinalarabicLacuteghzsquareduhiraganayodhebrewEninehangzhoufivebengalirafehebrewli"
+        "wnarmenianpointingindexupwhitetserewidehebrewXcirclemturnedbethebrewSF240000KastrokecyrillicChed"
+        "escendercyrillicgimarmenianphophungthaisokatakanahalfwidthdalethiriqafii57427mugsquarenieunhieuh"
+        "koreanafii10086afii57470controlRSpluscirclencommaaccentnoonmeemisolatedarabicdbopomofouhorngrave"
+        "Phookafii10102periodcenteredyesieungsioskoreanDieresisAcuteeopenreversedyoyaekoreancontrolESCaek"
+        "oreanthalarabicintegraltponeinferiorEinvertedbreveglottalstopmodpokatakanaOmegahiriqwidehebrewna"
+        "squarefourgujaratitokatakanaieungparenkoreanrdotaccentelevenromansquareccDcedillaUgraveyokatakan"
+        "aqubuts25CircumflexsmallcontrolNAKfinalkafshevaZcaronsmalltthadevarittorusquaretserehebrewblanky"
+        "ehmeemisolatedarabicthanthakhatupperleftthaiafii57381sosuathaiDzeabkhasiancyrilliczayinhebrewtdi"
+        "eresisEsdescendercyrillicNtildeKhookYusbigiotifiedcyrilliconehackarabicphophanthaiSF430000bekata"
+        "kanareshpatahOgravesmallgagurmukhiigurmukhihcircleintegralbottomIeightcircleinversesansserifpeez"
+        "isquaresaraueeleftthaiaogonekSF090000Sixromansigmalunatesymbolgreeknagurmukhiddhagujaratisioscir"
+        "clekoreantehhahinitialarabiclvocalicvowelsignbengaliquestiondownsmallplusreflexsupersetizhitsacy"
+        "rillicafii57444bobaimaithaiapproacheskiyeokkoreanSoftsigncyrillicMguilsinglrightgreaterequaletar"
+        "meniandieresisbelowcmbtriagrtapproximatelyequalpecolontriangularhalfmodshookDdotbelowdsuperiordc"
+        "roatubopomofocontrolUSspadesuitblackEgraveUdblgraveEcircumflexgravekashidaautoarabicmohmsquareaf"
+        "ii57799palatalizationcyrilliccmbrightangleUhornacuteIicyrilliclamjeeminitialarabicasmallhiragana"
+        "shevathousandcyrilliccorporationsquarequestiondownaimatragurmukhiigujaratialefqamatshebrewdezhze"
+        "dieresiscyrillicafii61248fourhangzhouemacrongraveomacronacutetevirlefthebrewquestiongreekoverlin"
+        "epeharmenianmemfinalpehebrewUhornwacuteascriptmuchlessblackleftpointingtrianglephieuphparenkorea"
+        "nabrevecyrillicBseventhaivenusSF360000afii57658Wgraveigravekenarmenianbetdageshtcheharabicrieulh"
+        "ieuhkoreanideographmooncircleScedillavtildesevenhackarabicorthogonalmansyonsquaresmonospacecaben"
+        "galinekatakanahalfwidthhvdohiraganakafdageshycircumflexkapyeounphieuphkoreanideographicspaceEtat"
+        "onosToarmeniangcommaaccentmagurmukhicommasmallakatakananokatakanayusmallkatakanapakatakanaUcircl"
+        "ezerosuperiorOmacronacuteclearNcircumflexbelowghabengaliapproxequalorimageafii57519iidevandotacc"
+        "enteematragurmukhithreecircleinversesansserifhiriq2dNhookleftIstrokeohorngraveRdblgraveideograph"
+        "icleftcirclegcircumflexTcommaaccenttitlocyrilliccmbnoonjeemisolatedarabicscedillatipehalefthebre"
+        "wAiecyrillicafii57695noonfinalarabicEpsilontonosintisquarevmonospacephagurmukhiepsilontonosXdota"
+        "ccentDzecyrillictserequarterhebrewafii57431shindageshhebrewotcyrillicpaampssquareTmonospacealefd"
+        "dhadevaGhadarmenianucircumflexUstraightstrokecyrilliczikatakanadakatakanaampersandmonospaceafii5"
+        "7804Bcircleocandragujaratipabengaliarrowupdowntackbelowcmbgafinitialarabiciotatonosideographicmo"
+        "onparenafii10055dadarabicbtopbarrikatakanahalfwidthaturnedbracketrightlessorgreaterminuteopenbul"
+        "lettwopersianreshhiriqH22073gabengaliblacklenticularbracketleftverticalmusicsharpsignafii57418af"
+        "ii57397oshortvowelsigndevasiosaparenkoreanuvowelsignbengalittehinitialarabicTretroflexhookthzsqu"
+        "aredeltaturnedWmonospacemusicalnotedblnundageshhebrewtriaglfshaddakasratanarabicpieupacirclekore"
+        "anramshorncentoldstyleEthSF210000mbopomofoDecyrillicqofpatahhebrewGammaafricanRhodmacronexistent"
+        "ialSF400000housesoliduslongoverlaycmbsabengalicontrolETBtahmedialarabicrupiahafii57450Sacutedota"
+        "ccentSF450000Wdotbelowafii57717vokatakanarrvocalicvowelsignbengaliafii57684ebengaligcircleideogr"
+        "aphicallianceparendblanglebracketrightsquarecmcommaabovecmbsamekhdageshhebrewafii57511ohungaruml"
+        "autafii10196uacutedaletshevahebrewearthmikatakanaYdotaccentlmonospaceKmonospaceHdieresisezhtaili"
+        "katakanahalfwidthllvocalicvowelsignbengaliHsmallalefhamzabelowfinalarabicmaichattawalowrightthai"
+        "omacrongravefiveringhalfleftbelowcmbOhornthothongthainikhahitleftthaivisargagujaraticmonospacene"
+        "katakanaroruathaieightgujaratipropersubsetvoicediterationkatakanablackdownpointingtriangleeightd"
+        "evaafii57672rhookturnedbracerightmidjeemarabicmvmegasquarenablaafii57669tikeutcirclekoreangheupt"
+        "urncyrillicetildelessoverequalKlinebelowecirclebetasymbolgreekaeabrevehookabovedbldandaucaronham"
+        "zafathaarabicnieunpansioskoreanbeamedsixteenthnotesrhotichookmodafii10074kcirclemieumpieupkorean"
+        "ccedillaacutenonenthaithreegujaratiparenlefttpkcalsquareyosmallkatakanahalfwidthonesuperiorideog"
+        "raphicfireparenplussmalllcirclepisymbolgreekhiriqnarrowhebrewyehinitialarabicYicyrilliconebengal"
+        "iicyrilliceshortvowelsigndevakadevaoneparenOhorntildeeuroafii10094integralbtUcircumflexbelowsubs"
+        "etRsmallinvertedsuperiorOacutesmalliibengalivavyodhebrewshaddadammaarabicaagurmukhicyrBreveeegur"
+        "mukhikagujaratitencircleDaarmenianaigujaratitwohackarabiconehalffathalowarabicchieuchaparenkorea"
+        "nkohiraganadalethatafsegoltehiraganaseenarabicKheicopticdiamondafii10040ieungaparenkoreanideogra"
+        "phiccommaadieresisfathaarabicaulengthmarkbengalithreearabicH18533dieresisquestionmagujaratiWsmal"
+        "lLmonospacerieulpieupkoreanmaitaikhuthaiafii10034squarewhitewithsmallblackforallninethaizayindag"
+        "eshdbloverlinecmbphieuphacirclekoreanlcedillayuhiraganazedescendercyrillicstrokelongoverlaycmbsi"
+        "hiraganasegoltahebrewweierstrassYhooknineteenparenSF260000gecyrillicfractionschwadieresiscyrilli"
+        "cafii10106Dideographmetalcircleafii10045maitholowleftthaiagujaratiIdieresissmallZlinebelowdaleth"
+        "olamrcaronLiwnarmenianacircumflextildeafii57412blacklowerlefttrianglearrowdownleftfivehangzhouEn"
+        "ghecyrillicbraceleftmonospaceycircleMacronhehhamzaaboveisolatedarabicqubuts18iimatragurmukhiiivo"
+        "welsignbengalisvsquareuhookabovekjecyrillicEhookaboveCheverticalstrokecyrillicThorncdotideograph"
+        "icnameparenutildebelowhiriqquarterhebrewguillemotrightmultiplyTsecyrilliceighteencircledcirclenf"
+        "squareEmcyrillicobopomofoafii57668kiyeokcirclekoreandaletdageshhebrewtimescircleudieresisacuteeo"
+        "koreanbraceleftsmallnssquarenotsupersetYsmalljaarmenianbackslashmonospacedollarmonospacesixteenc"
+        "ircleecircumflexYuslittleiotifiedcyrillicssangpieupkoreanghainfinalarabicwhitelenticularbracketl"
+        "eftsixperiodcentigradebracketleftmonospaceChedieresiscyrillicnvsquarecommareversedmodqbopomofoCm"
+        "onospaceafii57506PiShhacyrillicydotbelowudieresispparenthreecirclekacutenahiraganaTcircleidblgra"
+        "vemoverssquaredsquareTedescendercyrillicllhehaltonearabicHcircleyeokoreansecondquotesinglemonosp"
+        "acegravecomblolingthaiblacklenticularbracketleftafii10096eshreversedloopiocyrillicalefmaddaabove"
+        "arabicwhitedownpointingtriangletortoiseshellbracketleftsmallthreegurmukhiemonospaceOcircumflexgr"
+        "avefiyehhamzaabovefinalarabicdieresiscmbAbrevegraveaavowelsigndevaholamwidehebrewoomatragurmukhi"
+        "zparenObrevenihiraganaliraafii57453tsere2bfourarabicclicklateralrhosymbolgreekyinyangAringtseren"
+        "arrowhebrewuidotbelowrehyehaleflamarabicttehfinalarabictehmarbutaarabicmokatakanahalfwidthudevap"
+        "agurmukhisixgurmukhitippigurmukhiesdescendercyrillickapyeounpieupkoreanisuperiorGsmallhookttaguj"
+        "aratiquoteleftreversedpieupparenkoreanfofathaiiacuteMucurrencygadevavavabengaliascriptturnedcirc"
+        "lewithlefthalfblackafii10044reshpatahhebrewmasoracirclehebrewarrowtableftAEfiveromanIebrevecyril"
+        "licninegujaratihiriqshevawidehebrewMdotbelowccircleDotaccentsmallcircumflexafii10090breveinverte"
+        "ddoublecmbIdieresisIcyrilliceightinferiorbparenlogicalanditerationhiraganaNuumatragurmukhiVoarme"
+        "nianmiddotkiyeoksioskoreanphieuphcirclekoreanafii57682wawfinalarabicanbopomofohekutaarusquaredje"
+        "cyrillicjagurmukhicyusbigcyrillicwavedashTecyrillicthirteenparenkappaguramusquareeopenreversedho"
+        "okIinvertedbreveiinvertedbreveviramadevalameddageshhebrewocaronblackupperlefttriangleyoyingthaiO"
+        "tildedieresiskafdageshhebrewalefpatahhebrewnotgreaternorlessafii57452habengalijheharmenianthreep"
+        "arenwbsquarelamfinalarabicblackstarUpsilontonosphieuphkoreanbadevaheartsuitblackdollarsuperioray"
+        "inhebrewanusvarabengalivikatakanaPseveneighthsnapostropheSF030000Fsmallhakatakananineideographic"
+        "parendalethatafpatahseventeenparenafii10087dahiraganaafii57690Otilderinvertedbrevecentmaitrithai"
+        "asteriskaltonearabicZcircumflexmenarmeniantortoiseshellbracketleftverticalnkatakanahalfwidthafii"
+        "57430ordfemininecommaarabicKjecyrillicMmonospacekeharmenianfivegujaratiahiraganaThetaHlamedholam"
+        "dageshhebrewblackcirclehatafqamatshebrewObarredcyrillicosmallkatakanatbareightideographicparengl"
+        "ottalstopreversedmodholam26ukatakanahalfwidthnineperiodsioscieuckoreanCdotOcircleucirclebracelef"
+        "tverticaljhagurmukhitparenonethaithreetagurmukhiafii57413SF250000primemodhatafqamatsmahiraganaaf"
+        "ii57445KacyrillicNlinebelowpsilipneumatacyrilliccmbideographfirecirclesheenarabictehmeemisolated"
+        "arabicideographearthcirclekmsquaredsquarerieulmieumkoreanacircumflexdotbelowparenleftinferioryeh"
+        "meeminitialarabicCcircleemphasismarkarmeniannooninitialarabicedotbelowonehangzhoufeicopticngaguj"
+        "aratigahiraganalamalefhamzaabovefinalarabiconedevawhitetortoiseshellbracketrightMenarmeniancompa"
+        "ssdaletsegolwparenPcircleafii57929afii10104Hdotbelowistrokeellipsissuchthatadblgraveqadmahebrewy"
+        "icyrillicqmonospacecieuckoreanholamwhitecornerbracketrightverticalpointingindexrightwhitewhitele"
+        "ftpointingsmalltrianglesevenmonospaceFourromanSF540000eshcurlfagurmukhioneafii10033quotereversed"
+        "Mturnedglottalinvertedstrokeafii10071twomonospacesaraethaitaharabicBetabrevecmbuhorntildeaamatra"
+        "gurmukhiraarmenianafii57507Keharmenianoubopomofoyaekoreansupersetnotequalmunahhebrewhorizontalba"
+        "rfehinitialarabicivowelsigndevaecircumflexacuteecandradevaacutecombAsmallkiyeokparenkoreanarrowb"
+        "othPdotaccentjhadevacontrolSOUhungarumlautcyrillicumacronnonuthaiuuvowelsignbengalioogurmukhipoi"
+        "ntingindexdownwhiteyasmallhiraganareshngabengalitchehinitialarabicdotmathydotaccentsehiraganafdo"
+        "taccentudieresiscyrillicafii57446dzIdblgraveushortcyrillicnuScommaaccentgammasuperiorsiosacircle"
+        "koreaniebrevecyrillicxcirclereshtsereiecyrillicKappakoreanstandardsymbolIotadieresisImonospacemi"
+        "eumsioskoreanyusmallkatakanahalfwidthAmacronSchwadieresiscyrillicltshadeDeicopticanglenoonjeemin"
+        "itialarabicafii10093hoonsquareacircumflexgraveUpsilonpatah11qamatsqatanwidehebrewkiyeokacircleko"
+        "reanarrowrightdblstrokeadieresiscyrillictwentyhangzhouthehmedialarabicRmonospacephi1Edieresissma"
+        "llZedieresiscyrillicincrementwattosquareAdieresissmalldaletqubutsrighttriangleudieresisbelowsara"
+        "ueethairlonglegturnedtwentyperioddblintegralhahiraganaafii57687tusmallkatakanahalfwidthafii10066"
+        "hiriq21afii10103notgreaterpesetaosuperiorninehackarabictchehfinalarabicperiodarmenianekatakanaha"
+        "lfwidthlammeemkhahinitialarabiciotadieresistonosetatonosAbrevesolidusshortoverlaycmbkapyeounmieu"
+        "mkoreanhcedillaUtildeacuteEndescendercyrillicsaraithaiblacklowerrighttrianglebikatakanaafii61352"
+        "invcirclecheharmenianEfcyrillicaivowelsigndevaafii10039egujaratiGmonospacessuperiorcircleplusOci"
+        "rcumflexacircumflexDcirclerupeemarkbengaliDigammagreekdividesevenparenhuhiraganabqsquarecontrolF"
+        "FanusvaradevaoekoreantcircleUdieresisfisheyearrowrightafii57428checkmarkholamnarrowhebrewhturned"
+        "ecircumflexhookabovemohiraganadittomarkafii57673tackdownreshsegolcaroncmbzakatakanawdotaccentAlp"
+        "hamakatakanadtopbarlbarmieumaparenkoreanBsmallUdieresissmallCaronsmallshabengaliOmegatitlocyrill"
+        "icZhedieresiscyrillicfivecircleinversesansserifIdotElcyrillicAdieresischeabkhasiancyrillicwowaen"
+        "thaiEcedillabrevelamaleffinalarabicmaieklowrightthaiafii57685seharmenianhatafqamatswidehebrewdal"
+        "ettsereoslashdtailamacronblackrightpointingpointerunderscoremonospacechochanthaithreeideographic"
+        "parenlagujaratihehmedialaltonearabicwihiraganasioskoreanLlinebelowudieresisgraveEreversedcyrilli"
+        "cnlinebelowyenmonospacemoverssquareUshortcyrillicaarusquareDcroatOacutefiveinferiorTetsecyrillic"
+        "hookabovecombLsmalltipehahebrewfiveideographicparenwehiraganasixdevaGcircumflextwogujaratiqamats"
+        "widehebrewRcaronshadevafiguredashohornhookaboveaugurmukhivavdagesh65hohipthaiUdotbelowpatah2apar"
+        "tialdiffcosquareehiraganakmonospacemaieklowleftthaidhagujaratinumeralsigngreekdageshhebrewesmall"
+        "hiraganaparenrightverticaltethebrewhbarhieuhkoreanoslashacuteLdotbelowmacronRcommaaccentfparenza"
+        "hmedialarabicperispomenigreekcmbtthabengalizukatakanaHardsigncyrillicafii61664ringhalfrightbelow"
+        "cmbqafinitialarabicqoftserehebrewEcircumflexdotbelowarrowtabrightcommamonospacefourparenanglerig"
+        "htaadevaallequalhatafqamats28afii10059lamlamhehisolatedarabictahiraganaafii57636strokeshortoverl"
+        "aycmbqparenOmegagreekbulletinversesixideographicparenLdotbelowEzhNcommaaccentinonbreakingspacemp"
+        "asquareqafmedialarabicnjecyrillicEtildeNdotbelowAbrevedotbelowcandrabindubengalitusmallhiraganaj"
+        "caroncontrolSTXcontrolDLESF370000Zstrokemusicflatsignyehhamzaaboveinitialarabicssangsioskoreanci"
+        "euccirclekoreanuhornhookabovesixinferiormeemmedialarabicnotidenticalgakatakanaoverlinedashedWcir"
+        "cumflexyiwnarmenianhangulfillerEightromanUmacrondieresisTshecyrillicsaraiileftthaiwhitediamondco"
+        "ntainingblacksmalldiamondghadarmeniansquaremmradicalqamatsqatanhebrewmasquarefourgurmukhiYerudie"
+        "resiscyrillicquotesingleDsmallgukatakanaafii57393quotedblbaseyehnoonfinalarabicgmacronafii10057s"
+        "hagurmukhizcaronVecyrillicrhabengalichochoethaishimacopticcyrflexGbreveNcaronmolsquareafii10051m"
+        "ieumcirclekoreanIdieresiscyrillicqofdageshhebrewdargalefthebrewjparenpazerhebrewsummationtekatak"
+        "anahalfwidthafii57802verticallinebelowcmbEtaafii10073dalethiriqhebrewalefhamzaabovefinalarabicto"
+        "rtoiseshellbracketrightsmallsaraamthaihiriq14gimelkehiragananagujaratiakatakanahalfwidthDeltagre"
+        "ekwhitesquarecstretchedhatafsegol24EzhreversedmumsquareOhungarumlautVhohiraganamsuperiorchadevar"
+        "upeesignbengaligravemonospacenokatakanahalfwidthjcirclewawhamzaabovearabicwhiteleftpointingtrian"
+        "glesosalathaimokatakanaidevazerodevaAcyrillicdaletqamatsgaffinalarabickooposquareibengaliChedesc"
+        "enderabkhasiancyrillicnabengalirieulkiyeokkoreangpasquarejsuperiorglottalstopstrokeyoddageshhebr"
+        "ewzayindageshhebrewquotedblprimereversedsquareverticalfillchooknineoldstylezahinitialarabicfourn"
+        "umeratorbengalicircleUcircumflexsmalltwoperiodfilledboxdollarsmallRdotaccentdaletpatahhebrewKKsq"
+        "uarepashtahebrewngagurmukhidadmedialarabicudattadevablackuppointingtriangletwelvecirclengadevaqo"
+        "fhatafsegolhebrewdehiraganaqarneyparahebrewfourdevaafii57392KdotbelowhyphenmonospaceUringgreater"
+        "monospaceIogonekgekatakanamehiraganazerogujaratiwhiterightpointingtriangleUpsilondieresisperpend"
+        "icularmmsquaredsquareIzhitsacyrillicrakatakanathousandsseparatorarabicafii10048hekatakanayadevaT"
+        "welveromanZhearmenianreshshevahebrewlesssmallbmonospacearrowupdnbsetturnedsukatakanahalfwidthtih"
+        "iraganabehfinalarabicafii10035enhookcyrillicdblarrowrightalphaafii57458rihiraganatukatakanacircl"
+        "epostalmarkSmonospacepostalmarkfaceTcircumflexbelowtildecmbkafrafehebrewtildemugreekragujaratiDz"
+        "hecyrillicchagujaratiWdieresisanglebracketrightverticalwhitetelephonesigma1macroncmbafii10105lam"
+        "alefhamzaaboveisolatedarabictmonospacetehfinalarabicpieupsiostikeutkoreanhehfinalaltonearabicwhi"
+        "tecircleinversedammatanarabicasuperiorthereforethreedevaasterisksmallhieuhacirclekoreanblackrigh"
+        "tpointingtriangleafii57688ayinvisargadevatonefiverieultikeutkoreanZedescendercyrilliclameddagesh"
+        "numerotelephoneladevaeshortdevaoacutetelishaqetanahebrewNcirclecontrolCANendescendercyrillicapaa"
+        "tosquareIcircumflexprojectiveafii10042acyrillicflorinnotgreaternorequalhhooksuperiorideographicf"
+        "estivalparenthothanthaildotbelowmacronyodyodpatahhebrew"
+        ;
+
+    constexpr uint32_t AglHash(std::string_view name, uint32_t seed)
+    {
+        // FNV-1a with a final avalanche; must match the generator
+        uint32_t hash = 2166136261u ^ seed;
+        for (char c : name)
+        {
+            hash ^= (uint8_t)c;
+            hash *= 16777619u;
+        }
+        hash ^= hash >> 16;
+        hash *= 0x85EBCA6Bu;
+        hash ^= hash >> 13;
+        return hash;
+    }
+
+    constexpr const AglEntry* FindAglEntry(std::string_view name)
+    {
+        uint32_t seed = kAglSeeds[AglHash(name, 0) % kAglBucketCount];
+        const AglEntry& entry = kAglEntries[AglHash(name, seed) % kAglSlotCount];
+        return std::string_view(kAglNames + entry.nameOffset, entry.nameLength) == name ? &entry : nullptr;
+    }
+
+    // The tables are constexpr, so a broken generator fails the build
+    static_assert(FindAglEntry("A") && FindAglEntry("A")->value == 0x0041, "AGL lookup");
+    static_assert(FindAglEntry("zukatakana") && FindAglEntry("zukatakana")->value == 0x30BA, "AGL lookup");
+    static_assert(FindAglEntry("dalethatafpatah") && FindAglEntry("dalethatafpatah")->count == 2, "AGL lookup");
+    static_assert(!FindAglEntry("uni0041") && !FindAglEntry(""), "AGL lookup");
+}
+
+size_t AglLookup(std::string_view name, uint32_t* codePoints, size_t capacity)
+{
+    const AglEntry* entry = FindAglEntry(name);
+    if (!entry || entry->count > capacity)
+        return 0;
+    if (entry->count == 1)
+    {
+        codePoints[0] = entry->value;
+        return 1;
+    }
+    for (size_t i = 0; i < entry->count; ++i)
+        codePoints[i] = kAglSequences[entry->value + i];
+    return entry->count;
+}
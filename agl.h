@@ -0,0 +1,11 @@
+// agl.h : Adobe Glyph List lookup through a minimal perfect hash
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// Code points of a name in the Adobe Glyph List (one to four); 0 if the name is not listed
+size_t AglLookup(std::string_view name, uint32_t* codePoints, size_t capacity);
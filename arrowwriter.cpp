@@ -0,0 +1,575 @@
+// arrowwriter.cpp : Catalog export as Apache Arrow IPC for dataframe tools
+//
+
+#include "arrowwriter.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include "hash.h"
+#include "trace.h"
+
+namespace
+{
+    // Minimal FlatBuffers builder for the Arrow metadata. Like the reference builder it
+    // fills the buffer back to front, so children are created before the tables that
+    // refer to them. Positions returned are measured from the end of the buffer.
+    // Scalars are stored in host order, which is little-endian on all our targets.
+    class FlatBuilder
+    {
+    public:
+        template <typename T>
+        void Push(T value)
+        {
+            Align(sizeof(T));
+            uint8_t bytes[sizeof(T)];
+            memcpy(bytes, &value, sizeof(T));
+            for (size_t i = sizeof(T); i-- > 0;)
+                reversed.push_back(bytes[i]);
+        }
+
+        void PushOffset(uint32_t target)
+        {
+            Align(4);
+            Push<uint32_t>(static_cast<uint32_t>(reversed.size() + 4 - target));
+        }
+
+        uint32_t String(const char* text)
+        {
+            size_t length = strlen(text);
+            Align(4, length + 1);
+            reversed.push_back(0);
+            for (size_t i = length; i-- > 0;)
+                reversed.push_back(static_cast<uint8_t>(text[i]));
+            Push<uint32_t>(static_cast<uint32_t>(length));
+            return Position();
+        }
+
+        // Vector of structs, given as their little-endian bytes
+        uint32_t StructVector(const void* data, size_t count, size_t structSize)
+        {
+            size_t size = count * structSize;
+            Align(8, size);
+            const uint8_t* bytes = static_cast<const uint8_t*>(data);
+            for (size_t i = size; i-- > 0;)
+                reversed.push_back(bytes[i]);
+            Push<uint32_t>(static_cast<uint32_t>(count));
+            return Position();
+        }
+
+        uint32_t OffsetVector(const std::vector<uint32_t>& targets)
+        {
+            Align(4, targets.size() * 4);
+            for (size_t i = targets.size(); i-- > 0;)
+                PushOffset(targets[i]);
+            Push<uint32_t>(static_cast<uint32_t>(targets.size()));
+            return Position();
+        }
+
+        void StartTable()
+        {
+            fields.clear();
+            tableStart = Position();
+        }
+
+        template <typename T>
+        void AddField(uint16_t id, T value)
+        {
+            Push(value);
+            fields.push_back({ id, Position() });
+        }
+
+        void AddOffsetField(uint16_t id, uint32_t target)
+        {
+            PushOffset(target);
+            fields.push_back({ id, Position() });
+        }
+
+        uint32_t EndTable()
+        {
+            uint16_t slots = 0;
+            for (const auto& field : fields)
+                slots = std::max<uint16_t>(slots, field.id + 1);
+            uint16_t vtableSize = static_cast<uint16_t>(4 + 2 * slots);
+
+            // The table starts with the distance back to its vtable, which goes right before it
+            Push<int32_t>(vtableSize);
+            uint32_t table = Position();
+            std::vector<uint16_t> vtable(2 + slots, 0);
+            vtable[0] = vtableSize;
+            vtable[1] = static_cast<uint16_t>(table - tableStart);
+            for (const auto& field : fields)
+                vtable[2 + field.id] = static_cast<uint16_t>(table - field.position);
+            for (size_t i = vtable.size(); i-- > 0;)
+                Push<uint16_t>(vtable[i]);
+            return table;
+        }
+
+        std::vector<uint8_t> Finish(uint32_t root)
+        {
+            Align(8, 4);
+            PushOffset(root);
+            return std::vector<uint8_t>(reversed.rbegin(), reversed.rend());
+        }
+
+    private:
+        struct Field
+        {
+            uint16_t id;
+            uint32_t position;
+        };
+
+        uint32_t Position() const { return static_cast<uint32_t>(reversed.size()); }
+
+        // Pad so that an object of extra bytes pushed next ends size-aligned
+        void Align(size_t size, size_t extra = 0)
+        {
+            while ((reversed.size() + extra) % size != 0)
+                reversed.push_back(0);
+        }
+
+        std::vector<uint8_t> reversed;
+        std::vector<Field> fields;
+        uint32_t tableStart = 0;
+    };
+
+    // Arrow format enums (Schema.fbs, Message.fbs)
+    const int16_t kMetadataV5 = 4;
+    const uint8_t kHeaderSchema = 1;
+    const uint8_t kHeaderDictionaryBatch = 2;
+    const uint8_t kHeaderRecordBatch = 3;
+    const uint8_t kTypeInt = 2;
+    const uint8_t kTypeUtf8 = 5;
+
+    const size_t kBatchRows = 65536;
+
+    enum class ColumnKind
+    {
+        Dictionary,  // int32 indices into a utf8 dictionary
+        Utf8,
+        UInt,
+    };
+
+    struct Column
+    {
+        const char* name;
+        ColumnKind kind;
+        int bits;        // UInt width
+        bool nullable;
+        int dictionary;  // Dictionary id
+    };
+
+    const Column kColumns[] = {
+        { "family", ColumnKind::Dictionary, 0, false, 0 },
+        { "postScriptFamily", ColumnKind::Dictionary, 0, true, 1 },
+        { "face", ColumnKind::Dictionary, 0, false, 2 },
+        { "postScriptName", ColumnKind::Utf8, 0, true, -1 },
+        { "weight", ColumnKind::UInt, 16, false, -1 },
+        { "stretch", ColumnKind::UInt, 8, false, -1 },
+        { "style", ColumnKind::UInt, 8, false, -1 },
+        { "path", ColumnKind::Dictionary, 0, true, 3 },
+        { "faceIndex", ColumnKind::UInt, 32, false, -1 },
+        { "contentHash", ColumnKind::UInt, 64, true, -1 },
+        { "tablesHash", ColumnKind::UInt, 64, true, -1 },
+        { "unitsPerEm", ColumnKind::UInt, 16, true, -1 },
+    };
+    const int kDictionaryCount = 4;
+
+    struct Row
+    {
+        const FontFamily* family;
+        const FontInfo* font;
+    };
+
+    uint64_t HashText(const std::wstring& text)
+    {
+        return Xxh3Hash64(text.data(), text.size() * sizeof(wchar_t));
+    }
+
+    uint64_t HashText(const NameText& text)
+    {
+        return Xxh3Hash64(text.Bytes().data(), text.Bytes().size());
+    }
+
+    void AppendUtf8(std::string& out, const std::wstring& text)
+    {
+        out += WideToUtf8(text);
+    }
+
+    // Name strings are converted from their UTF-16BE bytes without a wide copy
+    void AppendUtf8(std::string& out, const NameText& text)
+    {
+        text.AppendUtf8(out);
+    }
+
+    // Distinct strings in first-seen order, found through an open-addressed table of ids
+    // kept at most half full
+    template <typename String>
+    struct Dictionary
+    {
+        std::vector<const String*> values;
+        std::vector<uint64_t> hashes;
+        std::vector<int32_t> slots;
+
+        void Reserve(size_t count)
+        {
+            size_t size = 16;
+            while (size < count * 2)
+                size *= 2;
+            if (size <= slots.size())
+                return;
+            slots.assign(size, -1);
+            for (size_t id = 0; id < values.size(); ++id)
+                slots[FreeSlot(hashes[id])] = static_cast<int32_t>(id);
+        }
+
+        int32_t Add(const String& text)
+        {
+            if ((values.size() + 1) * 2 > slots.size())
+                Reserve(values.size() + 1 > 8 ? values.size() * 2 : 8);
+            uint64_t hash = HashText(text);
+            size_t mask = slots.size() - 1;
+            for (size_t slot = hash & mask;; slot = (slot + 1) & mask)
+            {
+                int32_t id = slots[slot];
+                if (id < 0)
+                {
+                    id = static_cast<int32_t>(values.size());
+                    slots[slot] = id;
+                    values.push_back(&text);
+                    hashes.push_back(hash);
+                    return id;
+                }
+                if (hashes[id] == hash && *values[id] == text)
+                    return id;
+            }
+        }
+
+    private:
+        size_t FreeSlot(uint64_t hash) const
+        {
+            size_t mask = slots.size() - 1;
+            size_t slot = hash & mask;
+            while (slots[slot] >= 0)
+                slot = (slot + 1) & mask;
+            return slot;
+        }
+    };
+
+    // Field nodes, buffer locations and the 8-byte aligned body of one batch
+    struct RecordBody
+    {
+        std::vector<int64_t> nodes;    // (length, null count) per column
+        std::vector<int64_t> buffers;  // (offset, length) per buffer
+        std::string data;
+
+        void AddBuffer(const void* bytes, size_t size)
+        {
+            buffers.push_back(static_cast<int64_t>(data.size()));
+            buffers.push_back(static_cast<int64_t>(size));
+            data.append(static_cast<const char*>(bytes), size);
+            data.resize((data.size() + 7) & ~size_t(7), '\0');
+        }
+
+        // Validity bitmap (omitted when nothing is null) and values; value(i, out) is false for nulls
+        template <typename T, typename Value>
+        void AddPrimitive(size_t count, Value value)
+        {
+            std::vector<T> values(count, T());
+            std::vector<uint8_t> validity((count + 7) / 8, 0);
+            size_t nulls = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (value(i, values[i]))
+                    validity[i >> 3] |= static_cast<uint8_t>(1 << (i & 7));
+                else
+                    ++nulls;
+            }
+            nodes.push_back(static_cast<int64_t>(count));
+            nodes.push_back(static_cast<int64_t>(nulls));
+            AddBuffer(validity.data(), nulls != 0 ? validity.size() : 0);
+            AddBuffer(values.data(), count * sizeof(T));
+        }
+
+        // text(i) is null for null entries
+        template <typename Text>
+        void AddStrings(size_t count, Text text)
+        {
+            std::vector<int32_t> offsets(count + 1, 0);
+            std::vector<uint8_t> validity((count + 7) / 8, 0);
+            std::string utf8;
+            size_t nulls = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (const auto* value = text(i))
+                {
+                    AppendUtf8(utf8, *value);
+                    validity[i >> 3] |= static_cast<uint8_t>(1 << (i & 7));
+                }
+                else
+                {
+                    ++nulls;
+                }
+                offsets[i + 1] = static_cast<int32_t>(utf8.size());
+            }
+            nodes.push_back(static_cast<int64_t>(count));
+            nodes.push_back(static_cast<int64_t>(nulls));
+            AddBuffer(validity.data(), nulls != 0 ? validity.size() : 0);
+            AddBuffer(offsets.data(), offsets.size() * sizeof(int32_t));
+            AddBuffer(utf8.data(), utf8.size());
+        }
+    };
+
+    uint32_t AddIntType(FlatBuilder& builder, int bits, bool isSigned)
+    {
+        builder.StartTable();
+        builder.AddField<int32_t>(0, bits);
+        builder.AddField<uint8_t>(1, isSigned ? 1 : 0);
+        return builder.EndTable();
+    }
+
+    uint32_t AddSchema(FlatBuilder& builder)
+    {
+        std::vector<uint32_t> fields;
+        for (const Column& column : kColumns)
+        {
+            uint32_t name = builder.String(column.name);
+            uint32_t children = builder.OffsetVector({});
+            uint32_t type = 0;
+            uint32_t dictionary = 0;
+            if (column.kind == ColumnKind::UInt)
+            {
+                type = AddIntType(builder, column.bits, false);
+            }
+            else
+            {
+                builder.StartTable();
+                type = builder.EndTable();
+            }
+            if (column.kind == ColumnKind::Dictionary)
+            {
+                uint32_t indexType = AddIntType(builder, 32, true);
+                builder.StartTable();
+                builder.AddField<int64_t>(0, column.dictionary);
+                builder.AddOffsetField(1, indexType);
+                dictionary = builder.EndTable();
+            }
+
+            builder.StartTable();
+            builder.AddOffsetField(0, name);
+            builder.AddField<uint8_t>(1, column.nullable ? 1 : 0);
+            builder.AddField<uint8_t>(2, column.kind == ColumnKind::UInt ? kTypeInt : kTypeUtf8);
+            builder.AddOffsetField(3, type);
+            if (dictionary != 0)
+                builder.AddOffsetField(4, dictionary);
+            builder.AddOffsetField(5, children);
+            fields.push_back(builder.EndTable());
+        }
+        uint32_t fieldVector = builder.OffsetVector(fields);
+        builder.StartTable();
+        builder.AddField<int16_t>(0, 0);  // Little-endian
+        builder.AddOffsetField(1, fieldVector);
+        return builder.EndTable();
+    }
+
+    uint32_t AddRecordBatch(FlatBuilder& builder, size_t length, const RecordBody& body)
+    {
+        uint32_t nodes = builder.StructVector(body.nodes.data(), body.nodes.size() / 2, 16);
+        uint32_t buffers = builder.StructVector(body.buffers.data(), body.buffers.size() / 2, 16);
+        builder.StartTable();
+        builder.AddField<int64_t>(0, static_cast<int64_t>(length));
+        builder.AddOffsetField(1, nodes);
+        builder.AddOffsetField(2, buffers);
+        return builder.EndTable();
+    }
+
+    std::vector<uint8_t> FinishMessage(FlatBuilder& builder, uint8_t headerType, uint32_t header, size_t bodyLength)
+    {
+        builder.StartTable();
+        builder.AddField<int16_t>(0, kMetadataV5);
+        builder.AddField<uint8_t>(1, headerType);
+        builder.AddOffsetField(2, header);
+        builder.AddField<int64_t>(3, static_cast<int64_t>(bodyLength));
+        return builder.Finish(builder.EndTable());
+    }
+
+    // Footer entry locating one message in the file
+    struct Block
+    {
+        int64_t offset;
+        int32_t metaDataLength;
+        int32_t padding;
+        int64_t bodyLength;
+    };
+
+    class IpcWriter
+    {
+    public:
+        explicit IpcWriter(const std::wstring& path)
+            : file(FilePath(path), std::ios::out | std::ios::trunc | std::ios::binary)
+        {
+        }
+
+        bool IsOpen() const { return file.is_open(); }
+        bool Good() const { return file.good(); }
+
+        void Write(const void* data, size_t size)
+        {
+            file.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+            position += size;
+        }
+
+        void WriteU32(uint32_t value) { Write(&value, 4); }
+
+        // Continuation marker, metadata length, metadata padded to 8 bytes, body
+        Block WriteMessage(const std::vector<uint8_t>& metadata, const std::string& body)
+        {
+            static const uint8_t zeros[8] = {};
+            size_t padded = (metadata.size() + 7) & ~size_t(7);
+            Block block = { static_cast<int64_t>(position), static_cast<int32_t>(8 + padded), 0,
+                            static_cast<int64_t>(body.size()) };
+            WriteU32(0xFFFFFFFF);
+            WriteU32(static_cast<uint32_t>(padded));
+            Write(metadata.data(), metadata.size());
+            Write(zeros, padded - metadata.size());
+            Write(body.data(), body.size());
+            return block;
+        }
+
+    private:
+        std::ofstream file;
+        uint64_t position = 0;
+    };
+}
+
+bool WriteArrowCatalog(const std::wstring& path, const std::vector<FontFamily>& fontFamilies)
+{
+    TraceScope trace("WriteArrowCatalog");
+    bool streamFormat = path.size() >= 7 && path.compare(path.size() - 7, 7, L".arrows") == 0;
+    IpcWriter writer(path);
+    if (!writer.IsOpen())
+        return false;
+
+    // Dictionary indices for every row, in the order of the dictionary ids
+    std::vector<Row> rows;
+    Dictionary<std::wstring> families, paths;
+    Dictionary<NameText> postScriptFamilies, names;
+    std::vector<int32_t> indices[kDictionaryCount];
+    size_t fontCount = 0;
+    for (const auto& family : fontFamilies)
+        fontCount += family.fonts.size();
+    rows.reserve(fontCount);
+    for (int id = 0; id < kDictionaryCount; ++id)
+        indices[id].reserve(fontCount);
+    paths.Reserve(fontCount);
+
+    // Family names are looked up once per family, and faces of a collection usually follow each other
+    const std::wstring* lastPath = nullptr;
+    int32_t lastPathId = -1;
+    for (const auto& family : fontFamilies)
+    {
+        int32_t familyId = families.Add(family.primaryName);
+        int32_t postScriptFamilyId = family.postScriptFamilyName.Empty() ? -1 : postScriptFamilies.Add(family.postScriptFamilyName);
+        for (const auto& font : family.fonts)
+        {
+            rows.push_back({ &family, &font });
+            indices[0].push_back(familyId);
+            indices[1].push_back(postScriptFamilyId);
+            indices[2].push_back(names.Add(font.name));
+            if (font.filePath.empty())
+            {
+                indices[3].push_back(-1);
+                continue;
+            }
+            if (!lastPath || *lastPath != font.filePath)
+            {
+                lastPath = &font.filePath;
+                lastPathId = paths.Add(font.filePath);
+            }
+            indices[3].push_back(lastPathId);
+        }
+    }
+
+    static const char kMagic[8] = { 'A', 'R', 'R', 'O', 'W', '1', 0, 0 };
+    if (!streamFormat)
+        writer.Write(kMagic, 8);
+    {
+        FlatBuilder builder;
+        uint32_t schema = AddSchema(builder);
+        writer.WriteMessage(FinishMessage(builder, kHeaderSchema, schema, 0), std::string());
+    }
+
+    std::vector<Block> dictionaryBlocks, batchBlocks;
+    auto writeDictionary = [&](int id, const auto& values)
+    {
+        RecordBody body;
+        body.AddStrings(values.size(), [&](size_t i) { return values[i]; });
+        FlatBuilder builder;
+        uint32_t batch = AddRecordBatch(builder, values.size(), body);
+        builder.StartTable();
+        builder.AddField<int64_t>(0, id);
+        builder.AddOffsetField(1, batch);
+        uint32_t header = builder.EndTable();
+        dictionaryBlocks.push_back(writer.WriteMessage(FinishMessage(builder, kHeaderDictionaryBatch, header, body.data.size()), body.data));
+    };
+    // In the order of the dictionary ids
+    writeDictionary(0, families.values);
+    writeDictionary(1, postScriptFamilies.values);
+    writeDictionary(2, names.values);
+    writeDictionary(3, paths.values);
+
+    for (size_t start = 0; start < rows.size(); start += kBatchRows)
+    {
+        const Row* batch = rows.data() + start;
+        size_t count = std::min(kBatchRows, rows.size() - start);
+        auto index = [&](int id) {
+            return [&indices, id, start](size_t i, int32_t& out) { out = indices[id][start + i]; return out >= 0; };
+        };
+
+        // Columns in kColumns order
+        RecordBody body;
+        body.AddPrimitive<int32_t>(count, index(0));
+        body.AddPrimitive<int32_t>(count, index(1));
+        body.AddPrimitive<int32_t>(count, index(2));
+        body.AddStrings(count, [&](size_t i) {
+            const NameText& name = batch[i].font->postScriptName;
+            return name.Empty() ? nullptr : &name;
+        });
+        body.AddPrimitive<uint16_t>(count, [&](size_t i, uint16_t& out) { out = static_cast<uint16_t>(batch[i].font->weight); return true; });
+        body.AddPrimitive<uint8_t>(count, [&](size_t i, uint8_t& out) { out = static_cast<uint8_t>(batch[i].font->stretch); return true; });
+        body.AddPrimitive<uint8_t>(count, [&](size_t i, uint8_t& out) { out = static_cast<uint8_t>(batch[i].font->style); return true; });
+        body.AddPrimitive<int32_t>(count, index(3));
+        body.AddPrimitive<uint32_t>(count, [&](size_t i, uint32_t& out) { out = batch[i].font->faceIndex; return true; });
+        body.AddPrimitive<uint64_t>(count, [&](size_t i, uint64_t& out) { out = batch[i].font->contentHash; return out != 0; });
+        body.AddPrimitive<uint64_t>(count, [&](size_t i, uint64_t& out) { out = batch[i].font->tablesHash; return out != 0; });
+        body.AddPrimitive<uint16_t>(count, [&](size_t i, uint16_t& out) {
+            out = batch[i].font->metrics.unitsPerEm;
+            return (batch[i].font->metrics.flags & METRICS_HEAD) != 0;
+        });
+
+        FlatBuilder builder;
+        uint32_t header = AddRecordBatch(builder, count, body);
+        batchBlocks.push_back(writer.WriteMessage(FinishMessage(builder, kHeaderRecordBatch, header, body.data.size()), body.data));
+    }
+
+    // End-of-stream marker, then for the file format the footer and trailing magic
+    writer.WriteU32(0xFFFFFFFF);
+    writer.WriteU32(0);
+    if (!streamFormat)
+    {
+        FlatBuilder builder;
+        uint32_t schema = AddSchema(builder);
+        uint32_t dictionaryVector = builder.StructVector(dictionaryBlocks.data(), dictionaryBlocks.size(), sizeof(Block));
+        uint32_t batchVector = builder.StructVector(batchBlocks.data(), batchBlocks.size(), sizeof(Block));
+        builder.StartTable();
+        builder.AddField<int16_t>(0, kMetadataV5);
+        builder.AddOffsetField(1, schema);
+        builder.AddOffsetField(2, dictionaryVector);
+        builder.AddOffsetField(3, batchVector);
+        std::vector<uint8_t> footer = builder.Finish(builder.EndTable());
+        writer.Write(footer.data(), footer.size());
+        writer.WriteU32(static_cast<uint32_t>(footer.size()));
+        writer.Write(kMagic, 6);
+    }
+    return writer.Good();
+}
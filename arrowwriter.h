@@ -0,0 +1,14 @@
+// arrowwriter.h : Catalog export as Apache Arrow IPC for dataframe tools
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "catalog.h"
+
+// Write one row per font to path in the Arrow IPC file format, or the stream format when
+// path ends in ".arrows". Family, face, PostScript family and path columns are dictionary
+// encoded; the dictionaries are written once, ahead of record batches of up to 64K rows.
+// False if the file cannot be written.
+bool WriteArrowCatalog(const std::wstring& path, const std::vector<FontFamily>& fontFamilies);
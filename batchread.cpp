@@ -0,0 +1,339 @@
+// batchread.cpp : Batched positional file reads (IoRing on Windows 11, overlapped ReadFile otherwise, pread elsewhere)
+//
+
+#include "batchread.h"
+#include <algorithm>
+#ifdef _WIN32
+#include <ioringapi.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "catalog.h"
+#endif
+#include "trace.h"
+
+#ifdef _WIN32
+
+namespace
+{
+    using QueryIoRingCapabilitiesFn = HRESULT(WINAPI*)(IORING_CAPABILITIES*);
+    using CreateIoRingFn = HRESULT(WINAPI*)(IORING_VERSION, IORING_CREATE_FLAGS, UINT32, UINT32, HIORING*);
+    using BuildIoRingReadFileFn = HRESULT(WINAPI*)(HIORING, IORING_HANDLE_REF, IORING_BUFFER_REF, UINT32, UINT64, UINT_PTR,
+                                                   IORING_SQE_FLAGS);
+    using SubmitIoRingFn = HRESULT(WINAPI*)(HIORING, UINT32, UINT32, UINT32*);
+    using PopIoRingCompletionFn = HRESULT(WINAPI*)(HIORING, IORING_CQE*);
+    using SetIoRingCompletionEventFn = HRESULT(WINAPI*)(HIORING, HANDLE);
+    using CloseIoRingFn = HRESULT(WINAPI*)(HIORING);
+
+    struct IoRingApi
+    {
+        QueryIoRingCapabilitiesFn queryCapabilities = nullptr;
+        CreateIoRingFn create = nullptr;
+        BuildIoRingReadFileFn buildRead = nullptr;
+        SubmitIoRingFn submit = nullptr;
+        PopIoRingCompletionFn popCompletion = nullptr;
+        SetIoRingCompletionEventFn setCompletionEvent = nullptr;  // Optional: draining polls without it
+        CloseIoRingFn close = nullptr;
+
+        bool Available() const { return queryCapabilities && create && buildRead && submit && popCompletion && close; }
+    };
+
+    // The IoRing exports only exist from Windows 11 on, so they are looked up rather than imported
+    const IoRingApi& GetIoRingApi()
+    {
+        static const IoRingApi api = []()
+        {
+            IoRingApi api;
+            HMODULE module = GetModuleHandleW(L"kernelbase.dll");
+            if (!module)
+                return api;
+            api.queryCapabilities = (QueryIoRingCapabilitiesFn)GetProcAddress(module, "QueryIoRingCapabilities");
+            api.create = (CreateIoRingFn)GetProcAddress(module, "CreateIoRing");
+            api.buildRead = (BuildIoRingReadFileFn)GetProcAddress(module, "BuildIoRingReadFile");
+            api.submit = (SubmitIoRingFn)GetProcAddress(module, "SubmitIoRing");
+            api.popCompletion = (PopIoRingCompletionFn)GetProcAddress(module, "PopIoRingCompletion");
+            api.setCompletionEvent = (SetIoRingCompletionEventFn)GetProcAddress(module, "SetIoRingCompletionEvent");
+            api.close = (CloseIoRingFn)GetProcAddress(module, "CloseIoRing");
+            return api;
+        }();
+        return api;
+    }
+
+    // Record every completion waiting in the ring; returns how many there were
+    size_t PopCompletions(const IoRingApi& api, HIORING handle, std::vector<BatchRead>& reads)
+    {
+        size_t count = 0;
+        IORING_CQE completion;
+        while (api.popCompletion(handle, &completion) == S_OK)
+        {
+            BatchRead& read = reads[completion.UserData];
+            read.ok = SUCCEEDED(completion.ResultCode);
+            read.bytesRead = read.ok ? (uint32_t)completion.Information : 0;
+            ++count;
+        }
+        return count;
+    }
+
+    // Wait until every submitted read has completed, so none still writes into a buffer
+    // that is read again another way. Entries built but never submitted do not complete.
+    void DrainIoRing(const IoRingApi& api, HIORING handle, std::vector<BatchRead>& reads, size_t pending)
+    {
+        HANDLE event = api.setCompletionEvent ? CreateEventW(nullptr, FALSE, FALSE, nullptr) : nullptr;
+        bool waitable = event && SUCCEEDED(api.setCompletionEvent(handle, event));
+        while (pending > 0)
+        {
+            size_t popped = PopCompletions(api, handle, reads);
+            pending -= std::min(popped, pending);
+            if (pending == 0 || popped > 0)
+                continue;
+            // A completion posted between the pop and the wait leaves the event set
+            if (waitable)
+                WaitForSingleObject(event, 100);
+            else
+                Sleep(1);
+        }
+        if (event)
+            CloseHandle(event);
+    }
+}
+
+HANDLE OpenForBatchRead(const std::wstring& path)
+{
+    return CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                       FILE_ATTRIBUTE_NORMAL | FILE_FLAG_OVERLAPPED | FILE_FLAG_RANDOM_ACCESS, nullptr);
+}
+
+bool BatchFileSize(HANDLE file, uint64_t& size)
+{
+    LARGE_INTEGER fileSize = {};
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart < 0)
+        return false;
+    size = (uint64_t)fileSize.QuadPart;
+    return true;
+}
+
+void CloseBatchFile(HANDLE file)
+{
+    if (file != INVALID_HANDLE_VALUE)
+        CloseHandle(file);
+}
+
+BatchReader::BatchReader(uint32_t queueDepth)
+    : queueDepth(std::max<uint32_t>(queueDepth, 1))
+{
+    const IoRingApi& api = GetIoRingApi();
+    IORING_CAPABILITIES capabilities = {};
+    if (api.Available() && SUCCEEDED(api.queryCapabilities(&capabilities)))
+    {
+        this->queueDepth = std::min(this->queueDepth, capabilities.MaxSubmissionQueueSize);
+        IORING_CREATE_FLAGS flags = { IORING_CREATE_REQUIRED_FLAGS_NONE, IORING_CREATE_ADVISORY_FLAGS_NONE };
+        HIORING handle = nullptr;
+        // Completions are popped after every submit, so twice the submission queue never overflows
+        if (SUCCEEDED(api.create(IORING_VERSION_1, flags, this->queueDepth, this->queueDepth * 2, &handle)))
+            ring = handle;
+    }
+    if (!ring)
+        CreateEvents();
+}
+
+BatchReader::~BatchReader()
+{
+    if (ring)
+        GetIoRingApi().close(static_cast<HIORING>(ring));
+    for (HANDLE event : events)
+        CloseHandle(event);
+}
+
+void BatchReader::CreateEvents()
+{
+    for (uint32_t i = (uint32_t)events.size(); i < queueDepth; ++i)
+    {
+        HANDLE event = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+        if (!event)
+            break;
+        events.push_back(event);
+    }
+}
+
+void BatchReader::Read(std::vector<BatchRead>& reads)
+{
+    TraceScope trace("BatchRead");
+    for (auto& read : reads)
+    {
+        read.ok = false;
+        read.bytesRead = 0;
+    }
+    if (ring)
+        ReadWithIoRing(reads);
+    else
+        ReadOverlapped(reads);
+}
+
+void BatchReader::ReadWithIoRing(std::vector<BatchRead>& reads)
+{
+    const IoRingApi& api = GetIoRingApi();
+    HIORING handle = static_cast<HIORING>(ring);
+    // Built but not yet taken by a submit, and submitted but not completed
+    size_t next = 0, queued = 0, pending = 0;
+    while (next < reads.size() || queued + pending > 0)
+    {
+        while (next < reads.size() && queued + pending < queueDepth)
+        {
+            BatchRead& read = reads[next];
+            if (FAILED(api.buildRead(handle, IoRingHandleRefFromHandle(read.file), IoRingBufferRefFromPointer(read.buffer),
+                                     read.length, read.offset, (UINT_PTR)next, IOSQE_FLAGS_NONE)))
+                break;
+            ++next;
+            ++queued;
+        }
+        if (queued + pending == 0)
+        {
+            // Nothing could be queued; the remaining reads stay failed
+            return;
+        }
+
+        UINT32 submitted = 0;
+        HRESULT result = api.submit(handle, 1, INFINITE, &submitted);
+        submitted = std::min<UINT32>(submitted, (UINT32)queued);
+        queued -= submitted;
+        pending += submitted;
+        if (FAILED(result))
+        {
+            // Reads the ring accepted may still fill their buffers: collect them before
+            // the ring is closed and this batch's unfinished reads (and later batches)
+            // use ReadFile
+            DrainIoRing(api, handle, reads, pending);
+            api.close(handle);
+            ring = nullptr;
+            std::vector<size_t> retried;
+            std::vector<BatchRead> retry;
+            for (size_t i = 0; i < reads.size(); ++i)
+            {
+                if (reads[i].ok)
+                    continue;
+                retried.push_back(i);
+                retry.push_back(reads[i]);
+            }
+            ReadOverlapped(retry);
+            for (size_t i = 0; i < retried.size(); ++i)
+                reads[retried[i]] = retry[i];
+            return;
+        }
+        pending -= std::min(PopCompletions(api, handle, reads), pending);
+    }
+}
+
+void BatchReader::ReadOverlapped(std::vector<BatchRead>& reads)
+{
+    // A reader that started with an IoRing has no events until it falls back
+    if (events.empty())
+        CreateEvents();
+    if (events.empty())
+        return;
+    std::vector<OVERLAPPED> overlapped(events.size());
+    std::vector<bool> started(events.size());
+    for (size_t first = 0; first < reads.size(); first += events.size())
+    {
+        size_t count = std::min(events.size(), reads.size() - first);
+        // Issue the whole window, then collect; reads served from the cache complete inside ReadFile
+        for (size_t i = 0; i < count; ++i)
+        {
+            BatchRead& read = reads[first + i];
+            overlapped[i] = {};
+            overlapped[i].Offset = (DWORD)read.offset;
+            overlapped[i].OffsetHigh = (DWORD)(read.offset >> 32);
+            overlapped[i].hEvent = events[i];
+            started[i] = ReadFile(read.file, read.buffer, read.length, nullptr, &overlapped[i]) ||
+                         GetLastError() == ERROR_IO_PENDING;
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            BatchRead& read = reads[first + i];
+            DWORD bytes = 0;
+            if (started[i] && GetOverlappedResult(read.file, &overlapped[i], &bytes, TRUE))
+            {
+                read.ok = true;
+                read.bytesRead = bytes;
+            }
+        }
+    }
+}
+#else
+int OpenForBatchRead(const std::wstring& path)
+{
+    int file = open(WideToUtf8(path).c_str(), O_RDONLY | O_CLOEXEC);
+    if (file >= 0)
+        posix_fadvise(file, 0, 0, POSIX_FADV_RANDOM);
+    return file;
+}
+
+bool BatchFileSize(int file, uint64_t& size)
+{
+    struct stat info;
+    if (fstat(file, &info) != 0 || !S_ISREG(info.st_mode))
+        return false;
+    size = (uint64_t)info.st_size;
+    return true;
+}
+
+void CloseBatchFile(int file)
+{
+    if (file >= 0)
+        close(file);
+}
+
+BatchReader::BatchReader(uint32_t queueDepth)
+    : queueDepth(std::max<uint32_t>(queueDepth, 1))
+{
+}
+
+BatchReader::~BatchReader() = default;
+
+void BatchReader::Read(std::vector<BatchRead>& reads)
+{
+    TraceScope trace("BatchRead");
+    for (auto& read : reads)
+    {
+        read.ok = false;
+        read.bytesRead = 0;
+    }
+    ReadPositional(reads);
+}
+
+void BatchReader::ReadPositional(std::vector<BatchRead>& reads)
+{
+    for (size_t first = 0; first < reads.size(); first += queueDepth)
+    {
+        size_t count = std::min<size_t>(queueDepth, reads.size() - first);
+        // Start the whole window, then collect; ranges already cached cost nothing extra
+        for (size_t i = 0; i < count; ++i)
+        {
+            const BatchRead& read = reads[first + i];
+            posix_fadvise(read.file, (off_t)read.offset, (off_t)read.length, POSIX_FADV_WILLNEED);
+        }
+        for (size_t i = 0; i < count; ++i)
+        {
+            BatchRead& read = reads[first + i];
+            uint32_t done = 0;
+            bool ok = true;
+            while (done < read.length)
+            {
+                ssize_t bytes = pread(read.file, read.buffer + done, read.length - done, (off_t)(read.offset + done));
+                if (bytes < 0 && errno == EINTR)
+                    continue;
+                if (bytes <= 0)
+                {
+                    // 0 is the end of the file; a short read is still a successful one
+                    ok = bytes == 0;
+                    break;
+                }
+                done += (uint32_t)bytes;
+            }
+            read.ok = ok;
+            read.bytesRead = ok ? done : 0;
+        }
+    }
+}
+#endif
@@ -0,0 +1,76 @@
+// batchread.h : Batched positional file reads (IoRing on Windows 11, overlapped ReadFile otherwise, pread elsewhere)
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+#include <Windows.h>
+
+// A file opened by OpenForBatchRead
+using BatchFileHandle = HANDLE;
+const BatchFileHandle kNoBatchFile = INVALID_HANDLE_VALUE;
+#else
+using BatchFileHandle = int;
+const BatchFileHandle kNoBatchFile = -1;
+#endif
+
+// One positional read; buffer must hold length bytes
+struct BatchRead
+{
+    BatchFileHandle file = kNoBatchFile;
+    uint64_t offset = 0;
+    uint32_t length = 0;
+    uint8_t* buffer = nullptr;
+    uint32_t bytesRead = 0;  // Fewer than length at the end of the file
+    bool ok = false;
+};
+
+// Open a file for BatchReader (overlapped, so the fallback can keep several reads in flight);
+// kNoBatchFile if it cannot be opened
+BatchFileHandle OpenForBatchRead(const std::wstring& path);
+
+// Size of an opened file; false if it cannot be determined
+bool BatchFileSize(BatchFileHandle file, uint64_t& size);
+
+void CloseBatchFile(BatchFileHandle file);
+
+// Keeps up to queueDepth reads in flight so their latency overlaps, which is what matters on
+// cold or network-backed disks. Uses an IoRing where the OS has one (loaded at run time, so the
+// program still starts on Windows 10) and overlapped ReadFile with one event per read otherwise.
+// Elsewhere each window of queueDepth reads is announced with posix_fadvise, so the kernel
+// fetches the ranges in parallel, and then read with pread. Not thread-safe; use one reader
+// per thread.
+class BatchReader
+{
+public:
+    explicit BatchReader(uint32_t queueDepth = 256);
+    ~BatchReader();
+    BatchReader(const BatchReader&) = delete;
+    BatchReader& operator=(const BatchReader&) = delete;
+
+    // Perform every read; returns when all have completed or failed
+    void Read(std::vector<BatchRead>& reads);
+
+#ifdef _WIN32
+    bool UsesIoRing() const { return ring != nullptr; }
+
+private:
+    void* ring = nullptr;         // HIORING
+    std::vector<HANDLE> events;   // Fallback: one manual-reset event per read in flight, created on first use
+    uint32_t queueDepth;
+
+    void CreateEvents();
+    void ReadWithIoRing(std::vector<BatchRead>& reads);
+    void ReadOverlapped(std::vector<BatchRead>& reads);
+#else
+    bool UsesIoRing() const { return false; }
+
+private:
+    uint32_t queueDepth;
+
+    void ReadPositional(std::vector<BatchRead>& reads);
+#endif
+};
@@ -0,0 +1,217 @@
+// glyphname_bench.cpp : Throughput of glyph name extraction and AGL mapping on large fonts
+//
+// Usage: glyphname_bench [-seconds=N] [-glyphs=N] [files or directories...]
+// Two fonts are built in memory with -glyphs glyphs each (default 65,000): one naming them
+// in a post format 2 table and one in a CFF charset. Names mix uniXXXX, uXXXXX, AGL names
+// with suffixes and ligatures, and names that map to nothing, as CJK and pan-Unicode fonts
+// do. Given fonts are added to them. Every pass reads all glyph names into a fresh pool and
+// maps each to code points, until at least N seconds (default 2) have passed.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "../glyphnames.h"
+#include "../sfnt.h"
+#include "../tests/synthfont.h"
+
+namespace
+{
+    struct Totals
+    {
+        uint64_t glyphs = 0;
+        uint64_t named = 0;
+        uint64_t mapped = 0;      // Glyphs whose name gives at least one code point
+        double readSeconds = 0;
+        double mapSeconds = 0;
+    };
+
+    const char* const kSuffixedNames[] = { "a", "Aacute", "f_f_i", "uni0041_uni030A", "Lcommaaccent", "afii10017" };
+
+    std::string SyntheticName(uint32_t glyph)
+    {
+        char name[48];
+        switch (glyph % 4)
+        {
+        case 0: snprintf(name, sizeof(name), "uni%04X", 0x4E00 + glyph / 4); break;
+        case 1: snprintf(name, sizeof(name), "u%05X", 0x20000 + glyph / 4); break;
+        case 2: snprintf(name, sizeof(name), "%s.ss%u", kSuffixedNames[glyph / 4 % 6], glyph / 24); break;
+        default: snprintf(name, sizeof(name), "glyph%05u", glyph); break;
+        }
+        return name;
+    }
+
+    std::string BuildPostFont(uint16_t glyphCount)
+    {
+        std::string post;
+        PutU32(post, 0x00020000);
+        post.append(28, '\0');     // italicAngle through maxMemType1
+        PutU16(post, glyphCount);
+        PutU16(post, 0);           // .notdef
+        std::string strings;
+        for (uint32_t glyph = 1; glyph < glyphCount; ++glyph)
+        {
+            PutU16(post, 258 + glyph - 1);
+            std::string name = SyntheticName(glyph);
+            strings.push_back(char(name.size()));
+            strings += name;
+        }
+        return BuildFont({ { MakeTag('m', 'a', 'x', 'p'), BuildMaxp(glyphCount) }, { MakeTag('p', 'o', 's', 't'), post + strings } });
+    }
+
+    // INDEX with 4-byte offsets
+    std::string BuildIndex(const std::vector<std::string>& items)
+    {
+        std::string out;
+        PutU16(out, (uint32_t)items.size());
+        if (items.empty())
+            return out;
+        out.push_back(4);
+        uint32_t offset = 1;
+        PutU32(out, offset);
+        for (const auto& item : items)
+        {
+            offset += (uint32_t)item.size();
+            PutU32(out, offset);
+        }
+        for (const auto& item : items)
+            out += item;
+        return out;
+    }
+
+    // 5-byte integer operand, so the Top DICT size does not depend on the offsets
+    void PutDictOffset(std::string& out, uint32_t value, uint8_t op)
+    {
+        out.push_back(29);
+        PutU32(out, value);
+        out.push_back(char(op));
+    }
+
+    // Name-keyed CFF: the names are custom strings (SID 391 on) listed by a format 0 charset,
+    // every charstring a bare endchar
+    std::string BuildCffFont(uint16_t glyphCount)
+    {
+        std::vector<std::string> strings;
+        for (uint32_t glyph = 1; glyph < glyphCount; ++glyph)
+            strings.push_back(SyntheticName(glyph));
+        std::string head = std::string("\x01\x00\x04\x04", 4) + BuildIndex({ "Synthetic" });
+        std::string tail = BuildIndex(strings) + BuildIndex({});
+        size_t topDictSize = 2 + 1 + 8 + 12;
+        uint32_t charset = uint32_t(head.size() + topDictSize + tail.size());
+        std::string charsetData(1, '\0');  // Format 0
+        for (uint32_t glyph = 1; glyph < glyphCount; ++glyph)
+            PutU16(charsetData, 390 + glyph);
+        std::string dict;
+        PutDictOffset(dict, charset, 15);
+        PutDictOffset(dict, charset + (uint32_t)charsetData.size(), 17);
+        std::string cff = head + BuildIndex({ dict }) + tail + charsetData + BuildIndex(std::vector<std::string>(glyphCount, "\x0E"));
+        return BuildFont({ { MakeTag('m', 'a', 'x', 'p'), BuildMaxp(glyphCount) }, { MakeTag('C', 'F', 'F', ' '), cff } });
+    }
+
+    void AddFile(const std::filesystem::path& path, std::vector<std::string>& files)
+    {
+        std::ifstream in(path, std::ios::binary);
+        std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        FontContainer container;
+        if (container.Open((const uint8_t*)bytes.data(), bytes.size()))
+            files.push_back(std::move(bytes));
+    }
+
+    using Clock = std::chrono::steady_clock;
+
+    void ReadFile(const std::string& bytes, GlyphNamePool& pool, Totals& totals)
+    {
+        FontContainer container;
+        if (!container.Open((const uint8_t*)bytes.data(), bytes.size()))
+            return;
+        uint32_t faceCount = container.FaceCount();
+        for (uint32_t face = 0; face < faceCount; ++face)
+        {
+            if (!container.SelectFace(face))
+                continue;
+            Clock::time_point start = Clock::now();
+            GlyphNameTable table = ReadGlyphNames(container, pool);
+            Clock::time_point read = Clock::now();
+            uint32_t codePoints[16];
+            for (uint32_t id : table.names)
+            {
+                if (id == 0)
+                    continue;
+                totals.named += 1;
+                totals.mapped += GlyphNameToUnicode(pool.Get(id), codePoints, 16) > 0;
+            }
+            totals.glyphs += table.names.size();
+            totals.readSeconds += std::chrono::duration<double>(read - start).count();
+            totals.mapSeconds += std::chrono::duration<double>(Clock::now() - read).count();
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    double seconds = 2;
+    long glyphCount = 65000;
+    std::vector<std::string> files;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strncmp(argv[i], "-seconds=", 9) == 0)
+        {
+            seconds = atof(argv[i] + 9);
+            continue;
+        }
+        if (strncmp(argv[i], "-glyphs=", 8) == 0)
+        {
+            glyphCount = atol(argv[i] + 8);
+            continue;
+        }
+        std::error_code error;
+        if (std::filesystem::is_directory(argv[i], error))
+        {
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(argv[i], error))
+            {
+                if (entry.is_regular_file())
+                    AddFile(entry.path(), files);
+            }
+        }
+        else
+        {
+            AddFile(argv[i], files);
+        }
+    }
+    // Custom CFF strings must stay below SID 65536
+    if (glyphCount < 2 || glyphCount > 65535 - 390)
+    {
+        fprintf(stderr, "Usage: glyphname_bench [-seconds=N] [-glyphs=2..65145] [files or directories...]\n");
+        return 1;
+    }
+    files.push_back(BuildPostFont((uint16_t)glyphCount));
+    files.push_back(BuildCffFont((uint16_t)glyphCount));
+
+    Totals totals;
+    uint64_t passes = 0;
+    size_t distinct = 0, pooledBytes = 0;
+    Clock::time_point start = Clock::now();
+    double elapsed = 0;
+    do
+    {
+        GlyphNamePool pool;
+        for (const auto& bytes : files)
+            ReadFile(bytes, pool, totals);
+        distinct = pool.Count();
+        pooledBytes = pool.bytes;
+        passes += 1;
+        elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    } while (elapsed < seconds);
+
+    printf("%zu fonts, %llu passes in %.2f s: %llu glyphs, %llu named, %llu mapped\n", files.size(),
+        (unsigned long long)passes, elapsed, (unsigned long long)totals.glyphs, (unsigned long long)totals.named,
+        (unsigned long long)totals.mapped);
+    printf("Read %.0f glyphs/s, mapped %.0f names/s; %zu distinct names, %zu KB pooled per pass\n",
+        totals.glyphs / totals.readSeconds, totals.named / totals.mapSeconds, distinct, pooledBytes / 1024);
+    return 0;
+}
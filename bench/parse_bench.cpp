@@ -0,0 +1,164 @@
+// parse_bench.cpp : Parse throughput of the name, OS/2 and cmap readers over fonts in memory
+//
+// Usage: parse_bench [-seconds=N] [-corpus=DIR] files or directories...
+// All fonts are read into memory first, then every face is parsed the way the scanner
+// reads it (name records and the family/full/PostScript names, style, metrics, license,
+// cmap ranges and scripts) until at least N seconds (default 2) have passed.
+// -corpus=DIR instead writes the name, OS/2 and cmap table of every face to DIR/name,
+// DIR/os2 and DIR/cmap, the seed corpora of the fuzz targets.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "../cmap.h"
+#include "../sfnt.h"
+#include "../unicodescript.h"
+
+namespace
+{
+    struct Totals
+    {
+        uint64_t faces = 0;
+        uint64_t tableBytes = 0;
+        uint64_t checksum = 0;  // Keeps the results observable so nothing is optimized away
+    };
+
+    void AddFile(const std::filesystem::path& path, std::vector<std::vector<uint8_t>>& files)
+    {
+        std::ifstream in(path, std::ios::binary);
+        std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        FontContainer container;
+        if (container.Open(bytes.data(), bytes.size()))
+            files.push_back(std::move(bytes));
+    }
+
+    void WriteTable(const std::filesystem::path& directory, size_t file, uint32_t face, ByteSpan table)
+    {
+        if (table.Empty())
+            return;
+        std::filesystem::create_directories(directory);
+        std::ofstream out(directory / (std::to_string(file) + "_" + std::to_string(face)), std::ios::binary);
+        out.write(reinterpret_cast<const char*>(table.data), table.size);
+    }
+
+    void ExtractFile(const std::vector<uint8_t>& bytes, size_t file, const std::filesystem::path& corpus)
+    {
+        FontContainer container;
+        if (!container.Open(bytes.data(), bytes.size()))
+            return;
+        uint32_t faceCount = container.FaceCount();
+        for (uint32_t face = 0; face < faceCount; ++face)
+        {
+            if (!container.SelectFace(face))
+                continue;
+            WriteTable(corpus / "name", file, face, container.LoadTable(MakeTag('n', 'a', 'm', 'e')));
+            WriteTable(corpus / "os2", file, face, container.LoadTable(MakeTag('O', 'S', '/', '2')));
+            WriteTable(corpus / "cmap", file, face, container.LoadTable(MakeTag('c', 'm', 'a', 'p')));
+        }
+    }
+
+    void ParseFile(const std::vector<uint8_t>& bytes, Totals& totals)
+    {
+        FontContainer container;
+        if (!container.Open(bytes.data(), bytes.size()))
+            return;
+        uint32_t faceCount = container.FaceCount();
+        for (uint32_t face = 0; face < faceCount; ++face)
+        {
+            if (!container.SelectFace(face))
+                continue;
+            ByteSpan name = container.LoadTable(MakeTag('n', 'a', 'm', 'e'));
+            ByteSpan os2 = container.LoadTable(MakeTag('O', 'S', '/', '2'));
+            ByteSpan head = container.LoadTable(MakeTag('h', 'e', 'a', 'd'));
+            ByteSpan hhea = container.LoadTable(MakeTag('h', 'h', 'e', 'a'));
+            ByteSpan cmap = container.LoadTable(MakeTag('c', 'm', 'a', 'p'));
+
+            std::vector<NameRecord> records = ParseNameTable(name);
+            totals.checksum += FindName(records, NAME_FAMILY).size();
+            totals.checksum += FindName(records, NAME_FULL).size();
+            totals.checksum += FindName(records, NAME_POSTSCRIPT).size();
+            totals.checksum += FindAllNames(records, NAME_FAMILY).size();
+
+            FontStyle style = ReadFontStyle(os2, head);
+            FontMetrics metrics = ReadFontMetrics(head, hhea, os2, ByteSpan());
+            FontLicense license = ReadFontLicense(os2);
+            totals.checksum += style.weightClass + metrics.unitsPerEm + license.fsType;
+
+            std::vector<CodePointRange> ranges = ReadCmapRanges(cmap);
+            totals.checksum += ranges.size() + SupportedUnicodeScripts(ranges).size();
+
+            totals.faces += 1;
+            totals.tableBytes += name.size + os2.size + head.size + hhea.size + cmap.size;
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    double seconds = 2;
+    std::filesystem::path corpus;
+    std::vector<std::vector<uint8_t>> files;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strncmp(argv[i], "-seconds=", 9) == 0)
+        {
+            seconds = atof(argv[i] + 9);
+            continue;
+        }
+        if (strncmp(argv[i], "-corpus=", 8) == 0)
+        {
+            corpus = argv[i] + 8;
+            continue;
+        }
+        std::error_code error;
+        if (std::filesystem::is_directory(argv[i], error))
+        {
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(argv[i], error))
+            {
+                if (entry.is_regular_file())
+                    AddFile(entry.path(), files);
+            }
+        }
+        else
+        {
+            AddFile(argv[i], files);
+        }
+    }
+    if (files.empty())
+    {
+        fprintf(stderr, "Usage: parse_bench [-seconds=N] [-corpus=DIR] files or directories...\n");
+        return 1;
+    }
+
+    if (!corpus.empty())
+    {
+        for (size_t i = 0; i < files.size(); ++i)
+            ExtractFile(files[i], i, corpus);
+        printf("Wrote the tables of %zu files to %s\n", files.size(), corpus.string().c_str());
+        return 0;
+    }
+
+    using Clock = std::chrono::steady_clock;
+    Totals totals;
+    uint64_t passes = 0;
+    Clock::time_point start = Clock::now();
+    double elapsed = 0;
+    do
+    {
+        for (const auto& bytes : files)
+            ParseFile(bytes, totals);
+        passes += 1;
+        elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    } while (elapsed < seconds);
+
+    printf("%zu files, %llu passes in %.2f s\n", files.size(), (unsigned long long)passes, elapsed);
+    printf("%.0f faces/s, %.1f MB/s of table data (checksum %llu)\n",
+        totals.faces / elapsed, totals.tableBytes / elapsed / 1e6, (unsigned long long)totals.checksum);
+    return 0;
+}
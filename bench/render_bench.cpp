@@ -0,0 +1,149 @@
+// render_bench.cpp : Sample-text rendering throughput of the built-in rasterizer
+//
+// Usage: render_bench [-seconds=N] [-size=PX] [-out=DIR] [-pgm] files or directories...
+// All fonts are read into memory first, then the thumbnail sample of every face is
+// rendered until at least N seconds (default 2) have passed, and glyphs rasterized per
+// second are reported. -out=DIR also writes each face's thumbnail once, as
+// DIR/<file>-<face>.png (or .pgm with -pgm), the same image --thumbnails saves.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "../sfnt.h"
+#include "../thumbnail.h"
+
+namespace
+{
+    struct Font
+    {
+        std::filesystem::path path;
+        std::vector<uint8_t> bytes;
+    };
+
+    struct Totals
+    {
+        uint64_t faces = 0;
+        uint64_t glyphs = 0;
+        uint64_t failed = 0;
+        uint64_t pixels = 0;
+    };
+
+    void AddFile(const std::filesystem::path& path, std::vector<Font>& fonts)
+    {
+        std::ifstream in(path, std::ios::binary);
+        std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        FontContainer container;
+        if (container.Open(bytes.data(), bytes.size()))
+            fonts.push_back({ path, std::move(bytes) });
+    }
+
+    void RenderFile(const Font& font, const ThumbnailOptions& options, Totals& totals, const std::filesystem::path* out)
+    {
+        FontContainer container;
+        if (!container.Open(font.bytes.data(), font.bytes.size()))
+            return;
+        GrayImage image;
+        uint32_t faceCount = container.FaceCount();
+        for (uint32_t face = 0; face < faceCount; ++face)
+        {
+            SampleResult sample;
+            if (!container.SelectFace(face) ||
+                !RenderSample(container, options.text, options.pixelSize, options.maxWidth, image, sample))
+                continue;
+            totals.faces += 1;
+            totals.glyphs += sample.glyphs;
+            totals.failed += sample.failed;
+            totals.pixels += uint64_t(image.width) * uint64_t(image.height);
+            if (out)
+            {
+                std::filesystem::path path = *out / (font.path.stem().string() + "-" + std::to_string(face) + (options.png ? ".png" : ".pgm"));
+                if (!(options.png ? WritePng(path.wstring(), image) : WritePgm(path.wstring(), image)))
+                    fprintf(stderr, "Cannot write %s\n", path.string().c_str());
+            }
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    double seconds = 2;
+    std::filesystem::path out;
+    ThumbnailOptions options;
+    std::vector<Font> fonts;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strncmp(argv[i], "-seconds=", 9) == 0)
+        {
+            seconds = atof(argv[i] + 9);
+            continue;
+        }
+        if (strncmp(argv[i], "-size=", 6) == 0)
+        {
+            options.pixelSize = (float)atof(argv[i] + 6);
+            continue;
+        }
+        if (strncmp(argv[i], "-out=", 5) == 0)
+        {
+            out = argv[i] + 5;
+            continue;
+        }
+        if (strcmp(argv[i], "-pgm") == 0)
+        {
+            options.png = false;
+            continue;
+        }
+        std::error_code error;
+        if (std::filesystem::is_directory(argv[i], error))
+        {
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(argv[i], error))
+            {
+                if (entry.is_regular_file())
+                    AddFile(entry.path(), fonts);
+            }
+        }
+        else
+        {
+            AddFile(argv[i], fonts);
+        }
+    }
+    if (fonts.empty() || !(options.pixelSize > 0))
+    {
+        fprintf(stderr, "Usage: render_bench [-seconds=N] [-size=PX] [-out=DIR] [-pgm] files or directories...\n");
+        return 1;
+    }
+
+    if (!out.empty())
+    {
+        std::error_code error;
+        std::filesystem::create_directories(out, error);
+        Totals written;
+        for (const auto& font : fonts)
+            RenderFile(font, options, written, &out);
+        printf("Wrote %llu thumbnails to %s (%llu malformed glyphs)\n", (unsigned long long)written.faces,
+            out.string().c_str(), (unsigned long long)written.failed);
+    }
+
+    using Clock = std::chrono::steady_clock;
+    Totals totals;
+    uint64_t passes = 0;
+    Clock::time_point start = Clock::now();
+    double elapsed = 0;
+    do
+    {
+        for (const auto& font : fonts)
+            RenderFile(font, options, totals, nullptr);
+        passes += 1;
+        elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    } while (elapsed < seconds);
+
+    printf("%zu files, %llu passes in %.2f s at %g px\n", fonts.size(), (unsigned long long)passes, elapsed, options.pixelSize);
+    printf("%.0f glyphs/s, %.0f faces/s, %.1f Mpixels/s\n",
+        totals.glyphs / elapsed, totals.faces / elapsed, totals.pixels / elapsed / 1e6);
+    return 0;
+}
@@ -0,0 +1,129 @@
+// scan_bench.cpp : Throughput of the font file scanner, with its --trace output
+//
+// Usage: scan_bench [-seconds=N] [-hashes] [-trace=FILE] [-overhead] files or directories...
+// The given paths are expanded like the tool does (FindFontFiles), then every file is
+// scanned into a fresh catalog until at least N seconds (default 2) have passed. -hashes
+// also computes content and table hashes, reading whole files.
+// -trace=FILE records the scan phases like --trace: the Chrome trace-event file is written
+// and the phase summary printed at the end.
+// -overhead alternates untraced and traced passes for N seconds each and reports how much
+// slower a traced pass is.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "../catalog.h"
+#include "../dirwalk.h"
+#include "../fontfile.h"
+#include "../trace.h"
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct Run
+    {
+        uint64_t passes = 0;
+        uint64_t fonts = 0;
+        double seconds = 0;
+
+        double PassSeconds() const { return passes > 0 ? seconds / passes : 0; }
+    };
+
+    void ScanPass(const std::vector<std::wstring>& files, const ScanOptions& options, Run& run)
+    {
+        Clock::time_point start = Clock::now();
+        std::vector<FontFamily> families;
+        ScanFontFiles(nullptr, files, options, families);
+        for (const auto& family : families)
+            run.fonts += family.fonts.size();
+        run.passes += 1;
+        run.seconds += std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    void PrintRun(const char* label, const Run& run, size_t files)
+    {
+        printf("%s%llu passes in %.2f s: %.0f files/s, %.0f fonts/s\n", label, (unsigned long long)run.passes,
+            run.seconds, files * run.passes / run.seconds, run.fonts / run.seconds);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    double seconds = 2;
+    std::string tracePath;
+    bool overhead = false;
+    ScanOptions options;
+    std::vector<std::wstring> paths;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strncmp(argv[i], "-seconds=", 9) == 0)
+            seconds = atof(argv[i] + 9);
+        else if (strcmp(argv[i], "-hashes") == 0)
+            options.computeHashes = true;
+        else if (strncmp(argv[i], "-trace=", 7) == 0)
+            tracePath = argv[i] + 7;
+        else if (strcmp(argv[i], "-overhead") == 0)
+            overhead = true;
+        else
+            paths.push_back(Utf8ToWide(argv[i]));
+    }
+    std::vector<std::wstring> files = paths.empty() ? std::vector<std::wstring>() : FindFontFiles(paths, true).files;
+    if (files.empty())
+    {
+        fprintf(stderr, "Usage: scan_bench [-seconds=N] [-hashes] [-trace=FILE] [-overhead] files or directories...\n");
+        return 1;
+    }
+    printf("%zu font files\n", files.size());
+
+    // Warm the page cache so the first timed pass does not pay for disk reads
+    Run warmUp, untraced, traced;
+    ScanPass(files, options, warmUp);
+    if (overhead)
+    {
+        // Alternate, swapping the order each round, so drift in clock speed or cache
+        // state hits both sides alike
+        for (uint64_t round = 0; round == 0 || untraced.seconds + traced.seconds < 2 * seconds; ++round)
+        {
+            for (int side = 0; side < 2; ++side)
+            {
+                bool trace = (side == 0) == (round % 2 == 0);
+                if (trace)
+                    StartTrace();
+                else
+                    StopTrace();
+                ScanPass(files, options, trace ? traced : untraced);
+            }
+        }
+        StopTrace();
+        PrintRun("Untraced: ", untraced, files.size());
+        PrintRun("Traced: ", traced, files.size());
+        printf("Tracing overhead %.2f%% per pass\n", 100.0 * (traced.PassSeconds() / untraced.PassSeconds() - 1));
+    }
+    else
+    {
+        if (!tracePath.empty())
+            StartTrace();
+        Run& run = tracePath.empty() ? untraced : traced;
+        do
+        {
+            ScanPass(files, options, run);
+        } while (run.seconds < seconds);
+        PrintRun(tracePath.empty() ? "" : "Traced: ", run, files.size());
+    }
+    if (!tracePath.empty())
+    {
+        std::string summary = WideToUtf8(TraceSummary());
+        fputs(summary.c_str(), stdout);
+        if (!WriteTraceFile(Utf8ToWide(tracePath)))
+        {
+            fprintf(stderr, "Cannot write %s\n", tracePath.c_str());
+            return 1;
+        }
+        printf("Trace saved to %s\n", tracePath.c_str());
+    }
+    return 0;
+}
@@ -0,0 +1,146 @@
+// bytespan.h : Zero-copy, bounds-checked views over untrusted big-endian font data
+//
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <cstddef>
+
+// A view of font bytes. Sub-views that would leave the parent are empty, so a parser
+// checks a whole structure (header, record array, sub-table) once and then reads its
+// fields with the unchecked accessors. Unchecked reads assert in debug builds.
+struct ByteSpan
+{
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+
+    ByteSpan() = default;
+    ByteSpan(const uint8_t* bytes, size_t length) : data(bytes), size(length) {}
+
+    bool Empty() const { return size == 0; }
+    explicit operator bool() const { return data != nullptr; }
+
+    bool Has(size_t offset, size_t length) const
+    {
+        return offset <= size && length <= size - offset;
+    }
+
+    // [offset, offset + length), or an empty span if out of range
+    ByteSpan Sub(size_t offset, size_t length) const
+    {
+        return Has(offset, length) ? ByteSpan(data + offset, length) : ByteSpan();
+    }
+
+    // [offset, end), or an empty span if out of range
+    ByteSpan From(size_t offset) const
+    {
+        return offset <= size ? ByteSpan(data + offset, size - offset) : ByteSpan();
+    }
+
+    // count records of recordSize bytes at offset; empty unless all of them fit
+    ByteSpan Array(size_t offset, size_t count, size_t recordSize) const
+    {
+        if (offset > size || (recordSize != 0 && count > (size - offset) / recordSize))
+            return ByteSpan();
+        return ByteSpan(data + offset, count * recordSize);
+    }
+
+    // Unchecked field reads; the caller has already established the structure fits
+    uint8_t U8(size_t offset) const
+    {
+        assert(offset < size);
+        return data[offset];
+    }
+
+    uint16_t U16(size_t offset) const
+    {
+        assert(offset + 2 <= size);
+        return uint16_t((data[offset] << 8) | data[offset + 1]);
+    }
+
+    int16_t S16(size_t offset) const
+    {
+        return (int16_t)U16(offset);
+    }
+
+    uint32_t U24(size_t offset) const
+    {
+        assert(offset + 3 <= size);
+        return (uint32_t(data[offset]) << 16) | (uint32_t(data[offset + 1]) << 8) | uint32_t(data[offset + 2]);
+    }
+
+    uint32_t U32(size_t offset) const
+    {
+        assert(offset + 4 <= size);
+        return (uint32_t(data[offset]) << 24) | (uint32_t(data[offset + 1]) << 16) |
+               (uint32_t(data[offset + 2]) << 8) | uint32_t(data[offset + 3]);
+    }
+
+    int32_t S32(size_t offset) const
+    {
+        return (int32_t)U32(offset);
+    }
+};
+
+// Sequential reader for variable-length encodings. Every read is checked; after the
+// first failure all further reads fail too, so a parser can check once at the end.
+struct SpanCursor
+{
+    ByteSpan span;
+    size_t pos = 0;
+    bool failed = false;
+
+    explicit SpanCursor(ByteSpan source, size_t start = 0) : span(source), pos(start)
+    {
+        if (start > source.size) failed = true;
+    }
+
+    bool Ok() const { return !failed; }
+    size_t Remaining() const { return failed ? 0 : span.size - pos; }
+
+    bool Need(size_t length)
+    {
+        if (failed || length > span.size - pos)
+        {
+            failed = true;
+            return false;
+        }
+        return true;
+    }
+
+    uint8_t U8()
+    {
+        if (!Need(1)) return 0;
+        return span.data[pos++];
+    }
+
+    uint16_t U16()
+    {
+        if (!Need(2)) return 0;
+        uint16_t value = span.U16(pos);
+        pos += 2;
+        return value;
+    }
+
+    uint32_t U32()
+    {
+        if (!Need(4)) return 0;
+        uint32_t value = span.U32(pos);
+        pos += 4;
+        return value;
+    }
+
+    ByteSpan Bytes(size_t length)
+    {
+        if (!Need(length)) return ByteSpan();
+        ByteSpan result(span.data + pos, length);
+        pos += length;
+        return result;
+    }
+
+    void Skip(size_t length)
+    {
+        if (Need(length)) pos += length;
+    }
+};
@@ -0,0 +1,126 @@
+// catalog.cpp : Text helpers shared by the DirectWrite and file scanners
+//
+
+#include "catalog.h"
+#ifdef _WIN32
+#include <Windows.h>
+#endif
+
+namespace
+{
+    void AppendUtf8Char(std::string& out, uint32_t c)
+    {
+        if (c < 0x80)
+        {
+            out.push_back((char)c);
+        }
+        else if (c < 0x800)
+        {
+            out.push_back((char)(0xC0 | (c >> 6)));
+            out.push_back((char)(0x80 | (c & 0x3F)));
+        }
+        else if (c < 0x10000)
+        {
+            out.push_back((char)(0xE0 | (c >> 12)));
+            out.push_back((char)(0x80 | ((c >> 6) & 0x3F)));
+            out.push_back((char)(0x80 | (c & 0x3F)));
+        }
+        else
+        {
+            out.push_back((char)(0xF0 | (c >> 18)));
+            out.push_back((char)(0x80 | ((c >> 12) & 0x3F)));
+            out.push_back((char)(0x80 | ((c >> 6) & 0x3F)));
+            out.push_back((char)(0x80 | (c & 0x3F)));
+        }
+    }
+}
+
+std::string WideToUtf8(const std::wstring& wide)
+{
+    if (wide.empty()) return "";
+#ifdef _WIN32
+    int size = WideCharToMultiByte(CP_UTF8, 0, wide.c_str(), -1, nullptr, 0, nullptr, nullptr);
+    if (size <= 0) return "";
+    std::string result(size - 1, '\0');
+    WideCharToMultiByte(CP_UTF8, 0, wide.c_str(), -1, &result[0], size, nullptr, nullptr);
+    return result;
+#else
+    // UTF-32, or UTF-16 pairs where text was built from code units; unpaired surrogates
+    // become U+FFFD like on Windows
+    std::string result;
+    result.reserve(wide.size());
+    for (size_t i = 0; i < wide.size(); ++i)
+    {
+        uint32_t c = (uint32_t)wide[i];
+        if (c >= 0xD800 && c < 0xE000)
+        {
+            uint32_t low = i + 1 < wide.size() ? (uint32_t)wide[i + 1] : 0;
+            if (c < 0xDC00 && low >= 0xDC00 && low < 0xE000)
+            {
+                c = 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+                ++i;
+            }
+            else
+            {
+                c = 0xFFFD;
+            }
+        }
+        AppendUtf8Char(result, c > 0x10FFFF ? 0xFFFD : c);
+    }
+    return result;
+#endif
+}
+
+std::wstring Utf8ToWide(std::string_view utf8)
+{
+    std::wstring result;
+    result.reserve(utf8.size());
+    for (size_t i = 0; i < utf8.size();)
+    {
+        uint8_t lead = (uint8_t)utf8[i];
+        size_t length = lead < 0x80 ? 1 : lead >= 0xC2 && lead < 0xE0 ? 2 : lead >= 0xE0 && lead < 0xF0 ? 3
+                      : lead >= 0xF0 && lead < 0xF5 ? 4 : 0;
+        uint32_t c = length == 1 ? lead : length == 2 ? lead & 0x1F : length == 3 ? lead & 0x0F : lead & 0x07;
+        bool valid = length > 0 && i + length <= utf8.size();
+        for (size_t k = 1; valid && k < length; ++k)
+        {
+            uint8_t next = (uint8_t)utf8[i + k];
+            valid = (next & 0xC0) == 0x80;
+            c = (c << 6) | (next & 0x3F);
+        }
+        // Overlong forms, surrogates and values past U+10FFFF are invalid too
+        valid = valid && !(length == 3 && (c < 0x800 || (c >= 0xD800 && c < 0xE000))) &&
+                !(length == 4 && (c < 0x10000 || c > 0x10FFFF));
+        if (!valid)
+        {
+            result.push_back(wchar_t(0xFFFD));
+            ++i;
+            continue;
+        }
+        if (sizeof(wchar_t) == 2 && c >= 0x10000)
+        {
+            result.push_back(wchar_t(0xD800 + ((c - 0x10000) >> 10)));
+            result.push_back(wchar_t(0xDC00 + ((c - 0x10000) & 0x3FF)));
+        }
+        else
+        {
+            result.push_back(wchar_t(c));
+        }
+        i += length;
+    }
+    return result;
+}
+
+std::filesystem::path FilePath(const std::wstring& path)
+{
+#ifdef _WIN32
+    return std::filesystem::path(path);
+#else
+    return std::filesystem::path(WideToUtf8(path));
+#endif
+}
+
+NameText PostScriptFamilyPart(const NameText& psName)
+{
+    return psName.Before(L'-');
+}
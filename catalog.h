@@ -0,0 +1,105 @@
+// catalog.h : Font family/font records shared by the DirectWrite and file scanners
+//
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <set>
+#ifdef _WIN32
+#include <Windows.h>
+#include <dwrite.h>
+#endif
+#include "colorfont.h"
+#include "layout.h"
+#include "sfnt.h"
+
+#ifndef _WIN32
+// The DirectWrite style types with their values, so the file scanner builds without
+// DirectWrite. Fixed to int, since fonts carry weight and width classes outside the names.
+typedef uint32_t UINT32;
+struct IDWriteFactory;
+
+enum DWRITE_FONT_WEIGHT : int
+{
+    DWRITE_FONT_WEIGHT_NORMAL = 400,
+};
+
+enum DWRITE_FONT_STRETCH : int
+{
+    DWRITE_FONT_STRETCH_UNDEFINED = 0,
+    DWRITE_FONT_STRETCH_NORMAL = 5,
+};
+
+enum DWRITE_FONT_STYLE : int
+{
+    DWRITE_FONT_STYLE_NORMAL,
+    DWRITE_FONT_STYLE_OBLIQUE,
+    DWRITE_FONT_STYLE_ITALIC,
+};
+#endif
+
+struct FontInfo
+{
+    NameText name;                // Name strings stay encoded until written (see NameText)
+    NameText postScriptName;      // Add PostScript name
+    DWRITE_FONT_WEIGHT weight;
+    DWRITE_FONT_STRETCH stretch;
+    DWRITE_FONT_STYLE style;
+    std::wstring filePath;        // Empty for fonts whose file could not be resolved
+    UINT32 faceIndex = 0;         // Face index within a collection file
+    uint64_t contentHash = 0;     // XXH3 of the whole file (0 = not computed)
+    uint64_t tablesHash = 0;      // XXH3 over the face's tables ignoring head timestamps
+    FontMetrics metrics;          // head/hhea/OS/2/vhea line metrics
+    ColorInfo color;              // Color table flags, read with the metrics
+    FontLicense license;          // Embedding permission and vendor read with the metrics, strings with readLicense
+    std::shared_ptr<const LayoutInfo> layout;  // GSUB/GPOS tags, parsed on first use (see LoadLayoutInfo)
+    std::vector<uint32_t> unicodeScripts;      // ISO 15924 codes covered by cmap (read for the script index)
+};
+
+struct FontFamily
+{
+    std::wstring primaryName;           // Decoded: families are grouped and sorted by it
+    NameText postScriptFamilyName;      // Add PostScript family name
+    std::set<NameText> allNames;
+    std::vector<FontInfo> fonts;
+};
+
+// Optional work done while scanning
+struct ScanOptions
+{
+    bool computeHashes = false;  // Content and table hashes for duplicate detection
+    bool readMetrics = false;    // Line metrics, and color tables of system fonts (file scans always read color)
+    bool resolvePaths = false;   // File paths of system fonts, for data read after the scan
+    bool readScripts = false;    // cmap scripts and GSUB/GPOS tags for the script index
+    bool readLicense = false;    // License strings (name IDs 13/14)
+};
+
+// Cost of scanning one font file (file scans) or one font (system collection), for --top-slow
+struct ScanTiming
+{
+    std::wstring path;
+    std::wstring name;         // First face read from the file
+    uint32_t faces = 0;        // 0 if the file could not be read as a font
+    uint64_t nanoseconds = 0;  // Wall time including mapping and decompression
+    uint64_t fileSize = 0;
+    uint64_t bytesRead = 0;    // Decoded table bytes, plus the whole file when content hashes are computed
+    uint32_t tablesRead = 0;   // Table loads (the system collection does not report bytes or tables)
+};
+
+// Simple UTF-16 to UTF-8 conversion
+std::string WideToUtf8(const std::wstring& wide);
+
+// UTF-8 (file names and arguments on POSIX) to wide text; invalid bytes become U+FFFD
+std::wstring Utf8ToWide(std::string_view utf8);
+
+// Path for fstreams and std::filesystem: UTF-8 on POSIX, where converting wide text
+// follows the C locale and fails for non-ASCII names
+std::filesystem::path FilePath(const std::wstring& path);
+
+// Extract family part of a PostScript name (before the hyphen)
+NameText PostScriptFamilyPart(const NameText& psName);
@@ -0,0 +1,283 @@
+// catalogdiff.cpp : Added, removed and changed faces between two catalog snapshots
+//
+
+#include "catalogdiff.h"
+#include <algorithm>
+#include <deque>
+
+namespace
+{
+    struct FaceKey
+    {
+        uint64_t prefix;  // First four UTF-16 units of name, so most comparisons stay in the array
+        const NameText* name;
+        uint64_t contentHash;
+        CatalogFace face;
+    };
+
+    bool PathLess(const FaceKey& a, const FaceKey& b)
+    {
+        int order = a.face.font->filePath.compare(b.face.font->filePath);
+        return order != 0 ? order < 0 : a.face.font->faceIndex < b.face.font->faceIndex;
+    }
+
+    bool SamePath(const FaceKey& a, const FaceKey& b)
+    {
+        return a.face.font->faceIndex == b.face.font->faceIndex && a.face.font->filePath == b.face.font->filePath;
+    }
+
+    uint64_t NamePrefix(const NameText& name)
+    {
+        const std::string& bytes = name.Bytes();
+        uint64_t prefix = 0;
+        for (size_t i = 0; i < 8; ++i)
+            prefix = (prefix << 8) | (i < bytes.size() ? static_cast<uint8_t>(bytes[i]) : 0);
+        return prefix;
+    }
+
+    int CompareNames(const FaceKey& a, const FaceKey& b)
+    {
+        if (a.prefix != b.prefix) return a.prefix < b.prefix ? -1 : 1;
+        return a.name->Bytes().compare(b.name->Bytes());
+    }
+
+    bool KeyLess(const FaceKey& a, const FaceKey& b)
+    {
+        int order = CompareNames(a, b);
+        if (order != 0) return order < 0;
+        if (a.contentHash != b.contentHash) return a.contentHash < b.contentHash;
+        return PathLess(a, b);
+    }
+
+    // Faces without a PostScript name are keyed by "family face"; those strings live in names
+    std::vector<FaceKey> SortedKeys(const std::vector<FontFamily>& families, std::deque<NameText>& names)
+    {
+        std::vector<FaceKey> keys;
+        for (const auto& family : families)
+        {
+            for (const auto& font : family.fonts)
+            {
+                const NameText* name = &font.postScriptName;
+                if (name->Empty())
+                {
+                    names.push_back(family.primaryName + L" " + font.name.Text());
+                    name = &names.back();
+                }
+                keys.push_back({ NamePrefix(*name), name, font.contentHash, { &family, &font } });
+            }
+        }
+        std::sort(keys.begin(), keys.end(), KeyLess);
+        return keys;
+    }
+
+    bool SameMetrics(const FontMetrics& a, const FontMetrics& b)
+    {
+        return a.unitsPerEm == b.unitsPerEm && a.xMin == b.xMin && a.yMin == b.yMin && a.xMax == b.xMax &&
+               a.yMax == b.yMax && a.ascender == b.ascender && a.descender == b.descender && a.lineGap == b.lineGap &&
+               a.typoAscender == b.typoAscender && a.typoDescender == b.typoDescender &&
+               a.typoLineGap == b.typoLineGap && a.winAscent == b.winAscent && a.winDescent == b.winDescent &&
+               a.vertAscender == b.vertAscender && a.vertDescender == b.vertDescender &&
+               a.vertLineGap == b.vertLineGap && a.flags == b.flags;
+    }
+
+    bool SameColor(const ColorInfo& a, const ColorInfo& b)
+    {
+        return a.flags == b.flags && a.paletteCount == b.paletteCount && a.svgDocumentCount == b.svgDocumentCount &&
+               a.strikeSizes == b.strikeSizes;
+    }
+
+    bool SameLayout(const LayoutInfo& a, const LayoutInfo& b)
+    {
+        if (a.hasMorx != b.hasMorx || a.scripts.size() != b.scripts.size()) return false;
+        for (size_t i = 0; i < a.scripts.size(); ++i)
+        {
+            const ScriptFeatures& x = a.scripts[i];
+            const ScriptFeatures& y = b.scripts[i];
+            if (x.script != y.script || x.languages != y.languages || x.features != y.features) return false;
+        }
+        return true;
+    }
+
+    uint32_t CompareFaces(const CatalogFace& before, const CatalogFace& after)
+    {
+        const FontInfo& a = *before.font;
+        const FontInfo& b = *after.font;
+        uint32_t fields = 0;
+        if (before.family->primaryName != after.family->primaryName) fields |= DIFF_FAMILY;
+        if (a.name != b.name) fields |= DIFF_NAME;
+        if (a.weight != b.weight || a.stretch != b.stretch || a.style != b.style) fields |= DIFF_STYLE;
+        if (a.filePath != b.filePath || a.faceIndex != b.faceIndex) fields |= DIFF_LOCATION;
+        if (a.contentHash != 0 && b.contentHash != 0 && a.contentHash != b.contentHash) fields |= DIFF_CONTENT;
+        if (a.tablesHash != 0 && b.tablesHash != 0 && a.tablesHash != b.tablesHash) fields |= DIFF_TABLES;
+
+        // Metrics, color and license fields are read together; flags is 0 when they were not
+        if (a.metrics.flags != 0 && b.metrics.flags != 0)
+        {
+            if (a.metrics.fontRevision != b.metrics.fontRevision) fields |= DIFF_VERSION;
+            if (!SameMetrics(a.metrics, b.metrics)) fields |= DIFF_METRICS;
+            if (!SameColor(a.color, b.color)) fields |= DIFF_COLOR;
+            if (a.license.embedding != b.license.embedding || a.license.fsType != b.license.fsType ||
+                a.license.vendorId != b.license.vendorId)
+                fields |= DIFF_LICENSE;
+        }
+        // License strings are only read on request
+        if (!a.license.description.empty() && !b.license.description.empty() &&
+            (a.license.description != b.license.description || a.license.url != b.license.url))
+            fields |= DIFF_LICENSE;
+        if (!a.unicodeScripts.empty() && !b.unicodeScripts.empty() && a.unicodeScripts != b.unicodeScripts)
+            fields |= DIFF_SCRIPTS;
+        if (a.layout && b.layout && !SameLayout(*a.layout, *b.layout)) fields |= DIFF_LAYOUT;
+        return fields;
+    }
+
+    void Pair(const FaceKey& before, const FaceKey& after, CatalogDiff& diff)
+    {
+        uint32_t fields = CompareFaces(before.face, after.face);
+        if (fields == 0)
+        {
+            ++diff.unchanged;
+            return;
+        }
+        FaceChange change;
+        change.kind = FaceChangeKind::Changed;
+        change.before = before.face;
+        change.after = after.face;
+        change.fields = fields;
+        diff.changes.push_back(change);
+        ++diff.changed;
+    }
+
+    void Unpaired(const FaceKey* before, const FaceKey* after, CatalogDiff& diff)
+    {
+        FaceChange change;
+        if (before)
+        {
+            change.kind = FaceChangeKind::Removed;
+            change.before = before->face;
+            ++diff.removed;
+        }
+        else
+        {
+            change.kind = FaceChangeKind::Added;
+            change.after = after->face;
+            ++diff.added;
+        }
+        diff.changes.push_back(change);
+    }
+
+    // Faces with one name on each side (either run may be empty). Almost every run
+    // holds one face per side; duplicates are paired by identical content, then by
+    // location, then in order.
+    void MatchRun(const FaceKey* before, size_t beforeCount, const FaceKey* after, size_t afterCount, CatalogDiff& diff)
+    {
+        if (beforeCount == 1 && afterCount == 1)
+        {
+            Pair(*before, *after, diff);
+            return;
+        }
+        if (beforeCount == 0 || afterCount == 0)
+        {
+            for (size_t i = 0; i < beforeCount; ++i)
+                Unpaired(&before[i], nullptr, diff);
+            for (size_t j = 0; j < afterCount; ++j)
+                Unpaired(nullptr, &after[j], diff);
+            return;
+        }
+
+        std::vector<FaceKey> restBefore, restAfter;
+        size_t i = 0, j = 0;
+        while (i < beforeCount && j < afterCount)
+        {
+            uint64_t a = before[i].contentHash, b = after[j].contentHash;
+            if (a == b && a != 0)
+            {
+                Pair(before[i++], after[j++], diff);
+            }
+            else if (a < b || (a == b && a == 0))
+            {
+                restBefore.push_back(before[i++]);
+            }
+            else
+            {
+                restAfter.push_back(after[j++]);
+            }
+        }
+        restBefore.insert(restBefore.end(), before + i, before + beforeCount);
+        restAfter.insert(restAfter.end(), after + j, after + afterCount);
+
+        std::sort(restBefore.begin(), restBefore.end(), PathLess);
+        std::sort(restAfter.begin(), restAfter.end(), PathLess);
+        std::vector<const FaceKey*> leftBefore, leftAfter;
+        i = 0;
+        j = 0;
+        while (i < restBefore.size() && j < restAfter.size())
+        {
+            if (SamePath(restBefore[i], restAfter[j]))
+                Pair(restBefore[i++], restAfter[j++], diff);
+            else if (PathLess(restBefore[i], restAfter[j]))
+                leftBefore.push_back(&restBefore[i++]);
+            else
+                leftAfter.push_back(&restAfter[j++]);
+        }
+        for (; i < restBefore.size(); ++i)
+            leftBefore.push_back(&restBefore[i]);
+        for (; j < restAfter.size(); ++j)
+            leftAfter.push_back(&restAfter[j]);
+
+        size_t paired = std::min(leftBefore.size(), leftAfter.size());
+        for (size_t k = 0; k < paired; ++k)
+            Pair(*leftBefore[k], *leftAfter[k], diff);
+        for (size_t k = paired; k < leftBefore.size(); ++k)
+            Unpaired(leftBefore[k], nullptr, diff);
+        for (size_t k = paired; k < leftAfter.size(); ++k)
+            Unpaired(nullptr, leftAfter[k], diff);
+    }
+}
+
+const wchar_t* DiffFieldName(uint32_t field)
+{
+    switch (field)
+    {
+    case DIFF_FAMILY: return L"family";
+    case DIFF_NAME: return L"name";
+    case DIFF_STYLE: return L"style";
+    case DIFF_VERSION: return L"version";
+    case DIFF_CONTENT: return L"content";
+    case DIFF_TABLES: return L"tables";
+    case DIFF_LOCATION: return L"location";
+    case DIFF_METRICS: return L"metrics";
+    case DIFF_COLOR: return L"color";
+    case DIFF_LICENSE: return L"license";
+    case DIFF_SCRIPTS: return L"scripts";
+    case DIFF_LAYOUT: return L"layout";
+    default: return L"?";
+    }
+}
+
+CatalogDiff DiffCatalogs(const std::vector<FontFamily>& before, const std::vector<FontFamily>& after)
+{
+    std::deque<NameText> names;
+    std::vector<FaceKey> left = SortedKeys(before, names);
+    std::vector<FaceKey> right = SortedKeys(after, names);
+
+    // Merge join over runs of equal names
+    CatalogDiff diff;
+    size_t i = 0, j = 0;
+    while (i < left.size() || j < right.size())
+    {
+        int order = i == left.size() ? 1 : j == right.size() ? -1 : CompareNames(left[i], right[j]);
+        size_t iEnd = i, jEnd = j;
+        if (order <= 0)
+        {
+            while (iEnd < left.size() && CompareNames(left[iEnd], left[i]) == 0) ++iEnd;
+        }
+        if (order >= 0)
+        {
+            while (jEnd < right.size() && CompareNames(right[jEnd], right[j]) == 0) ++jEnd;
+        }
+        MatchRun(left.data() + i, iEnd - i, right.data() + j, jEnd - j, diff);
+        i = iEnd;
+        j = jEnd;
+    }
+    return diff;
+}
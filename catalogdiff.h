@@ -0,0 +1,66 @@
+// catalogdiff.h : Added, removed and changed faces between two catalog snapshots
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "catalog.h"
+
+// Fields that differ between the two versions of a face. Fields either catalog did
+// not record (hashes, metrics, layout) are not compared.
+enum : uint32_t
+{
+    DIFF_FAMILY = 0x0001,    // Family name
+    DIFF_NAME = 0x0002,      // Face name
+    DIFF_STYLE = 0x0004,     // Weight, stretch or slope
+    DIFF_VERSION = 0x0008,   // head.fontRevision
+    DIFF_CONTENT = 0x0010,   // File bytes
+    DIFF_TABLES = 0x0020,    // Tables apart from head timestamps
+    DIFF_LOCATION = 0x0040,  // File path or face index
+    DIFF_METRICS = 0x0080,
+    DIFF_COLOR = 0x0100,
+    DIFF_LICENSE = 0x0200,
+    DIFF_SCRIPTS = 0x0400,   // Unicode scripts covered by cmap
+    DIFF_LAYOUT = 0x0800,    // GSUB/GPOS scripts and features
+};
+
+// Short field name for a single DIFF_* bit
+const wchar_t* DiffFieldName(uint32_t field);
+
+enum class FaceChangeKind
+{
+    Added,
+    Removed,
+    Changed,
+};
+
+// One face, with the family it is listed under
+struct CatalogFace
+{
+    const FontFamily* family = nullptr;
+    const FontInfo* font = nullptr;
+};
+
+struct FaceChange
+{
+    FaceChangeKind kind = FaceChangeKind::Changed;
+    CatalogFace before;  // Empty for added faces
+    CatalogFace after;   // Empty for removed faces
+    uint32_t fields = 0; // DIFF_* of a changed face
+};
+
+struct CatalogDiff
+{
+    std::vector<FaceChange> changes;  // Ordered by PostScript name
+    size_t added = 0;
+    size_t removed = 0;
+    size_t changed = 0;
+    size_t unchanged = 0;
+};
+
+// Faces are matched by PostScript name (family and face name when it is missing).
+// Faces sharing a name are paired by content hash first, then by file path, then in
+// order. Both sides are sorted once and joined in a single pass; the result points
+// into the two catalogs.
+CatalogDiff DiffCatalogs(const std::vector<FontFamily>& before, const std::vector<FontFamily>& after);
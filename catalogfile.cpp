@@ -0,0 +1,379 @@
+// catalogfile.cpp : Saves and loads the scanned catalog (families, fonts, script index)
+//
+// Layout: "LFCT", version, families (with fonts), the script index, then the directory
+// listings of the walk that found the fonts (see dirwalk.h). All integers
+// are big-endian like the font data they come from; strings are UTF-16BE with a
+// 32-bit unit count.
+
+#include "catalogfile.h"
+#include <filesystem>
+#include <fstream>
+#include "fontfile.h"
+#include "trace.h"
+
+namespace
+{
+    const uint32_t kCatalogMagic = MakeTag('L', 'F', 'C', 'T');
+    const uint32_t kCatalogVersion = 5;
+
+    void PutU8(std::string& out, uint8_t value)
+    {
+        out += (char)value;
+    }
+
+    void PutU16(std::string& out, uint16_t value)
+    {
+        out += (char)(value >> 8);
+        out += (char)value;
+    }
+
+    void PutU32(std::string& out, uint32_t value)
+    {
+        PutU16(out, (uint16_t)(value >> 16));
+        PutU16(out, (uint16_t)value);
+    }
+
+    void PutU64(std::string& out, uint64_t value)
+    {
+        PutU32(out, (uint32_t)(value >> 32));
+        PutU32(out, (uint32_t)value);
+    }
+
+    void PutString(std::string& out, const std::wstring& text)
+    {
+        PutU32(out, (uint32_t)text.size());
+        for (wchar_t c : text)
+            PutU16(out, (uint16_t)c);
+    }
+
+    // Name strings are kept as UTF-16BE already and are written without decoding
+    void PutString(std::string& out, const NameText& text)
+    {
+        PutU32(out, (uint32_t)(text.Bytes().size() / 2));
+        out += text.Bytes();
+    }
+
+    void PutTags(std::string& out, const std::vector<uint32_t>& tags)
+    {
+        PutU32(out, (uint32_t)tags.size());
+        for (uint32_t tag : tags)
+            PutU32(out, tag);
+    }
+
+    template <typename Key>
+    void PutIndexMap(std::string& out, const std::map<Key, std::vector<uint32_t>>& map)
+    {
+        PutU32(out, (uint32_t)map.size());
+        for (const auto& entry : map)
+        {
+            if (sizeof(Key) == 8)
+                PutU64(out, entry.first);
+            else
+                PutU32(out, (uint32_t)entry.first);
+            PutTags(out, entry.second);
+        }
+    }
+
+    void PutMetrics(std::string& out, const FontMetrics& m)
+    {
+        PutU16(out, m.unitsPerEm);
+        PutU32(out, m.fontRevision);
+        const int16_t values[] = { m.xMin, m.yMin, m.xMax, m.yMax, m.ascender, m.descender, m.lineGap,
+                                   m.typoAscender, m.typoDescender, m.typoLineGap };
+        for (int16_t value : values)
+            PutU16(out, (uint16_t)value);
+        PutU16(out, m.winAscent);
+        PutU16(out, m.winDescent);
+        PutU16(out, (uint16_t)m.vertAscender);
+        PutU16(out, (uint16_t)m.vertDescender);
+        PutU16(out, (uint16_t)m.vertLineGap);
+        PutU8(out, m.flags);
+    }
+
+    void PutColor(std::string& out, const ColorInfo& color)
+    {
+        PutU8(out, color.flags);
+        PutU16(out, color.paletteCount);
+        PutU16(out, color.svgDocumentCount);
+        PutU16(out, (uint16_t)color.strikeSizes.size());
+        for (uint16_t ppem : color.strikeSizes)
+            PutU16(out, ppem);
+    }
+
+    void PutLicense(std::string& out, const FontLicense& license)
+    {
+        PutU8(out, (uint8_t)license.embedding);
+        PutU16(out, license.fsType);
+        PutU32(out, license.vendorId);
+        PutString(out, license.description);
+        PutString(out, license.url);
+    }
+
+    void PutFont(std::string& out, const FontInfo& font)
+    {
+        PutString(out, font.name);
+        PutString(out, font.postScriptName);
+        PutU16(out, (uint16_t)font.weight);
+        PutU16(out, (uint16_t)font.stretch);
+        PutU8(out, (uint8_t)font.style);
+        PutString(out, font.filePath);
+        PutU32(out, font.faceIndex);
+        PutU64(out, font.contentHash);
+        PutU64(out, font.tablesHash);
+        PutMetrics(out, font.metrics);
+        PutColor(out, font.color);
+        PutLicense(out, font.license);
+        PutTags(out, font.unicodeScripts);
+        PutU8(out, font.layout ? 1 : 0);
+        if (font.layout)
+        {
+            PutU32(out, (uint32_t)font.layout->scripts.size());
+            for (const auto& script : font.layout->scripts)
+            {
+                PutU32(out, script.script);
+                PutTags(out, script.languages);
+                PutTags(out, script.features);
+            }
+            PutU8(out, font.layout->hasMorx ? 1 : 0);
+        }
+    }
+
+    uint64_t GetU64(SpanCursor& in)
+    {
+        uint64_t high = in.U32();
+        return (high << 32) | in.U32();
+    }
+
+    std::wstring GetString(SpanCursor& in)
+    {
+        uint32_t length = in.U32();
+        ByteSpan units = in.Bytes(size_t(length) * 2);
+        std::wstring text;
+        text.reserve(units.size / 2);
+        for (size_t i = 0; i < units.size; i += 2)
+            text.push_back((wchar_t)units.U16(i));
+        return text;
+    }
+
+    NameText GetName(SpanCursor& in)
+    {
+        uint32_t length = in.U32();
+        ByteSpan units = in.Bytes(size_t(length) * 2);
+        if (units.Empty())
+            return NameText();
+        return NameText::FromUtf16BE(std::string(reinterpret_cast<const char*>(units.data), units.size));
+    }
+
+    std::vector<uint32_t> GetTags(SpanCursor& in)
+    {
+        uint32_t count = in.U32();
+        ByteSpan tags = in.Bytes(size_t(count) * 4);
+        std::vector<uint32_t> result;
+        result.reserve(tags.size / 4);
+        for (size_t i = 0; i < tags.size; i += 4)
+            result.push_back(tags.U32(i));
+        return result;
+    }
+
+    template <typename Key>
+    void GetIndexMap(SpanCursor& in, std::map<Key, std::vector<uint32_t>>& map)
+    {
+        uint32_t count = in.U32();
+        for (uint32_t i = 0; i < count && in.Ok(); ++i)
+        {
+            Key key = sizeof(Key) == 8 ? (Key)GetU64(in) : (Key)in.U32();
+            map[key] = GetTags(in);
+        }
+    }
+
+    void GetMetrics(SpanCursor& in, FontMetrics& m)
+    {
+        m.unitsPerEm = in.U16();
+        m.fontRevision = in.U32();
+        int16_t* values[] = { &m.xMin, &m.yMin, &m.xMax, &m.yMax, &m.ascender, &m.descender, &m.lineGap,
+                              &m.typoAscender, &m.typoDescender, &m.typoLineGap };
+        for (int16_t* value : values)
+            *value = (int16_t)in.U16();
+        m.winAscent = in.U16();
+        m.winDescent = in.U16();
+        m.vertAscender = (int16_t)in.U16();
+        m.vertDescender = (int16_t)in.U16();
+        m.vertLineGap = (int16_t)in.U16();
+        m.flags = in.U8();
+    }
+
+    void GetColor(SpanCursor& in, ColorInfo& color)
+    {
+        color.flags = in.U8();
+        color.paletteCount = in.U16();
+        color.svgDocumentCount = in.U16();
+        uint16_t strikeCount = in.U16();
+        for (uint16_t i = 0; i < strikeCount && in.Ok(); ++i)
+            color.strikeSizes.push_back(in.U16());
+    }
+
+    void GetLicense(SpanCursor& in, FontLicense& license)
+    {
+        uint8_t embedding = in.U8();
+        license.embedding = embedding <= (uint8_t)EmbeddingLevel::Unknown ? (EmbeddingLevel)embedding : EmbeddingLevel::Unknown;
+        license.fsType = in.U16();
+        license.vendorId = in.U32();
+        license.description = GetString(in);
+        license.url = GetString(in);
+    }
+
+    void GetFont(SpanCursor& in, FontInfo& font)
+    {
+        font.name = GetName(in);
+        font.postScriptName = GetName(in);
+        font.weight = (DWRITE_FONT_WEIGHT)in.U16();
+        font.stretch = (DWRITE_FONT_STRETCH)in.U16();
+        font.style = (DWRITE_FONT_STYLE)in.U8();
+        font.filePath = GetString(in);
+        font.faceIndex = in.U32();
+        font.contentHash = GetU64(in);
+        font.tablesHash = GetU64(in);
+        GetMetrics(in, font.metrics);
+        GetColor(in, font.color);
+        GetLicense(in, font.license);
+        font.unicodeScripts = GetTags(in);
+        if (in.U8())
+        {
+            auto layout = std::make_shared<LayoutInfo>();
+            uint32_t scriptCount = in.U32();
+            for (uint32_t i = 0; i < scriptCount && in.Ok(); ++i)
+            {
+                ScriptFeatures script;
+                script.script = in.U32();
+                script.languages = GetTags(in);
+                script.features = GetTags(in);
+                layout->scripts.push_back(std::move(script));
+            }
+            layout->hasMorx = in.U8() != 0;
+            font.layout = layout;
+        }
+    }
+}
+
+bool SaveCatalog(const std::wstring& path, const std::vector<FontFamily>& fontFamilies, const ScriptIndex& index,
+                 const DirectoryCache* directories)
+{
+    TraceScope trace("SaveCatalog");
+    std::string out;
+    PutU32(out, kCatalogMagic);
+    PutU32(out, kCatalogVersion);
+    PutU32(out, (uint32_t)fontFamilies.size());
+    for (const auto& family : fontFamilies)
+    {
+        PutString(out, family.primaryName);
+        PutString(out, family.postScriptFamilyName);
+        PutU32(out, (uint32_t)family.allNames.size());
+        for (const auto& name : family.allNames)
+            PutString(out, name);
+        PutU32(out, (uint32_t)family.fonts.size());
+        for (const auto& font : family.fonts)
+            PutFont(out, font);
+    }
+    PutIndexMap(out, index.unicodeScripts);
+    PutIndexMap(out, index.layoutScripts);
+    PutIndexMap(out, index.languages);
+    PutU32(out, directories ? (uint32_t)directories->size() : 0);
+    if (directories)
+    {
+        for (const auto& directory : *directories)
+        {
+            PutString(out, directory.first);
+            PutU64(out, directory.second.lastWriteTime);
+            PutU32(out, directory.second.rejected);
+            PutU32(out, (uint32_t)directory.second.entries.size());
+            for (const auto& entry : directory.second.entries)
+            {
+                PutU8(out, (uint8_t)entry.kind);
+                PutString(out, entry.name);
+            }
+        }
+    }
+
+    std::ofstream file(std::filesystem::path(path), std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!file.is_open())
+        return false;
+    file.write(out.data(), (std::streamsize)out.size());
+    return file.good();
+}
+
+bool LoadCatalog(const std::wstring& path, std::vector<FontFamily>& fontFamilies, ScriptIndex& index,
+                 DirectoryCache* directories)
+{
+    TraceScope trace("LoadCatalog");
+    MappedFile file;
+    if (!file.Open(path))
+        return false;
+
+    SpanCursor in(ByteSpan(file.data, file.size));
+    if (in.U32() != kCatalogMagic || in.U32() != kCatalogVersion)
+        return false;
+
+    std::vector<FontFamily> families;
+    uint32_t familyCount = in.U32();
+    for (uint32_t i = 0; i < familyCount && in.Ok(); ++i)
+    {
+        FontFamily family;
+        family.primaryName = GetString(in);
+        family.postScriptFamilyName = GetName(in);
+        uint32_t nameCount = in.U32();
+        for (uint32_t j = 0; j < nameCount && in.Ok(); ++j)
+            family.allNames.insert(GetName(in));
+        uint32_t fontCount = in.U32();
+        for (uint32_t j = 0; j < fontCount && in.Ok(); ++j)
+        {
+            FontInfo font;
+            GetFont(in, font);
+            family.fonts.push_back(std::move(font));
+        }
+        families.push_back(std::move(family));
+    }
+
+    ScriptIndex loaded;
+    GetIndexMap(in, loaded.unicodeScripts);
+    GetIndexMap(in, loaded.layoutScripts);
+    GetIndexMap(in, loaded.languages);
+    DirectoryCache listings;
+    uint32_t directoryCount = in.U32();
+    for (uint32_t i = 0; i < directoryCount && in.Ok(); ++i)
+    {
+        std::wstring directory = GetString(in);
+        DirectoryListing listing;
+        listing.lastWriteTime = GetU64(in);
+        listing.rejected = in.U32();
+        uint32_t entryCount = in.U32();
+        for (uint32_t j = 0; j < entryCount && in.Ok(); ++j)
+        {
+            uint8_t kind = in.U8();
+            if (kind > (uint8_t)EntryKind::Link)
+                return false;
+            listing.entries.push_back({ GetString(in), (EntryKind)kind });
+        }
+        listings[std::move(directory)] = std::move(listing);
+    }
+    if (!in.Ok())
+        return false;
+    // Family ids must refer to loaded families
+    auto validIds = [&](const std::vector<uint32_t>& ids)
+    {
+        for (uint32_t id : ids)
+            if (id >= families.size()) return false;
+        return true;
+    };
+    for (const auto& entry : loaded.unicodeScripts)
+        if (!validIds(entry.second)) return false;
+    for (const auto& entry : loaded.layoutScripts)
+        if (!validIds(entry.second)) return false;
+    for (const auto& entry : loaded.languages)
+        if (!validIds(entry.second)) return false;
+
+    fontFamilies = std::move(families);
+    index = std::move(loaded);
+    if (directories)
+        *directories = std::move(listings);
+    return true;
+}
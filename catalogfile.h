@@ -0,0 +1,19 @@
+// catalogfile.h : Saves and loads the scanned catalog (families, fonts, script index)
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "catalog.h"
+#include "dirwalk.h"
+#include "scriptindex.h"
+
+// Write the catalog to path, with the directory listings of the walk that found the fonts
+// when given; false if the file cannot be written
+bool SaveCatalog(const std::wstring& path, const std::vector<FontFamily>& fontFamilies, const ScriptIndex& index,
+                 const DirectoryCache* directories = nullptr);
+
+// Read a catalog written by SaveCatalog; false if it is missing, truncated or from another version
+bool LoadCatalog(const std::wstring& path, std::vector<FontFamily>& fontFamilies, ScriptIndex& index,
+                 DirectoryCache* directories = nullptr);
@@ -0,0 +1,453 @@
+// cff.cpp : CFF (Compact Font Format) structures and Type 2 charstring outlines
+//
+
+#include "cff.h"
+#include <cmath>
+#include "outline.h"
+
+namespace
+{
+    constexpr size_t kMaxDictOperands = 48;
+    constexpr size_t kMaxStack = 48;         // Type 2 argument stack limit
+    constexpr int kMaxSubrDepth = 10;        // Type 2 subroutine nesting limit
+
+    // One DICT operand; false for bytes that are neither operands nor operators
+    bool ReadDictOperand(SpanCursor& cursor, uint8_t b0, int32_t& value)
+    {
+        value = 0;
+        if (b0 == 28)
+        {
+            value = (int16_t)cursor.U16();
+        }
+        else if (b0 == 29)
+        {
+            value = (int32_t)cursor.U32();
+        }
+        else if (b0 == 30)
+        {
+            // Real number: nibbles up to an 0xF terminator
+            uint8_t byte = 0;
+            do
+            {
+                byte = cursor.U8();
+            } while (cursor.Ok() && (byte & 0x0F) != 0x0F && (byte & 0xF0) != 0xF0);
+        }
+        else if (b0 >= 32 && b0 <= 246)
+        {
+            value = int32_t(b0) - 139;
+        }
+        else if (b0 >= 247 && b0 <= 250)
+        {
+            value = (int32_t(b0) - 247) * 256 + cursor.U8() + 108;
+        }
+        else if (b0 >= 251 && b0 <= 254)
+        {
+            value = -(int32_t(b0) - 251) * 256 - cursor.U8() - 108;
+        }
+        else
+        {
+            return false;
+        }
+        return true;
+    }
+
+    // Local subroutines of a Top or Font DICT: Private is [size, offset] from the
+    // start of the table, and its Subrs offset is relative to the Private DICT.
+    // Fonts without local subroutines get an empty INDEX.
+    void ReadLocalSubrs(ByteSpan cff, ByteSpan dict, CffIndex& subrs)
+    {
+        int32_t operands[2];
+        size_t count = 0;
+        if (!FindCffDictEntry(dict, 18, operands, 2, count) || count < 2 || operands[0] < 0 || operands[1] < 0)
+            return;
+        ByteSpan privateDict = cff.Sub((size_t)operands[1], (size_t)operands[0]);
+        int32_t subrsOffset = 0;
+        if (!FindCffDictEntry(privateDict, 19, &subrsOffset, 1, count) || count < 1 || subrsOffset < 0)
+            return;
+        CffIndex index;
+        if (ReadCffIndex(cff, size_t(operands[1]) + size_t(subrsOffset), index))
+            subrs = index;
+    }
+
+    // Subroutine numbers are biased so small charstrings can call the most used ones
+    int32_t SubrBias(uint32_t count)
+    {
+        return count < 1240 ? 107 : count < 33900 ? 1131 : 32768;
+    }
+
+    // Type 2 charstring interpreter state
+    struct CharStringRunner
+    {
+        const CffFont& font;
+        const CffIndex& localSubrs;
+        PathSink& sink;
+        float stack[kMaxStack];
+        size_t count = 0;
+        float x = 0, y = 0;
+        uint32_t stems = 0;
+        bool widthSeen = false;
+        bool open = false;
+        bool ended = false;
+
+        CharStringRunner(const CffFont& cffFont, const CffIndex& subrs, PathSink& pathSink)
+            : font(cffFont), localSubrs(subrs), sink(pathSink)
+        {
+        }
+
+        // The first stack-clearing operator may carry the advance width as an extra
+        // leading argument; it is dropped since hmtx has the same value
+        size_t Start(bool hasWidth)
+        {
+            size_t first = !widthSeen && hasWidth ? 1 : 0;
+            widthSeen = true;
+            return first;
+        }
+
+        void MoveTo(float dx, float dy)
+        {
+            if (open) sink.Close();
+            x += dx;
+            y += dy;
+            sink.MoveTo(x, y);
+            open = true;
+        }
+
+        void LineTo(float dx, float dy)
+        {
+            x += dx;
+            y += dy;
+            sink.LineTo(x, y);
+        }
+
+        void CurveTo(float dx1, float dy1, float dx2, float dy2, float dx3, float dy3)
+        {
+            float x1 = x + dx1, y1 = y + dy1;
+            float x2 = x1 + dx2, y2 = y1 + dy2;
+            x = x2 + dx3;
+            y = y2 + dy3;
+            sink.CubicTo(x1, y1, x2, y2, x, y);
+        }
+
+        void Stems(bool hasWidth)
+        {
+            size_t first = Start(hasWidth);
+            stems += uint32_t((count - first) / 2);
+        }
+
+        bool Run(ByteSpan program, int depth);
+        bool Escape(uint8_t op);
+    };
+
+    bool CharStringRunner::Run(ByteSpan program, int depth)
+    {
+        if (depth > kMaxSubrDepth) return false;
+
+        SpanCursor cursor(program);
+        while (cursor.Remaining() > 0)
+        {
+            uint8_t b0 = cursor.U8();
+            if (b0 >= 32 || b0 == 28)
+            {
+                float value = 0;
+                if (b0 == 28) value = (int16_t)cursor.U16();
+                else if (b0 <= 246) value = float(int32_t(b0) - 139);
+                else if (b0 <= 250) value = float((int32_t(b0) - 247) * 256 + cursor.U8() + 108);
+                else if (b0 <= 254) value = float(-(int32_t(b0) - 251) * 256 - cursor.U8() - 108);
+                else value = (int32_t)cursor.U32() / 65536.0f;  // 16.16 fixed
+                if (!cursor.Ok() || count == kMaxStack) return false;
+                stack[count++] = value;
+                continue;
+            }
+
+            size_t i = 0;
+            switch (b0)
+            {
+            case 1:   // hstem
+            case 3:   // vstem
+            case 18:  // hstemhm
+            case 23:  // vstemhm
+                Stems(count % 2 != 0);
+                break;
+            case 19:  // hintmask
+            case 20:  // cntrmask
+                // Arguments here are an implied vstemhm; the mask has a bit per stem
+                Stems(count % 2 != 0);
+                cursor.Skip((stems + 7) / 8);
+                break;
+            case 21:  // rmoveto
+                i = Start(count > 2);
+                if (count - i < 2) return false;
+                MoveTo(stack[i], stack[i + 1]);
+                break;
+            case 22:  // hmoveto
+                i = Start(count > 1);
+                if (count - i < 1) return false;
+                MoveTo(stack[i], 0);
+                break;
+            case 4:   // vmoveto
+                i = Start(count > 1);
+                if (count - i < 1) return false;
+                MoveTo(0, stack[i]);
+                break;
+            case 5:   // rlineto
+                for (; i + 2 <= count; i += 2)
+                    LineTo(stack[i], stack[i + 1]);
+                break;
+            case 6:   // hlineto
+            case 7:   // vlineto
+            {
+                bool horizontal = b0 == 6;
+                for (; i < count; ++i, horizontal = !horizontal)
+                {
+                    if (horizontal) LineTo(stack[i], 0);
+                    else LineTo(0, stack[i]);
+                }
+                break;
+            }
+            case 8:   // rrcurveto
+                for (; i + 6 <= count; i += 6)
+                    CurveTo(stack[i], stack[i + 1], stack[i + 2], stack[i + 3], stack[i + 4], stack[i + 5]);
+                break;
+            case 24:  // rcurveline
+                for (; i + 8 <= count; i += 6)
+                    CurveTo(stack[i], stack[i + 1], stack[i + 2], stack[i + 3], stack[i + 4], stack[i + 5]);
+                if (i + 2 <= count)
+                    LineTo(stack[i], stack[i + 1]);
+                break;
+            case 25:  // rlinecurve
+                for (; i + 8 <= count; i += 2)
+                    LineTo(stack[i], stack[i + 1]);
+                if (i + 6 <= count)
+                    CurveTo(stack[i], stack[i + 1], stack[i + 2], stack[i + 3], stack[i + 4], stack[i + 5]);
+                break;
+            case 26:  // vvcurveto
+            {
+                float dx1 = 0;
+                if (count % 2 != 0) dx1 = stack[i++];
+                for (; i + 4 <= count; i += 4, dx1 = 0)
+                    CurveTo(dx1, stack[i], stack[i + 1], stack[i + 2], 0, stack[i + 3]);
+                break;
+            }
+            case 27:  // hhcurveto
+            {
+                float dy1 = 0;
+                if (count % 2 != 0) dy1 = stack[i++];
+                for (; i + 4 <= count; i += 4, dy1 = 0)
+                    CurveTo(stack[i], dy1, stack[i + 1], stack[i + 2], stack[i + 3], 0);
+                break;
+            }
+            case 30:  // vhcurveto
+            case 31:  // hvcurveto
+            {
+                // Tangents alternate; the last curve may take an extra final coordinate
+                bool horizontal = b0 == 31;
+                for (; i + 4 <= count; i += 4, horizontal = !horizontal)
+                {
+                    float last = count - i == 5 ? stack[i + 4] : 0;
+                    if (horizontal) CurveTo(stack[i], 0, stack[i + 1], stack[i + 2], last, stack[i + 3]);
+                    else CurveTo(0, stack[i], stack[i + 1], stack[i + 2], stack[i + 3], last);
+                }
+                break;
+            }
+            case 10:  // callsubr
+            case 29:  // callgsubr
+            {
+                if (count == 0) return false;
+                const CffIndex& subrs = b0 == 10 ? localSubrs : font.globalSubrs;
+                int32_t index = int32_t(stack[--count]) + SubrBias(subrs.count);
+                if (index < 0 || uint32_t(index) >= subrs.count) return false;
+                if (!Run(subrs.Get((uint32_t)index), depth + 1)) return false;
+                if (ended) return true;
+                continue;  // The subroutine's arguments stay on the stack
+            }
+            case 11:  // return
+                return cursor.Ok();
+            case 14:  // endchar
+                // Four extra arguments are the deprecated seac accent composition, not drawn
+                Start(count == 1 || count == 5);
+                if (open) sink.Close();
+                open = false;
+                ended = true;
+                return true;
+            case 12:
+                if (!Escape(cursor.U8())) return false;
+                break;
+            default:
+                return false;
+            }
+            count = 0;
+        }
+        return cursor.Ok();
+    }
+
+    bool CharStringRunner::Escape(uint8_t op)
+    {
+        const float* s = stack;
+        switch (op)
+        {
+        case 0:   // dotsection (deprecated, no effect)
+            return true;
+        case 35:  // flex
+            if (count < 13) return false;
+            CurveTo(s[0], s[1], s[2], s[3], s[4], s[5]);
+            CurveTo(s[6], s[7], s[8], s[9], s[10], s[11]);
+            return true;
+        case 34:  // hflex
+            if (count < 7) return false;
+            CurveTo(s[0], 0, s[1], s[2], s[3], 0);
+            CurveTo(s[4], 0, s[5], -s[2], s[6], 0);
+            return true;
+        case 36:  // hflex1
+            if (count < 9) return false;
+            CurveTo(s[0], s[1], s[2], s[3], s[4], 0);
+            CurveTo(s[5], 0, s[6], s[7], s[8], -(s[1] + s[3] + s[7]));
+            return true;
+        case 37:  // flex1
+        {
+            if (count < 11) return false;
+            float dx = s[0] + s[2] + s[4] + s[6] + s[8];
+            float dy = s[1] + s[3] + s[5] + s[7] + s[9];
+            CurveTo(s[0], s[1], s[2], s[3], s[4], s[5]);
+            if (std::fabs(dx) > std::fabs(dy)) CurveTo(s[6], s[7], s[8], s[9], s[10], -dy);
+            else CurveTo(s[6], s[7], s[8], s[9], -dx, s[10]);
+            return true;
+        }
+        default:
+            // The Type 2 arithmetic and storage operators are reserved in OpenType CFF
+            return false;
+        }
+    }
+}
+
+bool ReadCffIndex(ByteSpan cff, size_t offset, CffIndex& index)
+{
+    if (!cff.Has(offset, 2)) return false;
+    index.count = cff.U16(offset);
+    if (index.count == 0)
+    {
+        index.end = offset + 2;
+        return true;
+    }
+    if (!cff.Has(offset + 2, 1)) return false;
+    index.offSize = cff.U8(offset + 2);
+    if (index.offSize < 1 || index.offSize > 4) return false;
+    index.offsets = cff.Array(offset + 3, size_t(index.count) + 1, index.offSize);
+    if (index.offsets.Empty()) return false;
+    size_t base = offset + 3 + index.offsets.size - 1;
+    index.data = cff.From(base);
+    index.end = base + index.Offset(index.count);
+    return cff.Has(index.end, 0);
+}
+
+bool FindCffDictEntry(ByteSpan dict, uint16_t op, int32_t* operands, size_t capacity, size_t& count)
+{
+    int32_t values[kMaxDictOperands];
+    size_t stack = 0;
+    SpanCursor cursor(dict);
+    while (cursor.Remaining() > 0)
+    {
+        uint8_t b0 = cursor.U8();
+        if (b0 <= 21)
+        {
+            uint16_t entry = b0 == 12 ? uint16_t(0x0C00 | cursor.U8()) : b0;
+            if (!cursor.Ok()) return false;
+            if (entry == op)
+            {
+                count = stack < capacity ? stack : capacity;
+                for (size_t i = 0; i < count; ++i)
+                    operands[i] = values[i];
+                return true;
+            }
+            stack = 0;
+            continue;
+        }
+
+        int32_t value;
+        if (!ReadDictOperand(cursor, b0, value) || stack == kMaxDictOperands) return false;
+        values[stack++] = value;
+    }
+    return false;
+}
+
+bool CffFont::Open(ByteSpan cff)
+{
+    *this = CffFont();
+    table = cff;
+    if (!cff.Has(0, 4) || cff.U8(0) != 1) return false;
+
+    // Header, then the Name, Top DICT, String and Global Subr INDEXes back to back
+    CffIndex names;
+    if (!ReadCffIndex(cff, cff.U8(2), names) ||
+        !ReadCffIndex(cff, names.end, topDict) ||
+        !ReadCffIndex(cff, topDict.end, strings) ||
+        !ReadCffIndex(cff, strings.end, globalSubrs) ||
+        topDict.count == 0)
+        return false;
+
+    // An OpenType CFF table holds exactly one font
+    ByteSpan top = topDict.Get(0);
+    int32_t operands[2];
+    size_t count = 0;
+    if (!FindCffDictEntry(top, 17, operands, 1, count) || count < 1 || operands[0] < 0 ||
+        !ReadCffIndex(cff, (size_t)operands[0], charStrings))
+        return false;
+
+    cidKeyed = FindCffDictEntry(top, 0x0C1E, operands, 0, count);  // ROS
+    if (!cidKeyed)
+    {
+        localSubrs.resize(1);
+        ReadLocalSubrs(cff, top, localSubrs[0]);
+        return true;
+    }
+
+    // CID-keyed: each Font DICT has its own Private DICT; FDSelect picks one per glyph
+    CffIndex fdArray;
+    if (FindCffDictEntry(top, 0x0C24, operands, 1, count) && count == 1 && operands[0] >= 0 &&
+        ReadCffIndex(cff, (size_t)operands[0], fdArray))
+    {
+        localSubrs.resize(fdArray.count);
+        for (uint32_t fd = 0; fd < fdArray.count; ++fd)
+            ReadLocalSubrs(cff, fdArray.Get(fd), localSubrs[fd]);
+    }
+    if (FindCffDictEntry(top, 0x0C25, operands, 1, count) && count == 1 && operands[0] >= 0)
+        fdSelect = cff.From((size_t)operands[0]);
+    return true;
+}
+
+size_t CffFont::FontDictIndex(uint32_t glyph) const
+{
+    if (!fdSelect.Has(0, 1)) return 0;
+    uint8_t format = fdSelect.U8(0);
+    if (format == 0)
+    {
+        return fdSelect.Has(1 + size_t(glyph), 1) ? fdSelect.U8(1 + size_t(glyph)) : 0;
+    }
+    if (format == 3 && fdSelect.Has(1, 2))
+    {
+        // Ranges of [first, fd] sorted by first glyph, then a sentinel glyph
+        uint16_t rangeCount = fdSelect.U16(1);
+        ByteSpan ranges = fdSelect.Array(3, rangeCount, 3);
+        size_t lo = 0, hi = ranges.size / 3;
+        while (lo < hi)
+        {
+            size_t mid = (lo + hi) / 2;
+            if (ranges.U16(mid * 3) <= glyph) lo = mid + 1;
+            else hi = mid;
+        }
+        return lo > 0 ? ranges.U8((lo - 1) * 3 + 2) : 0;
+    }
+    return 0;
+}
+
+bool DrawCffGlyph(const CffFont& font, uint32_t glyph, PathSink& sink)
+{
+    if (glyph >= font.charStrings.count) return false;
+    static const CffIndex kNoSubrs;
+    size_t fd = font.FontDictIndex(glyph);
+    const CffIndex& subrs = fd < font.localSubrs.size() ? font.localSubrs[fd] : kNoSubrs;
+
+    CharStringRunner runner(font, subrs, sink);
+    if (!runner.Run(font.charStrings.Get(glyph), 0)) return false;
+    if (runner.open) sink.Close();
+    return true;
+}
@@ -0,0 +1,64 @@
+// cff.h : CFF (Compact Font Format) structures and Type 2 charstring outlines
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "bytespan.h"
+
+struct PathSink;
+
+// A CFF INDEX: count objects whose 1-based offsets are relative to the byte before the data
+struct CffIndex
+{
+    uint32_t count = 0;
+    uint8_t offSize = 0;
+    ByteSpan offsets;
+    ByteSpan data;   // Starts at the byte before the first object
+    size_t end = 0;  // Offset just past the INDEX in the table
+
+    uint32_t Offset(uint32_t i) const
+    {
+        uint32_t value = 0;
+        for (uint8_t k = 0; k < offSize; ++k)
+            value = (value << 8) | offsets.U8(size_t(i) * offSize + k);
+        return value;
+    }
+
+    // Empty span for a malformed entry
+    ByteSpan Get(uint32_t i) const
+    {
+        uint32_t start = Offset(i), next = Offset(i + 1);
+        return next >= start ? data.Sub(start, next - start) : ByteSpan();
+    }
+};
+
+bool ReadCffIndex(ByteSpan cff, size_t offset, CffIndex& index);
+
+// Operands of the first DICT entry for op (two-byte operators 12 x are 0x0C00 | x).
+// Real numbers read as 0; none of the operators looked up take one. False if the
+// entry is absent or the DICT is malformed.
+bool FindCffDictEntry(ByteSpan dict, uint16_t op, int32_t* operands, size_t capacity, size_t& count);
+
+// The single font of an OpenType CFF table, ready for charstring interpretation
+struct CffFont
+{
+    ByteSpan table;
+    CffIndex topDict;                  // Top DICT INDEX (one entry)
+    CffIndex strings;
+    CffIndex globalSubrs;
+    CffIndex charStrings;
+    std::vector<CffIndex> localSubrs;  // Per font DICT; a single entry for name-keyed fonts
+    ByteSpan fdSelect;                 // CID-keyed fonts: glyph to font DICT map
+    bool cidKeyed = false;
+
+    bool Open(ByteSpan cff);
+    uint32_t GlyphCount() const { return charStrings.count; }
+    // Font DICT (and so local subroutines) of a glyph
+    size_t FontDictIndex(uint32_t glyph) const;
+};
+
+// Run a glyph's Type 2 charstring into sink, in font units. False if the program is malformed.
+bool DrawCffGlyph(const CffFont& font, uint32_t glyph, PathSink& sink);
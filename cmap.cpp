@@ -0,0 +1,214 @@
+// cmap.cpp : Character coverage from the cmap table
+//
+
+#include "cmap.h"
+#include <algorithm>
+
+namespace
+{
+    enum
+    {
+        RANK_SYMBOL = 1,
+        RANK_BMP = 2,
+        RANK_FULL = 3,
+    };
+
+    void AddRange(std::vector<CodePointRange>& ranges, uint32_t first, uint32_t last)
+    {
+        if (!ranges.empty() && ranges.back().last + 1 == first)
+            ranges.back().last = last;
+        else
+            ranges.push_back({ first, last });
+    }
+
+    bool ReadFormat4(ByteSpan subtable, std::vector<CodePointRange>& ranges)
+    {
+        if (!subtable.Has(0, 14)) return false;
+        size_t segCount = subtable.U16(6) / 2;
+        // endCode[], reservedPad, startCode[], idDelta[], idRangeOffset[]
+        ByteSpan arrays = subtable.Array(14, segCount * 4 + 1, 2);
+        if (arrays.Empty()) return false;
+        size_t endCodes = 14, startCodes = 16 + segCount * 2;
+        size_t deltas = startCodes + segCount * 2, rangeOffsets = deltas + segCount * 2;
+
+        for (size_t i = 0; i < segCount; ++i)
+        {
+            uint32_t start = subtable.U16(startCodes + i * 2);
+            uint32_t end = subtable.U16(endCodes + i * 2);
+            uint16_t delta = subtable.U16(deltas + i * 2);
+            uint16_t rangeOffset = subtable.U16(rangeOffsets + i * 2);
+            if (start > end || start == 0xFFFF)
+                continue;
+
+            if (rangeOffset == 0)
+            {
+                // glyph = code + delta; at most one code in the segment maps to .notdef
+                uint32_t zero = uint16_t(0x10000 - delta);
+                if (zero < start || zero > end)
+                {
+                    AddRange(ranges, start, end);
+                }
+                else
+                {
+                    if (zero > start) AddRange(ranges, start, zero - 1);
+                    if (zero < end) AddRange(ranges, zero + 1, end);
+                }
+                continue;
+            }
+
+            // Glyph ids come from glyphIdArray, addressed relative to this idRangeOffset entry
+            size_t base = rangeOffsets + i * 2 + rangeOffset;
+            ByteSpan glyphs = subtable.Array(base, end - start + 1, 2);
+            if (glyphs.Empty())
+                continue;
+            for (uint32_t code = start; code <= end; ++code)
+            {
+                uint16_t glyph = glyphs.U16((code - start) * 2);
+                if (glyph != 0 && uint16_t(glyph + delta) != 0)
+                    AddRange(ranges, code, code);
+            }
+        }
+        return true;
+    }
+
+    bool ReadFormat12(ByteSpan subtable, std::vector<CodePointRange>& ranges)
+    {
+        if (!subtable.Has(0, 16)) return false;
+        bool manyToOne = subtable.U16(0) == 13;
+        uint32_t count = subtable.U32(12);
+        ByteSpan groups = subtable.Array(16, count, 12);
+        if (groups.Empty() && count > 0) return false;
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            size_t group = size_t(i) * 12;
+            uint32_t first = groups.U32(group);
+            uint32_t last = std::min<uint32_t>(groups.U32(group + 4), 0x10FFFF);
+            uint32_t glyph = groups.U32(group + 8);
+            if (first > last)
+                continue;
+            if (glyph == 0)
+            {
+                // Format 13 maps the whole group to this glyph; format 12 only its first code
+                if (manyToOne || first == last) continue;
+                ++first;
+            }
+            AddRange(ranges, first, last);
+        }
+        return true;
+    }
+
+    // Best subtable for Unicode lookups. Rank: full-repertoire Unicode (format 12/13) over
+    // BMP Unicode (format 4), then optionally a Windows symbol (3,0) format 4 subtable.
+    ByteSpan FindUnicodeSubtable(ByteSpan cmap, bool allowSymbol, int& bestRank)
+    {
+        ByteSpan best;
+        bestRank = 0;
+        if (!cmap.Has(0, 4)) return best;
+        uint16_t count = cmap.U16(2);
+        ByteSpan records = cmap.Array(4, count, 8);
+        for (size_t record = 0; record < records.size; record += 8)
+        {
+            uint16_t platformId = records.U16(record);
+            uint16_t encodingId = records.U16(record + 2);
+            ByteSpan subtable = cmap.From(records.U32(record + 4));
+            if (!subtable.Has(0, 2))
+                continue;
+            bool unicode = platformId == 0 || (platformId == 3 && (encodingId == 1 || encodingId == 10));
+            bool symbol = allowSymbol && platformId == 3 && encodingId == 0;
+            uint16_t format = subtable.U16(0);
+            int rank = unicode ? ((format == 12 || format == 13) ? RANK_FULL : format == 4 ? RANK_BMP : 0)
+                               : (symbol && format == 4) ? RANK_SYMBOL : 0;
+            if (rank > bestRank)
+            {
+                best = subtable;
+                bestRank = rank;
+            }
+        }
+        return best;
+    }
+
+    uint16_t LookupFormat4(ByteSpan subtable, uint32_t code)
+    {
+        if (code > 0xFFFF || !subtable.Has(0, 14)) return 0;
+        size_t segCount = subtable.U16(6) / 2;
+        if (subtable.Array(14, segCount * 4 + 1, 2).Empty()) return 0;
+        size_t endCodes = 14, startCodes = 16 + segCount * 2;
+        size_t deltas = startCodes + segCount * 2, rangeOffsets = deltas + segCount * 2;
+
+        // First segment whose endCode is at or above the code
+        size_t lo = 0, hi = segCount;
+        while (lo < hi)
+        {
+            size_t mid = (lo + hi) / 2;
+            if (subtable.U16(endCodes + mid * 2) < code) lo = mid + 1;
+            else hi = mid;
+        }
+        if (lo == segCount || subtable.U16(startCodes + lo * 2) > code) return 0;
+
+        uint16_t delta = subtable.U16(deltas + lo * 2);
+        uint16_t rangeOffset = subtable.U16(rangeOffsets + lo * 2);
+        if (rangeOffset == 0) return uint16_t(code + delta);
+        size_t entry = rangeOffsets + lo * 2 + rangeOffset + (code - subtable.U16(startCodes + lo * 2)) * 2;
+        if (!subtable.Has(entry, 2)) return 0;
+        uint16_t glyph = subtable.U16(entry);
+        return glyph != 0 ? uint16_t(glyph + delta) : 0;
+    }
+
+    uint16_t LookupFormat12(ByteSpan subtable, uint32_t code)
+    {
+        if (!subtable.Has(0, 16)) return 0;
+        bool manyToOne = subtable.U16(0) == 13;
+        ByteSpan groups = subtable.Array(16, subtable.U32(12), 12);
+        size_t lo = 0, hi = groups.size / 12;
+        while (lo < hi)
+        {
+            size_t mid = (lo + hi) / 2;
+            if (groups.U32(mid * 12 + 4) < code) lo = mid + 1;
+            else hi = mid;
+        }
+        if (lo == groups.size / 12 || groups.U32(lo * 12) > code) return 0;
+        uint32_t glyph = groups.U32(lo * 12 + 8);
+        if (!manyToOne) glyph += code - groups.U32(lo * 12);
+        return glyph <= 0xFFFF ? (uint16_t)glyph : 0;
+    }
+}
+
+std::vector<CodePointRange> ReadCmapRanges(ByteSpan cmap)
+{
+    std::vector<CodePointRange> ranges;
+    int bestRank = 0;
+    ByteSpan best = FindUnicodeSubtable(cmap, false, bestRank);
+
+    bool ok = bestRank == RANK_FULL ? ReadFormat12(best, ranges) : bestRank == RANK_BMP ? ReadFormat4(best, ranges) : false;
+    if (!ok)
+        ranges.clear();
+
+    // Subtables are meant to be sorted, but do not rely on it
+    std::sort(ranges.begin(), ranges.end(),
+              [](const CodePointRange& a, const CodePointRange& b) { return a.first < b.first; });
+    std::vector<CodePointRange> merged;
+    for (const auto& range : ranges)
+    {
+        if (!merged.empty() && range.first <= merged.back().last + 1)
+            merged.back().last = std::max(merged.back().last, range.last);
+        else
+            merged.push_back(range);
+    }
+    return merged;
+}
+
+uint16_t LookupGlyph(ByteSpan cmap, uint32_t codePoint)
+{
+    int rank = 0;
+    ByteSpan subtable = FindUnicodeSubtable(cmap, true, rank);
+    if (rank == RANK_FULL) return LookupFormat12(subtable, codePoint);
+    if (rank == RANK_BMP) return LookupFormat4(subtable, codePoint);
+    if (rank == RANK_SYMBOL)
+    {
+        // Symbol fonts map their 8-bit codes into the private use area at U+F000
+        uint16_t glyph = LookupFormat4(subtable, codePoint);
+        return glyph != 0 || codePoint > 0xFF ? glyph : LookupFormat4(subtable, 0xF000 + codePoint);
+    }
+    return 0;
+}
@@ -0,0 +1,23 @@
+// cmap.h : Character coverage from the cmap table
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "bytespan.h"
+
+struct CodePointRange
+{
+    uint32_t first;
+    uint32_t last;  // Inclusive
+};
+
+// Sorted, merged code point ranges mapped to a non-zero glyph by the best Unicode
+// subtable (format 12/13 for full Unicode, otherwise format 4). Symbol and Mac-only
+// cmaps give no ranges.
+std::vector<CodePointRange> ReadCmapRanges(ByteSpan cmap);
+
+// Glyph of a code point in the same Unicode subtable, falling back to a Windows symbol
+// subtable (whose codes may sit at U+F000 + byte); 0 if unmapped
+uint16_t LookupGlyph(ByteSpan cmap, uint32_t codePoint);
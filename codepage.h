@@ -0,0 +1,27 @@
+// codepage.h : Legacy name record encodings (Mac Roman, Shift-JIS, Big5, GB2312, Wansung)
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include "bytespan.h"
+
+enum class NameEncoding : uint8_t
+{
+    Unsupported,
+    Utf16,      // Unicode platform, Windows Symbol/BMP/full repertoire
+    MacRoman,
+    ShiftJis,   // Mac Japanese, Windows ShiftJIS
+    Big5,       // Mac Chinese (Traditional), Windows Big5
+    Gb2312,     // Mac Chinese (Simplified), Windows PRC
+    Wansung,    // Mac Korean, Windows Wansung
+};
+
+// Encoding of the strings of a name record's platform and encoding IDs
+NameEncoding NameRecordEncoding(uint16_t platformId, uint16_t encodingId);
+
+// Append a string in a single- or double-byte encoding (not Utf16); bytes without a mapping
+// become U+FFFD. Windows records store each character in 16 bits, single bytes with a zero
+// high byte, so withZeroBytes drops zero bytes first.
+void AppendCodepageText(std::wstring& out, NameEncoding encoding, ByteSpan text, bool withZeroBytes);
@@ -0,0 +1,137 @@
+// colorfont.cpp : Color glyph technology detection (COLR/CPAL, SVG, sbix, CBDT/CBLC)
+//
+
+#include "colorfont.h"
+#include <algorithm>
+#include "textformat.h"
+
+namespace
+{
+    const uint32_t kColrTag = MakeTag('C', 'O', 'L', 'R');
+    const uint32_t kCpalTag = MakeTag('C', 'P', 'A', 'L');
+    const uint32_t kSvgTag = MakeTag('S', 'V', 'G', ' ');
+    const uint32_t kSbixTag = MakeTag('s', 'b', 'i', 'x');
+    const uint32_t kCblcTag = MakeTag('C', 'B', 'L', 'C');
+    const uint32_t kCbdtTag = MakeTag('C', 'B', 'D', 'T');
+
+    // FormatColorInfo parts: "CPAL(3)", and each strike size after '[' or ','
+    constexpr TextFormat kCountedTable(L"{}({})");
+    constexpr TextFormat kStrikeSize(L"{}{}");
+
+    // Header bytes needed to reach offset + length, saturated for LoadTablePrefix
+    uint32_t PrefixEnd(uint64_t offset, uint64_t length)
+    {
+        uint64_t end = offset + length;
+        return end > UINT32_MAX ? UINT32_MAX : (uint32_t)end;
+    }
+
+    void AddStrikeSize(ColorInfo& info, uint16_t ppem)
+    {
+        auto it = std::lower_bound(info.strikeSizes.begin(), info.strikeSizes.end(), ppem);
+        if (it == info.strikeSizes.end() || *it != ppem)
+            info.strikeSizes.insert(it, ppem);
+    }
+}
+
+ColorInfo ReadColorInfo(FontContainer& container)
+{
+    ByteSpan colr = container.LoadTablePrefix(kColrTag, 34);
+    ByteSpan cpal = container.LoadTablePrefix(kCpalTag, 12);
+
+    // SVG: header, then the document count at the start of the document index
+    ByteSpan svg = container.LoadTablePrefix(kSvgTag, 6);
+    if (svg.Has(0, 6))
+        svg = container.LoadTablePrefix(kSvgTag, PrefixEnd(svg.U32(2), 2));
+
+    // sbix: header and strike offsets, then the ppem/ppi pair at the start of each strike
+    ByteSpan sbix = container.LoadTablePrefix(kSbixTag, 8);
+    if (sbix.Has(0, 8))
+    {
+        uint32_t strikeCount = sbix.U32(4);
+        sbix = container.LoadTablePrefix(kSbixTag, PrefixEnd(8, uint64_t(strikeCount) * 4));
+        ByteSpan offsets = sbix.Array(8, strikeCount, 4);
+        uint32_t end = 0;
+        for (size_t i = 0; i < offsets.size; i += 4)
+            end = std::max(end, PrefixEnd(offsets.U32(i), 4));
+        if (end > sbix.size)
+            sbix = container.LoadTablePrefix(kSbixTag, end);
+    }
+
+    // CBLC: header and the BitmapSize records; the bitmaps themselves are in CBDT
+    ByteSpan cblc = container.LoadTablePrefix(kCblcTag, 8);
+    if (cblc.Has(0, 8))
+        cblc = container.LoadTablePrefix(kCblcTag, PrefixEnd(8, uint64_t(cblc.U32(4)) * 48));
+
+    return ReadColorInfo(colr, cpal, svg, sbix, cblc, container.FindTable(kCbdtTag) != nullptr);
+}
+
+ColorInfo ReadColorInfo(ByteSpan colr, ByteSpan cpal, ByteSpan svg, ByteSpan sbix, ByteSpan cblc, bool hasCbdt)
+{
+    ColorInfo info;
+    if (colr.Has(0, 14))
+    {
+        // Version 1 tables usually keep version 0 records as a fallback for older renderers
+        uint16_t version = colr.U16(0);
+        if (colr.U16(2) > 0 || version == 0)
+            info.flags |= COLOR_COLR_V0;
+        if (version >= 1 && colr.Has(0, 34) && colr.U32(14) != 0)
+            info.flags |= COLOR_COLR_V1;
+    }
+    if (cpal.Has(0, 12))
+    {
+        info.flags |= COLOR_CPAL;
+        info.paletteCount = cpal.U16(4);
+    }
+    if (svg.Has(0, 6))
+    {
+        info.flags |= COLOR_SVG;
+        uint32_t listOffset = svg.U32(2);
+        if (svg.Has(listOffset, 2))
+            info.svgDocumentCount = svg.U16(listOffset);
+    }
+    if (sbix.Has(0, 8))
+    {
+        info.flags |= COLOR_SBIX;
+        uint32_t strikeCount = sbix.U32(4);
+        ByteSpan offsets = sbix.Array(8, strikeCount, 4);
+        for (size_t i = 0; i < offsets.size; i += 4)
+        {
+            uint32_t strike = offsets.U32(i);
+            if (sbix.Has(strike, 4))
+                AddStrikeSize(info, sbix.U16(strike));
+        }
+    }
+    if (hasCbdt && cblc.Has(0, 8))
+    {
+        info.flags |= COLOR_CBDT;
+        uint32_t sizeCount = cblc.U32(4);
+        ByteSpan sizes = cblc.Array(8, sizeCount, 48);
+        for (size_t i = 0; i < sizes.size; i += 48)
+            AddStrikeSize(info, sizes.U8(i + 45));  // ppemY
+    }
+    return info;
+}
+
+std::wstring FormatColorInfo(const ColorInfo& color)
+{
+    std::wstring text;
+    // The text with a space after any earlier part, to append the next one to
+    auto separated = [&]() -> std::wstring&
+    {
+        if (!text.empty()) text += L' ';
+        return text;
+    };
+    if (color.flags & COLOR_COLR_V1) separated() += color.flags & COLOR_COLR_V0 ? L"COLRv0+v1" : L"COLRv1";
+    else if (color.flags & COLOR_COLR_V0) separated() += L"COLRv0";
+    if (color.flags & COLOR_CPAL) FormatTo<kCountedTable>(separated(), L"CPAL", color.paletteCount);
+    if (color.flags & COLOR_SVG) FormatTo<kCountedTable>(separated(), L"SVG", color.svgDocumentCount);
+    if (color.flags & COLOR_SBIX) separated() += L"sbix";
+    if (color.flags & COLOR_CBDT) separated() += L"CBDT";
+    if (!color.strikeSizes.empty())
+    {
+        for (size_t i = 0; i < color.strikeSizes.size(); ++i)
+            FormatTo<kStrikeSize>(text, i == 0 ? L'[' : L',', color.strikeSizes[i]);
+        text += L']';
+    }
+    return text;
+}
@@ -0,0 +1,36 @@
+// colorfont.h : Color glyph technology detection (COLR/CPAL, SVG, sbix, CBDT/CBLC)
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "sfnt.h"
+
+enum : uint8_t
+{
+    COLOR_COLR_V0 = 0x01,  // COLR base glyph records (flat color layers)
+    COLOR_COLR_V1 = 0x02,  // COLR version 1 paint graphs (gradients, transforms)
+    COLOR_CPAL = 0x04,
+    COLOR_SVG = 0x08,
+    COLOR_SBIX = 0x10,     // Apple bitmap strikes (PNG/JPEG/TIFF)
+    COLOR_CBDT = 0x20,     // Google color bitmap strikes
+};
+
+// Color tables of a face, read from their headers only
+struct ColorInfo
+{
+    uint8_t flags = 0;                  // COLOR_*
+    uint16_t paletteCount = 0;          // CPAL
+    uint16_t svgDocumentCount = 0;      // SVG document index entries
+    std::vector<uint16_t> strikeSizes;  // ppem of sbix strikes and CBLC bitmap sizes, sorted, distinct
+};
+
+// Directory lookups plus a few header bytes per table; compressed tables are
+// decoded only as far as those headers reach
+ColorInfo ReadColorInfo(FontContainer& container);
+ColorInfo ReadColorInfo(ByteSpan colr, ByteSpan cpal, ByteSpan svg, ByteSpan sbix, ByteSpan cblc, bool hasCbdt);
+
+// "COLRv1 CPAL(3) sbix[20,40]", or an empty string for fonts without color tables
+std::wstring FormatColorInfo(const ColorInfo& color);
@@ -0,0 +1,499 @@
+// dirwalk.cpp : Parallel recursive search for font files
+//
+
+#include "dirwalk.h"
+#include <algorithm>
+#include <condition_variable>
+#include <cwchar>
+#include <mutex>
+#include <set>
+#include <string_view>
+#include <thread>
+#include <utility>
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/vfs.h>
+#endif
+#endif
+#include "fontfile.h"
+#include "sfnt.h"
+#include "trace.h"
+
+namespace
+{
+    // One directory listing takes as many entries as fit in this buffer per call
+    const uint32_t kListingBytes = 64 * 1024;
+
+#ifdef _WIN32
+    const wchar_t kSeparator = L'\\';
+#else
+    const wchar_t kSeparator = L'/';
+#endif
+
+    struct Entry
+    {
+        std::wstring path;
+        EntryKind kind = EntryKind::File;
+        bool unchanged = false;   // File: from a cached listing
+        size_t child = SIZE_MAX;  // Directory: index in Walk::directories once queued
+    };
+
+    struct Directory
+    {
+        std::wstring path;
+        std::vector<Entry> entries;  // In listing order
+    };
+
+    struct Walk
+    {
+        bool checkSignatures = false;
+        const DirectoryCache* cache = nullptr;  // Listings of the previous walk
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::vector<Directory> directories;
+        std::vector<size_t> pending;  // Directories waiting to be listed
+        std::vector<size_t> links;    // Linked directories, listed once pending runs out
+        size_t listing = 0;           // Directories being listed
+        std::set<std::pair<uint64_t, uint64_t>> visited;  // Volume serial (device) and file index (inode) of listed directories
+        std::map<uint64_t, bool> volumes;                 // Volume serial (device): directory times can be trusted
+        DirectoryCache listings;                       // Listings of this walk, with a cache
+        size_t listed = 0;
+        size_t cached = 0;
+        size_t entries = 0;
+        size_t rejected = 0;
+    };
+
+    bool IsFontSignature(const uint8_t* bytes)
+    {
+        switch (ByteSpan(bytes, 4).U32(0))
+        {
+        case 0x00010000:
+        case MakeTag('O', 'T', 'T', 'O'):
+        case MakeTag('t', 'r', 'u', 'e'):
+        case MakeTag('t', 'y', 'p', '1'):
+        case MakeTag('t', 't', 'c', 'f'):
+        case MakeTag('w', 'O', 'F', 'F'):
+        case MakeTag('w', 'O', 'F', '2'):
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    // Marks a directory as listed; false if it already was, through another link
+    bool FirstVisit(Walk& walk, uint64_t volume, uint64_t index)
+    {
+        std::lock_guard<std::mutex> lock(walk.mutex);
+        return walk.visited.insert({ volume, index }).second;
+    }
+
+    // Whether directory times on a volume can be trusted, asking trusted() once per volume
+    template <typename Check>
+    bool VolumeTimesTrusted(Walk& walk, uint64_t volume, Check trusted)
+    {
+        {
+            std::lock_guard<std::mutex> lock(walk.mutex);
+            auto it = walk.volumes.find(volume);
+            if (it != walk.volumes.end())
+                return it->second;
+        }
+        bool result = trusted();
+        std::lock_guard<std::mutex> lock(walk.mutex);
+        walk.volumes[volume] = result;
+        return result;
+    }
+
+#ifdef _WIN32
+    bool HasFontSignature(const std::wstring& path)
+    {
+        HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                  FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            // Let the scan report it as unreadable
+            return true;
+        }
+        uint8_t bytes[4] = {};
+        DWORD read = 0;
+        bool ok = ReadFile(file, bytes, sizeof(bytes), &read, nullptr) && read == sizeof(bytes);
+        CloseHandle(file);
+        return ok && IsFontSignature(bytes);
+    }
+
+    // Last-write time of a directory, or 0 where it does not follow the entries: NTFS and
+    // ReFS update it when entries are added, removed or renamed, FAT and exFAT do not
+    uint64_t DirectoryWriteTime(Walk& walk, HANDLE directory, const BY_HANDLE_FILE_INFORMATION& info)
+    {
+        bool trusted = VolumeTimesTrusted(walk, info.dwVolumeSerialNumber, [&]()
+        {
+            wchar_t fileSystem[MAX_PATH + 1] = {};
+            return GetVolumeInformationByHandleW(directory, nullptr, 0, nullptr, nullptr, nullptr, fileSystem, MAX_PATH + 1) &&
+                   (wcscmp(fileSystem, L"NTFS") == 0 || wcscmp(fileSystem, L"ReFS") == 0);
+        });
+        if (!trusted)
+            return 0;
+        return ((uint64_t)info.ftLastWriteTime.dwHighDateTime << 32) | info.ftLastWriteTime.dwLowDateTime;
+    }
+#else
+    bool HasFontSignature(const std::wstring& path)
+    {
+        int file = open(WideToUtf8(path).c_str(), O_RDONLY | O_CLOEXEC);
+        if (file < 0)
+        {
+            // Let the scan report it as unreadable
+            return true;
+        }
+        uint8_t bytes[4] = {};
+        bool ok = pread(file, bytes, sizeof(bytes), 0) == (ssize_t)sizeof(bytes);
+        close(file);
+        return ok && IsFontSignature(bytes);
+    }
+
+    // Modification time of a directory in nanoseconds, or 0 where it does not follow the
+    // entries: POSIX file systems update it when entries are added, removed or renamed,
+    // Linux's FAT and exFAT drivers only for some of those
+    uint64_t DirectoryWriteTime(Walk& walk, int directory, const struct stat& info)
+    {
+        bool trusted = VolumeTimesTrusted(walk, (uint64_t)info.st_dev, [&]()
+        {
+#ifdef __linux__
+            const long kMsdosMagic = 0x4D44, kExfatMagic = 0x2011BAB0;
+            struct statfs volume;
+            return fstatfs(directory, &volume) == 0 && (long)volume.f_type != kMsdosMagic && (long)volume.f_type != kExfatMagic;
+#else
+            (void)directory;
+            return true;
+#endif
+        });
+        if (!trusted)
+            return 0;
+        return (uint64_t)info.st_mtim.tv_sec * 1000000000u + (uint64_t)info.st_mtim.tv_nsec;
+    }
+#endif
+
+    // Entries of the cached listing of a directory, or false if it changed since
+    bool ReuseListing(Walk& walk, const std::wstring& path, uint64_t lastWriteTime, std::vector<Entry>& entries)
+    {
+        auto it = walk.cache->find(path);
+        if (lastWriteTime == 0 || it == walk.cache->end() || it->second.lastWriteTime != lastWriteTime)
+            return false;
+        const DirectoryListing& listing = it->second;
+        entries.reserve(listing.entries.size());
+        for (const auto& cached : listing.entries)
+        {
+            Entry entry;
+            entry.path = path + kSeparator + cached.name;
+            entry.kind = cached.kind;
+            entry.unchanged = cached.kind == EntryKind::File;
+            entries.push_back(std::move(entry));
+        }
+        std::lock_guard<std::mutex> lock(walk.mutex);
+        walk.listings[path] = listing;
+        ++walk.cached;
+        walk.rejected += listing.rejected;
+        return true;
+    }
+
+#ifdef _WIN32
+    // Font files and subdirectories of a directory through its handle, many entries per
+    // call, counting all entries. False when the directory cannot be opened, was already
+    // listed through another link, or its cached listing was reused (entries then hold it).
+    bool ReadDirectory(Walk& walk, const std::wstring& path, std::vector<uint64_t>& buffer, std::vector<Entry>& entries,
+                       size_t& count, uint64_t& lastWriteTime)
+    {
+        // Opening follows links, so the index identifies the target
+        HANDLE directory = CreateFileW(path.c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                       nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, nullptr);
+        if (directory == INVALID_HANDLE_VALUE)
+            return false;
+        BY_HANDLE_FILE_INFORMATION info = {};
+        if (GetFileInformationByHandle(directory, &info))
+        {
+            uint64_t index = ((uint64_t)info.nFileIndexHigh << 32) | info.nFileIndexLow;
+            if (!FirstVisit(walk, info.dwVolumeSerialNumber, index))
+            {
+                CloseHandle(directory);
+                return false;
+            }
+            if (walk.cache)
+            {
+                lastWriteTime = DirectoryWriteTime(walk, directory, info);
+                if (ReuseListing(walk, path, lastWriteTime, entries))
+                {
+                    CloseHandle(directory);
+                    return false;
+                }
+            }
+        }
+
+        while (GetFileInformationByHandleEx(directory, FileFullDirectoryInfo, buffer.data(), kListingBytes))
+        {
+            const uint8_t* next = reinterpret_cast<const uint8_t*>(buffer.data());
+            for (;;)
+            {
+                const FILE_FULL_DIR_INFO* item = reinterpret_cast<const FILE_FULL_DIR_INFO*>(next);
+                std::wstring_view name(item->FileName, item->FileNameLength / sizeof(wchar_t));
+                if (name != L"." && name != L"..")
+                {
+                    ++count;
+                    EntryKind kind = !(item->FileAttributes & FILE_ATTRIBUTE_DIRECTORY) ? EntryKind::File
+                                     : (item->FileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) ? EntryKind::Link
+                                     : EntryKind::Directory;
+                    if (kind != EntryKind::File || IsFontFileName(name))
+                    {
+                        Entry entry;
+                        entry.path = path + kSeparator;
+                        entry.path += name;
+                        entry.kind = kind;
+                        entries.push_back(std::move(entry));
+                    }
+                }
+                if (item->NextEntryOffset == 0)
+                    break;
+                next += item->NextEntryOffset;
+            }
+        }
+        CloseHandle(directory);
+        return true;
+    }
+#else
+    // Font files and subdirectories of a directory, counting all entries. Only regular files
+    // (or links to them) are kept, so a device or FIFO with a font extension is never opened.
+    // False when the directory cannot be opened, was already listed through another link, or
+    // its cached listing was reused (entries then hold it). readdir keeps its own buffer.
+    bool ReadDirectory(Walk& walk, const std::wstring& path, std::vector<uint64_t>&, std::vector<Entry>& entries,
+                       size_t& count, uint64_t& lastWriteTime)
+    {
+        // Opening follows links, so the inode identifies the target
+        int handle = open(WideToUtf8(path).c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+        if (handle < 0)
+            return false;
+        struct stat info;
+        if (fstat(handle, &info) == 0)
+        {
+            if (!FirstVisit(walk, (uint64_t)info.st_dev, (uint64_t)info.st_ino))
+            {
+                close(handle);
+                return false;
+            }
+            if (walk.cache)
+            {
+                lastWriteTime = DirectoryWriteTime(walk, handle, info);
+                if (ReuseListing(walk, path, lastWriteTime, entries))
+                {
+                    close(handle);
+                    return false;
+                }
+            }
+        }
+        DIR* directory = fdopendir(handle);
+        if (!directory)
+        {
+            close(handle);
+            return false;
+        }
+
+        while (const dirent* item = readdir(directory))
+        {
+            if (strcmp(item->d_name, ".") == 0 || strcmp(item->d_name, "..") == 0)
+                continue;
+            ++count;
+            unsigned char type = item->d_type;
+            bool link = type == DT_LNK;
+            if (type == DT_UNKNOWN || link)
+            {
+                // Some file systems leave the type out; links are typed by their target
+                struct stat target;
+                if (type == DT_UNKNOWN && fstatat(handle, item->d_name, &target, AT_SYMLINK_NOFOLLOW) == 0 && S_ISLNK(target.st_mode))
+                    link = true;
+                type = fstatat(handle, item->d_name, &target, 0) != 0 ? DT_UNKNOWN
+                     : S_ISDIR(target.st_mode) ? DT_DIR
+                     : S_ISREG(target.st_mode) ? DT_REG
+                     : DT_UNKNOWN;
+            }
+            if (type != DT_DIR && type != DT_REG)
+                continue;
+            EntryKind kind = type == DT_REG ? EntryKind::File : link ? EntryKind::Link : EntryKind::Directory;
+            std::wstring name = Utf8ToWide(item->d_name);
+            if (kind != EntryKind::File || IsFontFileName(name))
+            {
+                Entry entry;
+                entry.path = path + kSeparator;
+                entry.path += name;
+                entry.kind = kind;
+                entries.push_back(std::move(entry));
+            }
+        }
+        closedir(directory);
+        return true;
+    }
+#endif
+
+    // List one directory: font files (that pass the signature check) and subdirectories in
+    // listing order. Empty when the directory cannot be opened or was already listed
+    // through another link.
+    std::vector<Entry> ListDirectory(Walk& walk, const std::wstring& path, std::vector<uint64_t>& buffer)
+    {
+        std::vector<Entry> entries;
+        size_t count = 0;
+        uint64_t lastWriteTime = 0;
+        if (!ReadDirectory(walk, path, buffer, entries, count, lastWriteTime))
+            return entries;
+
+        size_t rejected = 0;
+        if (walk.checkSignatures)
+        {
+            auto end = std::remove_if(entries.begin(), entries.end(),
+                                      [](const Entry& entry) { return entry.kind == EntryKind::File && !HasFontSignature(entry.path); });
+            rejected = entries.end() - end;
+            entries.erase(end, entries.end());
+        }
+
+        DirectoryListing listing;
+        if (walk.cache)
+        {
+            listing.lastWriteTime = lastWriteTime;
+            listing.rejected = (uint32_t)rejected;
+            listing.entries.reserve(entries.size());
+            for (const auto& entry : entries)
+                listing.entries.push_back({ entry.path.substr(path.size() + 1), entry.kind });
+        }
+        std::lock_guard<std::mutex> lock(walk.mutex);
+        if (walk.cache)
+            walk.listings[path] = std::move(listing);
+        ++walk.listed;
+        walk.entries += count;
+        walk.rejected += rejected;
+        return entries;
+    }
+
+    void ListDirectories(Walk& walk)
+    {
+        TraceScope trace("ListDirectories");
+        std::vector<uint64_t> buffer(kListingBytes / sizeof(uint64_t));
+        std::unique_lock<std::mutex> lock(walk.mutex);
+        for (;;)
+        {
+            walk.wake.wait(lock, [&]() { return !walk.pending.empty() || walk.listing == 0; });
+            if (walk.pending.empty())
+            {
+                // Links go last so a directory reached both ways keeps its real path
+                if (walk.links.empty())
+                    break;
+                walk.pending.swap(walk.links);
+                walk.wake.notify_all();
+                continue;
+            }
+            size_t index = walk.pending.back();
+            walk.pending.pop_back();
+            std::wstring path = walk.directories[index].path;
+            ++walk.listing;
+            lock.unlock();
+
+            std::vector<Entry> entries = ListDirectory(walk, path, buffer);
+
+            lock.lock();
+            for (auto& entry : entries)
+            {
+                if (entry.kind == EntryKind::File)
+                    continue;
+                entry.child = walk.directories.size();
+                walk.directories.push_back({ std::move(entry.path), {} });
+                (entry.kind == EntryKind::Link ? walk.links : walk.pending).push_back(entry.child);
+            }
+            walk.directories[index].entries = std::move(entries);
+            --walk.listing;
+            walk.wake.notify_all();
+        }
+    }
+
+    void AppendFiles(const Walk& walk, size_t root, FontFileSearch& search)
+    {
+        // Depth-first with an explicit stack: followed links can make the tree deep
+        std::vector<std::pair<size_t, size_t>> stack = { { root, 0 } };
+        while (!stack.empty())
+        {
+            auto& top = stack.back();
+            const Directory& directory = walk.directories[top.first];
+            if (top.second == directory.entries.size())
+            {
+                stack.pop_back();
+                continue;
+            }
+            const Entry& entry = directory.entries[top.second++];
+            if (entry.kind != EntryKind::File)
+            {
+                stack.push_back({ entry.child, 0 });
+                continue;
+            }
+            search.files.push_back(entry.path);
+            search.unchanged.push_back(entry.unchanged);
+        }
+    }
+}
+
+FontFileSearch FindFontFiles(const std::vector<std::wstring>& paths, bool checkSignatures, DirectoryCache* cache)
+{
+    TraceScope trace("FindFontFiles");
+    Walk walk;
+    walk.checkSignatures = checkSignatures;
+    walk.cache = cache;
+    std::vector<std::pair<std::wstring, size_t>> roots;  // File path, or directory index
+    for (const auto& path : paths)
+    {
+#ifdef _WIN32
+        DWORD attributes = GetFileAttributesW(path.c_str());
+        if (attributes == INVALID_FILE_ATTRIBUTES)
+            continue;
+        bool directory = (attributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+#else
+        struct stat info;
+        if (stat(WideToUtf8(path).c_str(), &info) != 0)
+            continue;
+        bool directory = S_ISDIR(info.st_mode);
+#endif
+        if (!directory)
+        {
+            roots.push_back({ path, SIZE_MAX });
+            continue;
+        }
+        roots.push_back({ std::wstring(), walk.directories.size() });
+        walk.pending.push_back(walk.directories.size());
+        walk.directories.push_back({ path, {} });
+    }
+
+    // Listing mostly waits on the file system, so use more threads than cores
+    unsigned threadCount = std::max(std::thread::hardware_concurrency(), 4u);
+    std::vector<std::thread> threads;
+    for (unsigned t = 1; t < threadCount; ++t)
+        threads.emplace_back(ListDirectories, std::ref(walk));
+    ListDirectories(walk);
+    for (auto& thread : threads)
+        thread.join();
+
+    FontFileSearch search;
+    for (const auto& root : roots)
+    {
+        if (root.second != SIZE_MAX)
+        {
+            AppendFiles(walk, root.second, search);
+            continue;
+        }
+        search.files.push_back(root.first);
+        search.unchanged.push_back(false);
+    }
+    search.directories = walk.listed + walk.cached;
+    search.cachedDirectories = walk.cached;
+    search.entries = walk.entries;
+    search.rejected = walk.rejected;
+    if (cache)
+        *cache = std::move(walk.listings);
+    return search;
+}
@@ -0,0 +1,57 @@
+// dirwalk.h : Parallel recursive search for font files
+//
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+enum class EntryKind : uint8_t
+{
+    File,
+    Directory,
+    Link,       // Junction or symbolic link to a directory
+};
+
+struct DirectoryEntry
+{
+    std::wstring name;
+    EntryKind kind = EntryKind::File;
+};
+
+// What a walk found in one directory, saved with the catalog so a later walk can skip
+// listing the directory while its last-write time is the same
+struct DirectoryListing
+{
+    uint64_t lastWriteTime = 0;           // FILETIME (nanoseconds since 1970 on POSIX); 0 on file systems that do not keep it current
+    uint32_t rejected = 0;                // Font files that failed the signature check
+    std::vector<DirectoryEntry> entries;  // Font files and subdirectories in listing order
+};
+
+// Listings by full directory path
+using DirectoryCache = std::map<std::wstring, DirectoryListing>;
+
+struct FontFileSearch
+{
+    std::vector<std::wstring> files;  // Depth-first in directory order, as a sequential walk finds them
+    std::vector<bool> unchanged;      // Per file: found through a cached listing (see FindFontFiles)
+    size_t directories = 0;
+    size_t cachedDirectories = 0;     // Directories not listed because their listing was cached
+    size_t entries = 0;               // Directory entries looked at
+    size_t rejected = 0;              // Font extension, but no sfnt/collection/WOFF signature
+};
+
+// Expand files and directories (recursively) into font file paths. Directories are listed
+// by several threads in large batches. Links to directories are followed after all other
+// directories, and every directory is listed once, so link cycles end and a directory that
+// is also linked keeps its real path. Files are picked by extension (IsFontFileName); with
+// checkSignatures their first four bytes must also be a font signature. Paths of files are
+// taken as given.
+// With a cache, a directory whose last-write time matches its cached listing is not listed
+// and its files are marked unchanged; the cache is replaced by the listings of this walk.
+// A directory's time only changes when entries are added, removed or renamed, so files
+// rewritten in place are not noticed until a walk without the cache.
+FontFileSearch FindFontFiles(const std::vector<std::wstring>& paths, bool checkSignatures,
+                             DirectoryCache* cache = nullptr);
@@ -0,0 +1,868 @@
+// fontfile.cpp : Scans font files on disk (TTF/OTF/TTC/WOFF/WOFF2) without the system collection
+//
+
+#include "fontfile.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <map>
+#include <set>
+#include <thread>
+#include <cwctype>
+#ifdef _WIN32
+#include <dwrite_3.h>
+#else
+#include <cstdlib>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#include "batchread.h"
+#include "cmap.h"
+#include "colorfont.h"
+#include "hash.h"
+#include "layout.h"
+#include "sfnt.h"
+#include "trace.h"
+#include "unicodescript.h"
+#include "woff.h"
+
+#ifdef _WIN32
+bool MappedFile::Open(const std::wstring& path)
+{
+    TraceScope trace("MapFile");
+    Close();
+    file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                       FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER fileSize = {};
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0 || (ULONGLONG)fileSize.QuadPart > SIZE_MAX)
+    {
+        Close();
+        return false;
+    }
+
+    mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping)
+    {
+        Close();
+        return false;
+    }
+    data = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (!data)
+    {
+        Close();
+        return false;
+    }
+    size = (size_t)fileSize.QuadPart;
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (data) UnmapViewOfFile(data);
+    if (mapping) CloseHandle(mapping);
+    if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+    data = nullptr;
+    mapping = nullptr;
+    file = INVALID_HANDLE_VALUE;
+    size = 0;
+}
+#else
+bool MappedFile::Open(const std::wstring& path)
+{
+    TraceScope trace("MapFile");
+    Close();
+    file = open(WideToUtf8(path).c_str(), O_RDONLY | O_CLOEXEC);
+    if (file < 0) return false;
+
+    struct stat info;
+    if (fstat(file, &info) != 0 || !S_ISREG(info.st_mode) || info.st_size <= 0 || (uint64_t)info.st_size > SIZE_MAX)
+    {
+        Close();
+        return false;
+    }
+    void* view = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_SHARED, file, 0);
+    if (view == MAP_FAILED)
+    {
+        Close();
+        return false;
+    }
+    data = static_cast<const uint8_t*>(view);
+    size = (size_t)info.st_size;
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (data) munmap(const_cast<uint8_t*>(data), size);
+    if (file >= 0) close(file);
+    data = nullptr;
+    file = -1;
+    size = 0;
+}
+#endif
+
+bool IsFontFileName(std::wstring_view path)
+{
+    size_t dot = path.find_last_of(L'.');
+    if (dot == std::wstring_view::npos || path.size() - dot - 1 > 5) return false;
+    wchar_t buffer[5];
+    std::wstring_view ext(buffer, path.size() - dot - 1);
+    for (size_t i = 0; i < ext.size(); ++i) buffer[i] = towlower(path[dot + 1 + i]);
+    return ext == L"ttf" || ext == L"otf" || ext == L"ttc" || ext == L"otc" || ext == L"woff" || ext == L"woff2";
+}
+
+#ifdef _WIN32
+std::vector<std::wstring> SystemFontDirectories()
+{
+    std::vector<std::wstring> directories;
+    wchar_t buffer[MAX_PATH];
+    UINT length = GetWindowsDirectoryW(buffer, MAX_PATH);
+    if (length > 0 && length < MAX_PATH)
+    {
+        directories.push_back(std::wstring(buffer, length) + L"\\Fonts");
+    }
+    DWORD userLength = GetEnvironmentVariableW(L"LOCALAPPDATA", buffer, MAX_PATH);
+    if (userLength > 0 && userLength < MAX_PATH)
+    {
+        directories.push_back(std::wstring(buffer, userLength) + L"\\Microsoft\\Windows\\Fonts");
+    }
+    return directories;
+}
+#else
+std::vector<std::wstring> SystemFontDirectories()
+{
+    std::vector<std::wstring> directories;
+    const char* home = getenv("HOME");
+    const char* dataHome = getenv("XDG_DATA_HOME");
+    if (dataHome && *dataHome)
+        directories.push_back(Utf8ToWide(dataHome) + L"/fonts");
+    else if (home && *home)
+        directories.push_back(Utf8ToWide(home) + L"/.local/share/fonts");
+    if (home && *home)
+        directories.push_back(Utf8ToWide(home) + L"/.fonts");
+
+    // Colon-separated, most important first
+    const char* dataDirs = getenv("XDG_DATA_DIRS");
+    std::string_view dirs = dataDirs && *dataDirs ? dataDirs : "/usr/local/share:/usr/share";
+    while (!dirs.empty())
+    {
+        size_t colon = std::min(dirs.find(':'), dirs.size());
+        if (colon > 0)
+            directories.push_back(Utf8ToWide(dirs.substr(0, colon)) + L"/fonts");
+        dirs.remove_prefix(std::min(colon + 1, dirs.size()));
+    }
+    return directories;
+}
+#endif
+
+#ifdef _WIN32
+// Decode a whole WOFF2 file through DirectWrite when this build has no Brotli decoder.
+// Without a factory the shared one is used.
+static bool UnpackWoff2WithDirectWrite(IDWriteFactory* factory, const MappedFile& file, std::vector<uint8_t>& out)
+{
+    IDWriteFactory5* factory5 = nullptr;
+    if (!factory)
+    {
+        if (FAILED(DWriteCreateFactory(DWRITE_FACTORY_TYPE_SHARED, __uuidof(IDWriteFactory5), reinterpret_cast<IUnknown**>(&factory5))))
+            factory5 = nullptr;
+    }
+    else if (FAILED(factory->QueryInterface(__uuidof(IDWriteFactory5), reinterpret_cast<void**>(&factory5))))
+    {
+        factory5 = nullptr;
+    }
+    if (!factory5)
+        return false;
+
+    bool ok = false;
+    IDWriteFontFileStream* stream = nullptr;
+    if (SUCCEEDED(factory5->UnpackFontFile(DWRITE_CONTAINER_TYPE_WOFF2, file.data, (UINT32)file.size, &stream)) && stream)
+    {
+        UINT64 size = 0;
+        const void* fragment = nullptr;
+        void* context = nullptr;
+        if (SUCCEEDED(stream->GetFileSize(&size)) && size > 0 &&
+            SUCCEEDED(stream->ReadFileFragment(&fragment, 0, size, &context)))
+        {
+            const uint8_t* bytes = static_cast<const uint8_t*>(fragment);
+            out.assign(bytes, bytes + size);
+            stream->ReleaseFileFragment(context);
+            ok = true;
+        }
+        stream->Release();
+    }
+    factory5->Release();
+    return ok;
+}
+#else
+// Builds without Brotli cannot read WOFF2 outside Windows
+static bool UnpackWoff2WithDirectWrite(IDWriteFactory*, const MappedFile&, std::vector<uint8_t>&)
+{
+    return false;
+}
+#endif
+
+// Open the container of a mapped font file, unpacking WOFF2 through DirectWrite when this
+// build cannot decode it; unpacked holds those bytes and must outlive the container
+static bool OpenFontContainer(IDWriteFactory* factory, const MappedFile& file, FontContainer& container,
+                              std::vector<uint8_t>& unpacked)
+{
+    if (!container.Open(file.data, file.size))
+        return false;
+    if (container.kind != ContainerKind::Woff2 || Woff2DecoderAvailable())
+        return true;
+    return UnpackWoff2WithDirectWrite(factory, file, unpacked) && container.Open(unpacked.data(), unpacked.size());
+}
+
+// Hash every table of the selected face. head is hashed with checkSumAdjustment and the
+// created/modified dates zeroed so rebuilt copies of the same font compare equal.
+static uint64_t HashFontTables(FontContainer& container)
+{
+    TraceScope trace("HashFontTables");
+    // (tag, table hash) pairs in tag order, since table order differs between containers
+    std::vector<std::pair<uint64_t, uint64_t>> parts;
+    parts.reserve(container.tables.size());
+    for (const auto& entry : container.tables)
+    {
+        ByteSpan table = container.LoadTable(entry.tag);
+        uint64_t tableHash;
+        if (entry.tag == MakeTag('h', 'e', 'a', 'd') && table.Has(0, 36))
+        {
+            std::vector<uint8_t> head(table.data, table.data + table.size);
+            std::fill(head.begin() + 8, head.begin() + 12, uint8_t(0));
+            std::fill(head.begin() + 20, head.begin() + 36, uint8_t(0));
+            tableHash = Xxh3Hash64(head.data(), head.size());
+        }
+        else if (table)
+        {
+            tableHash = Xxh3Hash64(table.data, table.size);
+        }
+        else
+        {
+            // Undecodable (e.g. WOFF2-transformed) tables only contribute their length
+            tableHash = entry.length;
+        }
+        parts.emplace_back(entry.tag, tableHash);
+    }
+    std::sort(parts.begin(), parts.end());
+    return Xxh3Hash64(parts.data(), parts.size() * sizeof(parts[0]));
+}
+
+static FontInfo ReadFaceInfo(FontContainer& container, const std::vector<NameRecord>& names, const std::wstring& familyName,
+                             const ScanOptions& options)
+{
+    TraceScope trace("ReadFaceInfo");
+    FontInfo fontInfo;
+    ByteSpan os2 = container.LoadTable(MakeTag('O', 'S', '/', '2'));
+    ByteSpan head = container.LoadTable(MakeTag('h', 'e', 'a', 'd'));
+    FontStyle style = ReadFontStyle(os2, head);
+    fontInfo.weight = (DWRITE_FONT_WEIGHT)style.weightClass;
+    fontInfo.stretch = (DWRITE_FONT_STRETCH)style.widthClass;
+    fontInfo.style = style.italic ? DWRITE_FONT_STYLE_ITALIC
+                   : style.oblique ? DWRITE_FONT_STYLE_OBLIQUE
+                   : DWRITE_FONT_STYLE_NORMAL;
+
+    if (options.readMetrics)
+    {
+        fontInfo.metrics = ReadFontMetrics(head, container.LoadTable(MakeTag('h', 'h', 'e', 'a')), os2,
+                                           container.LoadTable(MakeTag('v', 'h', 'e', 'a')));
+    }
+    fontInfo.color = ReadColorInfo(container);
+    fontInfo.license = ReadFontLicense(os2);
+    if (options.readLicense)
+    {
+        // Often the whole license text; left in the name table unless an output prints it
+        fontInfo.license.description = FindName(names, NAME_LICENSE);
+        fontInfo.license.url = FindName(names, NAME_LICENSE_URL);
+    }
+
+    // Copied as record bytes; decoded when a listing writes them
+    fontInfo.name = FindNameText(names, NAME_FULL);
+    fontInfo.postScriptName = FindNameText(names, NAME_POSTSCRIPT);
+
+    // Fallback: use subfamily name
+    if (fontInfo.name.Empty())
+    {
+        std::wstring subfamily = FindName(names, NAME_TYPOGRAPHIC_SUBFAMILY);
+        if (subfamily.empty())
+            subfamily = FindName(names, NAME_SUBFAMILY);
+        fontInfo.name = subfamily.empty() ? familyName + L" (Unknown Style)" : familyName + L" " + subfamily;
+    }
+    return fontInfo;
+}
+
+// A face read from a file; faces are merged into families in file order
+struct ScannedFace
+{
+    FontInfo info;
+    std::wstring familyName;
+    std::vector<NameText> familyNames;      // Localized names of the family name ID, for aliases
+};
+
+// Read every face of an opened container. A sparse container sets incomplete if a face
+// needed bytes that were not read, and the file is then read again through a mapping.
+static void ReadFontFaces(FontContainer& container, const std::wstring& path, const ScanOptions& options,
+                          uint64_t contentHash, std::vector<ScannedFace>& faces)
+{
+    uint32_t faceCount = container.FaceCount();
+    for (uint32_t face = 0; face < faceCount; ++face)
+    {
+        if (!container.SelectFace(face))
+            continue;
+
+        // Only name, OS/2, head (and hhea/vhea for metrics) are decoded, plus color table headers
+        auto names = ParseNameTable(container.LoadTable(MakeTag('n', 'a', 'm', 'e')));
+        uint16_t familyNameId = NAME_TYPOGRAPHIC_FAMILY;
+        std::wstring familyName = FindName(names, familyNameId);
+        if (familyName.empty())
+        {
+            familyNameId = NAME_FAMILY;
+            familyName = FindName(names, familyNameId);
+        }
+        if (familyName.empty())
+            continue;
+
+        ScannedFace scanned;
+        scanned.info = ReadFaceInfo(container, names, familyName, options);
+        FontInfo& fontInfo = scanned.info;
+        fontInfo.filePath = path;
+        fontInfo.faceIndex = face;
+        if (options.computeHashes)
+        {
+            fontInfo.contentHash = contentHash;
+            fontInfo.tablesHash = HashFontTables(container);
+        }
+        if (options.readScripts)
+        {
+            TraceScope layoutTrace("ReadLayout");
+            fontInfo.layout = std::make_shared<LayoutInfo>(ReadLayoutInfo(container));
+            fontInfo.unicodeScripts = SupportedUnicodeScripts(ReadCmapRanges(container.LoadTable(MakeTag('c', 'm', 'a', 'p'))));
+        }
+        scanned.familyName = familyName;
+        scanned.familyNames = FindAllNames(names, familyNameId);
+        faces.push_back(std::move(scanned));
+    }
+}
+
+// Read one file through a mapping; false if it could not be read as a font
+static bool ReadFontFile(IDWriteFactory* factory, const std::wstring& path, const ScanOptions& options,
+                         std::vector<ScannedFace>& faces, ScanTiming& timing)
+{
+    TraceScope trace("ScanFile");
+    MappedFile file;
+    FontContainer container;
+    std::vector<uint8_t> unpacked;
+    if (!file.Open(path))
+        return false;
+    timing.fileSize = file.size;
+    if (!OpenFontContainer(factory, file, container, unpacked))
+        return false;
+
+    uint64_t contentHash = 0;
+    if (options.computeHashes)
+    {
+        TraceScope hashTrace("HashFile");
+        contentHash = Xxh3Hash64(file.data, file.size);
+        timing.bytesRead += file.size;
+    }
+
+    ReadFontFaces(container, path, options, contentHash, faces);
+    timing.bytesRead += container.bytesRead;
+    timing.tablesRead = container.tablesRead;
+    return true;
+}
+
+static void MergeFaces(std::vector<ScannedFace>& faces, std::map<std::wstring, size_t>& familyIndex,
+                       std::vector<FontFamily>& fontFamilies)
+{
+    for (auto& face : faces)
+    {
+        auto it = familyIndex.find(face.familyName);
+        if (it == familyIndex.end())
+        {
+            FontFamily fontFamily;
+            fontFamily.primaryName = face.familyName;
+            fontFamily.postScriptFamilyName = PostScriptFamilyPart(face.info.postScriptName);
+            it = familyIndex.emplace(face.familyName, fontFamilies.size()).first;
+            fontFamilies.push_back(fontFamily);
+        }
+
+        FontFamily& fontFamily = fontFamilies[it->second];
+        for (const auto& name : face.familyNames)
+        {
+            fontFamily.allNames.insert(name);
+        }
+        fontFamily.fonts.push_back(std::move(face.info));
+    }
+}
+
+namespace
+{
+    // Header scans read the first kHeaderBytes of every file (sfnt/collection headers and table
+    // directories) in one wave and the tables ReadFaceInfo uses in a second, instead of mapping
+    // whole files; kBatchFiles files are in flight at a time
+    const uint32_t kHeaderBytes = 16 * 1024;
+    const size_t kBatchFiles = 512;
+    const uint64_t kWholeFileLimit = 64 * 1024 * 1024;  // WOFF/WOFF2 up to this size are read whole
+
+    // Color tables only need their headers (see ReadColorInfo); a prefix that turns out too short
+    // marks the container incomplete
+    const uint32_t kColorHeaderBytes = 64 * 1024;
+    const struct
+    {
+        uint32_t tag;
+        uint32_t maxBytes;
+        bool metrics;  // Only read for ScanOptions::readMetrics
+    } kHeaderTables[] = {
+        { MakeTag('n', 'a', 'm', 'e'), UINT32_MAX, false },
+        { MakeTag('O', 'S', '/', '2'), UINT32_MAX, false },
+        { MakeTag('h', 'e', 'a', 'd'), UINT32_MAX, false },
+        { MakeTag('h', 'h', 'e', 'a'), UINT32_MAX, true },
+        { MakeTag('v', 'h', 'e', 'a'), UINT32_MAX, true },
+        { MakeTag('C', 'O', 'L', 'R'), kColorHeaderBytes, false },
+        { MakeTag('C', 'P', 'A', 'L'), kColorHeaderBytes, false },
+        { MakeTag('S', 'V', 'G', ' '), kColorHeaderBytes, false },
+        { MakeTag('s', 'b', 'i', 'x'), kColorHeaderBytes, false },
+        { MakeTag('C', 'B', 'L', 'C'), kColorHeaderBytes, false },
+    };
+
+    // Table ranges closer than this are read as one range; the bytes between them cost less
+    // than another request
+    const uint32_t kCoalesceGap = 4 * 1024;
+
+    struct BatchFile
+    {
+        BatchFileHandle handle = kNoBatchFile;
+        uint64_t size = 0;
+        std::vector<uint8_t> bytes;  // Header bytes, or the whole file
+        FontContainer container;
+        bool opened = false;         // container is open on bytes
+        bool reopen = false;         // bytes are the whole WOFF/WOFF2 file, to be opened by the parser
+        bool mapped = false;         // Read through a mapping instead (unusual layout, failed read)
+        bool reused = false;         // faces come from an earlier scan; the file is not read
+        bool readable = false;
+        std::vector<ScannedFace> faces;
+
+        ~BatchFile()
+        {
+            CloseBatchFile(handle);
+        }
+    };
+
+    // Plan the second wave for a file whose header bytes were read: the ranges of the tables
+    // the options need in a sparse sfnt container, the rest of a WOFF/WOFF2 file, or a
+    // fallback to mapping
+    void PlanTableReads(BatchFile& file, const ScanOptions& options, std::vector<BatchRead>& reads)
+    {
+        bool whole = file.bytes.size() == file.size;
+        ByteSpan bytes(file.bytes.data(), file.bytes.size());
+        uint32_t signature = bytes.Has(0, 4) ? bytes.U32(0) : 0;
+        bool woff2 = signature == MakeTag('w', 'O', 'F', '2');
+        if (woff2 && !Woff2DecoderAvailable())
+        {
+            // DirectWrite unpacks these from a mapping
+            file.mapped = true;
+            return;
+        }
+        if (!whole && (woff2 || signature == MakeTag('w', 'O', 'F', 'F')))
+        {
+            // Compressed tables are decoded from the whole file
+            if (file.size > kWholeFileLimit)
+            {
+                file.mapped = true;
+                return;
+            }
+            size_t header = file.bytes.size();
+            file.bytes.resize((size_t)file.size);
+            file.reopen = true;
+            reads.push_back({ file.handle, header, (uint32_t)(file.size - header), file.bytes.data() + header });
+            return;
+        }
+
+        FontContainer& container = file.container;
+        file.opened = container.Open(file.bytes.data(), file.bytes.size());
+        if (!file.opened)
+        {
+            // Directories past the header bytes; a whole file that does not open is not a font
+            file.mapped = !whole;
+            return;
+        }
+        if (whole)
+            return;
+
+        // Every face directory must be inside the header bytes; collect each table range once
+        std::map<uint32_t, uint32_t> ranges;
+        for (uint32_t face = 0; face < container.FaceCount(); ++face)
+        {
+            if (!container.SelectFace(face))
+            {
+                file.mapped = true;
+                return;
+            }
+            for (const auto& table : kHeaderTables)
+            {
+                if (table.metrics && !options.readMetrics)
+                    continue;
+                const TableEntry* entry = container.FindTable(table.tag);
+                if (!entry || entry->offset >= file.size)
+                    continue;
+                uint32_t length = (uint32_t)std::min<uint64_t>({ entry->length, table.maxBytes, file.size - entry->offset });
+                if (length > 0 && !container.file.Has(entry->offset, length))
+                    ranges[entry->offset] = std::max(ranges[entry->offset], length);
+            }
+        }
+        container.sparse = true;
+
+        // Merge overlapping and nearby tables (name and post, head/hhea/maxp/OS/2 are usually
+        // neighbours) into one read each
+        std::vector<std::pair<uint32_t, uint32_t>> merged;
+        for (const auto& range : ranges)
+        {
+            uint64_t end = (uint64_t)range.first + range.second;
+            if (!merged.empty() && range.first <= (uint64_t)merged.back().first + merged.back().second + kCoalesceGap)
+            {
+                auto& last = merged.back();
+                last.second = (uint32_t)std::max<uint64_t>(last.first + (uint64_t)last.second, end) - last.first;
+            }
+            else
+            {
+                merged.push_back(range);
+            }
+        }
+        for (const auto& range : merged)
+        {
+            std::vector<uint8_t>& bytes = container.decoded[range.first];
+            bytes.resize(range.second);
+            reads.push_back({ file.handle, range.first, range.second, bytes.data() });
+        }
+    }
+}
+
+// Calls perItem(i) for every i below count on all cores, the calling thread included, and
+// returns when all are done. Each thread calls its own copy of perItem, so state it captures
+// by value (like a mutable scratch buffer) is per thread.
+template <typename PerItem>
+static void ForEachParallel(size_t count, const PerItem& perItem)
+{
+    std::atomic<size_t> next{ 0 };
+    auto worker = [&next, count, perThread = perItem]() mutable
+    {
+        for (size_t i = next++; i < count; i = next++)
+            perThread(i);
+    };
+
+    unsigned threadCount = std::thread::hardware_concurrency();
+    if (threadCount == 0) threadCount = 1;
+    if (threadCount > count) threadCount = (unsigned)std::max<size_t>(count, 1);
+
+    std::vector<std::thread> threads;
+    for (unsigned t = 1; t < threadCount; ++t)
+        threads.emplace_back(worker);
+    worker();
+    for (auto& thread : threads)
+        thread.join();
+}
+
+// File scan that only needs header tables: batched reads of the directories and then of the
+// tables, parsed by all cores, merged in file order. Same results as mapping every file.
+static size_t ScanFontHeaders(IDWriteFactory* factory, const std::vector<std::wstring>& files, const ScanOptions& options,
+                              const std::map<std::wstring, std::vector<ScannedFace>>& reused,
+                              std::map<std::wstring, size_t>& familyIndex, std::vector<FontFamily>& fontFamilies)
+{
+    BatchReader reader;
+    size_t skipped = 0;
+    for (size_t first = 0; first < files.size(); first += kBatchFiles)
+    {
+        size_t count = std::min(kBatchFiles, files.size() - first);
+        std::vector<BatchFile> batch(count);
+
+        std::vector<BatchRead> reads;
+        std::vector<size_t> owners;
+        for (size_t i = 0; i < count; ++i)
+        {
+            BatchFile& file = batch[i];
+            auto earlier = reused.find(files[first + i]);
+            if (earlier != reused.end())
+            {
+                file.faces = earlier->second;
+                file.reused = file.readable = true;
+                continue;
+            }
+            file.handle = OpenForBatchRead(files[first + i]);
+            if (file.handle == kNoBatchFile || !BatchFileSize(file.handle, file.size) || file.size == 0)
+            {
+                // The mapping reports the same failure
+                file.mapped = true;
+                continue;
+            }
+            file.bytes.resize((size_t)std::min<uint64_t>(file.size, kHeaderBytes));
+            reads.push_back({ file.handle, 0, (uint32_t)file.bytes.size(), file.bytes.data() });
+            owners.push_back(i);
+        }
+        reader.Read(reads);
+
+        std::vector<BatchRead> tableReads;
+        std::vector<size_t> tableOwners;
+        for (size_t r = 0; r < reads.size(); ++r)
+        {
+            BatchFile& file = batch[owners[r]];
+            if (!reads[r].ok || reads[r].bytesRead != reads[r].length)
+            {
+                file.mapped = true;
+                continue;
+            }
+            PlanTableReads(file, options, tableReads);
+            tableOwners.resize(tableReads.size(), owners[r]);
+        }
+        reader.Read(tableReads);
+        for (size_t r = 0; r < tableReads.size(); ++r)
+        {
+            if (!tableReads[r].ok || tableReads[r].bytesRead != tableReads[r].length)
+                batch[tableOwners[r]].mapped = true;
+        }
+
+        ForEachParallel(count, [&](size_t i)
+        {
+            BatchFile& file = batch[i];
+            const std::wstring& path = files[first + i];
+            if (file.reused)
+                return;
+            if (!file.mapped)
+            {
+                TraceScope fileTrace("ScanFile");
+                if (file.reopen)
+                    file.opened = file.container.Open(file.bytes.data(), file.bytes.size());
+                if (file.opened)
+                    ReadFontFaces(file.container, path, options, 0, file.faces);
+                file.readable = file.opened;
+                file.mapped = file.container.incomplete;
+                // Faces own their strings; release the bytes and decoded tables while the batch goes on
+                file.container = FontContainer();
+                std::vector<uint8_t>().swap(file.bytes);
+            }
+            if (file.mapped)
+            {
+                ScanTiming unused;
+                file.faces.clear();
+                file.readable = ReadFontFile(factory, path, options, file.faces, unused);
+            }
+        });
+
+        for (auto& file : batch)
+        {
+            if (!file.readable)
+                ++skipped;
+            else
+                MergeFaces(file.faces, familyIndex, fontFamilies);
+        }
+    }
+    return skipped;
+}
+
+size_t ScanFontFiles(IDWriteFactory* factory, const std::vector<std::wstring>& files, const ScanOptions& options,
+                     std::vector<FontFamily>& fontFamilies, std::vector<ScanTiming>* timings,
+                     const std::vector<FontFamily>* reuse)
+{
+    TraceScope trace("ScanFontFiles");
+    std::map<std::wstring, size_t> familyIndex;
+    for (size_t i = 0; i < fontFamilies.size(); ++i)
+    {
+        familyIndex[fontFamilies[i].primaryName] = i;
+    }
+
+    // Faces of the earlier scan by file; the per-face family names are not saved, so each
+    // face brings the aliases of its whole family
+    std::map<std::wstring, std::vector<ScannedFace>> reused;
+    if (reuse)
+    {
+        for (const auto& family : *reuse)
+        {
+            std::vector<NameText> familyNames(family.allNames.begin(), family.allNames.end());
+            for (const auto& font : family.fonts)
+            {
+                if (!font.filePath.empty())
+                    reused[font.filePath].push_back({ font, family.primaryName, familyNames });
+            }
+        }
+    }
+
+    // Hashes and cmap/layout need whole files, and per-file timings should include each file's I/O
+    if (!timings && !options.computeHashes && !options.readScripts)
+        return ScanFontHeaders(factory, files, options, reused, familyIndex, fontFamilies);
+
+    size_t skipped = 0;
+    for (const auto& path : files)
+    {
+        ScanTiming timing;
+        std::vector<ScannedFace> faces;
+        auto start = std::chrono::steady_clock::now();
+        auto earlier = reused.find(path);
+        if (earlier != reused.end())
+            faces = earlier->second;
+        else if (!ReadFontFile(factory, path, options, faces, timing))
+            ++skipped;
+        if (!faces.empty())
+            timing.name = faces.front().info.name.Text();
+        timing.faces = (uint32_t)faces.size();
+        MergeFaces(faces, familyIndex, fontFamilies);
+        if (timings)
+        {
+            timing.path = path;
+            timing.nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+            timings->push_back(std::move(timing));
+        }
+    }
+    return skipped;
+}
+
+void HashFontFiles(std::vector<FontFamily>& fontFamilies)
+{
+    TraceScope trace("HashFontFiles");
+    // Group faces by file so collections are mapped and hashed once
+    std::map<std::wstring, std::vector<FontInfo*>> byFile;
+    for (auto& family : fontFamilies)
+    {
+        for (auto& font : family.fonts)
+        {
+            if (!font.filePath.empty() && font.contentHash == 0)
+                byFile[font.filePath].push_back(&font);
+        }
+    }
+
+    // Every font is in one file's list, so files can be hashed in any order
+    std::vector<std::pair<const std::wstring, std::vector<FontInfo*>>*> files;
+    for (auto& entry : byFile)
+        files.push_back(&entry);
+    ForEachParallel(files.size(), [&](size_t i)
+    {
+        TraceScope fileTrace("HashFile");
+        MappedFile file;
+        FontContainer container;
+        std::vector<uint8_t> unpacked;
+        if (!file.Open(files[i]->first) || !OpenFontContainer(nullptr, file, container, unpacked))
+            return;
+
+        uint64_t contentHash = Xxh3Hash64(file.data, file.size);
+        for (FontInfo* font : files[i]->second)
+        {
+            font->contentHash = contentHash;
+            if (container.SelectFace(font->faceIndex))
+                font->tablesHash = HashFontTables(container);
+        }
+    });
+}
+
+const LayoutInfo& LoadLayoutInfo(FontInfo& font)
+{
+    if (font.layout)
+        return *font.layout;
+
+    auto layout = std::make_shared<LayoutInfo>();
+    MappedFile file;
+    FontContainer container;
+    std::vector<uint8_t> unpacked;
+    if (!font.filePath.empty() && file.Open(font.filePath) && OpenFontContainer(nullptr, file, container, unpacked) &&
+        container.SelectFace(font.faceIndex))
+    {
+        *layout = ReadLayoutInfo(container);
+    }
+    font.layout = layout;
+    return *layout;
+}
+
+std::vector<FileCheck> VerifyFontFiles(const std::vector<std::wstring>& files)
+{
+    std::vector<FileCheck> results(files.size());
+    ForEachParallel(files.size(), [&](size_t i)
+    {
+        TraceScope fileTrace("VerifyFile");
+        MappedFile file;
+        if (file.Open(files[i]))
+            results[i] = VerifyFontData(file.data, file.size);
+    });
+    return results;
+}
+
+// Thumbnail file name from the PostScript name (or full name): characters outside
+// [A-Za-z0-9._-] become '_', and repeated names get a numeric suffix
+static std::wstring ThumbnailFileName(const FontInfo& font, std::set<std::wstring>& used, const wchar_t* extension)
+{
+    std::wstring base = font.postScriptName.Empty() ? font.name.Text() : font.postScriptName.Text();
+    for (wchar_t& c : base)
+    {
+        if (!(iswalnum(c) && c < 0x80) && c != L'-' && c != L'_' && c != L'.')
+            c = L'_';
+    }
+    if (base.empty())
+        base = L"font";
+
+    std::wstring name = base;
+    for (int n = 2; ; ++n)
+    {
+        // File names compare case-insensitively on Windows
+        std::wstring key = name;
+        std::transform(key.begin(), key.end(), key.begin(), towlower);
+        if (used.insert(key).second)
+            break;
+        name = base + L"-" + std::to_wstring(n);
+    }
+    return name + extension;
+}
+
+ThumbnailStats RenderThumbnails(const std::vector<FontFamily>& fontFamilies, const std::wstring& directory,
+                                const ThumbnailOptions& options)
+{
+    struct Job
+    {
+        const FontInfo* font;
+        std::wstring outputPath;
+        bool rendered = false;
+        bool written = false;
+        SampleResult sample;
+    };
+    std::vector<Job> jobs;
+    std::set<std::wstring> used;
+    std::filesystem::path root(directory);
+    for (const auto& family : fontFamilies)
+    {
+        for (const auto& font : family.fonts)
+        {
+            if (!font.filePath.empty())
+                jobs.push_back({ &font, (root / ThumbnailFileName(font, used, options.png ? L".png" : L".pgm")).wstring(), false, false, {} });
+        }
+    }
+
+    ThumbnailStats stats;
+    std::error_code error;
+    std::filesystem::create_directories(root, error);
+
+    // image is captured by value: every thread renders into its own
+    ForEachParallel(jobs.size(), [&, image = GrayImage()](size_t i) mutable
+    {
+        TraceScope jobTrace("RenderThumbnail");
+        Job& job = jobs[i];
+        MappedFile file;
+        FontContainer container;
+        std::vector<uint8_t> unpacked;
+        if (!file.Open(job.font->filePath) || !OpenFontContainer(nullptr, file, container, unpacked) ||
+            !container.SelectFace(job.font->faceIndex) ||
+            !RenderSample(container, options.text, options.pixelSize, options.maxWidth, image, job.sample))
+            return;
+        job.rendered = true;
+        job.written = options.png ? WritePng(job.outputPath, image) : WritePgm(job.outputPath, image);
+    });
+
+    for (const auto& job : jobs)
+    {
+        if (job.written) ++stats.written;
+        else if (job.rendered) ++stats.writeErrors;
+        else ++stats.noOutlines;
+        stats.glyphs += job.sample.glyphs;
+        stats.badGlyphs += job.sample.failed;
+    }
+    return stats;
+}
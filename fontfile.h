@@ -0,0 +1,78 @@
+// fontfile.h : Scans font files on disk (TTF/OTF/TTC/WOFF/WOFF2) without the system collection
+//
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <string_view>
+#ifdef _WIN32
+#include <Windows.h>
+#include <dwrite.h>
+#endif
+#include "catalog.h"
+#include "thumbnail.h"
+#include "verify.h"
+
+// Read-only view of a whole file
+struct MappedFile
+{
+#ifdef _WIN32
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE mapping = nullptr;
+#else
+    int file = -1;
+#endif
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+
+    MappedFile() = default;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile() { Close(); }
+
+    bool Open(const std::wstring& path);
+    void Close();
+};
+
+// True for extensions the scanner understands (.ttf .otf .ttc .otc .woff .woff2)
+bool IsFontFileName(std::wstring_view path);
+
+// %WINDIR%\Fonts and the per-user font directory; elsewhere the XDG data directories'
+// fonts folders and ~/.fonts
+std::vector<std::wstring> SystemFontDirectories();
+
+// Parse every face of the given files and merge them into families by family name.
+// Returns the number of files that could not be read as fonts. With timings, the cost
+// of each file is appended in file order. Scans without hashes, scripts or timings read
+// only the table directories and the byte ranges of the tables the options need, in
+// batches (see batchread.h). Files with faces in reuse (a catalog scanned earlier with the
+// same options) are not read; those faces are merged in their place.
+size_t ScanFontFiles(IDWriteFactory* factory, const std::vector<std::wstring>& files, const ScanOptions& options,
+                     std::vector<FontFamily>& fontFamilies, std::vector<ScanTiming>* timings = nullptr,
+                     const std::vector<FontFamily>* reuse = nullptr);
+
+// Fill in content/table hashes of fonts that have a file path but were not hashed
+// while scanning (e.g. fonts from the system collection). Each file is mapped once.
+void HashFontFiles(std::vector<FontFamily>& fontFamilies);
+
+// GSUB/GPOS tags of a font, read from its file the first time they are asked for.
+// Fonts without a readable file get an empty set.
+const LayoutInfo& LoadLayoutInfo(FontInfo& font);
+
+// Verify table checksums of every file using all cores; results are in the order of files
+std::vector<FileCheck> VerifyFontFiles(const std::vector<std::wstring>& files);
+
+struct ThumbnailStats
+{
+    size_t written = 0;
+    size_t noOutlines = 0;  // Unreadable files, bitmap-only faces and WOFF2 files with transformed glyf
+    size_t writeErrors = 0;
+    size_t glyphs = 0;
+    size_t badGlyphs = 0;   // Glyphs with malformed outline data
+};
+
+// Render a sample-text thumbnail of every font with a file path into directory, named
+// after its PostScript name, using all cores
+ThumbnailStats RenderThumbnails(const std::vector<FontFamily>& fontFamilies, const std::wstring& directory,
+                                const ThumbnailOptions& options);
@@ -0,0 +1,22 @@
+// fuzz_cmap.cpp : libFuzzer target for cmap subtable selection, range reading and lookups
+//
+
+#include <cstddef>
+#include <cstdint>
+#include "../cmap.h"
+#include "../unicodescript.h"
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
+{
+    ByteSpan cmap(data, size);
+    std::vector<CodePointRange> ranges = ReadCmapRanges(cmap);
+    SupportedUnicodeScripts(ranges);
+    for (uint32_t codePoint : { 0x20u, 0x41u, 0xF041u, 0x4E00u, 0x1F600u, 0x10FFFFu })
+        LookupGlyph(cmap, codePoint);
+    for (const auto& range : ranges)
+    {
+        LookupGlyph(cmap, range.first);
+        LookupGlyph(cmap, range.last);
+    }
+    return 0;
+}
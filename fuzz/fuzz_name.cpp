@@ -0,0 +1,29 @@
+// fuzz_name.cpp : libFuzzer target for the name table parser and string decoding
+//
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include "../sfnt.h"
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
+{
+    std::vector<NameRecord> records = ParseNameTable(ByteSpan(data, size));
+    for (const auto& record : records)
+        DecodeNameRecord(record);
+    for (uint16_t nameId : { NAME_FAMILY, NAME_SUBFAMILY, NAME_FULL, NAME_POSTSCRIPT, NAME_TYPOGRAPHIC_FAMILY })
+    {
+        FindName(records, nameId);
+        // Kept names must decode to the text they compare equal to, and encode back unchanged
+        for (const NameText& name : FindAllNames(records, nameId))
+        {
+            std::wstring text = name.Text();
+            if (!(name == text) || !(NameText(text) == name))
+                abort();
+            std::string utf8;
+            name.AppendUtf8(utf8);
+            name.Before(L'-');
+        }
+    }
+    return 0;
+}
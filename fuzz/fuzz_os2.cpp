@@ -0,0 +1,18 @@
+// fuzz_os2.cpp : libFuzzer target for the OS/2 readers (style, metrics, license)
+//
+
+#include <cstddef>
+#include <cstdint>
+#include "../sfnt.h"
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
+{
+    // The same bytes also stand in for head, hhea and vhea, whose fields overlap OS/2's
+    ByteSpan os2(data, size);
+    ReadFontStyle(os2, os2);
+    ReadFontStyle(os2, ByteSpan());
+    ReadFontMetrics(os2, os2, os2, os2);
+    FontLicense license = ReadFontLicense(os2);
+    EmbeddingLevelName(license.embedding);
+    return 0;
+}
@@ -0,0 +1,103 @@
+// replay_main.cpp : Runs a fuzz target without libFuzzer (compilers other than Clang)
+//
+// Usage: fuzz_name [-runs=N] [-seed=S] [files or directories...]
+// Each file is passed to the target once. With -runs=N, N random inputs follow, each a
+// given file (or nothing) with random bytes overwritten, appended or cut, so a crash
+// found by libFuzzer can be replayed and a corpus smoke-tested on any compiler.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+
+namespace
+{
+    std::vector<uint8_t> ReadFile(const std::filesystem::path& path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        return std::vector<uint8_t>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    // A heap copy of exactly size bytes, so sanitizers see reads past the end
+    void RunOne(const std::vector<uint8_t>& input)
+    {
+        std::unique_ptr<uint8_t[]> copy(new uint8_t[input.size() ? input.size() : 1]);
+        if (!input.empty())
+            memcpy(copy.get(), input.data(), input.size());
+        LLVMFuzzerTestOneInput(copy.get(), input.size());
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned long runs = 0;
+    unsigned long seed = 1;
+    std::vector<std::vector<uint8_t>> inputs;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (strncmp(argv[i], "-runs=", 6) == 0)
+        {
+            runs = strtoul(argv[i] + 6, nullptr, 10);
+            continue;
+        }
+        if (strncmp(argv[i], "-seed=", 6) == 0)
+        {
+            seed = strtoul(argv[i] + 6, nullptr, 10);
+            continue;
+        }
+        std::error_code error;
+        if (std::filesystem::is_directory(argv[i], error))
+        {
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(argv[i], error))
+            {
+                if (entry.is_regular_file())
+                    inputs.push_back(ReadFile(entry.path()));
+            }
+        }
+        else
+        {
+            inputs.push_back(ReadFile(argv[i]));
+        }
+    }
+
+    for (const auto& input : inputs)
+        RunOne(input);
+
+    std::mt19937 random((uint32_t)seed);
+    std::vector<uint8_t> input;
+    for (unsigned long run = 0; run < runs; ++run)
+    {
+        input = inputs.empty() ? std::vector<uint8_t>() : inputs[random() % inputs.size()];
+        unsigned edits = 1 + random() % 16;
+        for (unsigned e = 0; e < edits; ++e)
+        {
+            switch (random() % 4)
+            {
+            case 0:  // Overwrite a byte
+            case 1:
+                if (!input.empty())
+                    input[random() % input.size()] = (uint8_t)random();
+                break;
+            case 2:  // Append bytes
+                for (unsigned n = random() % 64; n > 0; --n)
+                    input.push_back((uint8_t)random());
+                break;
+            default:  // Cut the tail
+                if (!input.empty())
+                    input.resize(random() % input.size());
+                break;
+            }
+        }
+        RunOne(input);
+    }
+    printf("Ran %zu inputs and %lu random variations\n", inputs.size(), runs);
+    return 0;
+}
@@ -0,0 +1,367 @@
+// glyf.cpp : TrueType glyf/loca outline decoding into a reusable arena
+//
+
+#include "glyf.h"
+#include <algorithm>
+#include "outline.h"
+#include "sfnt.h"
+
+namespace
+{
+    const uint32_t kGlyfTag = MakeTag('g', 'l', 'y', 'f');
+    const uint32_t kLocaTag = MakeTag('l', 'o', 'c', 'a');
+
+    constexpr int kMaxCompositeDepth = 8;
+    // Components reference glyphs by index, so a few nested composites can expand to
+    // an enormous outline; malformed fonts are cut off at these totals
+    constexpr size_t kMaxPoints = 1 << 20;
+    constexpr size_t kMaxComponents = 1 << 16;
+
+    // Simple glyph flags
+    enum : uint8_t
+    {
+        ON_CURVE = 0x01,
+        X_SHORT = 0x02,
+        Y_SHORT = 0x04,
+        REPEAT = 0x08,
+        X_SAME_OR_POSITIVE = 0x10,
+        Y_SAME_OR_POSITIVE = 0x20,
+    };
+
+    // Composite component flags
+    enum : uint16_t
+    {
+        ARG_WORDS = 0x0001,
+        ARGS_ARE_XY = 0x0002,
+        HAVE_SCALE = 0x0008,
+        MORE_COMPONENTS = 0x0020,
+        HAVE_XY_SCALE = 0x0040,
+        HAVE_TWO_BY_TWO = 0x0080,
+        SCALED_COMPONENT_OFFSET = 0x0800,
+        UNSCALED_COMPONENT_OFFSET = 0x1000,
+    };
+
+    // Coordinate bytes a flag takes: 1 for a short delta, 0 for a repeated value, 2 otherwise
+    constexpr uint8_t CoordinateBytes(uint8_t flag)
+    {
+        return uint8_t((flag & X_SHORT ? 1 : flag & X_SAME_OR_POSITIVE ? 0 : 2) +
+                       (flag & Y_SHORT ? 1 : flag & Y_SAME_OR_POSITIVE ? 0 : 2));
+    }
+
+    // CoordinateBytes by the flag's low six bits
+    struct CoordinateByteTable
+    {
+        uint8_t bytes[64] = {};
+
+        constexpr CoordinateByteTable()
+        {
+            for (int flag = 0; flag < 64; ++flag)
+                bytes[flag] = CoordinateBytes(uint8_t(flag));
+        }
+    };
+    constexpr CoordinateByteTable kCoordinateBytes;
+
+    // Coordinates of one axis from their 0, 1 or 2 byte deltas; the caller has checked
+    // the flags' byte total against the data. Delta sizes follow no pattern a branch
+    // predictor can learn across glyphs, so every case is computed and one kept by
+    // masking (about 1.6x faster over whole fonts than a switch). Bytes are read through
+    // a pointer clamped to the last byte of the glyph, since a repeated coordinate at
+    // the very end would otherwise read past it.
+    template <uint8_t Short, uint8_t SameOrPositive>
+    const uint8_t* UnpackDeltas(const uint8_t* p, const uint8_t* last, const uint8_t* flags, size_t count,
+                                float GlyphPoint::*axis, GlyphPoint* points)
+    {
+        int32_t value = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            uint32_t flag = flags[i];
+            uint32_t isShort = (flag / Short) & 1, same = (flag / SameOrPositive) & 1;
+            size_t size = isShort + (((isShort | same) ^ 1) << 1);
+            const uint8_t* q = p < last ? p : last;
+            int32_t first = q[0];
+            int32_t wide = int16_t((first << 8) | q[size >> 1]);
+            int32_t sign = int32_t(same) - 1;
+            int32_t narrow = (first ^ sign) - sign;
+            value += (narrow & -int32_t(isShort)) | (wide & -int32_t(size >> 1));
+            p += size;
+            points[i].*axis = float(value);
+        }
+        return p;
+    }
+
+    struct DecodeState
+    {
+        const GlyfFont& font;
+        OutlineArena& arena;
+        size_t components = 0;
+    };
+
+    bool DecodeSimpleGlyph(ByteSpan data, size_t contourCount, OutlineArena& arena)
+    {
+        size_t endsSize = contourCount * 2;
+        if (!data.Has(10, endsSize + 2)) return false;
+        size_t instructionLength = data.U16(10 + endsSize);
+        size_t pointCount = size_t(data.U16(10 + endsSize - 2)) + 1;
+        if (!data.Has(12 + endsSize, instructionLength) || arena.points.size + pointCount > kMaxPoints)
+            return false;
+
+        uint32_t base = (uint32_t)arena.points.size;
+        uint32_t* contourEnds = arena.contourEnds.Extend(contourCount);
+        size_t previous = 0;
+        for (size_t c = 0; c < contourCount; ++c)
+        {
+            size_t end = size_t(data.U16(10 + c * 2)) + 1;
+            if (end <= previous || end > pointCount) return false;
+            contourEnds[c] = base + (uint32_t)end;
+            previous = end;
+        }
+
+        // Expand the run-length coded flags, totalling the coordinate bytes they call for
+        // so the coordinates can be read without further bounds checks
+        const uint8_t* p = data.data + 12 + endsSize + instructionLength;
+        const uint8_t* limit = data.data + data.size;
+        uint8_t* flags = arena.flags.Extend(pointCount);
+        size_t coordinateBytes = 0;
+        for (size_t i = 0; i < pointCount;)
+        {
+            if (p == limit) return false;
+            uint8_t flag = *p++;
+            size_t bytes = kCoordinateBytes.bytes[flag & 0x3F];
+            flags[i++] = flag;
+            coordinateBytes += bytes;
+            if (flag & REPEAT)
+            {
+                if (p == limit) return false;
+                size_t repeat = std::min<size_t>(*p++, pointCount - i);
+                for (size_t k = 0; k < repeat; ++k)
+                    flags[i + k] = flag;
+                coordinateBytes += bytes * repeat;
+                i += repeat;
+            }
+        }
+        if (size_t(limit - p) < coordinateBytes) return false;
+
+        GlyphPoint* points = arena.points.Extend(pointCount);
+        p = UnpackDeltas<X_SHORT, X_SAME_OR_POSITIVE>(p, limit - 1, flags, pointCount, &GlyphPoint::x, points);
+        UnpackDeltas<Y_SHORT, Y_SAME_OR_POSITIVE>(p, limit - 1, flags, pointCount, &GlyphPoint::y, points);
+        return true;
+    }
+
+    bool DecodeGlyph(DecodeState& state, uint32_t glyph, int depth);
+
+    // Each component is decoded in place after the points so far, then transformed
+    // and moved into position
+    bool DecodeCompositeGlyph(DecodeState& state, ByteSpan data, int depth)
+    {
+        OutlineArena& arena = state.arena;
+        size_t glyphStart = arena.points.size;
+        SpanCursor cursor(data, 10);
+        uint16_t flags = MORE_COMPONENTS;
+        while (flags & MORE_COMPONENTS)
+        {
+            if (++state.components > kMaxComponents) return false;
+            flags = cursor.U16();
+            uint16_t component = cursor.U16();
+            // Offsets are signed; point numbers for matched anchors are not
+            int32_t arg1, arg2;
+            if (flags & ARG_WORDS)
+            {
+                arg1 = flags & ARGS_ARE_XY ? int32_t(int16_t(cursor.U16())) : int32_t(cursor.U16());
+                arg2 = flags & ARGS_ARE_XY ? int32_t(int16_t(cursor.U16())) : int32_t(cursor.U16());
+            }
+            else
+            {
+                arg1 = flags & ARGS_ARE_XY ? int32_t(int8_t(cursor.U8())) : int32_t(cursor.U8());
+                arg2 = flags & ARGS_ARE_XY ? int32_t(int8_t(cursor.U8())) : int32_t(cursor.U8());
+            }
+
+            // F2DOT14 transform: x' = x * xx + y * yx, y' = x * xy + y * yy
+            float xx = 1, xy = 0, yx = 0, yy = 1;
+            if (flags & HAVE_SCALE)
+            {
+                xx = yy = (int16_t)cursor.U16() / 16384.0f;
+            }
+            else if (flags & HAVE_XY_SCALE)
+            {
+                xx = (int16_t)cursor.U16() / 16384.0f;
+                yy = (int16_t)cursor.U16() / 16384.0f;
+            }
+            else if (flags & HAVE_TWO_BY_TWO)
+            {
+                xx = (int16_t)cursor.U16() / 16384.0f;
+                xy = (int16_t)cursor.U16() / 16384.0f;
+                yx = (int16_t)cursor.U16() / 16384.0f;
+                yy = (int16_t)cursor.U16() / 16384.0f;
+            }
+            if (!cursor.Ok()) return false;
+
+            size_t componentStart = arena.points.size;
+            if (!DecodeGlyph(state, component, depth + 1)) return false;
+            size_t componentEnd = arena.points.size;
+            GlyphPoint* points = arena.points.Data();
+
+            bool identity = xx == 1 && xy == 0 && yx == 0 && yy == 1;
+            if (!identity)
+            {
+                for (size_t i = componentStart; i < componentEnd; ++i)
+                {
+                    float x = points[i].x, y = points[i].y;
+                    points[i].x = x * xx + y * yx;
+                    points[i].y = x * xy + y * yy;
+                }
+            }
+
+            float dx, dy;
+            if (flags & ARGS_ARE_XY)
+            {
+                dx = float(arg1);
+                dy = float(arg2);
+                if ((flags & SCALED_COMPONENT_OFFSET) && !(flags & UNSCALED_COMPONENT_OFFSET))
+                {
+                    dx = arg1 * xx + arg2 * yx;
+                    dy = arg1 * xy + arg2 * yy;
+                }
+            }
+            else
+            {
+                // Line the component's point arg2 up with the glyph's point arg1
+                size_t parent = glyphStart + size_t(arg1), child = componentStart + size_t(arg2);
+                if (parent >= componentStart || child >= componentEnd) return false;
+                dx = points[parent].x - points[child].x;
+                dy = points[parent].y - points[child].y;
+            }
+            if (dx != 0 || dy != 0)
+            {
+                for (size_t i = componentStart; i < componentEnd; ++i)
+                {
+                    points[i].x += dx;
+                    points[i].y += dy;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool DecodeGlyph(DecodeState& state, uint32_t glyph, int depth)
+    {
+        if (depth > kMaxCompositeDepth || glyph >= state.font.glyphCount) return false;
+        ByteSpan data = state.font.GlyphData(glyph);
+        if (data.Empty()) return true;
+        if (!data.Has(0, 10)) return false;
+        int16_t contourCount = data.S16(0);
+        if (contourCount > 0)
+            return DecodeSimpleGlyph(data, size_t(contourCount), state.arena);
+        return contourCount == 0 || DecodeCompositeGlyph(state, data, depth);
+    }
+
+    // One contour; starts on an on-curve point, or at the midpoint of the first two
+    // points if there is none
+    void DrawContour(const GlyphPoint* points, const uint8_t* flags, size_t count, PathSink& sink)
+    {
+        if (count == 0) return;
+
+        size_t first = 0;
+        while (first < count && !(flags[first] & ON_CURVE)) ++first;
+        GlyphPoint start;
+        size_t steps = count - 1;
+        if (first < count)
+        {
+            start = points[first];
+        }
+        else
+        {
+            first = 0;
+            start = { (points[0].x + points[1 % count].x) / 2, (points[0].y + points[1 % count].y) / 2 };
+            steps = count;  // Point 0 is still to come, as the last control point
+        }
+        sink.MoveTo(start.x, start.y);
+
+        const GlyphPoint* control = nullptr;
+        for (size_t k = 1; k <= steps; ++k)
+        {
+            size_t index = first + k < count ? first + k : first + k - count;
+            const GlyphPoint& p = points[index];
+            if (flags[index] & ON_CURVE)
+            {
+                if (control) sink.QuadTo(control->x, control->y, p.x, p.y);
+                else sink.LineTo(p.x, p.y);
+                control = nullptr;
+            }
+            else
+            {
+                if (control)
+                    sink.QuadTo(control->x, control->y, (control->x + p.x) / 2, (control->y + p.y) / 2);
+                control = &p;
+            }
+        }
+        if (control) sink.QuadTo(control->x, control->y, start.x, start.y);
+        sink.Close();
+    }
+}
+
+OutlineArena& ThreadOutlineArena()
+{
+    thread_local OutlineArena arena;
+    return arena;
+}
+
+void GlyphOutline::Draw(PathSink& sink) const
+{
+    uint32_t start = 0;
+    for (uint32_t c = 0; c < contourCount; ++c)
+    {
+        DrawContour(points + start, flags + start, contourEnds[c] - start, sink);
+        start = contourEnds[c];
+    }
+}
+
+bool GlyfFont::Open(FontContainer& container, uint32_t numGlyphs, bool indexToLocLong)
+{
+    *this = GlyfFont();
+    const TableEntry* entry = container.FindTable(kGlyfTag);
+    if (!entry || entry->transformed) return false;
+    glyf = container.LoadTable(kGlyfTag);
+    loca = container.LoadTable(kLocaTag);
+    longOffsets = indexToLocLong;
+    glyphCount = numGlyphs;
+    return glyf && !loca.Array(0, size_t(glyphCount) + 1, longOffsets ? 4 : 2).Empty();
+}
+
+ByteSpan GlyfFont::GlyphData(uint32_t glyph) const
+{
+    if (glyph >= glyphCount) return ByteSpan();
+    // Short offsets are stored halved
+    size_t start = longOffsets ? loca.U32(size_t(glyph) * 4) : size_t(loca.U16(size_t(glyph) * 2)) * 2;
+    size_t end = longOffsets ? loca.U32(size_t(glyph) * 4 + 4) : size_t(loca.U16(size_t(glyph) * 2 + 2)) * 2;
+    return end > start ? glyf.Sub(start, end - start) : ByteSpan();
+}
+
+bool GlyfFont::Decode(uint32_t glyph, OutlineArena& arena, GlyphOutline& outline) const
+{
+    arena.Clear();
+    DecodeState state{ *this, arena };
+    bool ok = DecodeGlyph(state, glyph, 0);
+    outline = GlyphOutline();
+    outline.glyph = glyph;
+    if (!ok) return false;
+
+    ByteSpan data = GlyphData(glyph);
+    outline.points = arena.points.Data();
+    outline.flags = arena.flags.Data();
+    outline.pointCount = (uint32_t)arena.points.size;
+    outline.contourEnds = arena.contourEnds.Data();
+    outline.contourCount = (uint32_t)arena.contourEnds.size;
+    outline.composite = data.Has(0, 2) && data.S16(0) < 0;
+    return true;
+}
+
+bool GlyfIterator::Next(GlyphOutline& outline)
+{
+    while (next < font.glyphCount)
+    {
+        if (font.Decode(next++, arena, outline))
+            return true;
+        ++failed;
+    }
+    return false;
+}
@@ -0,0 +1,121 @@
+// glyf.h : TrueType glyf/loca outline decoding into a reusable arena
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include "bytespan.h"
+
+struct FontContainer;
+struct PathSink;
+
+// Growable storage that is never initialized or shrunk; Clear keeps the memory
+template <typename T>
+struct ArenaBuffer
+{
+    std::unique_ptr<T[]> items;
+    size_t size = 0;
+    size_t capacity = 0;
+
+    void Clear() { size = 0; }
+    T* Data() const { return items.get(); }
+
+    // Appends count uninitialized items and returns the first; earlier pointers
+    // into the buffer are invalidated if it has to grow
+    T* Extend(size_t count)
+    {
+        if (count > capacity - size)
+        {
+            size_t grown = capacity * 2 > size + count ? capacity * 2 : size + count + 256;
+            std::unique_ptr<T[]> larger(new T[grown]);
+            if (size > 0) memcpy(larger.get(), items.get(), size * sizeof(T));
+            items = std::move(larger);
+            capacity = grown;
+        }
+        T* first = items.get() + size;
+        size += count;
+        return first;
+    }
+};
+
+struct GlyphPoint
+{
+    float x, y;
+};
+
+// Points and contours of the glyph being decoded, composites flattened. One arena
+// per thread is reused for every glyph, so decoding allocates nothing once it has
+// grown to the largest glyph.
+struct OutlineArena
+{
+    ArenaBuffer<GlyphPoint> points;
+    ArenaBuffer<uint8_t> flags;          // Per point; bit 0 is set for on-curve points
+    ArenaBuffer<uint32_t> contourEnds;   // One past the last point of each contour
+
+    void Clear()
+    {
+        points.Clear();
+        flags.Clear();
+        contourEnds.Clear();
+    }
+};
+
+// The calling thread's arena
+OutlineArena& ThreadOutlineArena();
+
+// A decoded glyph in font units; the arrays live in the arena and stay valid until
+// it decodes the next glyph
+struct GlyphOutline
+{
+    uint32_t glyph = 0;
+    const GlyphPoint* points = nullptr;
+    const uint8_t* flags = nullptr;
+    uint32_t pointCount = 0;
+    const uint32_t* contourEnds = nullptr;
+    uint32_t contourCount = 0;
+    bool composite = false;
+
+    bool OnCurve(uint32_t point) const { return (flags[point] & 1) != 0; }
+    // Quadratic segments into sink; two off-curve points in a row imply the on-curve
+    // point halfway between them
+    void Draw(PathSink& sink) const;
+};
+
+// The glyf and loca tables of a face. The spans point into the container, which
+// must stay open while the font is used.
+struct GlyfFont
+{
+    ByteSpan glyf;
+    ByteSpan loca;
+    bool longOffsets = false;  // head.indexToLocFormat
+    uint32_t glyphCount = 0;
+
+    // False without glyf/loca, with a loca too short for glyphCount, or for WOFF2
+    // files whose glyf table is stored transformed
+    bool Open(FontContainer& container, uint32_t numGlyphs, bool indexToLocLong);
+    // glyf data of a glyph; empty for glyphs without contours
+    ByteSpan GlyphData(uint32_t glyph) const;
+    // Unpacks a glyph, resolving composite components (with point-matched anchors)
+    // into one outline. False if the glyph data is malformed.
+    bool Decode(uint32_t glyph, OutlineArena& arena, GlyphOutline& outline) const;
+};
+
+// Every glyph of a font in glyph order, decoded into the thread's arena:
+//     GlyphOutline outline;
+//     for (GlyfIterator it(font); it.Next(outline);) ...
+// Malformed glyphs are counted and skipped.
+struct GlyfIterator
+{
+    const GlyfFont& font;
+    OutlineArena& arena;
+    uint32_t next = 0;
+    size_t failed = 0;
+
+    explicit GlyfIterator(const GlyfFont& source) : font(source), arena(ThreadOutlineArena()) {}
+    GlyfIterator(const GlyfFont& source, OutlineArena& storage) : font(source), arena(storage) {}
+
+    bool Next(GlyphOutline& outline);
+};
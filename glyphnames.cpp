@@ -0,0 +1,406 @@
+// glyphnames.cpp : Glyph names from post and CFF charsets, mapped to Unicode through the AGL
+//
+
+#include "glyphnames.h"
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include "agl.h"
+#include "cff.h"
+
+namespace
+{
+    // Macintosh standard order used by post formats 1, 2 and 2.5
+    const char* const kMacGlyphNames[258] =
+    {
+        ".notdef", ".null", "nonmarkingreturn", "space", "exclam", "quotedbl", "numbersign", "dollar",
+        "percent", "ampersand", "quotesingle", "parenleft", "parenright", "asterisk", "plus", "comma",
+        "hyphen", "period", "slash", "zero", "one", "two", "three", "four", "five", "six", "seven", "eight",
+        "nine", "colon", "semicolon", "less", "equal", "greater", "question", "at", "A", "B", "C", "D", "E",
+        "F", "G", "H", "I", "J", "K", "L", "M", "N", "O", "P", "Q", "R", "S", "T", "U", "V", "W", "X", "Y",
+        "Z", "bracketleft", "backslash", "bracketright", "asciicircum", "underscore", "grave", "a", "b", "c",
+        "d", "e", "f", "g", "h", "i", "j", "k", "l", "m", "n", "o", "p", "q", "r", "s", "t", "u", "v", "w",
+        "x", "y", "z", "braceleft", "bar", "braceright", "asciitilde", "Adieresis", "Aring", "Ccedilla",
+        "Eacute", "Ntilde", "Odieresis", "Udieresis", "aacute", "agrave", "acircumflex", "adieresis",
+        "atilde", "aring", "ccedilla", "eacute", "egrave", "ecircumflex", "edieresis", "iacute", "igrave",
+        "icircumflex", "idieresis", "ntilde", "oacute", "ograve", "ocircumflex", "odieresis", "otilde",
+        "uacute", "ugrave", "ucircumflex", "udieresis", "dagger", "degree", "cent", "sterling", "section",
+        "bullet", "paragraph", "germandbls", "registered", "copyright", "trademark", "acute", "dieresis",
+        "notequal", "AE", "Oslash", "infinity", "plusminus", "lessequal", "greaterequal", "yen", "mu",
+        "partialdiff", "summation", "product", "pi", "integral", "ordfeminine", "ordmasculine", "Omega",
+        "ae", "oslash", "questiondown", "exclamdown", "logicalnot", "radical", "florin", "approxequal",
+        "Delta", "guillemotleft", "guillemotright", "ellipsis", "nonbreakingspace", "Agrave", "Atilde",
+        "Otilde", "OE", "oe", "endash", "emdash", "quotedblleft", "quotedblright", "quoteleft", "quoteright",
+        "divide", "lozenge", "ydieresis", "Ydieresis", "fraction", "currency", "guilsinglleft",
+        "guilsinglright", "fi", "fl", "daggerdbl", "periodcentered", "quotesinglbase", "quotedblbase",
+        "perthousand", "Acircumflex", "Ecircumflex", "Aacute", "Edieresis", "Egrave", "Iacute",
+        "Icircumflex", "Idieresis", "Igrave", "Oacute", "Ocircumflex", "apple", "Ograve", "Uacute",
+        "Ucircumflex", "Ugrave", "dotlessi", "circumflex", "tilde", "macron", "breve", "dotaccent", "ring",
+        "cedilla", "hungarumlaut", "ogonek", "caron", "Lslash", "lslash", "Scaron", "scaron", "Zcaron",
+        "zcaron", "brokenbar", "Eth", "eth", "Yacute", "yacute", "Thorn", "thorn", "minus", "multiply",
+        "onesuperior", "twosuperior", "threesuperior", "onehalf", "onequarter", "threequarters", "franc",
+        "Gbreve", "gbreve", "Idotaccent", "Scedilla", "scedilla", "Cacute", "cacute", "Ccaron", "ccaron",
+        "dcroat",
+    };
+
+    // CFF standard strings (SIDs 0-390)
+    const char* const kCffStandardStrings[391] =
+    {
+        ".notdef", "space", "exclam", "quotedbl", "numbersign", "dollar", "percent", "ampersand",
+        "quoteright", "parenleft", "parenright", "asterisk", "plus", "comma", "hyphen", "period", "slash",
+        "zero", "one", "two", "three", "four", "five", "six", "seven", "eight", "nine", "colon", "semicolon",
+        "less", "equal", "greater", "question", "at", "A", "B", "C", "D", "E", "F", "G", "H", "I", "J", "K",
+        "L", "M", "N", "O", "P", "Q", "R", "S", "T", "U", "V", "W", "X", "Y", "Z", "bracketleft",
+        "backslash", "bracketright", "asciicircum", "underscore", "quoteleft", "a", "b", "c", "d", "e", "f",
+        "g", "h", "i", "j", "k", "l", "m", "n", "o", "p", "q", "r", "s", "t", "u", "v", "w", "x", "y", "z",
+        "braceleft", "bar", "braceright", "asciitilde", "exclamdown", "cent", "sterling", "fraction", "yen",
+        "florin", "section", "currency", "quotesingle", "quotedblleft", "guillemotleft", "guilsinglleft",
+        "guilsinglright", "fi", "fl", "endash", "dagger", "daggerdbl", "periodcentered", "paragraph",
+        "bullet", "quotesinglbase", "quotedblbase", "quotedblright", "guillemotright", "ellipsis",
+        "perthousand", "questiondown", "grave", "acute", "circumflex", "tilde", "macron", "breve",
+        "dotaccent", "dieresis", "ring", "cedilla", "hungarumlaut", "ogonek", "caron", "emdash", "AE",
+        "ordfeminine", "Lslash", "Oslash", "OE", "ordmasculine", "ae", "dotlessi", "lslash", "oslash", "oe",
+        "germandbls", "onesuperior", "logicalnot", "mu", "trademark", "Eth", "onehalf", "plusminus", "Thorn",
+        "onequarter", "divide", "brokenbar", "degree", "thorn", "threequarters", "twosuperior", "registered",
+        "minus", "eth", "multiply", "threesuperior", "copyright", "Aacute", "Acircumflex", "Adieresis",
+        "Agrave", "Aring", "Atilde", "Ccedilla", "Eacute", "Ecircumflex", "Edieresis", "Egrave", "Iacute",
+        "Icircumflex", "Idieresis", "Igrave", "Ntilde", "Oacute", "Ocircumflex", "Odieresis", "Ograve",
+        "Otilde", "Scaron", "Uacute", "Ucircumflex", "Udieresis", "Ugrave", "Yacute", "Ydieresis", "Zcaron",
+        "aacute", "acircumflex", "adieresis", "agrave", "aring", "atilde", "ccedilla", "eacute",
+        "ecircumflex", "edieresis", "egrave", "iacute", "icircumflex", "idieresis", "igrave", "ntilde",
+        "oacute", "ocircumflex", "odieresis", "ograve", "otilde", "scaron", "uacute", "ucircumflex",
+        "udieresis", "ugrave", "yacute", "ydieresis", "zcaron", "exclamsmall", "Hungarumlautsmall",
+        "dollaroldstyle", "dollarsuperior", "ampersandsmall", "Acutesmall", "parenleftsuperior",
+        "parenrightsuperior", "twodotenleader", "onedotenleader", "zerooldstyle", "oneoldstyle",
+        "twooldstyle", "threeoldstyle", "fouroldstyle", "fiveoldstyle", "sixoldstyle", "sevenoldstyle",
+        "eightoldstyle", "nineoldstyle", "commasuperior", "threequartersemdash", "periodsuperior",
+        "questionsmall", "asuperior", "bsuperior", "centsuperior", "dsuperior", "esuperior", "isuperior",
+        "lsuperior", "msuperior", "nsuperior", "osuperior", "rsuperior", "ssuperior", "tsuperior", "ff",
+        "ffi", "ffl", "parenleftinferior", "parenrightinferior", "Circumflexsmall", "hyphensuperior",
+        "Gravesmall", "Asmall", "Bsmall", "Csmall", "Dsmall", "Esmall", "Fsmall", "Gsmall", "Hsmall",
+        "Ismall", "Jsmall", "Ksmall", "Lsmall", "Msmall", "Nsmall", "Osmall", "Psmall", "Qsmall", "Rsmall",
+        "Ssmall", "Tsmall", "Usmall", "Vsmall", "Wsmall", "Xsmall", "Ysmall", "Zsmall", "colonmonetary",
+        "onefitted", "rupiah", "Tildesmall", "exclamdownsmall", "centoldstyle", "Lslashsmall", "Scaronsmall",
+        "Zcaronsmall", "Dieresissmall", "Brevesmall", "Caronsmall", "Dotaccentsmall", "Macronsmall",
+        "figuredash", "hypheninferior", "Ogoneksmall", "Ringsmall", "Cedillasmall", "questiondownsmall",
+        "oneeighth", "threeeighths", "fiveeighths", "seveneighths", "onethird", "twothirds", "zerosuperior",
+        "foursuperior", "fivesuperior", "sixsuperior", "sevensuperior", "eightsuperior", "ninesuperior",
+        "zeroinferior", "oneinferior", "twoinferior", "threeinferior", "fourinferior", "fiveinferior",
+        "sixinferior", "seveninferior", "eightinferior", "nineinferior", "centinferior", "dollarinferior",
+        "periodinferior", "commainferior", "Agravesmall", "Aacutesmall", "Acircumflexsmall", "Atildesmall",
+        "Adieresissmall", "Aringsmall", "AEsmall", "Ccedillasmall", "Egravesmall", "Eacutesmall",
+        "Ecircumflexsmall", "Edieresissmall", "Igravesmall", "Iacutesmall", "Icircumflexsmall",
+        "Idieresissmall", "Ethsmall", "Ntildesmall", "Ogravesmall", "Oacutesmall", "Ocircumflexsmall",
+        "Otildesmall", "Odieresissmall", "OEsmall", "Oslashsmall", "Ugravesmall", "Uacutesmall",
+        "Ucircumflexsmall", "Udieresissmall", "Yacutesmall", "Thornsmall", "Ydieresissmall", "001.000",
+        "001.001", "001.002", "001.003", "Black", "Bold", "Book", "Light", "Medium", "Regular", "Roman",
+        "Semibold",
+    };
+
+    // SIDs of the predefined Expert and ExpertSubset charsets, starting at glyph 1
+    const uint16_t kCffExpertCharset[165] =
+    {
+        1, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 13, 14, 15, 99, 239, 240, 241, 242, 243, 244,
+        245, 246, 247, 248, 27, 28, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262,
+        263, 264, 265, 266, 109, 110, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 280,
+        281, 282, 283, 284, 285, 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300,
+        301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 158, 155,
+        163, 319, 320, 321, 322, 323, 324, 325, 326, 150, 164, 169, 327, 328, 329, 330, 331, 332, 333, 334,
+        335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354,
+        355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374,
+        375, 376, 377, 378,
+    };
+
+    const uint16_t kCffExpertSubsetCharset[86] =
+    {
+        1, 231, 232, 235, 236, 237, 238, 13, 14, 15, 99, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248,
+        27, 28, 249, 250, 251, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 109,
+        110, 267, 268, 269, 270, 272, 300, 301, 302, 305, 314, 315, 158, 155, 163, 320, 321, 322, 323, 324,
+        325, 326, 150, 164, 169, 327, 328, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341,
+        342, 343, 344, 345, 346,
+    };
+
+    constexpr size_t kCffStandardStringCount = 391;
+
+    // SID (or CID) of every glyph; glyph 0 is always .notdef
+    bool ReadCffCharset(ByteSpan cff, int32_t offset, uint32_t glyphCount, std::vector<uint16_t>& ids)
+    {
+        ids.assign(glyphCount, 0);
+        switch (offset)
+        {
+        case 0:
+            // ISOAdobe: glyph i is SID i
+            for (uint32_t glyph = 1; glyph < glyphCount && glyph < 229; ++glyph)
+                ids[glyph] = (uint16_t)glyph;
+            return true;
+        case 1:
+            for (uint32_t glyph = 1; glyph < glyphCount && glyph <= std::size(kCffExpertCharset); ++glyph)
+                ids[glyph] = kCffExpertCharset[glyph - 1];
+            return true;
+        case 2:
+            for (uint32_t glyph = 1; glyph < glyphCount && glyph <= std::size(kCffExpertSubsetCharset); ++glyph)
+                ids[glyph] = kCffExpertSubsetCharset[glyph - 1];
+            return true;
+        }
+        if (offset < 0) return false;
+
+        SpanCursor cursor(cff, (size_t)offset);
+        uint8_t format = cursor.U8();
+        if (format == 0)
+        {
+            for (uint32_t glyph = 1; glyph < glyphCount && cursor.Ok(); ++glyph)
+                ids[glyph] = cursor.U16();
+        }
+        else if (format == 1 || format == 2)
+        {
+            // Ranges of consecutive ids: first, then the number of ids left in the range
+            uint32_t glyph = 1;
+            while (glyph < glyphCount && cursor.Ok())
+            {
+                uint32_t first = cursor.U16();
+                uint32_t left = format == 1 ? cursor.U8() : cursor.U16();
+                for (uint32_t k = 0; k <= left && glyph < glyphCount; ++k)
+                    ids[glyph++] = uint16_t(first + k);
+            }
+        }
+        else
+        {
+            return false;
+        }
+        return cursor.Ok();
+    }
+
+    bool ReadCffNames(ByteSpan cff, GlyphNamePool& pool, std::vector<uint32_t>& names)
+    {
+        CffFont font;
+        if (!font.Open(cff)) return false;
+
+        int32_t charset = 0;  // 0-2 are the predefined charsets
+        size_t count = 0;
+        FindCffDictEntry(font.topDict.Get(0), 15, &charset, 1, count);
+        std::vector<uint16_t> ids;
+        if (!ReadCffCharset(cff, charset, font.GlyphCount(), ids)) return false;
+
+        names.assign(font.GlyphCount(), 0);
+        for (uint32_t glyph = 0; glyph < font.GlyphCount(); ++glyph)
+        {
+            uint16_t id = ids[glyph];
+            if (font.cidKeyed)
+            {
+                // ROS present: the charset holds CIDs instead of SIDs
+                char name[16];
+                snprintf(name, sizeof(name), "cid%05u", (unsigned)id);
+                names[glyph] = pool.Intern(name);
+            }
+            else if (id < kCffStandardStringCount)
+            {
+                names[glyph] = pool.Intern(kCffStandardStrings[id]);
+            }
+            else if (id - kCffStandardStringCount < font.strings.count)
+            {
+                ByteSpan text = font.strings.Get(uint32_t(id - kCffStandardStringCount));
+                names[glyph] = pool.Intern(std::string_view((const char*)text.data, text.size));
+            }
+        }
+        return true;
+    }
+
+    bool ReadPostNames(ByteSpan post, uint32_t glyphCount, GlyphNamePool& pool, std::vector<uint32_t>& names)
+    {
+        if (!post.Has(0, 32)) return false;
+        names.assign(glyphCount, 0);
+
+        switch (post.U32(0))
+        {
+        case 0x00010000:
+            // Exactly the standard Macintosh glyph set
+            for (uint32_t glyph = 0; glyph < glyphCount && glyph < 258; ++glyph)
+                names[glyph] = pool.Intern(kMacGlyphNames[glyph]);
+            return true;
+        case 0x00020000:
+        {
+            if (!post.Has(32, 2)) return false;
+            uint16_t count = post.U16(32);
+            ByteSpan indices = post.Array(34, count, 2);
+            if (indices.Empty() && count > 0) return false;
+
+            // Pascal strings follow the index array; indices from 258 on refer to them in order
+            std::vector<std::string_view> custom;
+            SpanCursor cursor(post, 34 + indices.size);
+            while (cursor.Remaining() > 0)
+            {
+                ByteSpan text = cursor.Bytes(cursor.U8());
+                if (!cursor.Ok()) break;
+                custom.emplace_back((const char*)text.data, text.size);
+            }
+
+            for (uint32_t glyph = 0; glyph < glyphCount && glyph < count; ++glyph)
+            {
+                uint16_t index = indices.U16(size_t(glyph) * 2);
+                if (index < 258)
+                    names[glyph] = pool.Intern(kMacGlyphNames[index]);
+                else if (size_t(index - 258) < custom.size())
+                    names[glyph] = pool.Intern(custom[index - 258]);
+            }
+            return true;
+        }
+        case 0x00025000:
+        {
+            // Deprecated: each glyph is a signed offset into the standard order
+            if (!post.Has(32, 2)) return false;
+            uint16_t count = post.U16(32);
+            ByteSpan offsets = post.Array(34, count, 1);
+            if (offsets.Empty() && count > 0) return false;
+            for (uint32_t glyph = 0; glyph < glyphCount && glyph < count; ++glyph)
+            {
+                int32_t index = int32_t(glyph) + (int8_t)offsets.U8(glyph);
+                if (index >= 0 && index < 258)
+                    names[glyph] = pool.Intern(kMacGlyphNames[index]);
+            }
+            return true;
+        }
+        default:
+            // Format 3 (and CFF2 fonts) carry no names
+            return false;
+        }
+    }
+
+    bool HexValue(char c, uint32_t& digit)
+    {
+        // The AGL specification only accepts uppercase hex digits
+        if (c >= '0' && c <= '9') digit = uint32_t(c - '0');
+        else if (c >= 'A' && c <= 'F') digit = uint32_t(c - 'A' + 10);
+        else return false;
+        return true;
+    }
+
+    bool ParseHex(std::string_view text, uint32_t& value)
+    {
+        value = 0;
+        for (char c : text)
+        {
+            uint32_t digit;
+            if (!HexValue(c, digit)) return false;
+            value = (value << 4) | digit;
+        }
+        return true;
+    }
+
+    bool IsSurrogate(uint32_t value)
+    {
+        return value >= 0xD800 && value <= 0xDFFF;
+    }
+
+    size_t ComponentToUnicode(std::string_view component, uint32_t* codePoints, size_t capacity)
+    {
+        size_t count = AglLookup(component, codePoints, capacity);
+        if (count > 0) return count;
+
+        // uni followed by one or more groups of four hex digits, each a BMP non-surrogate
+        if (component.size() >= 7 && component.compare(0, 3, "uni") == 0 && (component.size() - 3) % 4 == 0)
+        {
+            size_t groups = (component.size() - 3) / 4;
+            if (groups > capacity) return 0;
+            for (size_t i = 0; i < groups; ++i)
+            {
+                uint32_t value;
+                if (!ParseHex(component.substr(3 + i * 4, 4), value) || IsSurrogate(value)) return 0;
+                codePoints[i] = value;
+            }
+            return groups;
+        }
+
+        // u followed by four to six hex digits
+        if (component.size() >= 5 && component.size() <= 7 && component[0] == 'u' && capacity > 0)
+        {
+            uint32_t value;
+            if (!ParseHex(component.substr(1), value) || IsSurrogate(value) || value > 0x10FFFF) return 0;
+            codePoints[0] = value;
+            return 1;
+        }
+        return 0;
+    }
+}
+
+GlyphNamePool::GlyphNamePool()
+{
+    strings.push_back(std::string_view());
+    ids.emplace(std::string_view(), 0);
+}
+
+uint32_t GlyphNamePool::Intern(std::string_view name)
+{
+    auto it = ids.find(name);
+    if (it != ids.end()) return it->second;
+
+    char* copy = nullptr;
+    if (name.size() > kBlockSize / 16)
+    {
+        // Rare long names get their own allocation so blocks stay densely filled
+        blocks.emplace_back(new char[name.size()]);
+        copy = blocks.back().get();
+    }
+    else
+    {
+        if (blockUsed + name.size() > kBlockSize)
+        {
+            blocks.emplace_back(new char[kBlockSize]);
+            block = blocks.back().get();
+            blockUsed = 0;
+        }
+        copy = block + blockUsed;
+        blockUsed += name.size();
+    }
+    memcpy(copy, name.data(), name.size());
+    bytes += name.size();
+
+    uint32_t id = (uint32_t)strings.size();
+    strings.emplace_back(copy, name.size());
+    ids.emplace(strings.back(), id);
+    return id;
+}
+
+GlyphNameTable ReadGlyphNames(FontContainer& container, GlyphNamePool& pool)
+{
+    GlyphNameTable table;
+    ByteSpan cff = container.LoadTable(MakeTag('C', 'F', 'F', ' '));
+    if (cff && ReadCffNames(cff, pool, table.names))
+    {
+        table.source = GlyphNameSource::Cff;
+        return table;
+    }
+
+    ByteSpan maxp = container.LoadTable(MakeTag('m', 'a', 'x', 'p'));
+    ByteSpan post = container.LoadTable(MakeTag('p', 'o', 's', 't'));
+    if (maxp.Has(4, 2) && ReadPostNames(post, maxp.U16(4), pool, table.names))
+    {
+        table.source = GlyphNameSource::Post;
+        return table;
+    }
+    table.names.clear();
+    return table;
+}
+
+size_t GlyphNameToUnicode(std::string_view name, uint32_t* codePoints, size_t capacity)
+{
+    name = name.substr(0, name.find('.'));
+    size_t count = 0;
+    for (;;)
+    {
+        size_t end = name.find('_');
+        count += ComponentToUnicode(name.substr(0, end), codePoints + count, capacity - count);
+        if (end == std::string_view::npos) break;
+        name.remove_prefix(end + 1);
+    }
+    return count;
+}
+
+const wchar_t* GlyphNameSourceName(GlyphNameSource source)
+{
+    switch (source)
+    {
+    case GlyphNameSource::Post: return L"post";
+    case GlyphNameSource::Cff: return L"CFF";
+    default: return L"none";
+    }
+}
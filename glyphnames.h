@@ -0,0 +1,60 @@
+// glyphnames.h : Glyph names from post and CFF charsets, mapped to Unicode through the AGL
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include "sfnt.h"
+
+// Interned glyph names shared by every font of a run. Most fonts reuse the same
+// names (standard Mac/CFF names, uniXXXX), so each distinct name is stored once
+// in large blocks and fonts refer to it by id. Id 0 is the empty name.
+struct GlyphNamePool
+{
+    static constexpr size_t kBlockSize = 64 * 1024;
+
+    std::vector<std::unique_ptr<char[]>> blocks;
+    char* block = nullptr;                                 // Block being filled
+    size_t blockUsed = kBlockSize;
+    size_t bytes = 0;                                      // Characters stored
+    std::vector<std::string_view> strings;                 // By id
+    std::unordered_map<std::string_view, uint32_t> ids;
+
+    GlyphNamePool();
+    GlyphNamePool(const GlyphNamePool&) = delete;
+    GlyphNamePool& operator=(const GlyphNamePool&) = delete;
+
+    uint32_t Intern(std::string_view name);
+    std::string_view Get(uint32_t id) const { return strings[id]; }
+    size_t Count() const { return strings.size() - 1; }
+};
+
+enum class GlyphNameSource
+{
+    None,
+    Post,  // post format 1, 2 or 2.5
+    Cff,   // CFF charset (CID-keyed fonts get cidNNNNN names)
+};
+
+struct GlyphNameTable
+{
+    GlyphNameSource source = GlyphNameSource::None;
+    std::vector<uint32_t> names;  // Pool id per glyph; 0 where the font names nothing
+};
+
+// Names of every glyph of the selected face. CFF outlines take their names from the
+// charset (as rasterizers and fontTools do); TrueType outlines from post.
+GlyphNameTable ReadGlyphNames(FontContainer& container, GlyphNamePool& pool);
+
+// Unicode code points of a glyph name following the Adobe Glyph List specification:
+// the suffix after '.' is dropped, '_' separates ligature components and each component
+// is looked up in the AGL or read as uniXXXX[XXXX...] / uXXXX[XX]. Returns the count
+// written; 0 if the name does not map.
+size_t GlyphNameToUnicode(std::string_view name, uint32_t* codePoints, size_t capacity);
+
+const wchar_t* GlyphNameSourceName(GlyphNameSource source);
@@ -0,0 +1,299 @@
+// hash.cpp : XXH3-64 content hashing for font files and tables
+//
+
+#include "hash.h"
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define LISTFONT_HASH_SSE2 1
+#else
+#define LISTFONT_HASH_SSE2 0
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace
+{
+    const uint32_t kPrime32_1 = 0x9E3779B1U;
+    const uint32_t kPrime32_2 = 0x85EBCA77U;
+    const uint32_t kPrime32_3 = 0xC2B2AE3DU;
+    const uint64_t kPrime64_1 = 0x9E3779B185EBCA87ULL;
+    const uint64_t kPrime64_2 = 0xC2B2AE3D27D4EB4FULL;
+    const uint64_t kPrime64_3 = 0x165667B19E3779F9ULL;
+    const uint64_t kPrime64_4 = 0x85EBCA77C2B2AE63ULL;
+    const uint64_t kPrime64_5 = 0x27D4EB2F165667C5ULL;
+    const uint64_t kPrimeMx1 = 0x165667919E3779F9ULL;
+    const uint64_t kPrimeMx2 = 0x9FB21C651E98DF25ULL;
+
+    const size_t kSecretSize = 192;
+    const size_t kStripeLen = 64;
+    const size_t kStripesPerBlock = (kSecretSize - kStripeLen) / 8;
+    const size_t kBlockLen = kStripeLen * kStripesPerBlock;
+
+    alignas(64) const uint8_t kSecret[kSecretSize] = {
+        0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+        0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+        0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+        0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+        0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+        0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+        0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+        0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+        0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+        0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+        0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+        0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+    };
+
+    // Little-endian loads (all supported targets are little-endian)
+    inline uint32_t Read32(const uint8_t* p)
+    {
+        uint32_t v;
+        memcpy(&v, p, sizeof(v));
+        return v;
+    }
+
+    inline uint64_t Read64(const uint8_t* p)
+    {
+        uint64_t v;
+        memcpy(&v, p, sizeof(v));
+        return v;
+    }
+
+    inline uint64_t Rotl64(uint64_t x, int r)
+    {
+        return (x << r) | (x >> (64 - r));
+    }
+
+    inline uint32_t Swap32(uint32_t x)
+    {
+        return ((x << 24) & 0xff000000) | ((x << 8) & 0x00ff0000) | ((x >> 8) & 0x0000ff00) | ((x >> 24) & 0x000000ff);
+    }
+
+    inline uint64_t Swap64(uint64_t x)
+    {
+        return (uint64_t(Swap32(uint32_t(x))) << 32) | Swap32(uint32_t(x >> 32));
+    }
+
+    // 64x64->128 multiply, folded to 64 bits by xoring the halves
+    inline uint64_t Mul128Fold64(uint64_t lhs, uint64_t rhs)
+    {
+#if defined(__SIZEOF_INT128__)
+        unsigned __int128 product = (unsigned __int128)lhs * rhs;
+        return uint64_t(product) ^ uint64_t(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+        uint64_t high;
+        uint64_t low = _umul128(lhs, rhs, &high);
+        return low ^ high;
+#else
+        uint64_t loLo = (lhs & 0xFFFFFFFF) * (rhs & 0xFFFFFFFF);
+        uint64_t hiLo = (lhs >> 32) * (rhs & 0xFFFFFFFF);
+        uint64_t loHi = (lhs & 0xFFFFFFFF) * (rhs >> 32);
+        uint64_t hiHi = (lhs >> 32) * (rhs >> 32);
+        uint64_t cross = (loLo >> 32) + (hiLo & 0xFFFFFFFF) + loHi;
+        uint64_t upper = (hiLo >> 32) + (cross >> 32) + hiHi;
+        uint64_t lower = (cross << 32) | (loLo & 0xFFFFFFFF);
+        return lower ^ upper;
+#endif
+    }
+
+    inline uint64_t Xxh64Avalanche(uint64_t h)
+    {
+        h ^= h >> 33;
+        h *= kPrime64_2;
+        h ^= h >> 29;
+        h *= kPrime64_3;
+        h ^= h >> 32;
+        return h;
+    }
+
+    inline uint64_t Avalanche(uint64_t h)
+    {
+        h ^= h >> 37;
+        h *= kPrimeMx1;
+        h ^= h >> 32;
+        return h;
+    }
+
+    inline uint64_t Rrmxmx(uint64_t h, uint64_t len)
+    {
+        h ^= Rotl64(h, 49) ^ Rotl64(h, 24);
+        h *= kPrimeMx2;
+        h ^= (h >> 35) + len;
+        h *= kPrimeMx2;
+        return h ^ (h >> 28);
+    }
+
+    inline uint64_t Mix16(const uint8_t* input, const uint8_t* secret)
+    {
+        return Mul128Fold64(Read64(input) ^ Read64(secret), Read64(input + 8) ^ Read64(secret + 8));
+    }
+
+    uint64_t Hash0To16(const uint8_t* input, size_t len)
+    {
+        if (len > 8)
+        {
+            uint64_t inputLo = Read64(input) ^ (Read64(kSecret + 24) ^ Read64(kSecret + 32));
+            uint64_t inputHi = Read64(input + len - 8) ^ (Read64(kSecret + 40) ^ Read64(kSecret + 48));
+            uint64_t acc = len + Swap64(inputLo) + inputHi + Mul128Fold64(inputLo, inputHi);
+            return Avalanche(acc);
+        }
+        if (len >= 4)
+        {
+            uint64_t input64 = Read32(input + len - 4) + (uint64_t(Read32(input)) << 32);
+            uint64_t keyed = input64 ^ (Read64(kSecret + 8) ^ Read64(kSecret + 16));
+            return Rrmxmx(keyed, len);
+        }
+        if (len > 0)
+        {
+            uint32_t combined = (uint32_t(input[0]) << 16) | (uint32_t(input[len >> 1]) << 24) |
+                                uint32_t(input[len - 1]) | (uint32_t(len) << 8);
+            uint64_t keyed = uint64_t(combined) ^ uint64_t(Read32(kSecret) ^ Read32(kSecret + 4));
+            return Xxh64Avalanche(keyed);
+        }
+        return Xxh64Avalanche(Read64(kSecret + 56) ^ Read64(kSecret + 64));
+    }
+
+    uint64_t Hash17To128(const uint8_t* input, size_t len)
+    {
+        uint64_t acc = len * kPrime64_1;
+        if (len > 32)
+        {
+            if (len > 64)
+            {
+                if (len > 96)
+                {
+                    acc += Mix16(input + 48, kSecret + 96);
+                    acc += Mix16(input + len - 64, kSecret + 112);
+                }
+                acc += Mix16(input + 32, kSecret + 64);
+                acc += Mix16(input + len - 48, kSecret + 80);
+            }
+            acc += Mix16(input + 16, kSecret + 32);
+            acc += Mix16(input + len - 32, kSecret + 48);
+        }
+        acc += Mix16(input, kSecret);
+        acc += Mix16(input + len - 16, kSecret + 16);
+        return Avalanche(acc);
+    }
+
+    uint64_t Hash129To240(const uint8_t* input, size_t len)
+    {
+        uint64_t acc = len * kPrime64_1;
+        size_t rounds = len / 16;
+        for (size_t i = 0; i < 8; ++i)
+            acc += Mix16(input + 16 * i, kSecret + 16 * i);
+        uint64_t accEnd = Mix16(input + len - 16, kSecret + 136 - 17);
+        acc = Avalanche(acc);
+        for (size_t i = 8; i < rounds; ++i)
+            accEnd += Mix16(input + 16 * i, kSecret + 16 * (i - 8) + 3);
+        return Avalanche(acc + accEnd);
+    }
+
+#if LISTFONT_HASH_SSE2
+    inline void Accumulate512(__m128i* acc, const uint8_t* input, const uint8_t* secret)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input) + i);
+            __m128i key = _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret) + i);
+            __m128i dataKey = _mm_xor_si128(data, key);
+            __m128i dataKeyHi = _mm_shuffle_epi32(dataKey, _MM_SHUFFLE(0, 3, 0, 1));
+            __m128i product = _mm_mul_epu32(dataKey, dataKeyHi);
+            __m128i swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+            acc[i] = _mm_add_epi64(product, _mm_add_epi64(acc[i], swapped));
+        }
+    }
+
+    inline void ScrambleAcc(__m128i* acc, const uint8_t* secret)
+    {
+        const __m128i prime = _mm_set1_epi32((int)kPrime32_1);
+        for (int i = 0; i < 4; ++i)
+        {
+            __m128i value = _mm_xor_si128(acc[i], _mm_srli_epi64(acc[i], 47));
+            __m128i key = _mm_loadu_si128(reinterpret_cast<const __m128i*>(secret) + i);
+            __m128i dataKey = _mm_xor_si128(value, key);
+            __m128i dataKeyHi = _mm_shuffle_epi32(dataKey, _MM_SHUFFLE(0, 3, 0, 1));
+            __m128i productLo = _mm_mul_epu32(dataKey, prime);
+            __m128i productHi = _mm_mul_epu32(dataKeyHi, prime);
+            acc[i] = _mm_add_epi64(productLo, _mm_slli_epi64(productHi, 32));
+        }
+    }
+#else
+    inline void Accumulate512(uint64_t* acc, const uint8_t* input, const uint8_t* secret)
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            uint64_t data = Read64(input + 8 * i);
+            uint64_t dataKey = data ^ Read64(secret + 8 * i);
+            acc[i ^ 1] += data;
+            acc[i] += uint64_t(uint32_t(dataKey)) * (dataKey >> 32);
+        }
+    }
+
+    inline void ScrambleAcc(uint64_t* acc, const uint8_t* secret)
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            uint64_t value = acc[i];
+            value ^= value >> 47;
+            value ^= Read64(secret + 8 * i);
+            value *= kPrime32_1;
+            acc[i] = value;
+        }
+    }
+#endif
+
+    uint64_t HashLong(const uint8_t* input, size_t len)
+    {
+        alignas(16) uint64_t lanes[8] = { kPrime32_3, kPrime64_1, kPrime64_2, kPrime64_3,
+                                          kPrime64_4, kPrime32_2, kPrime64_5, kPrime32_1 };
+#if LISTFONT_HASH_SSE2
+        __m128i acc[4];
+        for (int i = 0; i < 4; ++i)
+            acc[i] = _mm_load_si128(reinterpret_cast<const __m128i*>(lanes) + i);
+#else
+        uint64_t* acc = lanes;
+#endif
+
+        size_t blocks = (len - 1) / kBlockLen;
+        for (size_t n = 0; n < blocks; ++n)
+        {
+            const uint8_t* block = input + n * kBlockLen;
+            for (size_t s = 0; s < kStripesPerBlock; ++s)
+                Accumulate512(acc, block + s * kStripeLen, kSecret + s * 8);
+            ScrambleAcc(acc, kSecret + kSecretSize - kStripeLen);
+        }
+
+        size_t stripes = ((len - 1) - kBlockLen * blocks) / kStripeLen;
+        const uint8_t* tail = input + blocks * kBlockLen;
+        for (size_t s = 0; s < stripes; ++s)
+            Accumulate512(acc, tail + s * kStripeLen, kSecret + s * 8);
+        Accumulate512(acc, input + len - kStripeLen, kSecret + kSecretSize - kStripeLen - 7);
+
+#if LISTFONT_HASH_SSE2
+        for (int i = 0; i < 4; ++i)
+            _mm_store_si128(reinterpret_cast<__m128i*>(lanes) + i, acc[i]);
+#endif
+
+        uint64_t result = len * kPrime64_1;
+        for (int i = 0; i < 4; ++i)
+        {
+            const uint8_t* secret = kSecret + 11 + 16 * i;
+            result += Mul128Fold64(lanes[2 * i] ^ Read64(secret), lanes[2 * i + 1] ^ Read64(secret + 8));
+        }
+        return Avalanche(result);
+    }
+}
+
+uint64_t Xxh3Hash64(const void* data, size_t size)
+{
+    const uint8_t* input = static_cast<const uint8_t*>(data);
+    if (size <= 16) return Hash0To16(input, size);
+    if (size <= 128) return Hash17To128(input, size);
+    if (size <= 240) return Hash129To240(input, size);
+    return HashLong(input, size);
+}
@@ -0,0 +1,10 @@
+// hash.h : XXH3-64 content hashing for font files and tables
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// XXH3 64-bit hash (seed 0), bit-compatible with the reference xxHash implementation
+uint64_t Xxh3Hash64(const void* data, size_t size);
@@ -0,0 +1,308 @@
+// jsonwriter.cpp : Catalog export as JSON for tools that consume listfont output
+//
+
+#include "jsonwriter.h"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include "trace.h"
+
+namespace
+{
+    void AppendUtf8String(std::string& out, const std::string& utf8)
+    {
+        out += '"';
+        for (char c : utf8)
+        {
+            if (c == '"' || c == '\\')
+            {
+                out += '\\';
+                out += c;
+            }
+            else if ((unsigned char)c < 0x20)
+            {
+                char escape[7];
+                snprintf(escape, sizeof(escape), "\\u%04x", (unsigned)c);
+                out += escape;
+            }
+            else
+            {
+                out += c;
+            }
+        }
+        out += '"';
+    }
+
+    void AppendString(std::string& out, const std::wstring& text)
+    {
+        AppendUtf8String(out, WideToUtf8(text));
+    }
+
+    void AppendString(std::string& out, const NameText& text)
+    {
+        std::string utf8;
+        text.AppendUtf8(utf8);
+        AppendUtf8String(out, utf8);
+    }
+
+    void AppendField(std::string& out, const char* name, long long value)
+    {
+        out += '"';
+        out += name;
+        out += "\": ";
+        out += std::to_string(value);
+    }
+
+    void AppendMetrics(std::string& out, const FontMetrics& m)
+    {
+        out += "{ ";
+        bool first = true;
+        auto separator = [&]() { if (!first) out += ", "; first = false; };
+        if (m.flags & METRICS_HEAD)
+        {
+            separator();
+            AppendField(out, "unitsPerEm", m.unitsPerEm);
+            char revision[32];
+            snprintf(revision, sizeof(revision), ", \"fontRevision\": %.3f", m.fontRevision / 65536.0);
+            out += revision;
+            out += ", \"bbox\": [" + std::to_string(m.xMin) + ", " + std::to_string(m.yMin) + ", " +
+                   std::to_string(m.xMax) + ", " + std::to_string(m.yMax) + "]";
+        }
+        if (m.flags & METRICS_HHEA)
+        {
+            separator();
+            out += "\"hhea\": { ";
+            AppendField(out, "ascender", m.ascender);
+            out += ", ";
+            AppendField(out, "descender", m.descender);
+            out += ", ";
+            AppendField(out, "lineGap", m.lineGap);
+            out += " }";
+        }
+        if (m.flags & METRICS_OS2)
+        {
+            separator();
+            out += "\"typo\": { ";
+            AppendField(out, "ascender", m.typoAscender);
+            out += ", ";
+            AppendField(out, "descender", m.typoDescender);
+            out += ", ";
+            AppendField(out, "lineGap", m.typoLineGap);
+            out += (m.flags & METRICS_USE_TYPO) ? ", \"useTypoMetrics\": true }" : ", \"useTypoMetrics\": false }";
+            out += ", \"win\": { ";
+            AppendField(out, "ascent", m.winAscent);
+            out += ", ";
+            AppendField(out, "descent", m.winDescent);
+            out += " }";
+        }
+        if (m.flags & METRICS_VHEA)
+        {
+            separator();
+            out += "\"vhea\": { ";
+            AppendField(out, "ascender", m.vertAscender);
+            out += ", ";
+            AppendField(out, "descender", m.vertDescender);
+            out += ", ";
+            AppendField(out, "lineGap", m.vertLineGap);
+            out += " }";
+        }
+        out += first ? "}" : " }";
+    }
+
+    void AppendTag(std::string& out, uint32_t tag)
+    {
+        out += '"';
+        for (int shift = 24; shift >= 0; shift -= 8)
+        {
+            char c = (char)((tag >> shift) & 0xFF);
+            if (c == '"' || c == '\\') out += '\\';
+            out += (c >= 0x20 && c < 0x7F) ? c : '?';
+        }
+        out += '"';
+    }
+
+    void AppendTagList(std::string& out, const std::vector<uint32_t>& tags)
+    {
+        out += '[';
+        for (size_t i = 0; i < tags.size(); ++i)
+        {
+            if (i) out += ", ";
+            AppendTag(out, tags[i]);
+        }
+        out += ']';
+    }
+
+    void AppendLayout(std::string& out, const LayoutInfo& layout)
+    {
+        out += "{ \"scripts\": {";
+        for (size_t i = 0; i < layout.scripts.size(); ++i)
+        {
+            const ScriptFeatures& script = layout.scripts[i];
+            out += i ? ", " : " ";
+            AppendTag(out, script.script);
+            out += ": { \"languages\": ";
+            AppendTagList(out, script.languages);
+            out += ", \"features\": ";
+            AppendTagList(out, script.features);
+            out += " }";
+        }
+        out += layout.scripts.empty() ? "}" : " }";
+        out += layout.hasMorx ? ", \"morx\": true }" : ", \"morx\": false }";
+    }
+
+    // Only the color technologies present are listed
+    void AppendColor(std::string& out, const ColorInfo& color)
+    {
+        out += "{";
+        bool first = true;
+        auto separator = [&]()
+        {
+            out += first ? " " : ", ";
+            first = false;
+        };
+        auto flag = [&](uint8_t bit, const char* name)
+        {
+            if (color.flags & bit)
+            {
+                separator();
+                out += '"';
+                out += name;
+                out += "\": true";
+            }
+        };
+        flag(COLOR_COLR_V0, "colrV0");
+        flag(COLOR_COLR_V1, "colrV1");
+        if (color.flags & COLOR_CPAL)
+        {
+            separator();
+            AppendField(out, "palettes", color.paletteCount);
+        }
+        if (color.flags & COLOR_SVG)
+        {
+            separator();
+            AppendField(out, "svgDocuments", color.svgDocumentCount);
+        }
+        flag(COLOR_SBIX, "sbix");
+        flag(COLOR_CBDT, "cbdt");
+        if (!color.strikeSizes.empty())
+        {
+            separator();
+            out += "\"strikeSizes\": [";
+            for (size_t i = 0; i < color.strikeSizes.size(); ++i)
+                out += (i ? ", " : "") + std::to_string(color.strikeSizes[i]);
+            out += "]";
+        }
+        out += first ? "}" : " }";
+    }
+
+    void AppendLicense(std::string& out, const FontLicense& license)
+    {
+        out += "{ \"embedding\": \"";
+        out += WideToUtf8(EmbeddingLevelName(license.embedding));
+        out += "\"";
+        if (license.embedding != EmbeddingLevel::Unknown)
+        {
+            out += ", ";
+            AppendField(out, "fsType", license.fsType);
+            out += (license.fsType & FSTYPE_NO_SUBSETTING) ? ", \"noSubsetting\": true" : ", \"noSubsetting\": false";
+            out += (license.fsType & FSTYPE_BITMAP_ONLY) ? ", \"bitmapOnly\": true" : ", \"bitmapOnly\": false";
+        }
+        if (license.vendorId != 0)
+        {
+            out += ", \"vendor\": ";
+            AppendTag(out, license.vendorId);
+        }
+        if (!license.description.empty())
+        {
+            out += ", \"description\": ";
+            AppendString(out, license.description);
+        }
+        if (!license.url.empty())
+        {
+            out += ", \"url\": ";
+            AppendString(out, license.url);
+        }
+        out += " }";
+    }
+
+    void AppendFont(std::string& out, const FontInfo& font)
+    {
+        out += "        {\n          \"name\": ";
+        AppendString(out, font.name);
+        out += ",\n          \"postScriptName\": ";
+        AppendString(out, font.postScriptName);
+        out += ",\n          ";
+        AppendField(out, "weight", font.weight);
+        out += ", ";
+        AppendField(out, "stretch", font.stretch);
+        out += ", ";
+        AppendField(out, "style", font.style);
+        if (!font.filePath.empty())
+        {
+            out += ",\n          \"file\": ";
+            AppendString(out, font.filePath);
+            out += ", ";
+            AppendField(out, "faceIndex", font.faceIndex);
+        }
+        if (font.contentHash != 0)
+        {
+            char hashes[80];
+            snprintf(hashes, sizeof(hashes), ",\n          \"contentHash\": \"%016llx\", \"tablesHash\": \"%016llx\"",
+                     (unsigned long long)font.contentHash, (unsigned long long)font.tablesHash);
+            out += hashes;
+        }
+        out += ",\n          \"metrics\": ";
+        AppendMetrics(out, font.metrics);
+        if (font.color.flags != 0)
+        {
+            out += ",\n          \"color\": ";
+            AppendColor(out, font.color);
+        }
+        out += ",\n          \"license\": ";
+        AppendLicense(out, font.license);
+        if (font.layout)
+        {
+            out += ",\n          \"layout\": ";
+            AppendLayout(out, *font.layout);
+        }
+        out += "\n        }";
+    }
+}
+
+bool WriteJsonCatalog(const std::wstring& path, const std::vector<FontFamily>& fontFamilies)
+{
+    TraceScope trace("WriteJsonCatalog");
+    std::string out = "{\n  \"families\": [";
+    for (size_t i = 0; i < fontFamilies.size(); ++i)
+    {
+        const FontFamily& family = fontFamilies[i];
+        out += i == 0 ? "\n    {\n      \"name\": " : ",\n    {\n      \"name\": ";
+        AppendString(out, family.primaryName);
+        out += ",\n      \"postScriptFamilyName\": ";
+        AppendString(out, family.postScriptFamilyName);
+        out += ",\n      \"aliases\": [";
+        bool first = true;
+        for (const auto& name : family.allNames)
+        {
+            if (name == family.primaryName)
+                continue;
+            if (!first) out += ", ";
+            AppendString(out, name);
+            first = false;
+        }
+        out += "],\n      \"fonts\": [";
+        for (size_t j = 0; j < family.fonts.size(); ++j)
+        {
+            out += j == 0 ? "\n" : ",\n";
+            AppendFont(out, family.fonts[j]);
+        }
+        out += family.fonts.empty() ? "]\n    }" : "\n      ]\n    }";
+    }
+    out += fontFamilies.empty() ? "]\n}\n" : "\n  ]\n}\n";
+
+    std::ofstream file(std::filesystem::path(path), std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!file.is_open())
+        return false;
+    file << out;
+    return file.good();
+}
@@ -0,0 +1,11 @@
+// jsonwriter.h : Catalog export as JSON for tools that consume listfont output
+//
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "catalog.h"
+
+// Write families, fonts, their metrics and (if loaded) layout tags to path as UTF-8 JSON; false if the file cannot be written
+bool WriteJsonCatalog(const std::wstring& path, const std::vector<FontFamily>& fontFamilies);
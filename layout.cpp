@@ -0,0 +1,162 @@
+// layout.cpp : OpenType layout (GSUB/GPOS) script, language and feature enumeration
+//
+
+#include "layout.h"
+#include <algorithm>
+#include "textformat.h"
+
+namespace
+{
+    void InsertSorted(std::vector<uint32_t>& tags, uint32_t tag)
+    {
+        auto it = std::lower_bound(tags.begin(), tags.end(), tag);
+        if (it == tags.end() || *it != tag)
+            tags.insert(it, tag);
+    }
+
+    ScriptFeatures& GetScript(LayoutInfo& layout, uint32_t script)
+    {
+        auto it = std::lower_bound(layout.scripts.begin(), layout.scripts.end(), script,
+                                   [](const ScriptFeatures& entry, uint32_t tag) { return entry.script < tag; });
+        if (it == layout.scripts.end() || it->script != script)
+        {
+            ScriptFeatures entry;
+            entry.script = script;
+            it = layout.scripts.insert(it, entry);
+        }
+        return *it;
+    }
+
+    // Add the features a LangSys table references
+    void AddLangSys(ByteSpan langSys, ByteSpan featureRecords, ScriptFeatures& entry)
+    {
+        if (!langSys.Has(0, 6)) return;
+        uint16_t required = langSys.U16(2);
+        uint16_t count = langSys.U16(4);
+        ByteSpan indices = langSys.Array(6, count, 2);
+        size_t featureCount = featureRecords.size / 6;
+        if (required != 0xFFFF && required < featureCount)
+            InsertSorted(entry.features, featureRecords.U32(size_t(required) * 6));
+        for (uint16_t i = 0; i < count && !indices.Empty(); ++i)
+        {
+            uint16_t index = indices.U16(size_t(i) * 2);
+            if (index < featureCount)
+                InsertSorted(entry.features, featureRecords.U32(size_t(index) * 6));
+        }
+    }
+
+    // Merge the ScriptList of a GSUB or GPOS table
+    void AddLayoutTable(ByteSpan table, LayoutInfo& layout)
+    {
+        if (!table.Has(0, 10)) return;
+        ByteSpan scriptList = table.From(table.U16(4));
+        ByteSpan featureList = table.From(table.U16(6));
+        if (!scriptList.Has(0, 2) || !featureList.Has(0, 2)) return;
+
+        ByteSpan featureRecords = featureList.Array(2, featureList.U16(0), 6);
+        uint16_t scriptCount = scriptList.U16(0);
+        ByteSpan scriptRecords = scriptList.Array(2, scriptCount, 6);
+        for (uint16_t i = 0; i < scriptCount && !scriptRecords.Empty(); ++i)
+        {
+            size_t record = size_t(i) * 6;
+            ScriptFeatures& entry = GetScript(layout, scriptRecords.U32(record));
+            ByteSpan script = scriptList.From(scriptRecords.U16(record + 4));
+            if (!script.Has(0, 4)) continue;
+
+            uint16_t defaultLangSys = script.U16(0);
+            if (defaultLangSys != 0)
+                AddLangSys(script.From(defaultLangSys), featureRecords, entry);
+
+            uint16_t langSysCount = script.U16(2);
+            ByteSpan langSysRecords = script.Array(4, langSysCount, 6);
+            for (uint16_t j = 0; j < langSysCount && !langSysRecords.Empty(); ++j)
+            {
+                size_t langRecord = size_t(j) * 6;
+                InsertSorted(entry.languages, langSysRecords.U32(langRecord));
+                AddLangSys(script.From(langSysRecords.U16(langRecord + 4)), featureRecords, entry);
+            }
+        }
+    }
+}
+
+const ScriptFeatures* LayoutInfo::FindScript(uint32_t script) const
+{
+    auto it = std::lower_bound(scripts.begin(), scripts.end(), script,
+                               [](const ScriptFeatures& entry, uint32_t tag) { return entry.script < tag; });
+    return it != scripts.end() && it->script == script ? &*it : nullptr;
+}
+
+bool LayoutInfo::HasFeature(uint32_t feature, uint32_t script) const
+{
+    for (const auto& entry : scripts)
+    {
+        if (script != 0 && entry.script != script)
+            continue;
+        if (std::binary_search(entry.features.begin(), entry.features.end(), feature))
+            return true;
+    }
+    return false;
+}
+
+LayoutInfo ReadLayoutInfo(FontContainer& container)
+{
+    // morx is only checked for presence; its chains are not OpenType features
+    return ReadLayoutInfo(container.LoadTable(MakeTag('G', 'S', 'U', 'B')), container.LoadTable(MakeTag('G', 'P', 'O', 'S')),
+                          container.FindTable(MakeTag('m', 'o', 'r', 'x')) != nullptr);
+}
+
+LayoutInfo ReadLayoutInfo(ByteSpan gsub, ByteSpan gpos, bool hasMorx)
+{
+    LayoutInfo layout;
+    AddLayoutTable(gsub, layout);
+    AddLayoutTable(gpos, layout);
+    layout.hasMorx = hasMorx;
+    return layout;
+}
+
+bool ParseTag(const std::wstring& text, uint32_t& tag)
+{
+    if (text.empty() || text.size() > 4) return false;
+    tag = 0;
+    for (size_t i = 0; i < 4; ++i)
+    {
+        wchar_t c = i < text.size() ? text[i] : L' ';
+        if (c < 0x20 || c > 0x7E) return false;
+        tag = (tag << 8) | uint32_t(c);
+    }
+    return true;
+}
+
+// " latn[kern liga] arab(URD )[init medi fina] morx"
+void AppendLayout(std::wstring& out, const LayoutInfo& layout)
+{
+    size_t start = out.size();
+    for (const auto& script : layout.scripts)
+    {
+        out += L' ';
+        AppendText(out, TagText{ script.script });
+        if (!script.languages.empty())
+        {
+            out += L'(';
+            for (size_t i = 0; i < script.languages.size(); ++i)
+            {
+                if (i)
+                    out += L',';
+                AppendText(out, TagText{ script.languages[i] });
+            }
+            out += L')';
+        }
+        out += L'[';
+        for (size_t i = 0; i < script.features.size(); ++i)
+        {
+            if (i)
+                out += L' ';
+            AppendText(out, TagText{ script.features[i] });
+        }
+        out += L']';
+    }
+    if (layout.hasMorx)
+        out += L" morx";
+    if (out.size() == start)
+        out += L" none";
+}
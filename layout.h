@@ -0,0 +1,38 @@
+// layout.h : OpenType layout (GSUB/GPOS) script, language and feature enumeration
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "sfnt.h"
+
+struct ScriptFeatures
+{
+    uint32_t script = 0;
+    std::vector<uint32_t> languages;  // Language system tags besides the default, sorted
+    std::vector<uint32_t> features;   // Features of any of the script's language systems, sorted
+};
+
+// GSUB and GPOS merged into per-script tag sets
+struct LayoutInfo
+{
+    std::vector<ScriptFeatures> scripts;  // Sorted by script tag
+    bool hasMorx = false;                 // AAT shaping table present
+
+    const ScriptFeatures* FindScript(uint32_t script) const;
+
+    // script = 0 matches a feature registered under any script
+    bool HasFeature(uint32_t feature, uint32_t script = 0) const;
+};
+
+// Read GSUB, GPOS and morx presence of the selected face
+LayoutInfo ReadLayoutInfo(FontContainer& container);
+LayoutInfo ReadLayoutInfo(ByteSpan gsub, ByteSpan gpos, bool hasMorx);
+
+// Append the tags as " latn[kern liga] arab(URD )[init medi fina] morx", or " none"
+void AppendLayout(std::wstring& out, const LayoutInfo& layout);
+
+// "liga" or "lao" (padded with spaces) to a tag; false if longer than 4 characters or not printable ASCII
+bool ParseTag(const std::wstring& text, uint32_t& tag);
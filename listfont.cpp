@@ -1,23 +1,50 @@
 // listfont.cpp : Lists all font families and their fonts with raw weight data
 //
 
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cwchar>
 #include <fstream>
+#include <map>
 #include <vector>
 #include <string>
 #include <set>
 #include <Windows.h>
 #include <dwrite.h>
+#include "arrowwriter.h"
+#include "catalog.h"
+#include "catalogdiff.h"
+#include "catalogfile.h"
+#include "cmap.h"
+#include "dirwalk.h"
+#include "fontfile.h"
+#include "glyphnames.h"
+#include "jsonwriter.h"
+#include "memreport.h"
+#include "outputtemplate.h"
+#include "query.h"
+#include "scriptindex.h"
+#include "textformat.h"
+#include "trace.h"
+#include "unicodescript.h"
 
 #pragma comment(lib, "dwrite.lib")
 
-// Simple UTF-16 to UTF-8 conversion
-std::string WideToUtf8(const std::wstring& wide)
+// Command-line text as code points, combining surrogate pairs
+std::u32string WideToCodePoints(const std::wstring& wide)
 {
-    if (wide.empty()) return "";
-    int size = WideCharToMultiByte(CP_UTF8, 0, wide.c_str(), -1, nullptr, 0, nullptr, nullptr);
-    if (size <= 0) return "";
-    std::string result(size - 1, '\0');
-    WideCharToMultiByte(CP_UTF8, 0, wide.c_str(), -1, &result[0], size, nullptr, nullptr);
+    std::u32string result;
+    for (size_t i = 0; i < wide.size(); ++i)
+    {
+        char32_t c = (char32_t)wide[i];
+        if (c >= 0xD800 && c < 0xDC00 && i + 1 < wide.size() && wide[i + 1] >= 0xDC00 && wide[i + 1] < 0xE000)
+        {
+            c = 0x10000 + ((c - 0xD800) << 10) + (char32_t(wide[i + 1]) - 0xDC00);
+            ++i;
+        }
+        result.push_back(c);
+    }
     return result;
 }
 
@@ -32,6 +59,26 @@ void ConsoleOutput(const std::wstring& text)
     }
 }
 
+// Write the same text to the console and the log file
+void WriteOutput(std::ofstream& logFile, const std::wstring& text)
+{
+    ConsoleOutput(text);
+    logFile << WideToUtf8(text);
+}
+
+// Reports format their lines into one buffer (see textformat.h) and write it in blocks
+const size_t kOutputBlock = 64 * 1024;
+
+// Write text once it has grown to a block, or whatever there is with force; the buffer keeps
+// its capacity for the next lines
+void FlushOutput(std::ofstream& logFile, std::wstring& text, bool force = false)
+{
+    if (text.empty() || (!force && text.size() < kOutputBlock))
+        return;
+    WriteOutput(logFile, text);
+    text.clear();
+}
+
 // Get all localized strings from IDWriteLocalizedStrings
 std::vector<std::wstring> GetAllLocalizedStrings(IDWriteLocalizedStrings* strings)
 {
@@ -39,6 +86,7 @@ std::vector<std::wstring> GetAllLocalizedStrings(IDWriteLocalizedStrings* string
     if (!strings) return result;
     
     UINT32 count = strings->GetCount();
+    result.reserve(count);
     for (UINT32 i = 0; i < count; ++i)
     {
         UINT32 length = 0;
@@ -47,7 +95,7 @@ std::vector<std::wstring> GetAllLocalizedStrings(IDWriteLocalizedStrings* string
             std::wstring text(length, L'\0');
             if (SUCCEEDED(strings->GetString(i, &text[0], length + 1)))
             {
-                result.push_back(text);
+                result.push_back(std::move(text));
             }
         }
     }
@@ -57,6 +105,7 @@ std::vector<std::wstring> GetAllLocalizedStrings(IDWriteLocalizedStrings* string
 // Get the primary name (first available, preferring English)
 std::wstring GetPrimaryName(IDWriteLocalizedStrings* strings)
 {
+    TraceScope trace("GetPrimaryName");
     if (!strings) return L"";
     
     // Try to get English name first
@@ -88,74 +137,141 @@ std::wstring GetPrimaryName(IDWriteLocalizedStrings* strings)
     return L"";
 }
 
-struct FontInfo
+// Resolve the local file backing a font face (empty for fonts from non-local loaders)
+std::wstring GetFontFilePath(IDWriteFontFace* face, UINT32& faceIndex)
 {
-    std::wstring name;
-    std::wstring postScriptName;  // Add PostScript name
-    DWRITE_FONT_WEIGHT weight;
-    DWRITE_FONT_STRETCH stretch;
-    DWRITE_FONT_STYLE style;
-};
+    std::wstring path;
+    faceIndex = face->GetIndex();
+    UINT32 fileCount = 1;
+    IDWriteFontFile* file = nullptr;
+    if (SUCCEEDED(face->GetFiles(&fileCount, &file)) && file)
+    {
+        const void* key = nullptr;
+        UINT32 keySize = 0;
+        IDWriteFontFileLoader* loader = nullptr;
+        if (SUCCEEDED(file->GetReferenceKey(&key, &keySize)) && SUCCEEDED(file->GetLoader(&loader)) && loader)
+        {
+            IDWriteLocalFontFileLoader* localLoader = nullptr;
+            if (SUCCEEDED(loader->QueryInterface(__uuidof(IDWriteLocalFontFileLoader), reinterpret_cast<void**>(&localLoader))) && localLoader)
+            {
+                UINT32 length = 0;
+                if (SUCCEEDED(localLoader->GetFilePathLengthFromKey(key, keySize, &length)))
+                {
+                    path.resize(length);
+                    if (FAILED(localLoader->GetFilePathFromKey(key, keySize, &path[0], length + 1)))
+                        path.clear();
+                }
+                localLoader->Release();
+            }
+            loader->Release();
+        }
+        file->Release();
+    }
+    return path;
+}
 
-struct FontFamily
+// A table of a DirectWrite font face, held until it goes out of scope
+struct FaceTable
 {
-    std::wstring primaryName;
-    std::wstring postScriptFamilyName;  // Add PostScript family name
-    std::set<std::wstring> allNames;
-    std::vector<FontInfo> fonts;
+    IDWriteFontFace* face = nullptr;
+    void* context = nullptr;
+    ByteSpan span;
+
+    FaceTable(IDWriteFontFace* fontFace, uint32_t tag) : face(fontFace)
+    {
+        // DirectWrite tags are little-endian
+        UINT32 dwriteTag = (tag >> 24) | ((tag >> 8) & 0xFF00) | ((tag << 8) & 0xFF0000) | (tag << 24);
+        const void* data = nullptr;
+        UINT32 size = 0;
+        BOOL exists = FALSE;
+        if (SUCCEEDED(face->TryGetFontTable(dwriteTag, &data, &size, &context, &exists)) && exists)
+            span = ByteSpan(static_cast<const uint8_t*>(data), size);
+    }
+    FaceTable(const FaceTable&) = delete;
+    FaceTable& operator=(const FaceTable&) = delete;
+    ~FaceTable()
+    {
+        if (context) face->ReleaseFontTable(context);
+    }
 };
 
-int main()
+// GSUB/GPOS tags and cmap scripts of a face, for the script index
+void GetFontScripts(IDWriteFontFace* face, FontInfo& fontInfo)
 {
-    // Setup console for UTF-8 and Unicode
-    SetConsoleOutputCP(CP_UTF8);
-    SetConsoleCP(CP_UTF8);
-    
-    // Enable Unicode console output
-    HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
-    DWORD dwMode = 0;
-    GetConsoleMode(hOut, &dwMode);
-    dwMode |= ENABLE_PROCESSED_OUTPUT | ENABLE_VIRTUAL_TERMINAL_PROCESSING;
-    SetConsoleMode(hOut, dwMode);
-    
-    // Open log file
-    std::ofstream logFile("font.log", std::ios::out | std::ios::trunc | std::ios::binary);
-    if (!logFile.is_open())
+    FaceTable gsub(face, MakeTag('G', 'S', 'U', 'B'));
+    FaceTable gpos(face, MakeTag('G', 'P', 'O', 'S'));
+    FaceTable morx(face, MakeTag('m', 'o', 'r', 'x'));
+    FaceTable cmap(face, MakeTag('c', 'm', 'a', 'p'));
+    fontInfo.layout = std::make_shared<LayoutInfo>(ReadLayoutInfo(gsub.span, gpos.span, (bool)morx.span));
+    fontInfo.unicodeScripts = SupportedUnicodeScripts(ReadCmapRanges(cmap.span));
+}
+
+FontMetrics GetFontMetrics(IDWriteFontFace* face)
+{
+    FaceTable head(face, MakeTag('h', 'e', 'a', 'd'));
+    FaceTable hhea(face, MakeTag('h', 'h', 'e', 'a'));
+    FaceTable os2(face, MakeTag('O', 'S', '/', '2'));
+    FaceTable vhea(face, MakeTag('v', 'h', 'e', 'a'));
+    return ReadFontMetrics(head.span, hhea.span, os2.span, vhea.span);
+}
+
+// DirectWrite maps tables in place, so only the header pages are touched
+ColorInfo GetFontColor(IDWriteFontFace* face)
+{
+    FaceTable colr(face, MakeTag('C', 'O', 'L', 'R'));
+    FaceTable cpal(face, MakeTag('C', 'P', 'A', 'L'));
+    FaceTable svg(face, MakeTag('S', 'V', 'G', ' '));
+    FaceTable sbix(face, MakeTag('s', 'b', 'i', 'x'));
+    FaceTable cblc(face, MakeTag('C', 'B', 'L', 'C'));
+    FaceTable cbdt(face, MakeTag('C', 'B', 'D', 'T'));
+    return ReadColorInfo(colr.span, cpal.span, svg.span, sbix.span, cblc.span, (bool)cbdt.span);
+}
+
+std::wstring GetInformationalString(IDWriteFont* font, DWRITE_INFORMATIONAL_STRING_ID id)
+{
+    std::wstring text;
+    BOOL exists = FALSE;
+    IDWriteLocalizedStrings* strings = nullptr;
+    if (SUCCEEDED(font->GetInformationalStrings(id, &strings, &exists)) && exists && strings)
     {
-        ConsoleOutput(L"Error: Could not create font.log file!\n");
-        return 1;
+        text = GetPrimaryName(strings);
+        strings->Release();
     }
-    logFile << "\xEF\xBB\xBF"; // UTF-8 BOM
-    
-    ConsoleOutput(L"Font Family Enumerator\n");
-    ConsoleOutput(L"======================\n");
-    
-    // Initialize DirectWrite
-    IDWriteFactory* factory = nullptr;
-    HRESULT hr = DWriteCreateFactory(DWRITE_FACTORY_TYPE_SHARED, __uuidof(IDWriteFactory), 
-                                   reinterpret_cast<IUnknown**>(&factory));
-    if (FAILED(hr) || !factory)
+    return text;
+}
+
+// OS/2 embedding permission and vendor; the license strings only when asked for
+FontLicense GetFontLicense(IDWriteFont* font, IDWriteFontFace* face, bool readStrings)
+{
+    FaceTable os2(face, MakeTag('O', 'S', '/', '2'));
+    FontLicense license = ReadFontLicense(os2.span);
+    if (readStrings)
     {
-        ConsoleOutput(L"Error: Failed to create DirectWrite factory.\n");
-        return 1;
+        license.description = GetInformationalString(font, DWRITE_INFORMATIONAL_STRING_LICENSE_DESCRIPTION);
+        license.url = GetInformationalString(font, DWRITE_INFORMATIONAL_STRING_LICENSE_INFO_URL);
     }
-    
+    return license;
+}
+
+// Enumerate the system font collection through DirectWrite
+bool EnumerateSystemFonts(IDWriteFactory* factory, const ScanOptions& options, std::vector<FontFamily>& fontFamilies,
+                          std::vector<ScanTiming>* timings = nullptr)
+{
+    TraceScope trace("EnumerateSystemFonts");
     // Get system font collection
     IDWriteFontCollection* collection = nullptr;
-    hr = factory->GetSystemFontCollection(&collection);
+    HRESULT hr = factory->GetSystemFontCollection(&collection);
     if (FAILED(hr) || !collection)
     {
-        ConsoleOutput(L"Error: Failed to get system font collection.\n");
-        factory->Release();
-        return 1;
+        return false;
     }
     
-    std::vector<FontFamily> fontFamilies;
     UINT32 familyCount = collection->GetFontFamilyCount();
     
     // Process each font family
     for (UINT32 i = 0; i < familyCount; ++i)
     {
+        TraceScope familyTrace("EnumerateFamily");
         IDWriteFontFamily* family = nullptr;
         if (FAILED(collection->GetFontFamily(i, &family)) || !family)
             continue;
@@ -168,9 +284,9 @@ int main()
         {
             fontFamily.primaryName = GetPrimaryName(familyNames);
             auto allNames = GetAllLocalizedStrings(familyNames);
-            for (const auto& name : allNames)
+            for (auto& name : allNames)
             {
-                fontFamily.allNames.insert(name);
+                fontFamily.allNames.insert(std::move(name));
             }
             familyNames->Release();
         }
@@ -179,21 +295,13 @@ int main()
         IDWriteFont* repFont = nullptr;
         if (SUCCEEDED(family->GetFirstMatchingFont(DWRITE_FONT_WEIGHT_NORMAL, DWRITE_FONT_STRETCH_NORMAL, DWRITE_FONT_STYLE_NORMAL, &repFont)) && repFont)
         {
+            TraceScope psTrace("PostScriptName");
             BOOL exists = FALSE;
             IDWriteLocalizedStrings* psNames = nullptr;
             if (SUCCEEDED(repFont->GetInformationalStrings(DWRITE_INFORMATIONAL_STRING_POSTSCRIPT_NAME, &psNames, &exists)) && exists && psNames)
             {
-                std::wstring psName = GetPrimaryName(psNames);
                 // Extract family part (before the hyphen)
-                size_t pos = psName.find(L'-');
-                if (pos != std::wstring::npos)
-                {
-                    fontFamily.postScriptFamilyName = psName.substr(0, pos);
-                }
-                else
-                {
-                    fontFamily.postScriptFamilyName = psName;
-                }
+                fontFamily.postScriptFamilyName = PostScriptFamilyPart(GetPrimaryName(psNames));
                 psNames->Release();
             }
             repFont->Release();
@@ -206,6 +314,7 @@ int main()
             IDWriteFont* font = nullptr;
             if (FAILED(family->GetFont(j, &font)) || !font)
                 continue;
+            auto fontStart = std::chrono::steady_clock::now();
                 
             FontInfo fontInfo;
             fontInfo.weight = font->GetWeight();
@@ -223,16 +332,19 @@ int main()
             }
             
             // Get PostScript name
-            IDWriteLocalizedStrings* psNames = nullptr;
-            if (SUCCEEDED(font->GetInformationalStrings(DWRITE_INFORMATIONAL_STRING_POSTSCRIPT_NAME, &psNames, &exists)) 
-                && exists && psNames)
             {
-                fontInfo.postScriptName = GetPrimaryName(psNames);
-                psNames->Release();
+                TraceScope psTrace("PostScriptName");
+                IDWriteLocalizedStrings* psNames = nullptr;
+                if (SUCCEEDED(font->GetInformationalStrings(DWRITE_INFORMATIONAL_STRING_POSTSCRIPT_NAME, &psNames, &exists)) 
+                    && exists && psNames)
+                {
+                    fontInfo.postScriptName = GetPrimaryName(psNames);
+                    psNames->Release();
+                }
             }
             
             // Fallback: use subfamily name
-            if (fontInfo.name.empty())
+            if (fontInfo.name.Empty())
             {
                 IDWriteLocalizedStrings* subfamilyNames = nullptr;
                 if (SUCCEEDED(font->GetInformationalStrings(DWRITE_INFORMATIONAL_STRING_WIN32_SUBFAMILY_NAMES, &subfamilyNames, &exists)) 
@@ -248,8 +360,37 @@ int main()
                 }
             }
             
-            fontFamily.fonts.push_back(fontInfo);
+            // The font face is only needed for work that reads the font bytes
+            IDWriteFontFace* face = nullptr;
+            bool needPath = options.computeHashes || options.resolvePaths;
+            if ((needPath || options.readMetrics || options.readLicense || options.readScripts) && SUCCEEDED(font->CreateFontFace(&face)) && face)
+            {
+                TraceScope faceTrace("ReadFontFace");
+                if (needPath)
+                    fontInfo.filePath = GetFontFilePath(face, fontInfo.faceIndex);
+                if (options.readMetrics)
+                {
+                    fontInfo.metrics = GetFontMetrics(face);
+                    fontInfo.color = GetFontColor(face);
+                }
+                if (options.readMetrics || options.readLicense)
+                    fontInfo.license = GetFontLicense(font, face, options.readLicense);
+                if (options.readScripts)
+                    GetFontScripts(face, fontInfo);
+                face->Release();
+            }
+            
             font->Release();
+            if (timings)
+            {
+                ScanTiming timing;
+                timing.path = fontInfo.filePath;
+                timing.name = fontInfo.name.Text();
+                timing.faces = 1;
+                timing.nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - fontStart).count();
+                timings->push_back(std::move(timing));
+            }
+            fontFamily.fonts.push_back(fontInfo);
         }
         
         if (!fontFamily.primaryName.empty())
@@ -260,89 +401,1052 @@ int main()
         family->Release();
     }
     
-    // Output results
-    ConsoleOutput(L"Found " + std::to_wstring(fontFamilies.size()) + L" font families\n\n");
-    logFile << "Found " << fontFamilies.size() << " font families\n\n";
-    
+    collection->Release();
+    return true;
+}
+
+constexpr TextFormat kDuplicatesLine(L"DUPLICATES: {} identical, {} near-identical\n");
+constexpr TextFormat kIdenticalLine(L"  Identical ({:x16}, {} files):\n");
+constexpr TextFormat kNearIdenticalLine(L"  Near-identical, head differs ({:x16}, {} files):\n");
+constexpr TextFormat kPathLine(L"    {}\n");
+constexpr TextFormat kFaceIndex(L"#{}");
+
+// Report files with identical bytes, then faces whose tables only differ in head timestamps
+void ReportDuplicates(const std::vector<FontFamily>& fontFamilies, std::ofstream& logFile)
+{
+    TraceScope trace("ReportDuplicates");
+    std::map<uint64_t, std::set<std::wstring>> identical;
+    std::map<uint64_t, std::map<uint64_t, std::wstring>> nearIdentical;  // tablesHash -> contentHash -> face
     for (const auto& family : fontFamilies)
     {
-        // Output family name and aliases
-        std::wstring familyLine = L"FAMILY: " + family.primaryName;
-        if (!family.postScriptFamilyName.empty() && family.postScriptFamilyName != family.primaryName)
+        for (const auto& font : family.fonts)
         {
-            familyLine += L" [" + family.postScriptFamilyName + L"]";
+            if (font.contentHash == 0)
+                continue;
+            identical[font.contentHash].insert(font.filePath);
+            
+            std::wstring face = font.filePath;
+            if (font.faceIndex > 0)
+                FormatTo<kFaceIndex>(face, font.faceIndex);
+            nearIdentical[font.tablesHash].emplace(font.contentHash, face);
+        }
+    }
+    
+    size_t identicalGroups = 0, nearGroups = 0;
+    for (const auto& group : identical)
+        if (group.second.size() > 1) ++identicalGroups;
+    for (const auto& group : nearIdentical)
+        if (group.second.size() > 1) ++nearGroups;
+    
+    std::wstring text;
+    FormatTo<kDuplicatesLine>(text, identicalGroups, nearGroups);
+    for (const auto& group : identical)
+    {
+        if (group.second.size() < 2)
+            continue;
+        FormatTo<kIdenticalLine>(text, group.first, group.second.size());
+        for (const auto& path : group.second)
+            FormatTo<kPathLine>(text, path);
+        FlushOutput(logFile, text);
+    }
+    for (const auto& group : nearIdentical)
+    {
+        if (group.second.size() < 2)
+            continue;
+        FormatTo<kNearIdenticalLine>(text, group.first, group.second.size());
+        for (const auto& face : group.second)
+            FormatTo<kPathLine>(text, face.second);
+        FlushOutput(logFile, text);
+    }
+    text += L"\n";
+    FlushOutput(logFile, text, true);
+}
+
+constexpr TextFormat kMilliseconds(L"{:.2} ms");
+constexpr TextFormat kMicroseconds(L"{:.1} us");
+constexpr TextFormat kMegabytes(L"{:.1} MB");
+constexpr TextFormat kKilobytes(L"{:.1} KB");
+constexpr TextFormat kBytes(L"{} B");
+
+// "1.25 ms" or "830.0 us", for FormatTo
+struct DurationText
+{
+    uint64_t nanoseconds;
+};
+
+void AppendText(std::wstring& out, DurationText duration)
+{
+    if (duration.nanoseconds >= 1000000)
+        FormatTo<kMilliseconds>(out, duration.nanoseconds / 1e6);
+    else
+        FormatTo<kMicroseconds>(out, duration.nanoseconds / 1e3);
+}
+
+// "1.5 MB", "12.0 KB" or "512 B", for FormatTo
+struct BytesText
+{
+    uint64_t bytes;
+};
+
+void AppendText(std::wstring& out, BytesText size)
+{
+    if (size.bytes >= 1024 * 1024)
+        FormatTo<kMegabytes>(out, size.bytes / 1048576.0);
+    else if (size.bytes >= 1024)
+        FormatTo<kKilobytes>(out, size.bytes / 1024.0);
+    else
+        FormatTo<kBytes>(out, size.bytes);
+}
+
+constexpr TextFormat kSlowestLine(L"SLOWEST: {} of {} scanned\n");
+constexpr TextFormat kSlowFontStart(L"  {:>10}  {}");
+constexpr TextFormat kSlowFaces(L" ({} and {} more faces)");
+constexpr TextFormat kSlowFace(L" ({})");
+constexpr TextFormat kSlowReads(L", {} read of {}, {} table loads");
+constexpr TextFormat kSlowShareLine(L"  These took {:.1}% of {}\n");
+constexpr TextFormat kHistogramLine(L"  {} |{}{} {}\n");
+
+// The count slowest files (or system fonts) with what they cost, then a histogram of all scan times
+void ReportSlowFonts(std::vector<ScanTiming> timings, size_t count, std::ofstream& logFile)
+{
+    uint64_t total = 0;
+    for (const auto& timing : timings)
+        total += timing.nanoseconds;
+    count = std::min(count, timings.size());
+    std::partial_sort(timings.begin(), timings.begin() + count, timings.end(),
+                      [](const ScanTiming& a, const ScanTiming& b) { return a.nanoseconds > b.nanoseconds; });
+
+    uint64_t slowest = 0;
+    std::wstring text;
+    FormatTo<kSlowestLine>(text, count, timings.size());
+    for (size_t i = 0; i < count; ++i)
+    {
+        const ScanTiming& timing = timings[i];
+        slowest += timing.nanoseconds;
+        FormatTo<kSlowFontStart>(text, DurationText{ timing.nanoseconds }, timing.path);
+        if (!timing.name.empty() && timing.faces > 1)
+            FormatTo<kSlowFaces>(text, timing.name, timing.faces - 1);
+        else if (!timing.name.empty())
+            FormatTo<kSlowFace>(text, timing.name);
+        else if (timing.faces == 0)
+            text += L" (unreadable)";
+        if (timing.fileSize > 0)
+            FormatTo<kSlowReads>(text, BytesText{ timing.bytesRead }, BytesText{ timing.fileSize }, timing.tablesRead);
+        text += L"\n";
+        FlushOutput(logFile, text);
+    }
+    if (total > 0)
+        FormatTo<kSlowShareLine>(text, 100.0 * slowest / total, DurationText{ total });
+
+    // Buckets grow by about 3x from 10 us
+    const uint64_t kLimits[] = { 10000, 30000, 100000, 300000, 1000000, 3000000, 10000000, 30000000, 100000000, UINT64_MAX };
+    const wchar_t* kLabels[] = { L"   < 10 us", L"  10-30 us", L" 30-100 us", L"100-300 us", L"  0.3-1 ms",
+                                 L"    1-3 ms", L"   3-10 ms", L"  10-30 ms", L" 30-100 ms", L" >= 100 ms" };
+    const size_t kBuckets = sizeof(kLimits) / sizeof(kLimits[0]);
+    size_t buckets[kBuckets] = {};
+    size_t largest = 0;
+    for (const auto& timing : timings)
+    {
+        size_t b = 0;
+        while (timing.nanoseconds >= kLimits[b])
+            ++b;
+        largest = std::max(largest, ++buckets[b]);
+    }
+    text += L"SCAN TIME HISTOGRAM:\n";
+    for (size_t b = 0; b < kBuckets; ++b)
+    {
+        size_t width = largest > 0 ? (buckets[b] * 40 + largest - 1) / largest : 0;
+        FormatTo<kHistogramLine>(text, kLabels[b], RepeatedText{ L'#', width }, RepeatedText{ L' ', 40 - width }, buckets[b]);
+    }
+    text += L"\n";
+    FlushOutput(logFile, text, true);
+}
+
+constexpr TextFormat kUnreadableLine(L"UNREADABLE: {}\n");
+constexpr TextFormat kCorruptLine(L"CORRUPT: {}\n");
+constexpr TextFormat kCorruptFaceLine(L"CORRUPT: {}#{}\n");
+constexpr TextFormat kProblemLine(L"  '{}' {}\n");
+constexpr TextFormat kChecksumProblemLine(L"  '{}' {} (stored 0x{:X8}, computed 0x{:X8})\n");
+constexpr TextFormat kVerifiedLine(L"Verified {} files ({} faces), {} with problems\n");
+
+// Print fonts with corrupt tables; returns the number of files with problems
+size_t ReportIntegrity(const std::vector<std::wstring>& files, const std::vector<FileCheck>& results, std::ofstream& logFile)
+{
+    size_t faces = 0, badFiles = 0;
+    std::wstring text;
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+        const FileCheck& check = results[i];
+        faces += check.faces.size();
+        if (!check.readable)
+        {
+            FormatTo<kUnreadableLine>(text, files[i]);
+            ++badFiles;
+            continue;
         }
-        familyLine += L"\n";
-        ConsoleOutput(familyLine);
         
-        std::string logFamilyLine = "FAMILY: " + WideToUtf8(family.primaryName);
-        if (!family.postScriptFamilyName.empty() && family.postScriptFamilyName != family.primaryName)
+        bool fileReported = false;
+        for (const auto& face : check.faces)
+        {
+            if (face.problems.empty())
+                continue;
+            if (!fileReported)
+            {
+                ++badFiles;
+                fileReported = true;
+            }
+            if (check.faces.size() > 1)
+                FormatTo<kCorruptFaceLine>(text, files[i], face.faceIndex);
+            else
+                FormatTo<kCorruptLine>(text, files[i]);
+            for (const auto& problem : face.problems)
+            {
+                if (problem.issue == TableIssue::ChecksumMismatch || problem.issue == TableIssue::HeadAdjustment)
+                    FormatTo<kChecksumProblemLine>(text, TagText{ problem.tag }, TableIssueName(problem.issue), problem.expected, problem.actual);
+                else
+                    FormatTo<kProblemLine>(text, TagText{ problem.tag }, TableIssueName(problem.issue));
+            }
+        }
+        FlushOutput(logFile, text);
+    }
+    FormatTo<kVerifiedLine>(text, files.size(), faces, badFiles);
+    FlushOutput(logFile, text, true);
+    return badFiles;
+}
+
+constexpr TextFormat kGlyphFontLine(L"FONT: {} ({} glyphs, {})\n");
+constexpr TextFormat kGlyphFaceLine(L"FONT: {}#{} ({} glyphs, {})\n");
+constexpr TextFormat kGlyphLine(L"  {} {}");
+constexpr TextFormat kCodePoint(L" U+{:X4}");
+constexpr TextFormat kGlyphSummaryLine(L"Read {} glyph names of {} faces: {} distinct, {} KB pooled\n");
+
+// Print the glyph names of every face with the code points the AGL rules give them.
+// One pool is shared by all fonts, so common names are stored once.
+void ReportGlyphNames(const std::vector<std::wstring>& files, std::ofstream& logFile)
+{
+    GlyphNamePool pool;
+    size_t faces = 0, glyphs = 0;
+    std::wstring text;
+    for (const auto& path : files)
+    {
+        MappedFile file;
+        FontContainer container;
+        if (!file.Open(path) || !container.Open(file.data, file.size))
+        {
+            FormatTo<kUnreadableLine>(text, path);
+            continue;
+        }
+        
+        uint32_t faceCount = container.FaceCount();
+        for (uint32_t face = 0; face < faceCount; ++face)
+        {
+            if (!container.SelectFace(face))
+                continue;
+            GlyphNameTable table = ReadGlyphNames(container, pool);
+            ++faces;
+            glyphs += table.names.size();
+            
+            // CJK fonts have tens of thousands of glyphs; written in blocks
+            if (faceCount > 1)
+                FormatTo<kGlyphFaceLine>(text, path, face, table.names.size(), GlyphNameSourceName(table.source));
+            else
+                FormatTo<kGlyphFontLine>(text, path, table.names.size(), GlyphNameSourceName(table.source));
+            for (size_t glyph = 0; glyph < table.names.size(); ++glyph)
+            {
+                std::string_view name = pool.Get(table.names[glyph]);
+                FormatTo<kGlyphLine>(text, glyph, name);
+                uint32_t codePoints[16];
+                size_t count = GlyphNameToUnicode(name, codePoints, 16);
+                for (size_t i = 0; i < count; ++i)
+                    FormatTo<kCodePoint>(text, codePoints[i]);
+                text += L'\n';
+                FlushOutput(logFile, text);
+            }
+        }
+    }
+    FormatTo<kGlyphSummaryLine>(text, glyphs, faces, pool.Count(), (pool.bytes + 1023) / 1024);
+    FlushOutput(logFile, text, true);
+}
+
+constexpr TextFormat kRevision(L"{:.3}");
+
+// head fontRevision (16.16) as "1.000", for FormatTo
+struct RevisionText
+{
+    uint32_t revision;
+};
+
+void AppendText(std::wstring& out, RevisionText text)
+{
+    FormatTo<kRevision>(out, text.revision / 65536.0);
+}
+
+constexpr TextFormat kCatalogFaceName(L"{} {}");
+constexpr TextFormat kCatalogFaceFamily(L" ({} {})");
+
+// "PostScriptName (Family Face) path#index", for FormatTo
+struct CatalogFaceText
+{
+    const CatalogFace& face;
+};
+
+void AppendText(std::wstring& out, CatalogFaceText text)
+{
+    const FontInfo& font = *text.face.font;
+    // The family and face name are only added in parentheses when the PostScript name leads
+    if (font.postScriptName.Empty())
+    {
+        FormatTo<kCatalogFaceName>(out, text.face.family->primaryName, font.name);
+    }
+    else
+    {
+        font.postScriptName.AppendTo(out);
+        FormatTo<kCatalogFaceFamily>(out, text.face.family->primaryName, font.name);
+    }
+    if (!font.filePath.empty())
+    {
+        out += L' ';
+        out += font.filePath;
+    }
+    if (font.faceIndex > 0)
+        FormatTo<kFaceIndex>(out, font.faceIndex);
+}
+
+constexpr TextFormat kDiffLine(L"DIFF: {} -> {}\n");
+constexpr TextFormat kAddedLine(L"  ADDED: {}\n");
+constexpr TextFormat kRemovedLine(L"  REMOVED: {}\n");
+constexpr TextFormat kChangedStart(L"  CHANGED: {}:");
+constexpr TextFormat kChangedField(L"{}{}");
+constexpr TextFormat kChangedValues(L" {} -> {}");
+constexpr TextFormat kChangedLocation(L" {}#{} -> {}#{}");
+constexpr TextFormat kComparedLine(L"Compared {} and {} faces: {} added, {} removed, {} changed, {} unchanged\n");
+
+// Print the faces added, removed and changed between two catalogs
+void ReportCatalogDiff(const std::wstring& beforePath, const std::wstring& afterPath, const std::vector<FontFamily>& before,
+                       const std::vector<FontFamily>& after, std::ofstream& logFile)
+{
+    CatalogDiff diff = DiffCatalogs(before, after);
+    size_t beforeFaces = diff.removed + diff.changed + diff.unchanged;
+    size_t afterFaces = diff.added + diff.changed + diff.unchanged;
+
+    // An OS image update can touch thousands of faces; written in blocks
+    std::wstring text;
+    FormatTo<kDiffLine>(text, beforePath, afterPath);
+    for (const auto& change : diff.changes)
+    {
+        if (change.kind == FaceChangeKind::Added)
+        {
+            FormatTo<kAddedLine>(text, CatalogFaceText{ change.after });
+            FlushOutput(logFile, text);
+            continue;
+        }
+        if (change.kind == FaceChangeKind::Removed)
+        {
+            FormatTo<kRemovedLine>(text, CatalogFaceText{ change.before });
+            FlushOutput(logFile, text);
+            continue;
+        }
+        const FontInfo& a = *change.before.font;
+        const FontInfo& b = *change.after.font;
+        FormatTo<kChangedStart>(text, CatalogFaceText{ change.after });
+        const wchar_t* separator = L" ";
+        for (uint32_t field = 1; field <= DIFF_LAYOUT; field <<= 1)
+        {
+            if (!(change.fields & field))
+                continue;
+            FormatTo<kChangedField>(text, separator, DiffFieldName(field));
+            if (field == DIFF_VERSION)
+                FormatTo<kChangedValues>(text, RevisionText{ a.metrics.fontRevision }, RevisionText{ b.metrics.fontRevision });
+            else if (field == DIFF_FAMILY)
+                FormatTo<kChangedValues>(text, change.before.family->primaryName, change.after.family->primaryName);
+            else if (field == DIFF_NAME)
+                FormatTo<kChangedValues>(text, a.name, b.name);
+            else if (field == DIFF_LOCATION)
+                FormatTo<kChangedLocation>(text, a.filePath, a.faceIndex, b.filePath, b.faceIndex);
+            separator = L", ";
+        }
+        text += L'\n';
+        FlushOutput(logFile, text);
+    }
+    FormatTo<kComparedLine>(text, beforeFaces, afterFaces, diff.added, diff.removed, diff.changed, diff.unchanged);
+    FlushOutput(logFile, text, true);
+}
+
+// The saved fonts whose files the search found through unchanged directories, for
+// --update-catalog to merge instead of reading those files again
+std::vector<FontFamily> SavedFontsOfUnchangedFiles(const std::vector<FontFamily>& saved, const FontFileSearch& search)
+{
+    std::set<std::wstring> unchanged;
+    for (size_t i = 0; i < search.files.size(); ++i)
+    {
+        if (search.unchanged[i])
+            unchanged.insert(search.files[i]);
+    }
+    std::vector<FontFamily> reuse;
+    for (const auto& family : saved)
+    {
+        FontFamily kept = family;
+        kept.fonts.clear();
+        for (const auto& font : family.fonts)
+        {
+            if (unchanged.count(font.filePath))
+                kept.fonts.push_back(font);
+        }
+        if (!kept.fonts.empty())
+            reuse.push_back(std::move(kept));
+    }
+    return reuse;
+}
+
+struct Options
+{
+    std::vector<std::wstring> inputPaths;
+    bool includeSystem = false;  // --system: list the system collection as well as inputPaths
+    bool duplicates = false;     // --duplicates: report duplicate font files
+    bool verify = false;         // --verify: check table checksums instead of listing
+    bool glyphNames = false;     // --glyph-names: list glyph names instead of fonts
+    std::wstring jsonPath;       // --json: also write the catalog as JSON
+    std::wstring arrowPath;      // --arrow: also write the catalog as Arrow IPC
+    std::wstring tracePath;      // --trace: time the scan phases and write a Chrome trace
+    size_t topSlow = 0;          // --top-slow: report the slowest files and a histogram of scan times
+    bool memReport = false;      // --mem-report: report heap use of the catalog structures at exit
+    std::vector<Condition> conditions;  // --where/--feature/--script: only list fonts matching all of these
+    bool showLayout = false;     // --layout: list scripts and features of each font
+    bool showLicense = false;    // --embeddable: list embedding permission and vendor of each font
+    std::wstring catalogPath;    // --catalog: list a saved catalog instead of scanning
+    std::wstring saveCatalogPath;  // --save-catalog: save the scanned catalog with its script index
+    bool updateCatalog = false;    // --update-catalog: rescan only what changed since the saved catalog
+    std::wstring diffBefore, diffAfter;  // --diff: compare two saved catalogs instead of listing
+    std::vector<std::pair<uint32_t, uint32_t>> supports;  // --supports: (script, language) queries on the index
+    std::wstring thumbnailPath;  // --thumbnails: render a sample-text image of each listed font into this directory
+    ThumbnailOptions thumbnail;  // --sample/--pixel-size/--thumbnail-format
+    OutputTemplate fontTemplate;  // --template: one line per font instead of the listing
+    OutputTemplate familyHeader;  // --family-header: a line before the fonts of each family
+    OutputTemplate familyFooter;  // --family-footer: a line after them
+    ScanOptions scan;
+};
+
+void PrintUsage()
+{
+    ConsoleOutput(L"Usage: listfont [options] [font files or directories...]\n"
+                  L"  --system       Include the system font collection when paths are given\n"
+                  L"  --duplicates   Report identical and near-identical font files\n"
+                  L"  --verify       Check table checksums of the given files (default: system font folders)\n"
+                  L"  --glyph-names  List the glyph names of the given files with their Unicode mapping\n"
+                  L"  --json FILE    Also write families, fonts and metrics to FILE as JSON\n"
+                  L"  --arrow FILE   Also write one row per font to FILE as an Arrow IPC file\n"
+                  L"                 (the Arrow stream format if FILE ends in .arrows)\n"
+                  L"  --where COND   Only list fonts matching COND, e.g. unitsPerEm=1000 or lineGap>0\n"
+                  L"                 Fields: " + QueryFieldList() + L"\n"
+                  L"  --feature TAG[:SCRIPT]  Only list fonts with an OpenType feature, e.g. tnum:latn\n"
+                  L"  --script TAG   Only list fonts with an OpenType script, e.g. arab\n"
+                  L"  --embeddable LEVEL  Only list fonts whose OS/2 fsType allows embedding for\n"
+                  L"                 installable, editable or preview use, with their permissions\n"
+                  L"  --template TEXT  List one line per font shaped by TEXT instead, e.g. \"{family};{name};{weight}\"\n"
+                  L"                 with \\n, \\t, {{ and }} as escapes and {fsType:X4} or {weight:3} for hex and padding\n"
+                  L"                 Fields: " + TemplateFieldList() + L"\n"
+                  L"  --family-header TEXT  A line before the fonts of each family, with family fields only\n"
+                  L"  --family-footer TEXT  A line after them\n"
+                  L"  --layout       List the OpenType scripts and features of each font\n"
+                  L"  --supports SCRIPT[:LANG]  Only list families supporting a script, given as a Unicode\n"
+                  L"                 script code (Deva) or OpenType tags (dev2:HIN), from the script index\n"
+                  L"  --thumbnails DIR  Render a sample-text thumbnail of each listed font into DIR\n"
+                  L"  --sample TEXT  Thumbnail text (default: The quick brown fox jumps over the lazy dog)\n"
+                  L"  --pixel-size N Thumbnail em size in pixels (default 32)\n"
+                  L"  --thumbnail-format png|pgm  Thumbnail image format (default png)\n"
+                  L"  --save-catalog FILE  Save the scanned catalog and its script index to FILE\n"
+                  L"  --update-catalog FILE  Like --save-catalog, but reuse the fonts in FILE from directories\n"
+                  L"                 that have not changed since it was saved\n"
+                  L"  --catalog FILE List the catalog saved in FILE instead of scanning\n"
+                  L"  --diff OLD NEW List the faces added, removed or changed between two saved catalogs\n"
+                  L"  --trace FILE   Time each phase, write a Chrome trace-event file and print a summary\n"
+                  L"  --top-slow N   List the N slowest font files with bytes and tables read, and a\n"
+                  L"                 histogram of scan times\n"
+                  L"  --mem-report   Report the heap used by each catalog structure, allocation counts and\n"
+                  L"                 peak working set after listing\n");
+}
+
+// Writes the --trace file and prints the phase summary when wmain returns
+struct TraceReport
+{
+    std::wstring path;
+
+    ~TraceReport()
+    {
+        if (path.empty())
+            return;
+        if (!WriteTraceFile(path))
+            ConsoleOutput(L"Error: Could not write " + path + L"\n");
+        ConsoleOutput(L"\n" + TraceSummary() + L"Trace saved to " + path + L"\n");
+    }
+};
+
+bool ParseOptions(int argc, wchar_t* argv[], Options& options)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::wstring arg = argv[i];
+        if (arg == L"--system")
+        {
+            options.includeSystem = true;
+        }
+        else if (arg == L"--duplicates")
+        {
+            options.duplicates = true;
+            options.scan.computeHashes = true;
+        }
+        else if (arg == L"--verify")
+        {
+            options.verify = true;
+        }
+        else if (arg == L"--glyph-names")
+        {
+            options.glyphNames = true;
+        }
+        else if (arg == L"--layout")
+        {
+            options.showLayout = true;
+            options.scan.resolvePaths = true;
+        }
+        else if (arg == L"--feature" || arg == L"--script")
+        {
+            Condition condition;
+            bool valid = arg == L"--feature" ? ParseFeatureCondition(i + 1 < argc ? argv[i + 1] : L"", condition)
+                                             : ParseScriptCondition(i + 1 < argc ? argv[i + 1] : L"", condition);
+            if (!valid)
+            {
+                ConsoleOutput(L"Error: " + arg + L" needs a tag of up to 4 characters\n");
+                return false;
+            }
+            ++i;
+            options.conditions.push_back(condition);
+        }
+        else if (arg == L"--embeddable")
+        {
+            Condition condition;
+            if (!ParseEmbeddableCondition(i + 1 < argc ? argv[i + 1] : L"", condition))
+            {
+                ConsoleOutput(L"Error: --embeddable needs installable, editable or preview\n");
+                return false;
+            }
+            ++i;
+            options.conditions.push_back(condition);
+            options.showLicense = true;
+            options.scan.readMetrics = true;
+        }
+        else if (arg == L"--supports")
+        {
+            std::wstring value = i + 1 < argc ? argv[++i] : L"";
+            size_t colon = value.find(L':');
+            uint32_t script = 0, language = 0;
+            if (!ParseTag(value.substr(0, colon), script) ||
+                (colon != std::wstring::npos && !ParseTag(value.substr(colon + 1), language)))
+            {
+                ConsoleOutput(L"Error: --supports needs SCRIPT or SCRIPT:LANGUAGE tags\n");
+                return false;
+            }
+            options.supports.emplace_back(script, language);
+            options.scan.readScripts = true;
+        }
+        else if (arg == L"--arrow" || arg == L"--trace")
+        {
+            if (i + 1 >= argc)
+            {
+                ConsoleOutput(L"Error: " + arg + L" needs a file name\n");
+                return false;
+            }
+            if (arg == L"--arrow")
+            {
+                options.arrowPath = argv[++i];
+                options.scan.readMetrics = true;
+            }
+            else
+            {
+                options.tracePath = argv[++i];
+            }
+        }
+        else if (arg == L"--catalog" || arg == L"--save-catalog" || arg == L"--update-catalog")
+        {
+            if (i + 1 >= argc)
+            {
+                ConsoleOutput(L"Error: " + arg + L" needs a file name\n");
+                return false;
+            }
+            if (arg == L"--catalog")
+            {
+                options.catalogPath = argv[++i];
+            }
+            else
+            {
+                options.saveCatalogPath = argv[++i];
+                options.updateCatalog = arg == L"--update-catalog";
+                options.scan.computeHashes = true;  // Content hashes key faces in --diff
+                options.scan.readScripts = true;
+                options.scan.readMetrics = true;
+                options.scan.readLicense = true;
+            }
+        }
+        else if (arg == L"--diff")
+        {
+            if (i + 2 >= argc)
+            {
+                ConsoleOutput(L"Error: --diff needs two catalog files\n");
+                return false;
+            }
+            options.diffBefore = argv[++i];
+            options.diffAfter = argv[++i];
+        }
+        else if (arg == L"--thumbnails" || arg == L"--sample" || arg == L"--pixel-size" || arg == L"--thumbnail-format")
+        {
+            if (i + 1 >= argc)
+            {
+                ConsoleOutput(L"Error: " + arg + L" needs a value\n");
+                return false;
+            }
+            std::wstring value = argv[++i];
+            if (arg == L"--thumbnails")
+            {
+                options.thumbnailPath = value;
+                options.scan.resolvePaths = true;
+            }
+            else if (arg == L"--sample")
+            {
+                options.thumbnail.text = WideToCodePoints(value);
+            }
+            else if (arg == L"--pixel-size")
+            {
+                options.thumbnail.pixelSize = std::wcstof(value.c_str(), nullptr);
+                if (options.thumbnail.pixelSize < 1 || options.thumbnail.pixelSize > 1024)
+                {
+                    ConsoleOutput(L"Error: --pixel-size needs a size from 1 to 1024\n");
+                    return false;
+                }
+            }
+            else if (value == L"png" || value == L"pgm")
+            {
+                options.thumbnail.png = value == L"png";
+            }
+            else
+            {
+                ConsoleOutput(L"Error: --thumbnail-format needs png or pgm\n");
+                return false;
+            }
+        }
+        else if (arg == L"--template" || arg == L"--family-header" || arg == L"--family-footer")
+        {
+            if (i + 1 >= argc)
+            {
+                ConsoleOutput(L"Error: " + arg + L" needs a template\n");
+                return false;
+            }
+            OutputTemplate& format = arg == L"--template" ? options.fontTemplate
+                                   : arg == L"--family-header" ? options.familyHeader
+                                   : options.familyFooter;
+            std::wstring error;
+            if (!ParseOutputTemplate(argv[++i], arg == L"--template", format, error))
+            {
+                ConsoleOutput(L"Error: " + arg + L": " + error + L"\n");
+                return false;
+            }
+            // Read what the fields show
+            options.scan.readMetrics = options.scan.readMetrics || (format.data & TEMPLATE_METRICS);
+            options.scan.computeHashes = options.scan.computeHashes || (format.data & TEMPLATE_HASHES);
+            options.scan.readLicense = options.scan.readLicense || (format.data & TEMPLATE_LICENSE);
+            options.scan.readScripts = options.scan.readScripts || (format.data & TEMPLATE_SCRIPTS);
+            options.scan.resolvePaths = options.scan.resolvePaths || (format.data & TEMPLATE_PATHS);
+        }
+        else if (arg == L"--mem-report")
         {
-            logFamilyLine += " [" + WideToUtf8(family.postScriptFamilyName) + "]";
+            options.memReport = true;
+        }
+        else if (arg == L"--top-slow")
+        {
+            if (i + 1 >= argc)
+            {
+                ConsoleOutput(L"Error: --top-slow needs a count\n");
+                return false;
+            }
+            options.topSlow = std::wcstoul(argv[++i], nullptr, 10);
+            if (options.topSlow == 0)
+            {
+                ConsoleOutput(L"Error: --top-slow needs a count above 0\n");
+                return false;
+            }
+            options.scan.resolvePaths = true;  // Name the files of system fonts
+        }
+        else if (arg == L"--json" || arg == L"--where")
+        {
+            if (i + 1 >= argc)
+            {
+                ConsoleOutput(L"Error: " + arg + L" needs a value\n");
+                return false;
+            }
+            std::wstring value = argv[++i];
+            options.scan.readMetrics = true;
+            if (arg == L"--json")
+            {
+                options.jsonPath = value;
+                options.scan.readLicense = true;
+            }
+            else
+            {
+                Condition condition;
+                if (!ParseCondition(value, condition))
+                {
+                    ConsoleOutput(L"Error: Invalid condition " + value + L"\n");
+                    return false;
+                }
+                options.conditions.push_back(condition);
+            }
+        }
+        else if (arg.size() > 1 && arg[0] == L'-')
+        {
+            ConsoleOutput(L"Error: Unknown option " + arg + L"\n");
+            return false;
+        }
+        else
+        {
+            options.inputPaths.push_back(arg);
+        }
+    }
+    if (NeedsLayout(options.conditions))
+        options.scan.resolvePaths = true;
+    return true;
+}
+
+// Lines of the listing
+constexpr TextFormat kReusedLine(L"Reused {} of {} directories\n");
+constexpr TextFormat kSkippedLine(L"Skipped {} unreadable font files\n");
+constexpr TextFormat kRenderedStart(L"Rendered {} thumbnails ({} glyphs) to {}");
+constexpr TextFormat kNoOutlines(L", {} fonts without readable outlines");
+constexpr TextFormat kBadGlyphs(L", {} malformed glyphs");
+constexpr TextFormat kWriteErrors(L", {} files could not be written");
+constexpr TextFormat kFoundLine(L"Found {} font families\n\n");
+constexpr TextFormat kFamilyLine(L"FAMILY: {}\n");
+constexpr TextFormat kFamilyPostScriptLine(L"FAMILY: {} [{}]\n");
+constexpr TextFormat kFontLine(L"  {} (Weight: {}, Stretch: {}, Style: {})\n");
+constexpr TextFormat kFontPostScriptLine(L"  {} [{}] (Weight: {}, Stretch: {}, Style: {})\n");
+constexpr TextFormat kColorLine(L"    Color: {}\n");
+constexpr TextFormat kEmbeddingStart(L"    Embedding: {}");
+constexpr TextFormat kFsType(L" (fsType 0x{:X4})");
+constexpr TextFormat kVendor(L", vendor {}");
+
+int wmain(int argc, wchar_t* argv[])
+{
+    // Setup console for UTF-8 and Unicode
+    SetConsoleOutputCP(CP_UTF8);
+    SetConsoleCP(CP_UTF8);
+    
+    // Enable Unicode console output
+    HANDLE hOut = GetStdHandle(STD_OUTPUT_HANDLE);
+    DWORD dwMode = 0;
+    GetConsoleMode(hOut, &dwMode);
+    dwMode |= ENABLE_PROCESSED_OUTPUT | ENABLE_VIRTUAL_TERMINAL_PROCESSING;
+    SetConsoleMode(hOut, dwMode);
+    
+    Options options;
+    if (!ParseOptions(argc, argv, options))
+    {
+        PrintUsage();
+        return 1;
+    }
+    TraceReport traceReport{ options.tracePath };
+    if (!options.tracePath.empty())
+        StartTrace();
+    if (options.memReport)
+        StartAllocationCounting();
+    
+    // Open log file
+    std::ofstream logFile("font.log", std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!logFile.is_open())
+    {
+        ConsoleOutput(L"Error: Could not create font.log file!\n");
+        return 1;
+    }
+    logFile << "\xEF\xBB\xBF"; // UTF-8 BOM
+    
+    ConsoleOutput(L"Font Family Enumerator\n");
+    ConsoleOutput(L"======================\n");
+    
+    if (options.verify)
+    {
+        // Integrity mode reads the files directly; DirectWrite would silently skip broken ones
+        std::vector<std::wstring> roots = options.inputPaths.empty() ? SystemFontDirectories() : options.inputPaths;
+        std::vector<std::wstring> files = FindFontFiles(roots, false).files;
+        size_t badFiles = ReportIntegrity(files, VerifyFontFiles(files), logFile);
+        logFile.close();
+        ConsoleOutput(L"Results saved to font.log\n");
+        return badFiles > 0 ? 1 : 0;
+    }
+    
+    if (!options.diffBefore.empty())
+    {
+        std::vector<FontFamily> before, after;
+        ScriptIndex unusedIndex;
+        std::wstring unreadable;
+        if (!LoadCatalog(options.diffBefore, before, unusedIndex))
+            unreadable = options.diffBefore;
+        else if (!LoadCatalog(options.diffAfter, after, unusedIndex))
+            unreadable = options.diffAfter;
+        if (!unreadable.empty())
+        {
+            ConsoleOutput(L"Error: Could not read catalog " + unreadable + L"\n");
+            return 1;
+        }
+        ReportCatalogDiff(options.diffBefore, options.diffAfter, before, after, logFile);
+        logFile.close();
+        ConsoleOutput(L"Results saved to font.log\n");
+        return 0;
+    }
+    
+    if (options.glyphNames)
+    {
+        std::vector<std::wstring> roots = options.inputPaths.empty() ? SystemFontDirectories() : options.inputPaths;
+        std::vector<std::wstring> files = FindFontFiles(roots, false).files;
+        ReportGlyphNames(files, logFile);
+        logFile.close();
+        ConsoleOutput(L"Results saved to font.log\n");
+        return 0;
+    }
+    
+    // Initialize DirectWrite
+    IDWriteFactory* factory = nullptr;
+    HRESULT hr = DWriteCreateFactory(DWRITE_FACTORY_TYPE_SHARED, __uuidof(IDWriteFactory), 
+                                   reinterpret_cast<IUnknown**>(&factory));
+    if (FAILED(hr) || !factory)
+    {
+        ConsoleOutput(L"Error: Failed to create DirectWrite factory.\n");
+        return 1;
+    }
+    
+    std::vector<FontFamily> fontFamilies;
+    ScriptIndex scriptIndex;
+    std::vector<ScanTiming> scanTimings;
+    DirectoryCache directoryCache;
+    if (!options.catalogPath.empty())
+    {
+        if (!LoadCatalog(options.catalogPath, fontFamilies, scriptIndex))
+        {
+            ConsoleOutput(L"Error: Could not read catalog " + options.catalogPath + L"\n");
+            factory->Release();
+            return 1;
+        }
+    }
+    else
+    {
+        if (options.inputPaths.empty() || options.includeSystem)
+        {
+            if (!EnumerateSystemFonts(factory, options.scan, fontFamilies, options.topSlow > 0 ? &scanTimings : nullptr))
+            {
+                ConsoleOutput(L"Error: Failed to get system font collection.\n");
+                factory->Release();
+                return 1;
+            }
+        }
+        if (!options.inputPaths.empty())
+        {
+            // Font files and directories given on the command line (instead of the system collection unless --system)
+            // Files that are not fonts after all are left out here and counted as unreadable
+            std::vector<FontFamily> saved;
+            if (options.updateCatalog)
+            {
+                ScriptIndex unusedIndex;
+                if (!LoadCatalog(options.saveCatalogPath, saved, unusedIndex, &directoryCache))
+                    directoryCache.clear();
+            }
+            FontFileSearch search = FindFontFiles(options.inputPaths, true, options.saveCatalogPath.empty() ? nullptr : &directoryCache);
+            std::vector<FontFamily> reuse = SavedFontsOfUnchangedFiles(saved, search);
+            size_t skipped = search.rejected +
+                             ScanFontFiles(factory, search.files, options.scan, fontFamilies, options.topSlow > 0 ? &scanTimings : nullptr,
+                                           options.updateCatalog ? &reuse : nullptr);
+            if (options.updateCatalog)
+            {
+                std::wstring line;
+                FormatTo<kReusedLine>(line, search.cachedDirectories, search.directories);
+                ConsoleOutput(line);
+            }
+            if (skipped > 0)
+            {
+                std::wstring line;
+                FormatTo<kSkippedLine>(line, skipped);
+                ConsoleOutput(line);
+            }
+        }
+        if (options.scan.readScripts)
+        {
+            scriptIndex = BuildScriptIndex(fontFamilies);
+        }
+    }
+    
+    if (options.scan.computeHashes)
+    {
+        // System fonts were only resolved to paths; hash their files now
+        HashFontFiles(fontFamilies);
+    }
+    
+    if (!options.saveCatalogPath.empty() && !SaveCatalog(options.saveCatalogPath, fontFamilies, scriptIndex, &directoryCache))
+    {
+        ConsoleOutput(L"Error: Could not write catalog " + options.saveCatalogPath + L"\n");
+    }
+    
+    // Script support is answered from the index; family ids are positions before any filtering
+    if (!options.supports.empty())
+    {
+        std::vector<size_t> matches(fontFamilies.size(), 0);
+        for (const auto& query : options.supports)
+        {
+            for (uint32_t id : QueryScriptIndex(scriptIndex, query.first, query.second))
+                ++matches[id];
+        }
+        std::vector<FontFamily> supported;
+        for (size_t i = 0; i < fontFamilies.size(); ++i)
+        {
+            if (matches[i] == options.supports.size())
+                supported.push_back(std::move(fontFamilies[i]));
+        }
+        fontFamilies = std::move(supported);
+    }
+    
+    FilterFonts(fontFamilies, options.conditions);
+    if (options.showLayout || (options.fontTemplate.data & TEMPLATE_LAYOUT))
+    {
+        for (auto& family : fontFamilies)
+            for (auto& font : family.fonts)
+                LoadLayoutInfo(font);
+    }
+    if (!options.jsonPath.empty() && !WriteJsonCatalog(options.jsonPath, fontFamilies))
+    {
+        ConsoleOutput(L"Error: Could not write " + options.jsonPath + L"\n");
+    }
+    if (!options.arrowPath.empty() && !WriteArrowCatalog(options.arrowPath, fontFamilies))
+    {
+        ConsoleOutput(L"Error: Could not write " + options.arrowPath + L"\n");
+    }
+    
+    if (!options.thumbnailPath.empty())
+    {
+        ThumbnailStats stats = RenderThumbnails(fontFamilies, options.thumbnailPath, options.thumbnail);
+        std::wstring line;
+        FormatTo<kRenderedStart>(line, stats.written, stats.glyphs, options.thumbnailPath);
+        if (stats.noOutlines > 0)
+            FormatTo<kNoOutlines>(line, stats.noOutlines);
+        if (stats.badGlyphs > 0)
+            FormatTo<kBadGlyphs>(line, stats.badGlyphs);
+        if (stats.writeErrors > 0)
+            FormatTo<kWriteErrors>(line, stats.writeErrors);
+        line += L'\n';
+        WriteOutput(logFile, line);
+    }
+    
+    // Output results
+    TraceScope outputTrace("Output");
+    std::wstring text;
+    text.reserve(kOutputBlock + 4096);
+    bool templates = options.fontTemplate.given || options.familyHeader.given || options.familyFooter.given;
+    if (!templates)
+        FormatTo<kFoundLine>(text, fontFamilies.size());
+    
+    for (const auto& family : fontFamilies)
+    {
+        // Templates replace the whole listing; the ones not given write nothing
+        if (templates)
+        {
+            if (options.familyHeader.given)
+                AppendTemplateLine(text, options.familyHeader, family);
+            if (options.fontTemplate.given)
+            {
+                for (const auto& font : family.fonts)
+                    AppendTemplateLine(text, options.fontTemplate, family, font);
+            }
+            if (options.familyFooter.given)
+                AppendTemplateLine(text, options.familyFooter, family);
+            FlushOutput(logFile, text);
+            continue;
         }
-        logFamilyLine += "\n";
-        logFile << logFamilyLine;
+        
+        // Output family name and aliases
+        if (!family.postScriptFamilyName.Empty() && family.postScriptFamilyName != family.primaryName)
+            FormatTo<kFamilyPostScriptLine>(text, family.primaryName, family.postScriptFamilyName);
+        else
+            FormatTo<kFamilyLine>(text, family.primaryName);
         
         if (family.allNames.size() > 1)
         {
-            std::wstring aliasLine = L"  Aliases: ";
-            logFile << "  Aliases: ";
+            text += L"  Aliases: ";
             bool first = true;
             for (const auto& name : family.allNames)
             {
                 if (name != family.primaryName)
                 {
-                    if (!first) 
-                    {
-                        aliasLine += L", ";
-                        logFile << ", ";
-                    }
-                    aliasLine += name;
-                    logFile << WideToUtf8(name);
+                    if (!first)
+                        text += L", ";
+                    name.AppendTo(text);
                     first = false;
                 }
             }
-            aliasLine += L"\n";
-            ConsoleOutput(aliasLine);
-            logFile << "\n";
+            text += L'\n';
         }
         
-        // Output fonts in family
+        // Output fonts in family, with the PostScript name if different
         for (const auto& font : family.fonts)
         {
-            // Build output line with PostScript name if different
-            std::wstring fontLine = L"  " + font.name;
-            if (!font.postScriptName.empty() && font.postScriptName != font.name)
+            if (!font.postScriptName.Empty() && font.postScriptName != font.name)
+                FormatTo<kFontPostScriptLine>(text, font.name, font.postScriptName, font.weight, font.stretch, font.style);
+            else
+                FormatTo<kFontLine>(text, font.name, font.weight, font.stretch, font.style);
+            
+            if (font.color.flags != 0)
             {
-                fontLine += L" [" + font.postScriptName + L"]";
+                FormatTo<kColorLine>(text, FormatColorInfo(font.color));
             }
-            fontLine += L" (Weight: " + std::to_wstring(font.weight) + 
-                       L", Stretch: " + std::to_wstring(font.stretch) + 
-                       L", Style: " + std::to_wstring(font.style) + L")\n";
-            
-            ConsoleOutput(fontLine);
-                      
-            // Same for log file
-            std::string logLine = "  " + WideToUtf8(font.name);
-            if (!font.postScriptName.empty() && font.postScriptName != font.name)
+            if (options.showLicense)
+            {
+                FormatTo<kEmbeddingStart>(text, EmbeddingLevelName(font.license.embedding));
+                if (font.license.fsType & FSTYPE_NO_SUBSETTING)
+                    text += L", no subsetting";
+                if (font.license.fsType & FSTYPE_BITMAP_ONLY)
+                    text += L", bitmap only";
+                if (font.license.embedding != EmbeddingLevel::Unknown)
+                    FormatTo<kFsType>(text, font.license.fsType);
+                if (font.license.vendorId != 0)
+                    FormatTo<kVendor>(text, TagText{ font.license.vendorId });
+                text += L'\n';
+            }
+            if (options.showLayout && font.layout)
             {
-                logLine += " [" + WideToUtf8(font.postScriptName) + "]";
+                text += L"    Layout:";
+                AppendLayout(text, *font.layout);
+                text += L'\n';
             }
-            logLine += " (Weight: " + std::to_string(font.weight) + 
-                      ", Stretch: " + std::to_string(font.stretch) + 
-                      ", Style: " + std::to_string(font.style) + ")\n";
-            logFile << logLine;
         }
         
-        ConsoleOutput(L"\n");
-        logFile << "\n";
+        text += L'\n';
+        FlushOutput(logFile, text);
+    }
+    FlushOutput(logFile, text, true);
+    
+    if (options.duplicates)
+    {
+        ReportDuplicates(fontFamilies, logFile);
+    }
+    if (options.topSlow > 0)
+    {
+        ReportSlowFonts(std::move(scanTimings), options.topSlow, logFile);
+    }
+    if (options.memReport)
+    {
+        WriteOutput(logFile, MemoryReport(fontFamilies, scriptIndex));
     }
     
     logFile.close();
-    collection->Release();
     factory->Release();
     
     ConsoleOutput(L"Results saved to font.log\n");
+    
+    // Only pause when started without arguments (e.g. from Explorer)
+    if (argc > 1)
+        return 0;
+    
     ConsoleOutput(L"Press Enter to exit...\n");
     
     // Wait for user input
@@ -0,0 +1,379 @@
+// memreport.cpp : Heap accounting for --mem-report (catalog structure sizes, allocation counts, peak RSS)
+//
+
+#include "memreport.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <new>
+#include <set>
+#include <unordered_set>
+#ifdef _WIN32
+#include <Windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#else
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+#include "textformat.h"
+
+namespace
+{
+    std::atomic<bool> counting{ false };
+    std::atomic<uint64_t> allocations{ 0 };
+    std::atomic<uint64_t> frees{ 0 };
+    std::atomic<int64_t> liveBytes{ 0 };
+    std::atomic<int64_t> peakBytes{ 0 };
+
+    void CountAllocation(int64_t size)
+    {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        int64_t live = liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+        int64_t peak = peakBytes.load(std::memory_order_relaxed);
+        while (live > peak && !peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    void CountFree(int64_t size)
+    {
+        frees.fetch_add(1, std::memory_order_relaxed);
+        liveBytes.fetch_sub(size, std::memory_order_relaxed);
+    }
+
+    // In front of every block: the requested size, and whether the allocation was counted so
+    // blocks from before StartAllocationCounting are not subtracted when they are freed
+    struct alignas(std::max_align_t) BlockHeader
+    {
+        int64_t size;
+        bool counted;
+    };
+
+    // Counts the allocations of a container's own allocator, to measure the node and control
+    // block sizes of the standard library in use instead of assuming its layout
+    struct ProbeCounts
+    {
+        uint64_t blocks = 0;
+        uint64_t bytes = 0;
+    };
+
+    thread_local ProbeCounts probe;
+
+    template <typename T>
+    struct ProbeAllocator
+    {
+        using value_type = T;
+
+        ProbeAllocator() = default;
+        template <typename U>
+        ProbeAllocator(const ProbeAllocator<U>&) {}
+
+        T* allocate(size_t count)
+        {
+            ++probe.blocks;
+            probe.bytes += count * sizeof(T);
+            return std::allocator<T>().allocate(count);
+        }
+
+        void deallocate(T* block, size_t count) { std::allocator<T>().deallocate(block, count); }
+
+        template <typename U>
+        bool operator==(const ProbeAllocator<U>&) const { return true; }
+        template <typename U>
+        bool operator!=(const ProbeAllocator<U>&) const { return false; }
+    };
+
+    template <typename Tree>
+    struct Probed;
+
+    template <typename Key, typename Compare, typename Allocator>
+    struct Probed<std::set<Key, Compare, Allocator>>
+    {
+        using type = std::set<Key, Compare, ProbeAllocator<Key>>;
+    };
+
+    template <typename Key, typename Value, typename Compare, typename Allocator>
+    struct Probed<std::map<Key, Value, Compare, Allocator>>
+    {
+        using type = std::map<Key, Value, Compare, ProbeAllocator<std::pair<const Key, Value>>>;
+    };
+
+    // Heap of a std::set/std::map: what the empty tree allocates (a head node in some
+    // implementations) and the node of each element
+    struct TreeCost
+    {
+        uint64_t emptyBlocks = 0;
+        uint64_t emptyBytes = 0;
+        uint64_t nodeBytes = 0;
+    };
+
+    template <typename Tree>
+    TreeCost MeasureTree()
+    {
+        using Probe = typename Probed<Tree>::type;
+        TreeCost cost;
+        probe = {};
+        Probe tree;
+        cost.emptyBlocks = probe.blocks;
+        cost.emptyBytes = probe.bytes;
+        tree.insert(typename Probe::value_type{});
+        cost.nodeBytes = probe.bytes - cost.emptyBytes;
+        return cost;
+    }
+
+    template <typename Tree>
+    const TreeCost& CostOf()
+    {
+        static const TreeCost cost = MeasureTree<Tree>();
+        return cost;
+    }
+
+    // The block std::make_shared allocates for one value: control block and value together
+    template <typename T>
+    uint64_t SharedBlockBytes()
+    {
+        static const uint64_t bytes = []
+        {
+            probe = {};
+            std::allocate_shared<T>(ProbeAllocator<T>());
+            return probe.bytes;
+        }();
+        return bytes;
+    }
+
+    const size_t kInlineCapacity = std::wstring().capacity();
+
+    // Short strings live inside the object; longer ones own capacity + terminator on the heap
+    void AddString(MemoryPart& part, const std::wstring& text)
+    {
+        if (text.capacity() <= kInlineCapacity)
+            return;
+        ++part.blocks;
+        part.bytes += (text.capacity() + 1) * sizeof(wchar_t);
+    }
+
+    const size_t kInlineNameCapacity = std::string().capacity();
+
+    void AddString(MemoryPart& part, const NameText& text)
+    {
+        if (text.Bytes().capacity() <= kInlineNameCapacity)
+            return;
+        ++part.blocks;
+        part.bytes += text.Bytes().capacity() + 1;
+    }
+
+    template <typename T>
+    void AddVector(MemoryPart& part, const std::vector<T>& items)
+    {
+        if (items.capacity() == 0)
+            return;
+        ++part.blocks;
+        part.bytes += items.capacity() * sizeof(T);
+    }
+
+    template <typename Tree>
+    void AddTree(MemoryPart& part, const Tree& tree)
+    {
+        const TreeCost& cost = CostOf<Tree>();
+        part.blocks += cost.emptyBlocks + tree.size();
+        part.bytes += cost.emptyBytes + tree.size() * cost.nodeBytes;
+    }
+
+    template <typename Map>
+    void AddMap(MemoryPart& part, const Map& map)
+    {
+        AddTree(part, map);
+        for (const auto& entry : map)
+            AddVector(part, entry.second);
+    }
+
+    constexpr TextFormat kMegabytes(L"{:.1} MB");
+
+    // "12.3 MB", for FormatTo
+    struct MegabytesText
+    {
+        int64_t bytes;
+    };
+
+    void AppendText(std::wstring& out, MegabytesText size)
+    {
+        FormatTo<kMegabytes>(out, size.bytes / 1048576.0);
+    }
+
+    constexpr TextFormat kMemoryLine(L"MEMORY: {} fonts in {} families\n  Structure              Blocks         Bytes   Share\n");
+    constexpr TextFormat kPartLine(L"  {:<18} {:>10} {:>13} {:>6.1}%\n");
+    constexpr TextFormat kTotalLine(L"  {:<18} {:>10} {:>13}  ({}, {:.0} bytes per font)\n");
+    constexpr TextFormat kHeapLine(L"  Heap: {} allocations, {} frees, {} live, {} peak");
+    constexpr TextFormat kCatalogShare(L" (catalog is {:.0}% of live)");
+#ifdef _WIN32
+    constexpr TextFormat kResidentLine(L"  Working set: {}, peak {}\n");
+
+    bool ResidentMemory(int64_t& current, int64_t& peak)
+    {
+        PROCESS_MEMORY_COUNTERS counters = {};
+        counters.cb = sizeof(counters);
+        if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+            return false;
+        current = (int64_t)counters.WorkingSetSize;
+        peak = (int64_t)counters.PeakWorkingSetSize;
+        return true;
+    }
+#else
+    constexpr TextFormat kResidentLine(L"  Resident set: {}, peak {}\n");
+
+    // Peak from getrusage; current from /proc where there is one, else the peak
+    bool ResidentMemory(int64_t& current, int64_t& peak)
+    {
+        rusage usage = {};
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+            return false;
+#ifdef __APPLE__
+        peak = (int64_t)usage.ru_maxrss;
+#else
+        peak = (int64_t)usage.ru_maxrss * 1024;
+#endif
+        current = peak;
+        std::ifstream statm("/proc/self/statm");
+        int64_t pages = 0, residentPages = 0;
+        if (statm >> pages >> residentPages)
+            current = residentPages * sysconf(_SC_PAGESIZE);
+        return true;
+    }
+#endif
+}
+
+void* operator new(size_t size)
+{
+    if (size > SIZE_MAX - sizeof(BlockHeader))
+        throw std::bad_alloc();
+    auto header = (BlockHeader*)malloc(sizeof(BlockHeader) + size);
+    if (!header)
+        throw std::bad_alloc();
+    header->size = (int64_t)size;
+    header->counted = counting.load(std::memory_order_relaxed);
+    if (header->counted)
+        CountAllocation(header->size);
+    return header + 1;
+}
+
+void operator delete(void* block) noexcept
+{
+    if (!block)
+        return;
+    BlockHeader* header = (BlockHeader*)block - 1;
+    if (header->counted)
+        CountFree(header->size);
+    free(header);
+}
+
+void operator delete(void* block, size_t) noexcept
+{
+    operator delete(block);
+}
+
+void StartAllocationCounting()
+{
+    counting = true;
+}
+
+AllocationStats GetAllocationStats()
+{
+    AllocationStats stats;
+    stats.allocations = allocations.load();
+    stats.frees = frees.load();
+    stats.liveBytes = liveBytes.load();
+    stats.peakBytes = peakBytes.load();
+    return stats;
+}
+
+std::vector<MemoryPart> MeasureCatalogMemory(const std::vector<FontFamily>& fontFamilies, const ScriptIndex& scriptIndex)
+{
+    MemoryPart familyRecords{ L"Family records" };
+    MemoryPart familyNames{ L"Family names" };
+    MemoryPart aliasSets{ L"Alias set nodes" };
+    MemoryPart aliasStrings{ L"Alias strings" };
+    MemoryPart fontRecords{ L"Font vectors" };
+    MemoryPart fontNames{ L"Font names" };
+    MemoryPart filePaths{ L"File paths" };
+    MemoryPart licenseStrings{ L"License strings" };
+    MemoryPart fontScripts{ L"Font script lists" };
+    MemoryPart layouts{ L"Layout info" };
+    MemoryPart index{ L"Script index" };
+
+    AddVector(familyRecords, fontFamilies);
+    std::unordered_set<const LayoutInfo*> seenLayouts;
+    for (const auto& family : fontFamilies)
+    {
+        AddString(familyNames, family.primaryName);
+        AddString(familyNames, family.postScriptFamilyName);
+        AddTree(aliasSets, family.allNames);
+        for (const auto& name : family.allNames)
+            AddString(aliasStrings, name);
+        AddVector(fontRecords, family.fonts);
+        for (const auto& font : family.fonts)
+        {
+            AddString(fontNames, font.name);
+            AddString(fontNames, font.postScriptName);
+            AddString(filePaths, font.filePath);
+            AddString(licenseStrings, font.license.description);
+            AddString(licenseStrings, font.license.url);
+            AddVector(fontScripts, font.unicodeScripts);
+            // Faces of one file and catalog entries may share a LayoutInfo
+            if (font.layout && seenLayouts.insert(font.layout.get()).second)
+            {
+                ++layouts.blocks;
+                layouts.bytes += SharedBlockBytes<LayoutInfo>();
+                AddVector(layouts, font.layout->scripts);
+                for (const auto& script : font.layout->scripts)
+                {
+                    AddVector(layouts, script.languages);
+                    AddVector(layouts, script.features);
+                }
+            }
+        }
+    }
+    AddMap(index, scriptIndex.unicodeScripts);
+    AddMap(index, scriptIndex.layoutScripts);
+    AddMap(index, scriptIndex.languages);
+
+    return { familyRecords, familyNames, aliasSets, aliasStrings, fontRecords, fontNames, filePaths, licenseStrings,
+             fontScripts, layouts, index };
+}
+
+std::wstring MemoryReport(const std::vector<FontFamily>& fontFamilies, const ScriptIndex& scriptIndex)
+{
+    size_t fonts = 0;
+    for (const auto& family : fontFamilies)
+        fonts += family.fonts.size();
+    std::vector<MemoryPart> parts = MeasureCatalogMemory(fontFamilies, scriptIndex);
+    uint64_t totalBlocks = 0, totalBytes = 0;
+    for (const MemoryPart& part : parts)
+    {
+        totalBlocks += part.blocks;
+        totalBytes += part.bytes;
+    }
+
+    std::wstring report;
+    FormatTo<kMemoryLine>(report, fonts, fontFamilies.size());
+    for (const MemoryPart& part : parts)
+        FormatTo<kPartLine>(report, part.name, part.blocks, part.bytes, totalBytes > 0 ? 100.0 * part.bytes / totalBytes : 0.0);
+    FormatTo<kTotalLine>(report, L"Total", totalBlocks, totalBytes, MegabytesText{ (int64_t)totalBytes },
+                         fonts > 0 ? (double)totalBytes / fonts : 0.0);
+
+    AllocationStats stats = GetAllocationStats();
+    if (counting.load())
+    {
+        FormatTo<kHeapLine>(report, stats.allocations, stats.frees, MegabytesText{ stats.liveBytes }, MegabytesText{ stats.peakBytes });
+        if (stats.liveBytes > 0)
+            FormatTo<kCatalogShare>(report, 100.0 * totalBytes / stats.liveBytes);
+        report += L"\n";
+    }
+
+    int64_t resident = 0, peakResident = 0;
+    if (ResidentMemory(resident, peakResident))
+        FormatTo<kResidentLine>(report, MegabytesText{ resident }, MegabytesText{ peakResident });
+    return report + L"\n";
+}
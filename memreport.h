@@ -0,0 +1,41 @@
+// memreport.h : Heap accounting for --mem-report (catalog structure sizes, allocation counts, peak RSS)
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "catalog.h"
+#include "scriptindex.h"
+
+// Count operator new/delete from now on; call before the catalog is built. Counting is off by
+// default so the replacement allocator costs a single check per call, plus a 16-byte header
+// per block that keeps its size. Blocks allocated before this call are not counted when freed.
+void StartAllocationCounting();
+
+struct AllocationStats
+{
+    uint64_t allocations = 0;
+    uint64_t frees = 0;
+    int64_t liveBytes = 0;   // Requested bytes not yet freed
+    int64_t peakBytes = 0;   // Highest liveBytes seen
+};
+
+AllocationStats GetAllocationStats();
+
+// Heap owned by one kind of catalog structure; blocks approximate the allocations behind it
+struct MemoryPart
+{
+    const wchar_t* name;
+    uint64_t blocks = 0;
+    uint64_t bytes = 0;
+};
+
+// Walk the catalog and estimate the heap bytes of its strings, alias sets, font vectors,
+// layout info and script index from capacities, and tree node and shared block sizes
+// measured once on the standard library in use
+std::vector<MemoryPart> MeasureCatalogMemory(const std::vector<FontFamily>& fontFamilies, const ScriptIndex& scriptIndex);
+
+// Structure table, allocation counts, and current and peak working set (resident set on POSIX)
+std::wstring MemoryReport(const std::vector<FontFamily>& fontFamilies, const ScriptIndex& scriptIndex);
@@ -0,0 +1,48 @@
+// outline.cpp : Glyph outlines from glyf (quadratic) and CFF (cubic) tables
+//
+
+#include "outline.h"
+
+namespace
+{
+    const uint32_t kCffTag = MakeTag('C', 'F', 'F', ' ');
+}
+
+bool OutlineFont::Open(FontContainer& container)
+{
+    *this = OutlineFont();
+    ByteSpan head = container.LoadTable(MakeTag('h', 'e', 'a', 'd'));
+    ByteSpan maxp = container.LoadTable(MakeTag('m', 'a', 'x', 'p'));
+    if (!head.Has(0, 54) || !maxp.Has(0, 6)) return false;
+    unitsPerEm = head.U16(18);
+    glyphCount = maxp.U16(4);
+    if (unitsPerEm == 0) return false;
+
+    if (container.FindTable(kCffTag))
+    {
+        if (!cff.Open(container.LoadTable(kCffTag))) return false;
+        format = OutlineFormat::Cff;
+        if (glyphCount > cff.GlyphCount()) glyphCount = cff.GlyphCount();
+        return true;
+    }
+
+    if (!glyf.Open(container, glyphCount, head.S16(50) != 0)) return false;
+    format = OutlineFormat::TrueType;
+    return true;
+}
+
+bool OutlineFont::Draw(uint32_t glyph, PathSink& sink) const
+{
+    switch (format)
+    {
+    case OutlineFormat::TrueType:
+    {
+        GlyphOutline outline;
+        if (!glyf.Decode(glyph, ThreadOutlineArena(), outline)) return false;
+        outline.Draw(sink);
+        return true;
+    }
+    case OutlineFormat::Cff: return DrawCffGlyph(cff, glyph, sink);
+    default: return false;
+    }
+}
@@ -0,0 +1,44 @@
+// outline.h : Glyph outlines from glyf (quadratic) and CFF (cubic) tables
+//
+
+#pragma once
+
+#include <cstdint>
+#include "cff.h"
+#include "glyf.h"
+#include "sfnt.h"
+
+// Receives a glyph outline in font units. Contours always start with MoveTo and
+// end with Close; the closing segment back to the start point is implied.
+struct PathSink
+{
+    virtual ~PathSink() = default;
+    virtual void MoveTo(float x, float y) = 0;
+    virtual void LineTo(float x, float y) = 0;
+    virtual void QuadTo(float cx, float cy, float x, float y) = 0;
+    virtual void CubicTo(float c1x, float c1y, float c2x, float c2y, float x, float y) = 0;
+    virtual void Close() = 0;
+};
+
+enum class OutlineFormat
+{
+    None,
+    TrueType,  // glyf/loca
+    Cff,
+};
+
+// The outline tables of the selected face. The spans point into the container,
+// which must stay open while the font is used.
+struct OutlineFont
+{
+    OutlineFormat format = OutlineFormat::None;
+    uint32_t glyphCount = 0;
+    uint16_t unitsPerEm = 0;
+    GlyfFont glyf;
+    CffFont cff;
+
+    // False for faces without outlines, CFF2 fonts and WOFF2 files with a transformed glyf table
+    bool Open(FontContainer& container);
+    // False if the glyph data is malformed; the sink may have received part of the outline
+    bool Draw(uint32_t glyph, PathSink& sink) const;
+};
@@ -0,0 +1,264 @@
+// outputtemplate.cpp : --template/--family-header/--family-footer: listing lines shaped by the user
+//
+
+#include "outputtemplate.h"
+#include "layout.h"
+
+namespace
+{
+    struct TemplateField
+    {
+        const wchar_t* name;
+        bool font;               // Needs a font, so not allowed in family header and footer templates
+        uint8_t data;            // TEMPLATE_* scan data the value comes from
+        uint8_t requiredTables;  // METRICS_* flags the value comes from (0 = always available)
+        int64_t (*number)(const FontFamily& family, const FontInfo& font);               // Integer fields
+        void (*text)(std::wstring& out, const FontFamily& family, const FontInfo& font);  // The others
+    };
+
+    // 16 hex digits, or nothing for a hash that was not computed
+    void AppendHash(std::wstring& out, uint64_t hash)
+    {
+        static const TextFormat::Field kHash = { 0, 0, true, false, 16 };
+        if (hash != 0)
+            AppendInteger(out, hash, false, kHash);
+    }
+
+    const TemplateField kFields[] = {
+        { L"family", false, 0, 0, nullptr, [](std::wstring& out, const FontFamily& family, const FontInfo&) { out += family.primaryName; } },
+        { L"familyPostScript", false, 0, 0, nullptr, [](std::wstring& out, const FontFamily& family, const FontInfo&) { family.postScriptFamilyName.AppendTo(out); } },
+        { L"aliases", false, 0, 0, nullptr, [](std::wstring& out, const FontFamily& family, const FontInfo&)
+            {
+                size_t start = out.size();
+                for (const auto& name : family.allNames)
+                {
+                    if (name == family.primaryName)
+                        continue;
+                    if (out.size() != start)
+                        out += L", ";
+                    name.AppendTo(out);
+                }
+            } },
+        { L"fontCount", false, 0, 0, [](const FontFamily& family, const FontInfo&) -> int64_t { return (int64_t)family.fonts.size(); }, nullptr },
+        { L"name", true, 0, 0, nullptr, [](std::wstring& out, const FontFamily&, const FontInfo& f) { f.name.AppendTo(out); } },
+        { L"postScriptName", true, 0, 0, nullptr, [](std::wstring& out, const FontFamily&, const FontInfo& f) { f.postScriptName.AppendTo(out); } },
+        { L"weight", true, 0, 0, [](const FontFamily&, const FontInfo& f) -> int64_t { return f.weight; }, nullptr },
+        { L"stretch", true, 0, 0, [](const FontFamily&, const FontInfo& f) -> int64_t { return f.stretch; }, nullptr },
+        { L"style", true, 0, 0, [](const FontFamily&, const FontInfo& f) -> int64_t { return f.style; }, nullptr },
+        { L"file", true, TEMPLATE_PATHS, 0, nullptr, [](std::wstring& out, const FontFamily&, const FontInfo& f) { out += f.filePath; } },
+        { L"faceIndex", true, 0, 0, [](const FontFamily&, const FontInfo& f) -> int64_t { return f.faceIndex; }, nullptr },
+        { L"contentHash", true, TEMPLATE_HASHES, 0, nullptr, [](std::wstring& out, const FontFamily&, const FontInfo& f) { AppendHash(out, f.contentHash); } },
+        { L"tablesHash", true, TEMPLATE_HASHES, 0, nullptr, [](std::wstring& out, const FontFamily&, const FontInfo& f) { AppendHash(out, f.tablesHash); } },
+        { L"unitsPerEm", true, TEMPLATE_METRICS, METRICS_HEAD, [](const FontFamily&, const FontInfo& f) -> int64_t { return f.metrics.unitsPerEm; }, nullptr },
+        { L"fontRevision", true, TEMPLATE_METRICS, METRICS_HEAD, nullptr, [](std::wstring& out, const FontFamily&, const FontInfo& f)
+            {
+                // 16.16 fixed to three decimals, as font editors show it
+                static const TextFormat::Field kInteger = {};
+                static const TextFormat::Field kDecimals = { 0, 0, false, false, 3 };
+                uint32_t whole = f.metrics.fontRevision >> 16;
+                uint32_t decimals = ((f.metrics.fontRevision & 0xFFFF) * 1000 + 0x8000) >> 16;
+                if (decimals == 1000)
+                {
+                    ++whole;
+                    decimals = 0;
+                }
+                AppendInteger(out, whole, false, kInteger);
+                out += L'.';
+                AppendInteger(out, decimals, false, kDecimals);
+            } },
+        { L"xMin", true, TEMPLATE_METRICS, METRICS_HEAD, [](const FontFamily&, const FontInfo& f) -> int64_t { return f.metrics.xMin; }, nullptr },
+        { L"yMin", true, TEMPLATE_METRICS, METRICS_HEAD, [](const FontFamily&, const FontInfo& f) -> int64_t { return f.metrics.yMin; }, nullptr },
+        { L"xMax", true, TEMPLATE_METRICS, METRICS_HEAD, [](const FontFamily&, const FontInfo& f) -> int64_t { return f.metrics.xMax; }, nullptr },
+        { L"yMax", true, TEMPLATE_METRICS, METRICS_HEAD, [](const FontFamily&, const FontInfo& f) -> int64_t { return f.metrics.yMax; }, nullptr },
+        { L"ascender", true, TEMPLATE_METRICS, METRICS_HHEA, [](const FontFamily&, const FontInfo& f) -> int64_t { return f.metrics.ascender; }, nullptr },
+        { L"descender", true, TEMPLATE_METRICS, METRICS_HHEA, [](const FontFamily&, const FontInfo& f) -> int64_t { return f.metrics.descender; }, nullptr },
+        { L"lineGap", true, TEMPLATE_METRICS, METRICS_HHEA, [](const FontFamily&, const FontInfo& f) -> int64_t { return f.metrics.lineGap; }, nullptr },
+        { L"typoAscender", true, TEMPLATE_METRICS, METRICS_OS2, [](const FontFamily&, const FontInfo& f) -> int64_t { return f.metrics.typoAscender; }, nullptr },
+        { L"typoDescender", true, TEMPLATE_METRICS, METRICS_OS2, [](const FontFamily&, const FontInfo& f) -> int64_t { return f.metrics.typoDescender; }, nullptr },
+        { L"typoLineGap", true, TEMPLATE_METRICS, METRICS_OS2, [](const FontFamily&, const FontInfo& f) -> int64_t { return f.metrics.typoLineGap; }, nullptr },
+        { L"useTypoMetrics", true, TEMPLATE_METRICS, METRICS_OS2, [](const FontFamily&, const FontInfo& f) -> int64_t { return (f.metrics.flags & METRICS_USE_TYPO) ? 1 : 0; }, nullptr },
+        { L"winAscent", true, TEMPLATE_METRICS, METRICS_OS2, [](const FontFamily&, const FontInfo& f) -> int64_t { return f.metrics.winAscent; }, nullptr },
+        { L"winDescent", true, TEMPLATE_METRICS, METRICS_OS2, [](const FontFamily&, const FontInfo& f) -> int64_t { return f.metrics.winDescent; }, nullptr },
+        { L"vertical", true, TEMPLATE_METRICS, 0, [](const FontFamily&, const FontInfo& f) -> int64_t { return (f.metrics.flags & METRICS_VHEA) ? 1 : 0; }, nullptr },
+        { L"vertAscender", true, TEMPLATE_METRICS, METRICS_VHEA, [](const FontFamily&, const FontInfo& f) -> int64_t { return f.metrics.vertAscender; }, nullptr },
+        { L"vertDescender", true, TEMPLATE_METRICS, METRICS_VHEA, [](const FontFamily&, const FontInfo& f) -> int64_t { return f.metrics.vertDescender; }, nullptr },
+        { L"vertLineGap", true, TEMPLATE_METRICS, METRICS_VHEA, [](const FontFamily&, const FontInfo& f) -> int64_t { return f.metrics.vertLineGap; }, nullptr },
+        { L"color", true, TEMPLATE_METRICS, 0, nullptr, [](std::wstring& out, const FontFamily&, const FontInfo& f) { out += FormatColorInfo(f.color); } },
+        { L"palettes", true, TEMPLATE_METRICS, 0, [](const FontFamily&, const FontInfo& f) -> int64_t { return f.color.paletteCount; }, nullptr },
+        { L"svgDocuments", true, TEMPLATE_METRICS, 0, [](const FontFamily&, const FontInfo& f) -> int64_t { return f.color.svgDocumentCount; }, nullptr },
+        { L"embedding", true, TEMPLATE_METRICS, 0, nullptr, [](std::wstring& out, const FontFamily&, const FontInfo& f) { out += EmbeddingLevelName(f.license.embedding); } },
+        { L"fsType", true, TEMPLATE_METRICS, METRICS_OS2, [](const FontFamily&, const FontInfo& f) -> int64_t { return f.license.fsType; }, nullptr },
+        { L"vendor", true, TEMPLATE_METRICS, 0, nullptr, [](std::wstring& out, const FontFamily&, const FontInfo& f)
+            {
+                if (f.license.vendorId != 0)
+                    AppendText(out, TagText{ f.license.vendorId });
+            } },
+        { L"licenseDescription", true, TEMPLATE_LICENSE, 0, nullptr, [](std::wstring& out, const FontFamily&, const FontInfo& f) { out += f.license.description; } },
+        { L"licenseUrl", true, TEMPLATE_LICENSE, 0, nullptr, [](std::wstring& out, const FontFamily&, const FontInfo& f) { out += f.license.url; } },
+        { L"unicodeScripts", true, TEMPLATE_SCRIPTS, 0, nullptr, [](std::wstring& out, const FontFamily&, const FontInfo& f)
+            {
+                for (size_t i = 0; i < f.unicodeScripts.size(); ++i)
+                {
+                    if (i)
+                        out += L',';
+                    AppendText(out, TagText{ f.unicodeScripts[i] });
+                }
+            } },
+        { L"layout", true, TEMPLATE_PATHS | TEMPLATE_LAYOUT, 0, nullptr, [](std::wstring& out, const FontFamily&, const FontInfo& f)
+            {
+                if (!f.layout)
+                    return;
+                // Without the space AppendLayout puts before each script
+                size_t start = out.size();
+                AppendLayout(out, *f.layout);
+                out.erase(start, 1);
+            } },
+    };
+
+    bool FindField(const std::wstring& name, size_t& index)
+    {
+        for (size_t i = 0; i < sizeof(kFields) / sizeof(kFields[0]); ++i)
+        {
+            if (name == kFields[i].name)
+            {
+                index = i;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // "x", "X8" or "2" after the colon of an integer field, as in TextFormat
+    bool ParseFieldFormat(const std::wstring& text, TextFormat::Field& format)
+    {
+        size_t i = 0;
+        if (i < text.size() && (text[i] == L'x' || text[i] == L'X'))
+        {
+            format.hex = true;
+            format.upper = text[i] == L'X';
+            ++i;
+        }
+        for (; i < text.size(); ++i)
+        {
+            if (text[i] < L'0' || text[i] > L'9')
+                return false;
+            format.width = (uint8_t)(format.width * 10 + (text[i] - L'0'));
+            if (format.width > TextFormat::kMaxWidth)
+                return false;
+        }
+        return true;
+    }
+
+    void RunSteps(std::wstring& out, const OutputTemplate& format, const FontFamily& family, const FontInfo& font)
+    {
+        const wchar_t* literals = format.literals.data();
+        for (const auto& step : format.steps)
+        {
+            out.append(literals + step.literalStart, step.literalLength);
+            if (step.field == SIZE_MAX)
+                continue;
+            const TemplateField& field = kFields[step.field];
+            if ((font.metrics.flags & field.requiredTables) != field.requiredTables)
+                continue;
+            if (field.number)
+                AppendField(out, step.format, field.number(family, font));
+            else
+                field.text(out, family, font);
+        }
+        out += L'\n';
+    }
+}
+
+bool ParseOutputTemplate(const std::wstring& text, bool allowFontFields, OutputTemplate& result, std::wstring& error)
+{
+    OutputTemplate parsed;
+    parsed.given = true;
+    TemplateStep step;
+    for (size_t i = 0; i < text.size(); ++i)
+    {
+        wchar_t c = text[i];
+        wchar_t next = i + 1 < text.size() ? text[i + 1] : L'\0';
+        if (c == L'\\' && (next == L'n' || next == L't' || next == L'\\'))
+        {
+            parsed.literals += next == L'n' ? L'\n' : next == L't' ? L'\t' : L'\\';
+            ++i;
+            continue;
+        }
+        if ((c == L'{' || c == L'}') && next == c)
+        {
+            parsed.literals += c;
+            ++i;
+            continue;
+        }
+        if (c == L'}')
+        {
+            error = L"} without {, write }} for a brace";
+            return false;
+        }
+        if (c != L'{')
+        {
+            parsed.literals += c;
+            continue;
+        }
+
+        size_t close = text.find(L'}', i + 1);
+        if (close == std::wstring::npos)
+        {
+            error = L"{ without }, write {{ for a brace";
+            return false;
+        }
+        std::wstring placeholder = text.substr(i + 1, close - i - 1);
+        size_t colon = placeholder.find(L':');
+        std::wstring name = placeholder.substr(0, colon);
+        if (!FindField(name, step.field))
+        {
+            error = L"Unknown field {" + name + L"}";
+            return false;
+        }
+        const TemplateField& field = kFields[step.field];
+        if (field.font && !allowFontFields)
+        {
+            error = L"{" + name + L"} is a font field, family templates only take family fields";
+            return false;
+        }
+        if (colon != std::wstring::npos && (!field.number || !ParseFieldFormat(placeholder.substr(colon + 1), step.format)))
+        {
+            error = L"Invalid format in {" + placeholder + L"}, only integer fields take :x, :X and a width";
+            return false;
+        }
+        parsed.data |= field.data;
+        step.literalLength = parsed.literals.size() - step.literalStart;
+        parsed.steps.push_back(step);
+        step = TemplateStep();
+        step.literalStart = parsed.literals.size();
+        i = close;
+    }
+    step.literalLength = parsed.literals.size() - step.literalStart;
+    if (step.literalLength > 0)
+        parsed.steps.push_back(step);
+    result = std::move(parsed);
+    return true;
+}
+
+std::wstring TemplateFieldList()
+{
+    std::wstring list;
+    for (const auto& field : kFields)
+    {
+        if (!list.empty()) list += L", ";
+        list += field.name;
+    }
+    return list;
+}
+
+void AppendTemplateLine(std::wstring& out, const OutputTemplate& format, const FontFamily& family)
+{
+    // Family templates have no font fields, so nothing is read from this
+    static const FontInfo kNoFont = {};
+    RunSteps(out, format, family, kNoFont);
+}
+
+void AppendTemplateLine(std::wstring& out, const OutputTemplate& format, const FontFamily& family, const FontInfo& font)
+{
+    RunSteps(out, format, family, font);
+}
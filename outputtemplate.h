@@ -0,0 +1,54 @@
+// outputtemplate.h : --template/--family-header/--family-footer: listing lines shaped by the user
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "catalog.h"
+#include "textformat.h"
+
+// Scan data a template's fields need besides the names and style
+enum : uint8_t
+{
+    TEMPLATE_METRICS = 0x01,  // ScanOptions::readMetrics
+    TEMPLATE_HASHES = 0x02,   // ScanOptions::computeHashes
+    TEMPLATE_LICENSE = 0x04,  // ScanOptions::readLicense
+    TEMPLATE_SCRIPTS = 0x08,  // ScanOptions::readScripts
+    TEMPLATE_PATHS = 0x10,    // ScanOptions::resolvePaths
+    TEMPLATE_LAYOUT = 0x20,   // LoadLayoutInfo before listing
+};
+
+// One instruction: copy literal text, or write a field
+struct TemplateStep
+{
+    size_t literalStart = 0;
+    size_t literalLength = 0;
+    size_t field = SIZE_MAX;    // Index into the field table, SIZE_MAX for literal text only
+    TextFormat::Field format;   // hex and width of integer fields
+};
+
+// A template parsed into instructions once; writing a record runs them without looking at
+// the template text again
+struct OutputTemplate
+{
+    bool given = false;     // Set by ParseOutputTemplate; an empty template still writes a line
+    uint8_t data = 0;       // TEMPLATE_*
+    std::wstring literals;  // Literal text of all steps, escapes resolved
+    std::vector<TemplateStep> steps;
+};
+
+// Parse text with {field} placeholders, e.g. "{family};{name};{weight}". Integer fields take
+// the formats of TextFormat, like {fsType:X4} or {weight:4}. {{ and }} write a brace, \n, \t
+// and \\ a line break, tab and backslash. Font fields are rejected unless allowFontFields
+// (family header and footer templates). On failure error says what is wrong.
+bool ParseOutputTemplate(const std::wstring& text, bool allowFontFields, OutputTemplate& result, std::wstring& error);
+
+// Comma-separated list of the field names, family fields first
+std::wstring TemplateFieldList();
+
+// Write one line for a family (header and footer templates) or a font of it. Fields from a
+// table the font lacks are written empty.
+void AppendTemplateLine(std::wstring& out, const OutputTemplate& format, const FontFamily& family);
+void AppendTemplateLine(std::wstring& out, const OutputTemplate& format, const FontFamily& family, const FontInfo& font);
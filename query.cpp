@@ -0,0 +1,215 @@
+// query.cpp : --where/--feature/--script filters over font fields (style, metrics, color, license, layout)
+//
+
+#include "query.h"
+#include <algorithm>
+#include <cwchar>
+#include "fontfile.h"
+
+namespace
+{
+    struct QueryField
+    {
+        const wchar_t* name;
+        uint8_t requiredTables;  // METRICS_* flags the value comes from (0 = always available)
+        int64_t (*get)(const FontInfo& font);
+        bool layout = false;     // Value comes from LoadLayoutInfo
+    };
+
+    const QueryField kFields[] = {
+        { L"weight", 0, [](const FontInfo& f) -> int64_t { return f.weight; } },
+        { L"stretch", 0, [](const FontInfo& f) -> int64_t { return f.stretch; } },
+        { L"style", 0, [](const FontInfo& f) -> int64_t { return f.style; } },
+        { L"unitsPerEm", METRICS_HEAD, [](const FontInfo& f) -> int64_t { return f.metrics.unitsPerEm; } },
+        { L"xMin", METRICS_HEAD, [](const FontInfo& f) -> int64_t { return f.metrics.xMin; } },
+        { L"yMin", METRICS_HEAD, [](const FontInfo& f) -> int64_t { return f.metrics.yMin; } },
+        { L"xMax", METRICS_HEAD, [](const FontInfo& f) -> int64_t { return f.metrics.xMax; } },
+        { L"yMax", METRICS_HEAD, [](const FontInfo& f) -> int64_t { return f.metrics.yMax; } },
+        { L"ascender", METRICS_HHEA, [](const FontInfo& f) -> int64_t { return f.metrics.ascender; } },
+        { L"descender", METRICS_HHEA, [](const FontInfo& f) -> int64_t { return f.metrics.descender; } },
+        { L"lineGap", METRICS_HHEA, [](const FontInfo& f) -> int64_t { return f.metrics.lineGap; } },
+        { L"typoAscender", METRICS_OS2, [](const FontInfo& f) -> int64_t { return f.metrics.typoAscender; } },
+        { L"typoDescender", METRICS_OS2, [](const FontInfo& f) -> int64_t { return f.metrics.typoDescender; } },
+        { L"typoLineGap", METRICS_OS2, [](const FontInfo& f) -> int64_t { return f.metrics.typoLineGap; } },
+        { L"useTypoMetrics", METRICS_OS2, [](const FontInfo& f) -> int64_t { return (f.metrics.flags & METRICS_USE_TYPO) ? 1 : 0; } },
+        { L"winAscent", METRICS_OS2, [](const FontInfo& f) -> int64_t { return f.metrics.winAscent; } },
+        { L"winDescent", METRICS_OS2, [](const FontInfo& f) -> int64_t { return f.metrics.winDescent; } },
+        { L"vertical", 0, [](const FontInfo& f) -> int64_t { return (f.metrics.flags & METRICS_VHEA) ? 1 : 0; } },
+        { L"vertAscender", METRICS_VHEA, [](const FontInfo& f) -> int64_t { return f.metrics.vertAscender; } },
+        { L"vertDescender", METRICS_VHEA, [](const FontInfo& f) -> int64_t { return f.metrics.vertDescender; } },
+        { L"vertLineGap", METRICS_VHEA, [](const FontInfo& f) -> int64_t { return f.metrics.vertLineGap; } },
+        { L"color", 0, [](const FontInfo& f) -> int64_t { return f.color.flags != 0 ? 1 : 0; } },
+        { L"colrV0", 0, [](const FontInfo& f) -> int64_t { return (f.color.flags & COLOR_COLR_V0) ? 1 : 0; } },
+        { L"colrV1", 0, [](const FontInfo& f) -> int64_t { return (f.color.flags & COLOR_COLR_V1) ? 1 : 0; } },
+        { L"palettes", 0, [](const FontInfo& f) -> int64_t { return f.color.paletteCount; } },
+        { L"svg", 0, [](const FontInfo& f) -> int64_t { return (f.color.flags & COLOR_SVG) ? 1 : 0; } },
+        { L"svgDocuments", 0, [](const FontInfo& f) -> int64_t { return f.color.svgDocumentCount; } },
+        { L"sbix", 0, [](const FontInfo& f) -> int64_t { return (f.color.flags & COLOR_SBIX) ? 1 : 0; } },
+        { L"cbdt", 0, [](const FontInfo& f) -> int64_t { return (f.color.flags & COLOR_CBDT) ? 1 : 0; } },
+        { L"strikes", 0, [](const FontInfo& f) -> int64_t { return (int64_t)f.color.strikeSizes.size(); } },
+        { L"embedding", 0, [](const FontInfo& f) -> int64_t { return (int64_t)f.license.embedding; } },
+        { L"fsType", METRICS_OS2, [](const FontInfo& f) -> int64_t { return f.license.fsType; } },
+        { L"noSubsetting", METRICS_OS2, [](const FontInfo& f) -> int64_t { return (f.license.fsType & FSTYPE_NO_SUBSETTING) ? 1 : 0; } },
+        { L"bitmapOnly", METRICS_OS2, [](const FontInfo& f) -> int64_t { return (f.license.fsType & FSTYPE_BITMAP_ONLY) ? 1 : 0; } },
+        { L"scripts", 0, [](const FontInfo& f) -> int64_t { return (int64_t)f.layout->scripts.size(); }, true },
+        { L"morx", 0, [](const FontInfo& f) -> int64_t { return f.layout->hasMorx ? 1 : 0; }, true },
+    };
+
+    bool FindField(const std::wstring& name, size_t& index)
+    {
+        for (size_t i = 0; i < sizeof(kFields) / sizeof(kFields[0]); ++i)
+        {
+            if (name == kFields[i].name)
+            {
+                index = i;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool IsLayoutCondition(const Condition& condition)
+    {
+        return condition.kind != ConditionKind::Field || kFields[condition.field].layout;
+    }
+
+    bool Matches(const FontInfo& font, const Condition& condition)
+    {
+        if (condition.kind == ConditionKind::Feature)
+            return font.layout->HasFeature(condition.feature, condition.script);
+        if (condition.kind == ConditionKind::Script)
+            return font.layout->FindScript(condition.script) != nullptr;
+
+        const QueryField& field = kFields[condition.field];
+        if ((font.metrics.flags & field.requiredTables) != field.requiredTables)
+            return false;
+
+        int64_t value = field.get(font);
+        switch (condition.op)
+        {
+        case CompareOp::Equal: return value == condition.value;
+        case CompareOp::NotEqual: return value != condition.value;
+        case CompareOp::Less: return value < condition.value;
+        case CompareOp::LessEqual: return value <= condition.value;
+        case CompareOp::Greater: return value > condition.value;
+        case CompareOp::GreaterEqual: return value >= condition.value;
+        }
+        return false;
+    }
+}
+
+bool ParseCondition(const std::wstring& text, Condition& condition)
+{
+    size_t opStart = text.find_first_of(L"=!<>");
+    if (opStart == std::wstring::npos || opStart == 0)
+        return false;
+
+    std::wstring field = text.substr(0, opStart);
+    size_t opLength = (opStart + 1 < text.size() && text[opStart + 1] == L'=') ? 2 : 1;
+    std::wstring op = text.substr(opStart, opLength);
+    if (op == L"=" || op == L"==") condition.op = CompareOp::Equal;
+    else if (op == L"!=") condition.op = CompareOp::NotEqual;
+    else if (op == L"<") condition.op = CompareOp::Less;
+    else if (op == L"<=") condition.op = CompareOp::LessEqual;
+    else if (op == L">") condition.op = CompareOp::Greater;
+    else if (op == L">=") condition.op = CompareOp::GreaterEqual;
+    else return false;
+
+    std::wstring value = text.substr(opStart + opLength);
+    if (value.empty())
+        return false;
+    wchar_t* end = nullptr;
+    condition.value = wcstoll(value.c_str(), &end, 10);
+    if (*end != L'\0')
+        return false;
+
+    condition.kind = ConditionKind::Field;
+    return FindField(field, condition.field);
+}
+
+bool ParseEmbeddableCondition(const std::wstring& text, Condition& condition)
+{
+    EmbeddingLevel level;
+    if (text == L"installable") level = EmbeddingLevel::Installable;
+    else if (text == L"editable") level = EmbeddingLevel::Editable;
+    else if (text == L"preview") level = EmbeddingLevel::Preview;
+    else return false;
+
+    // Levels are ordered from least restrictive, so a font allows every level after its own
+    condition.kind = ConditionKind::Field;
+    condition.op = CompareOp::LessEqual;
+    condition.value = (int64_t)level;
+    return FindField(L"embedding", condition.field);
+}
+
+std::wstring QueryFieldList()
+{
+    std::wstring list;
+    for (const auto& field : kFields)
+    {
+        if (!list.empty()) list += L", ";
+        list += field.name;
+    }
+    return list;
+}
+
+bool ParseFeatureCondition(const std::wstring& text, Condition& condition)
+{
+    size_t colon = text.find(L':');
+    condition.kind = ConditionKind::Feature;
+    condition.script = 0;
+    if (!ParseTag(text.substr(0, colon), condition.feature))
+        return false;
+    return colon == std::wstring::npos || ParseTag(text.substr(colon + 1), condition.script);
+}
+
+bool ParseScriptCondition(const std::wstring& text, Condition& condition)
+{
+    condition.kind = ConditionKind::Script;
+    return ParseTag(text, condition.script);
+}
+
+bool MatchesAll(FontInfo& font, const std::vector<Condition>& conditions)
+{
+    for (const auto& condition : conditions)
+    {
+        if (!IsLayoutCondition(condition) && !Matches(font, condition))
+            return false;
+    }
+    for (const auto& condition : conditions)
+    {
+        if (IsLayoutCondition(condition))
+        {
+            LoadLayoutInfo(font);
+            if (!Matches(font, condition))
+                return false;
+        }
+    }
+    return true;
+}
+
+bool NeedsLayout(const std::vector<Condition>& conditions)
+{
+    for (const auto& condition : conditions)
+    {
+        if (IsLayoutCondition(condition))
+            return true;
+    }
+    return false;
+}
+
+void FilterFonts(std::vector<FontFamily>& fontFamilies, const std::vector<Condition>& conditions)
+{
+    if (conditions.empty())
+        return;
+    for (auto& family : fontFamilies)
+    {
+        auto& fonts = family.fonts;
+        fonts.erase(std::remove_if(fonts.begin(), fonts.end(),
+                                   [&](FontInfo& font) { return !MatchesAll(font, conditions); }),
+                    fonts.end());
+    }
+    fontFamilies.erase(std::remove_if(fontFamilies.begin(), fontFamilies.end(),
+                                      [](const FontFamily& family) { return family.fonts.empty(); }),
+                       fontFamilies.end());
+}
@@ -0,0 +1,62 @@
+// query.h : --where/--feature/--script filters over font fields (style, metrics, color, license, layout)
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "catalog.h"
+
+enum class CompareOp
+{
+    Equal,
+    NotEqual,
+    Less,
+    LessEqual,
+    Greater,
+    GreaterEqual,
+};
+
+enum class ConditionKind
+{
+    Field,    // field op value
+    Feature,  // OpenType feature present (for a script)
+    Script,   // OpenType script present
+};
+
+struct Condition
+{
+    ConditionKind kind = ConditionKind::Field;
+    size_t field = 0;  // Index into the field table
+    CompareOp op = CompareOp::Equal;
+    int64_t value = 0;
+    uint32_t feature = 0;
+    uint32_t script = 0;  // 0 = any script
+};
+
+// Parse "field<op>value" with op one of = != < <= > >=, e.g. "unitsPerEm=2048"
+bool ParseCondition(const std::wstring& text, Condition& condition);
+
+// Parse "tnum" or "tnum:latn" (feature registered for that script)
+bool ParseFeatureCondition(const std::wstring& text, Condition& condition);
+
+// Parse a script tag such as "arab" or "deva"
+bool ParseScriptCondition(const std::wstring& text, Condition& condition);
+
+// Parse "installable", "editable" or "preview": fonts whose fsType allows embedding for that
+// use (an installable font may also be embedded for editing, and so on). Fonts without OS/2 never match.
+bool ParseEmbeddableCondition(const std::wstring& text, Condition& condition);
+
+// Comma-separated list of the field names accepted by ParseCondition
+std::wstring QueryFieldList();
+
+// A condition on a metric of a table the font lacks never matches. Cheap conditions are
+// checked first so GSUB/GPOS are only read for fonts that pass them.
+bool MatchesAll(FontInfo& font, const std::vector<Condition>& conditions);
+
+// True if any condition needs the GSUB/GPOS tags (and so the font files)
+bool NeedsLayout(const std::vector<Condition>& conditions);
+
+// Keep only fonts matching every condition, then drop families left empty
+void FilterFonts(std::vector<FontFamily>& fontFamilies, const std::vector<Condition>& conditions);
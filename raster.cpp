@@ -0,0 +1,233 @@
+// raster.cpp : Anti-aliased coverage rasterizer for glyph outlines
+//
+
+#include "raster.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define LISTFONT_RASTER_SSE2 1
+#else
+#define LISTFONT_RASTER_SSE2 0
+#endif
+
+namespace
+{
+    // Curves are split into enough lines that none strays more than kTolerance pixels
+    // from the curve. A quadratic's chord deviates by a quarter of its second difference
+    // and a cubic's by at most 3/4 of the larger of its two; n segments divide that by n^2.
+    constexpr float kTolerance = 0.0625f;
+    constexpr int kMaxSegments = 128;
+
+    int SegmentCount(float deviation)
+    {
+        float n = std::ceil(std::sqrt(deviation / kTolerance));
+        return n < 1 ? 1 : n > kMaxSegments ? kMaxSegments : (int)n;
+    }
+}
+
+void Rasterizer::Reset(int w, int h)
+{
+    width = std::max(w, 0);
+    height = std::max(h, 0);
+    stride = (size_t(width) + 2 + 3) & ~size_t(3);
+    area.assign(stride * size_t(height), 0.0f);
+}
+
+void Rasterizer::Line(float x0, float y0, float x1, float y1)
+{
+    if (y0 == y1 || height == 0 || !std::isfinite(x0 + y0 + x1 + y1)) return;
+
+    // Split at the canvas sides; parts outside become vertical edges along them, so
+    // area left of the canvas still reaches the row sum and area right of it is cut
+    float limit = float(width);
+    for (float side : { 0.0f, limit })
+    {
+        if ((x0 < side) != (x1 < side) && x0 != side && x1 != side)
+        {
+            float y = y0 + (side - x0) * (y1 - y0) / (x1 - x0);
+            Line(x0, y0, side, y);
+            Line(side, y, x1, y1);
+            return;
+        }
+    }
+    x0 = std::min(std::max(x0, 0.0f), limit);
+    x1 = std::min(std::max(x1, 0.0f), limit);
+
+    float direction = 1;
+    if (y0 > y1)
+    {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+        direction = -1;
+    }
+    if (y1 <= 0 || y0 >= float(height)) return;
+
+    float dxdy = (x1 - x0) / (y1 - y0);
+    float x = x0;
+    int yStart = 0;
+    // Clamped again per row: rounding after the split above can step a hair past a side
+    if (y0 < 0)
+        x = std::min(std::max(x - y0 * dxdy, 0.0f), limit);
+    else
+        yStart = (int)y0;
+    int yEnd = std::min(height, (int)std::ceil(y1));
+
+    for (int y = yStart; y < yEnd; ++y)
+    {
+        float* row = area.data() + size_t(y) * stride;
+        float dy = std::min(float(y + 1), y1) - std::max(float(y), y0);
+        float xNext = std::min(std::max(x + dxdy * dy, 0.0f), limit);
+        float d = dy * direction;
+        float left = std::min(x, xNext), right = std::max(x, xNext);
+        float leftFloor = std::floor(left);
+        int leftCell = (int)leftFloor;
+        int rightCell = (int)std::ceil(right);
+
+        if (rightCell <= leftCell + 1)
+        {
+            // Within one pixel: split by the mean x of the segment
+            float mid = 0.5f * (x + xNext) - leftFloor;
+            row[leftCell] += d - d * mid;
+            row[leftCell + 1] += d * mid;
+        }
+        else
+        {
+            // Across pixels: a triangle in the first, trapezoids in between, a triangle in the last
+            float s = 1 / (right - left);
+            float leftFraction = left - leftFloor;
+            float a0 = 0.5f * s * (1 - leftFraction) * (1 - leftFraction);
+            float rightFraction = right - float(rightCell) + 1;
+            float am = 0.5f * s * rightFraction * rightFraction;
+            row[leftCell] += d * a0;
+            if (rightCell == leftCell + 2)
+            {
+                row[leftCell + 1] += d * (1 - a0 - am);
+            }
+            else
+            {
+                float a1 = s * (1.5f - leftFraction);
+                row[leftCell + 1] += d * (a1 - a0);
+                for (int cell = leftCell + 2; cell < rightCell - 1; ++cell)
+                    row[cell] += d * s;
+                float a2 = a1 + float(rightCell - leftCell - 3) * s;
+                row[rightCell - 1] += d * (1 - a2 - am);
+            }
+            row[rightCell] += d * am;
+        }
+        x = xNext;
+    }
+}
+
+void Rasterizer::Quad(float x0, float y0, float cx, float cy, float x1, float y1)
+{
+    float devX = x0 - 2 * cx + x1, devY = y0 - 2 * cy + y1;
+    int n = SegmentCount(0.25f * std::sqrt(devX * devX + devY * devY));
+    float px = x0, py = y0;
+    for (int i = 1; i < n; ++i)
+    {
+        float t = float(i) / float(n), u = 1 - t;
+        float qx = u * u * x0 + 2 * u * t * cx + t * t * x1;
+        float qy = u * u * y0 + 2 * u * t * cy + t * t * y1;
+        Line(px, py, qx, qy);
+        px = qx;
+        py = qy;
+    }
+    Line(px, py, x1, y1);
+}
+
+void Rasterizer::Cubic(float x0, float y0, float c1x, float c1y, float c2x, float c2y, float x1, float y1)
+{
+    float dev1X = x0 - 2 * c1x + c2x, dev1Y = y0 - 2 * c1y + c2y;
+    float dev2X = c1x - 2 * c2x + x1, dev2Y = c1y - 2 * c2y + y1;
+    int n = SegmentCount(0.75f * std::sqrt(std::max(dev1X * dev1X + dev1Y * dev1Y, dev2X * dev2X + dev2Y * dev2Y)));
+    float px = x0, py = y0;
+    for (int i = 1; i < n; ++i)
+    {
+        float t = float(i) / float(n), u = 1 - t;
+        float a = u * u * u, b = 3 * u * u * t, c = 3 * u * t * t, e = t * t * t;
+        float qx = a * x0 + b * c1x + c * c2x + e * x1;
+        float qy = a * y0 + b * c1y + c * c2y + e * y1;
+        Line(px, py, qx, qy);
+        px = qx;
+        py = qy;
+    }
+    Line(px, py, x1, y1);
+}
+
+void Rasterizer::Accumulate(uint8_t* coverage, size_t pitch)
+{
+    for (int y = 0; y < height; ++y)
+    {
+        float* row = area.data() + size_t(y) * stride;
+        uint8_t* out = coverage + size_t(y) * pitch;
+        float sum = 0;
+        int x = 0;
+#if LISTFONT_RASTER_SSE2
+        // Prefix sum of four cells at a time: two shifted adds, then the carry from the last group
+        const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+        const __m128 one = _mm_set1_ps(1.0f), scale = _mm_set1_ps(255.0f);
+        __m128 carry = _mm_setzero_ps();
+        for (; x + 4 <= width; x += 4)
+        {
+            __m128 v = _mm_loadu_ps(row + x);
+            v = _mm_add_ps(v, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 4)));
+            v = _mm_add_ps(v, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 8)));
+            v = _mm_add_ps(v, carry);
+            carry = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3));
+            __m128i level = _mm_cvtps_epi32(_mm_mul_ps(_mm_min_ps(_mm_and_ps(v, absMask), one), scale));
+            level = _mm_packs_epi32(level, level);
+            int32_t bytes = _mm_cvtsi128_si32(_mm_packus_epi16(level, level));
+            memcpy(out + x, &bytes, 4);
+        }
+        sum = _mm_cvtss_f32(carry);
+#endif
+        for (; x < width; ++x)
+        {
+            sum += row[x];
+            out[x] = (uint8_t)(std::min(std::fabs(sum), 1.0f) * 255.0f + 0.5f);
+        }
+        std::fill(row, row + stride, 0.0f);
+    }
+}
+
+void RasterSink::MoveTo(float x, float y)
+{
+    Close();
+    startX = lastX = X(x);
+    startY = lastY = Y(y);
+}
+
+void RasterSink::LineTo(float x, float y)
+{
+    float px = X(x), py = Y(y);
+    raster.Line(lastX, lastY, px, py);
+    lastX = px;
+    lastY = py;
+}
+
+void RasterSink::QuadTo(float cx, float cy, float x, float y)
+{
+    float px = X(x), py = Y(y);
+    raster.Quad(lastX, lastY, X(cx), Y(cy), px, py);
+    lastX = px;
+    lastY = py;
+}
+
+void RasterSink::CubicTo(float c1x, float c1y, float c2x, float c2y, float x, float y)
+{
+    float px = X(x), py = Y(y);
+    raster.Cubic(lastX, lastY, X(c1x), Y(c1y), X(c2x), Y(c2y), px, py);
+    lastX = px;
+    lastY = py;
+}
+
+void RasterSink::Close()
+{
+    if (lastX != startX || lastY != startY)
+        raster.Line(lastX, lastY, startX, startY);
+    lastX = startX;
+    lastY = startY;
+}
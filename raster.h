@@ -0,0 +1,56 @@
+// raster.h : Anti-aliased coverage rasterizer for glyph outlines
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "outline.h"
+
+// Accumulates the signed area every line segment covers in each pixel; a running sum
+// along each row then turns the area deltas into coverage (nonzero winding, with
+// overlapping contours saturating). Curves are flattened into lines first.
+struct Rasterizer
+{
+    int width = 0;
+    int height = 0;
+    size_t stride = 0;        // Cells per row: width plus two for segments ending at the right edge
+    std::vector<float> area;
+
+    // Clear to an empty width x height canvas; the buffer is reused across calls
+    void Reset(int w, int h);
+
+    // Pixel coordinates with y pointing down; points outside the canvas are clamped
+    void Line(float x0, float y0, float x1, float y1);
+    void Quad(float x0, float y0, float cx, float cy, float x1, float y1);
+    void Cubic(float x0, float y0, float c1x, float c1y, float c2x, float c2y, float x1, float y1);
+
+    // Coverage as 0-255, one byte per pixel, rows pitch bytes apart. Clears the canvas.
+    void Accumulate(uint8_t* coverage, size_t pitch);
+};
+
+// Draws font-unit outlines onto a rasterizer: scaled, flipped so y points down and
+// offset so the glyph origin lands at (originX, originY) in pixels
+struct RasterSink : PathSink
+{
+    Rasterizer& raster;
+    float scale;
+    float originX, originY;
+    float startX = 0, startY = 0;  // Current contour start, in pixels
+    float lastX = 0, lastY = 0;
+
+    RasterSink(Rasterizer& target, float pixelsPerUnit, float x, float y)
+        : raster(target), scale(pixelsPerUnit), originX(x), originY(y)
+    {
+    }
+
+    float X(float x) const { return originX + x * scale; }
+    float Y(float y) const { return originY - y * scale; }
+
+    void MoveTo(float x, float y) override;
+    void LineTo(float x, float y) override;
+    void QuadTo(float cx, float cy, float x, float y) override;
+    void CubicTo(float c1x, float c1y, float c2x, float c2y, float x, float y) override;
+    void Close() override;
+};
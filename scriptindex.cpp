@@ -0,0 +1,79 @@
+// scriptindex.cpp : Script/language support index from catalog families
+//
+
+#include "scriptindex.h"
+#include <algorithm>
+#include <iterator>
+#include "trace.h"
+
+namespace
+{
+    // Families are visited in id order, so appending keeps every list sorted
+    void AddFamily(std::vector<uint32_t>& families, uint32_t id)
+    {
+        if (families.empty() || families.back() != id)
+            families.push_back(id);
+    }
+
+    template <typename Key>
+    const std::vector<uint32_t>* Find(const std::map<Key, std::vector<uint32_t>>& map, Key key)
+    {
+        auto it = map.find(key);
+        return it != map.end() ? &it->second : nullptr;
+    }
+
+    // ISO 15924 codes start with an uppercase letter, OpenType script tags are lowercase
+    bool IsUnicodeScriptCode(uint32_t tag)
+    {
+        uint32_t first = tag >> 24;
+        return first >= 'A' && first <= 'Z';
+    }
+}
+
+ScriptIndex BuildScriptIndex(const std::vector<FontFamily>& fontFamilies)
+{
+    TraceScope trace("BuildScriptIndex");
+    ScriptIndex index;
+    for (uint32_t id = 0; id < (uint32_t)fontFamilies.size(); ++id)
+    {
+        for (const auto& font : fontFamilies[id].fonts)
+        {
+            for (uint32_t script : font.unicodeScripts)
+                AddFamily(index.unicodeScripts[script], id);
+            if (!font.layout)
+                continue;
+            for (const auto& script : font.layout->scripts)
+            {
+                AddFamily(index.layoutScripts[script.script], id);
+                for (uint32_t language : script.languages)
+                {
+                    AddFamily(index.languages[(uint64_t(script.script) << 32) | language], id);
+                    AddFamily(index.languages[language], id);
+                }
+            }
+        }
+    }
+    return index;
+}
+
+std::vector<uint32_t> QueryScriptIndex(const ScriptIndex& index, uint32_t script, uint32_t language)
+{
+    bool unicode = IsUnicodeScriptCode(script);
+    const std::vector<uint32_t>* scriptFamilies = unicode ? Find(index.unicodeScripts, script)
+                                                          : Find(index.layoutScripts, script);
+    if (!scriptFamilies)
+        return {};
+    if (language == 0)
+        return *scriptFamilies;
+
+    // A Unicode script has no language systems of its own: accept the language under any OpenType script
+    const std::vector<uint32_t>* languageFamilies =
+        Find(index.languages, unicode ? uint64_t(language) : (uint64_t(script) << 32) | language);
+    if (!languageFamilies)
+        return {};
+
+    std::vector<uint32_t> result;
+    std::set_intersection(scriptFamilies->begin(), scriptFamilies->end(), languageFamilies->begin(),
+                          languageFamilies->end(), std::back_inserter(result));
+    return result;
+}
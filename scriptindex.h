@@ -0,0 +1,26 @@
+// scriptindex.h : Script/language support index from catalog families
+//
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <vector>
+#include "catalog.h"
+
+// Family ids are indices into the catalog's family list; every list is sorted
+struct ScriptIndex
+{
+    std::map<uint32_t, std::vector<uint32_t>> unicodeScripts;  // ISO 15924 ('Deva') from cmap coverage
+    std::map<uint32_t, std::vector<uint32_t>> layoutScripts;   // OpenType script ('dev2') from GSUB/GPOS
+    std::map<uint64_t, std::vector<uint32_t>> languages;       // OpenType script << 32 | language; script 0 = any
+
+    bool Empty() const { return unicodeScripts.empty() && layoutScripts.empty(); }
+};
+
+// Index fonts whose layout and unicodeScripts were read during the scan
+ScriptIndex BuildScriptIndex(const std::vector<FontFamily>& fontFamilies);
+
+// Families supporting script, given as an ISO 15924 code ('Deva') or an OpenType script
+// tag ('dev2'), and if language is non-zero also that OpenType language system ('HIN ')
+std::vector<uint32_t> QueryScriptIndex(const ScriptIndex& index, uint32_t script, uint32_t language);
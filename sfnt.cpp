@@ -0,0 +1,616 @@
+// sfnt.cpp : Portable reader for sfnt fonts (TrueType/OpenType, collections, WOFF, WOFF2)
+//
+
+#include "sfnt.h"
+#include <cstring>
+#include "codepage.h"
+#include "trace.h"
+#include "woff.h"
+
+bool FontContainer::Open(const uint8_t* bytes, size_t length)
+{
+    TraceScope trace("OpenContainer");
+    tablesRead = 0;
+    bytesRead = 0;
+    sparse = false;
+    incomplete = false;
+    file = ByteSpan(bytes, length);
+    kind = ContainerKind::Unknown;
+    faceOffsets.clear();
+    tables.clear();
+    decoded.clear();
+    woff2.reset();
+    if (!bytes || !file.Has(0, 12)) return false;
+
+    uint32_t signature = file.U32(0);
+    switch (signature)
+    {
+    case 0x00010000:
+    case MakeTag('O', 'T', 'T', 'O'):
+    case MakeTag('t', 'r', 'u', 'e'):
+    case MakeTag('t', 'y', 'p', '1'):
+        kind = ContainerKind::Sfnt;
+        faceOffsets.push_back(0);
+        break;
+    case MakeTag('t', 't', 'c', 'f'):
+    {
+        uint32_t numFonts = file.U32(8);
+        ByteSpan offsets = file.Array(12, numFonts, 4);
+        if (numFonts == 0 || offsets.Empty()) return false;
+        kind = ContainerKind::Collection;
+        for (uint32_t i = 0; i < numFonts; ++i)
+        {
+            faceOffsets.push_back(offsets.U32(i * 4));
+        }
+        break;
+    }
+    case MakeTag('w', 'O', 'F', 'F'):
+        kind = ContainerKind::Woff;
+        if (!ParseWoffHeader(*this)) return false;
+        break;
+    case MakeTag('w', 'O', 'F', '2'):
+        kind = ContainerKind::Woff2;
+        if (!ParseWoff2Header(*this)) return false;
+        break;
+    default:
+        return false;
+    }
+    return SelectFace(0);
+}
+
+uint32_t FontContainer::FaceCount() const
+{
+    switch (kind)
+    {
+    case ContainerKind::Sfnt:
+    case ContainerKind::Collection:
+        return (uint32_t)faceOffsets.size();
+    case ContainerKind::Woff:
+        return 1;
+    case ContainerKind::Woff2:
+        return (uint32_t)woff2Faces.size();
+    default:
+        return 0;
+    }
+}
+
+bool FontContainer::SelectFace(uint32_t index)
+{
+    if (index >= FaceCount()) return false;
+
+    if (kind == ContainerKind::Woff)
+    {
+        // WOFF holds a single face whose directory was read with the header
+        return true;
+    }
+
+    tables.clear();
+    if (kind == ContainerKind::Woff2)
+    {
+        for (uint16_t tableIndex : woff2Faces[index])
+        {
+            tables.push_back(woff2Tables[tableIndex]);
+        }
+        return true;
+    }
+
+    ByteSpan header = file.Sub(faceOffsets[index], 12);
+    if (header.Empty()) return false;
+    flavor = header.U32(0);
+    uint16_t numTables = header.U16(4);
+    ByteSpan records = file.Array(faceOffsets[index] + 12, numTables, 16);
+    if (records.Empty() && numTables > 0) return false;
+
+    for (uint16_t i = 0; i < numTables; ++i)
+    {
+        size_t record = size_t(i) * 16;
+        TableEntry entry;
+        entry.tag = records.U32(record);
+        entry.checksum = records.U32(record + 4);
+        entry.offset = records.U32(record + 8);
+        entry.length = records.U32(record + 12);
+        entry.storedLength = entry.length;
+        tables.push_back(entry);
+    }
+    return true;
+}
+
+// Table bytes of a sparse container: inside the header bytes, or inside one of the file
+// ranges read separately (a range may cover several adjacent tables)
+static ByteSpan LoadSparseTable(FontContainer& container, const TableEntry& entry, uint32_t length)
+{
+    if (length == 0)
+        return ByteSpan();
+    ByteSpan inHeader = container.file.Sub(entry.offset, length);
+    if (inHeader)
+        return inHeader;
+    auto it = container.decoded.upper_bound(entry.offset);
+    if (it != container.decoded.begin())
+    {
+        --it;
+        ByteSpan range(it->second.data(), it->second.size());
+        ByteSpan table = range.Sub(entry.offset - it->first, length);
+        if (table)
+            return table;
+    }
+    container.incomplete = true;
+    return ByteSpan();
+}
+
+const TableEntry* FontContainer::FindTable(uint32_t tag) const
+{
+    for (const auto& entry : tables)
+    {
+        if (entry.tag == tag)
+            return &entry;
+    }
+    return nullptr;
+}
+
+ByteSpan FontContainer::LoadTable(uint32_t tag)
+{
+    const TableEntry* entry = FindTable(tag);
+    if (!entry) return ByteSpan();
+    ++tablesRead;
+    bytesRead += entry->length;
+
+    switch (kind)
+    {
+    case ContainerKind::Sfnt:
+    case ContainerKind::Collection:
+        if (sparse)
+            return LoadSparseTable(*this, *entry, entry->length);
+        return file.Sub(entry->offset, entry->length);
+    case ContainerKind::Woff:
+        if (entry->storedLength == entry->length)
+        {
+            // Stored uncompressed
+            return file.Sub(entry->offset, entry->length);
+        }
+        else
+        {
+            // A prefix decoded by LoadTablePrefix is replaced by the whole table
+            auto it = decoded.find(entry->offset);
+            if (it == decoded.end() || it->second.size() != entry->length)
+            {
+                std::vector<uint8_t> table;
+                if (!DecodeWoffTable(*this, *entry, table)) return ByteSpan();
+                it = decoded.insert_or_assign(entry->offset, std::move(table)).first;
+            }
+            return ByteSpan(it->second.data(), it->second.size());
+        }
+    case ContainerKind::Woff2:
+        // Transformed glyf/loca/hmtx would need full reconstruction; the scanner never asks for them
+        if (!entry->transformed)
+        {
+            return DecodeWoff2Range(*this, entry->offset, entry->length);
+        }
+        return ByteSpan();
+    default:
+        return ByteSpan();
+    }
+}
+
+ByteSpan FontContainer::LoadTablePrefix(uint32_t tag, uint32_t length)
+{
+    const TableEntry* entry = FindTable(tag);
+    if (!entry) return ByteSpan();
+    if (length > entry->length) length = entry->length;
+    ++tablesRead;
+    bytesRead += length;
+
+    switch (kind)
+    {
+    case ContainerKind::Sfnt:
+    case ContainerKind::Collection:
+        if (sparse)
+            return LoadSparseTable(*this, *entry, length);
+        return file.Sub(entry->offset, length);
+    case ContainerKind::Woff:
+        if (entry->storedLength == entry->length)
+        {
+            return file.Sub(entry->offset, length);
+        }
+        else
+        {
+            auto it = decoded.find(entry->offset);
+            if (it == decoded.end() || it->second.size() < length)
+            {
+                std::vector<uint8_t> prefix;
+                if (!DecodeWoffTable(*this, *entry, prefix, length)) return ByteSpan();
+                it = decoded.insert_or_assign(entry->offset, std::move(prefix)).first;
+            }
+            return ByteSpan(it->second.data(), length);
+        }
+    case ContainerKind::Woff2:
+        if (!entry->transformed)
+        {
+            return DecodeWoff2Range(*this, entry->offset, length);
+        }
+        return ByteSpan();
+    default:
+        return ByteSpan();
+    }
+}
+
+std::vector<NameRecord> ParseNameTable(ByteSpan name)
+{
+    TraceScope trace("ParseNameTable");
+    std::vector<NameRecord> records;
+    if (!name.Has(0, 6)) return records;
+
+    uint16_t count = name.U16(2);
+    ByteSpan storage = name.From(name.U16(4));
+    ByteSpan recordArray = name.Array(6, count, 12);
+    if (recordArray.Empty()) return records;
+
+    records.reserve(count);
+    for (uint16_t i = 0; i < count; ++i)
+    {
+        size_t record = size_t(i) * 12;
+        ByteSpan text = storage.Sub(recordArray.U16(record + 10), recordArray.U16(record + 8));
+        if (!text)
+            continue;
+
+        NameRecord entry;
+        entry.platformId = recordArray.U16(record);
+        entry.encodingId = recordArray.U16(record + 2);
+        entry.languageId = recordArray.U16(record + 4);
+        entry.nameId = recordArray.U16(record + 6);
+        entry.text = text;
+        records.push_back(entry);
+    }
+    return records;
+}
+
+// UTF-16BE name strings are copied as-is where wchar_t is UTF-16 (Windows)
+// and combined into code points where it is UTF-32
+static void AppendUtf16BE(std::wstring& out, ByteSpan text)
+{
+    size_t units = text.size / 2;
+    out.reserve(out.size() + units);
+    for (size_t i = 0; i < units; ++i)
+    {
+        uint32_t unit = text.U16(i * 2);
+        if (sizeof(wchar_t) == 4 && unit >= 0xD800 && unit < 0xDC00 && i + 1 < units)
+        {
+            uint32_t low = text.U16((i + 1) * 2);
+            if (low >= 0xDC00 && low < 0xE000)
+            {
+                unit = 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00);
+                ++i;
+            }
+        }
+        out.push_back((wchar_t)unit);
+    }
+}
+
+std::wstring DecodeNameRecord(const NameRecord& record)
+{
+    std::wstring text;
+    NameEncoding encoding = NameRecordEncoding(record.platformId, record.encodingId);
+    if (encoding == NameEncoding::Utf16)
+        AppendUtf16BE(text, record.text);
+    else if (encoding != NameEncoding::Unsupported)
+        AppendCodepageText(text, encoding, record.text, record.platformId == 3);
+    return text;
+}
+
+// Higher is better; 0 means the record cannot be decoded. Legacy encodings come last: fonts
+// that have them usually carry Unicode records as well.
+static int NameRecordRank(const NameRecord& record)
+{
+    NameEncoding encoding = NameRecordEncoding(record.platformId, record.encodingId);
+    if (encoding == NameEncoding::Unsupported)
+        return 0;
+    if (encoding != NameEncoding::Utf16)
+        return 1;
+    if (record.platformId == 3)
+        return record.languageId == 0x0409 ? 4 : 3;
+    return 2;
+}
+
+NameText::NameText(const std::wstring& text)
+{
+    bytes.reserve(text.size() * 2);
+    for (wchar_t c : text)
+    {
+        uint32_t unit = (uint32_t)c;
+        if (unit >= 0x10000)
+        {
+            // UTF-32 wchar_t: back to a surrogate pair
+            unit -= 0x10000;
+            uint32_t high = 0xD800 + (unit >> 10);
+            bytes.push_back((char)(high >> 8));
+            bytes.push_back((char)(high & 0xFF));
+            unit = 0xDC00 + (unit & 0x3FF);
+        }
+        bytes.push_back((char)(unit >> 8));
+        bytes.push_back((char)(unit & 0xFF));
+    }
+}
+
+NameText::NameText(const NameRecord& record)
+{
+    if (NameRecordEncoding(record.platformId, record.encodingId) == NameEncoding::Utf16)
+        bytes.assign(reinterpret_cast<const char*>(record.text.data), record.text.size & ~size_t(1));
+    else
+        *this = NameText(DecodeNameRecord(record));
+}
+
+NameText NameText::FromUtf16BE(std::string bytes)
+{
+    NameText text;
+    text.bytes = std::move(bytes);
+    text.bytes.resize(text.bytes.size() & ~size_t(1));
+    return text;
+}
+
+std::wstring NameText::Text() const
+{
+    std::wstring text;
+    AppendTo(text);
+    return text;
+}
+
+void NameText::AppendTo(std::wstring& out) const
+{
+    AppendUtf16BE(out, ByteSpan(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size()));
+}
+
+void NameText::AppendUtf8(std::string& out) const
+{
+    size_t units = bytes.size() / 2;
+    auto unitAt = [&](size_t i) { return ((uint32_t)(uint8_t)bytes[i * 2] << 8) | (uint8_t)bytes[i * 2 + 1]; };
+    out.reserve(out.size() + units);
+    for (size_t i = 0; i < units; ++i)
+    {
+        uint32_t c = unitAt(i);
+        if (c >= 0xD800 && c < 0xE000)
+        {
+            uint32_t low = i + 1 < units ? unitAt(i + 1) : 0;
+            if (c < 0xDC00 && low >= 0xDC00 && low < 0xE000)
+            {
+                c = 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+                ++i;
+            }
+            else
+            {
+                c = 0xFFFD;
+            }
+        }
+        if (c < 0x80)
+        {
+            out.push_back((char)c);
+        }
+        else if (c < 0x800)
+        {
+            out.push_back((char)(0xC0 | (c >> 6)));
+            out.push_back((char)(0x80 | (c & 0x3F)));
+        }
+        else if (c < 0x10000)
+        {
+            out.push_back((char)(0xE0 | (c >> 12)));
+            out.push_back((char)(0x80 | ((c >> 6) & 0x3F)));
+            out.push_back((char)(0x80 | (c & 0x3F)));
+        }
+        else
+        {
+            out.push_back((char)(0xF0 | (c >> 18)));
+            out.push_back((char)(0x80 | ((c >> 12) & 0x3F)));
+            out.push_back((char)(0x80 | ((c >> 6) & 0x3F)));
+            out.push_back((char)(0x80 | (c & 0x3F)));
+        }
+    }
+}
+
+NameText NameText::Before(wchar_t c) const
+{
+    NameText part;
+    for (size_t i = 0; i + 1 < bytes.size(); i += 2)
+    {
+        if ((uint8_t)bytes[i] == ((uint32_t)c >> 8) && (uint8_t)bytes[i + 1] == ((uint32_t)c & 0xFF))
+        {
+            part.bytes.assign(bytes, 0, i);
+            return part;
+        }
+    }
+    return *this;
+}
+
+bool NameText::operator==(const std::wstring& text) const
+{
+    // Compared unit by unit; only a name with a surrogate pair needs the encoded copy
+    if (bytes.size() != text.size() * 2)
+        return sizeof(wchar_t) == 4 && *this == NameText(text);
+    for (size_t i = 0; i < text.size(); ++i)
+    {
+        uint32_t unit = ((uint32_t)(uint8_t)bytes[i * 2] << 8) | (uint8_t)bytes[i * 2 + 1];
+        if (unit != (uint32_t)text[i])
+            return false;
+    }
+    return true;
+}
+
+void AppendText(std::wstring& out, const NameText& text)
+{
+    text.AppendTo(out);
+}
+
+// The best decodable record for a name ID, or null
+static const NameRecord* FindNameRecord(const std::vector<NameRecord>& records, uint16_t nameId)
+{
+    const NameRecord* best = nullptr;
+    int bestRank = 0;
+    for (const auto& record : records)
+    {
+        if (record.nameId != nameId || record.text.Empty())
+            continue;
+        int rank = NameRecordRank(record);
+        if (rank > bestRank)
+        {
+            best = &record;
+            bestRank = rank;
+        }
+    }
+    return best;
+}
+
+std::wstring FindName(const std::vector<NameRecord>& records, uint16_t nameId)
+{
+    const NameRecord* best = FindNameRecord(records, nameId);
+    return best ? DecodeNameRecord(*best) : L"";
+}
+
+NameText FindNameText(const std::vector<NameRecord>& records, uint16_t nameId)
+{
+    const NameRecord* best = FindNameRecord(records, nameId);
+    return best ? NameText(*best) : NameText();
+}
+
+// Records that decode the same way and hold the same bytes give the same string
+static bool SameNameText(const NameRecord& a, const NameRecord& b)
+{
+    NameEncoding encoding = NameRecordEncoding(a.platformId, a.encodingId);
+    if (encoding != NameRecordEncoding(b.platformId, b.encodingId))
+        return false;
+    // Windows stores legacy encodings with zero bytes, Mac without
+    if (encoding != NameEncoding::Utf16 && a.platformId != b.platformId)
+        return false;
+    return a.text.size == b.text.size && memcmp(a.text.data, b.text.data, a.text.size) == 0;
+}
+
+std::vector<NameText> FindAllNames(const std::vector<NameRecord>& records, uint16_t nameId)
+{
+    std::vector<NameText> result;
+    std::vector<const NameRecord*> copied;
+    for (const auto& record : records)
+    {
+        if (record.nameId != nameId || NameRecordRank(record) == 0)
+            continue;
+        // Most languages repeat the English name; compare the record bytes before copying
+        bool repeated = false;
+        for (const NameRecord* earlier : copied)
+        {
+            if (SameNameText(*earlier, record))
+            {
+                repeated = true;
+                break;
+            }
+        }
+        if (repeated)
+            continue;
+        copied.push_back(&record);
+        NameText text(record);
+        if (text.Empty())
+            continue;
+        bool seen = false;
+        for (const auto& existing : result)
+        {
+            if (existing == text)
+            {
+                seen = true;
+                break;
+            }
+        }
+        if (!seen)
+            result.push_back(std::move(text));
+    }
+    return result;
+}
+
+FontStyle ReadFontStyle(ByteSpan os2, ByteSpan head)
+{
+    FontStyle style;
+    if (os2.Has(0, 64))
+    {
+        uint16_t weightClass = os2.U16(4);
+        uint16_t widthClass = os2.U16(6);
+        uint16_t fsSelection = os2.U16(62);
+        if (weightClass >= 1 && weightClass <= 999) style.weightClass = weightClass;
+        if (widthClass >= 1 && widthClass <= 9) style.widthClass = widthClass;
+        style.italic = (fsSelection & 0x0001) != 0;
+        style.oblique = (fsSelection & 0x0200) != 0;
+    }
+    else if (head.Has(0, 54))
+    {
+        uint16_t macStyle = head.U16(44);
+        style.weightClass = (macStyle & 0x0001) ? 700 : 400;
+        style.italic = (macStyle & 0x0002) != 0;
+    }
+    return style;
+}
+
+FontMetrics ReadFontMetrics(ByteSpan head, ByteSpan hhea, ByteSpan os2, ByteSpan vhea)
+{
+    FontMetrics metrics;
+    if (head.Has(0, 54))
+    {
+        metrics.flags |= METRICS_HEAD;
+        metrics.unitsPerEm = head.U16(18);
+        metrics.fontRevision = head.U32(4);
+        metrics.xMin = head.S16(36);
+        metrics.yMin = head.S16(38);
+        metrics.xMax = head.S16(40);
+        metrics.yMax = head.S16(42);
+    }
+    if (hhea.Has(0, 36))
+    {
+        metrics.flags |= METRICS_HHEA;
+        metrics.ascender = hhea.S16(4);
+        metrics.descender = hhea.S16(6);
+        metrics.lineGap = hhea.S16(8);
+    }
+    // Typo and win metrics are present from OS/2 version 0 (78 bytes) on
+    if (os2.Has(0, 78))
+    {
+        metrics.flags |= METRICS_OS2;
+        if (os2.U16(62) & 0x0080) metrics.flags |= METRICS_USE_TYPO;
+        metrics.typoAscender = os2.S16(68);
+        metrics.typoDescender = os2.S16(70);
+        metrics.typoLineGap = os2.S16(72);
+        metrics.winAscent = os2.U16(74);
+        metrics.winDescent = os2.U16(76);
+    }
+    if (vhea.Has(0, 36))
+    {
+        metrics.flags |= METRICS_VHEA;
+        metrics.vertAscender = vhea.S16(4);
+        metrics.vertDescender = vhea.S16(6);
+        metrics.vertLineGap = vhea.S16(8);
+    }
+    return metrics;
+}
+
+EmbeddingLevel EmbeddingLevelFromFsType(uint16_t fsType)
+{
+    if (fsType & 0x0008) return EmbeddingLevel::Editable;
+    if (fsType & 0x0004) return EmbeddingLevel::Preview;
+    if (fsType & 0x0002) return EmbeddingLevel::Restricted;
+    return EmbeddingLevel::Installable;
+}
+
+const wchar_t* EmbeddingLevelName(EmbeddingLevel level)
+{
+    switch (level)
+    {
+    case EmbeddingLevel::Installable: return L"installable";
+    case EmbeddingLevel::Editable: return L"editable";
+    case EmbeddingLevel::Preview: return L"preview";
+    case EmbeddingLevel::Restricted: return L"restricted";
+    default: return L"unknown";
+    }
+}
+
+FontLicense ReadFontLicense(ByteSpan os2)
+{
+    FontLicense license;
+    if (os2.Has(0, 10))
+    {
+        license.fsType = os2.U16(8);
+        license.embedding = EmbeddingLevelFromFsType(license.fsType);
+    }
+    if (os2.Has(0, 62))
+        license.vendorId = os2.U32(58);
+    return license;
+}
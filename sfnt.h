@@ -0,0 +1,204 @@
+// sfnt.h : Portable reader for sfnt fonts (TrueType/OpenType, collections, WOFF, WOFF2)
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "bytespan.h"
+
+constexpr uint32_t MakeTag(char a, char b, char c, char d)
+{
+    return (uint32_t(uint8_t(a)) << 24) | (uint32_t(uint8_t(b)) << 16) | (uint32_t(uint8_t(c)) << 8) | uint32_t(uint8_t(d));
+}
+
+enum class ContainerKind
+{
+    Unknown,
+    Sfnt,
+    Collection,
+    Woff,
+    Woff2,
+};
+
+struct TableEntry
+{
+    uint32_t tag = 0;
+    uint32_t checksum = 0;
+    uint32_t offset = 0;        // File offset (sfnt/WOFF) or offset in the decompressed stream (WOFF2)
+    uint32_t length = 0;        // Decoded table length
+    uint32_t storedLength = 0;  // Compressed length in WOFF/WOFF2, otherwise equal to length
+    bool transformed = false;   // WOFF2 glyf/loca/hmtx transform applied
+};
+
+struct Woff2Stream;
+
+// A font file opened in place. Tables are decoded lazily: plain sfnt tables are
+// returned as views into the file bytes, WOFF tables are inflated one at a time
+// and WOFF2 streams are only decompressed as far as the requested table ends.
+struct FontContainer
+{
+    ContainerKind kind = ContainerKind::Unknown;
+    ByteSpan file;                                    // Whole container bytes
+    uint32_t flavor = 0;                              // sfnt version of the selected face
+    std::vector<uint32_t> faceOffsets;                // sfnt/collection: table directory offsets
+    std::vector<TableEntry> woff2Tables;              // WOFF2: complete table directory
+    std::vector<std::vector<uint16_t>> woff2Faces;    // WOFF2: table indices of each face
+    std::vector<TableEntry> tables;                   // Tables of the selected face
+    std::map<uint32_t, std::vector<uint8_t>> decoded; // WOFF: inflated tables by offset; sparse: file ranges by offset
+    std::shared_ptr<Woff2Stream> woff2;               // WOFF2: decompressed stream prefix
+    uint32_t tablesRead = 0;                          // LoadTable/LoadTablePrefix calls since Open
+    uint64_t bytesRead = 0;                           // Decoded table bytes those calls returned
+    bool sparse = false;                              // sfnt/collection: file holds the directories, tables are in decoded
+    bool incomplete = false;                          // A sparse load asked for bytes that were not read
+
+    bool Open(const uint8_t* bytes, size_t length);
+    uint32_t FaceCount() const;
+    bool SelectFace(uint32_t index);
+    const TableEntry* FindTable(uint32_t tag) const;
+    ByteSpan LoadTable(uint32_t tag);
+    // The first length bytes of a table (fewer if it is shorter), for reading headers
+    // without decoding the rest of a compressed table
+    ByteSpan LoadTablePrefix(uint32_t tag, uint32_t length);
+};
+
+struct NameRecord
+{
+    uint16_t platformId;
+    uint16_t encodingId;
+    uint16_t languageId;
+    uint16_t nameId;
+    ByteSpan text;  // Encoded string bytes inside the name table
+};
+
+// Name IDs used by the scanner
+enum : uint16_t
+{
+    NAME_FAMILY = 1,
+    NAME_SUBFAMILY = 2,
+    NAME_FULL = 4,
+    NAME_POSTSCRIPT = 6,
+    NAME_LICENSE = 13,
+    NAME_LICENSE_URL = 14,
+    NAME_TYPOGRAPHIC_FAMILY = 16,
+    NAME_TYPOGRAPHIC_SUBFAMILY = 17,
+};
+
+std::vector<NameRecord> ParseNameTable(ByteSpan name);
+std::wstring DecodeNameRecord(const NameRecord& record);
+
+// A name string kept as UTF-16BE, the encoding of nearly all name records, and decoded only
+// when it is written out. Unicode records and catalogs are copied as they are; strings
+// from legacy records and DirectWrite are encoded once. Equal strings have equal bytes, so
+// names compare and sort without decoding, in UTF-16 code unit order.
+class NameText
+{
+public:
+    NameText() = default;
+    NameText(const std::wstring& text);
+    NameText(const wchar_t* text) : NameText(std::wstring(text)) {}
+    explicit NameText(const NameRecord& record);
+    static NameText FromUtf16BE(std::string bytes);
+
+    std::wstring Text() const;
+    void AppendTo(std::wstring& out) const;
+    // Straight to UTF-8; unpaired surrogates become U+FFFD like WideCharToMultiByte makes them
+    void AppendUtf8(std::string& out) const;
+    bool Empty() const { return bytes.empty(); }
+    const std::string& Bytes() const { return bytes; }
+
+    // Text before the first c (all of it without one), e.g. the family part of a PostScript name
+    NameText Before(wchar_t c) const;
+
+    bool operator==(const NameText& other) const { return bytes == other.bytes; }
+    bool operator!=(const NameText& other) const { return bytes != other.bytes; }
+    bool operator<(const NameText& other) const { return bytes < other.bytes; }
+    bool operator==(const std::wstring& text) const;
+    bool operator!=(const std::wstring& text) const { return !(*this == text); }
+
+private:
+    std::string bytes;
+};
+
+// For FormatTo
+void AppendText(std::wstring& out, const NameText& text);
+
+// Preferred string for a name ID (Windows en-US first, then any decodable record)
+std::wstring FindName(const std::vector<NameRecord>& records, uint16_t nameId);
+NameText FindNameText(const std::vector<NameRecord>& records, uint16_t nameId);
+
+// All distinct localized strings for a name ID
+std::vector<NameText> FindAllNames(const std::vector<NameRecord>& records, uint16_t nameId);
+
+struct FontStyle
+{
+    uint16_t weightClass = 400;
+    uint16_t widthClass = 5;
+    bool italic = false;
+    bool oblique = false;
+};
+
+// Weight/width/slope from OS/2, falling back to head.macStyle
+FontStyle ReadFontStyle(ByteSpan os2, ByteSpan head);
+
+// Line-layout metrics in design units. Fields of tables the face lacks stay zero;
+// flags records which tables were present.
+struct FontMetrics
+{
+    uint16_t unitsPerEm = 0;
+    uint32_t fontRevision = 0;                                     // head, 16.16 fixed
+    int16_t xMin = 0, yMin = 0, xMax = 0, yMax = 0;                // head bounding box
+    int16_t ascender = 0, descender = 0, lineGap = 0;              // hhea
+    int16_t typoAscender = 0, typoDescender = 0, typoLineGap = 0;  // OS/2
+    uint16_t winAscent = 0, winDescent = 0;                        // OS/2
+    int16_t vertAscender = 0, vertDescender = 0, vertLineGap = 0;  // vhea
+    uint8_t flags = 0;                                             // METRICS_*
+};
+
+enum : uint8_t
+{
+    METRICS_HEAD = 0x01,
+    METRICS_HHEA = 0x02,
+    METRICS_OS2 = 0x04,
+    METRICS_VHEA = 0x08,
+    METRICS_USE_TYPO = 0x10,  // OS/2 fsSelection USE_TYPO_METRICS
+};
+
+FontMetrics ReadFontMetrics(ByteSpan head, ByteSpan hhea, ByteSpan os2, ByteSpan vhea);
+
+// OS/2 fsType embedding permission, least restrictive first
+enum class EmbeddingLevel : uint8_t
+{
+    Installable,  // No restriction (fsType 0)
+    Editable,     // Embed for viewing and editing (bit 3)
+    Preview,      // Embed for preview and print only (bit 2)
+    Restricted,   // Must not be embedded (bit 1)
+    Unknown,      // No OS/2 table
+};
+
+enum : uint16_t
+{
+    FSTYPE_NO_SUBSETTING = 0x0100,
+    FSTYPE_BITMAP_ONLY = 0x0200,
+};
+
+// Licensing metadata: embedding permission and vendor from OS/2, license strings from name
+struct FontLicense
+{
+    EmbeddingLevel embedding = EmbeddingLevel::Unknown;
+    uint16_t fsType = 0;
+    uint32_t vendorId = 0;    // OS/2 achVendID as a tag (0 = not set)
+    std::wstring description; // name ID 13
+    std::wstring url;         // name ID 14
+};
+
+// Permission bits 1-3 are exclusive; when several are set the least restrictive applies
+EmbeddingLevel EmbeddingLevelFromFsType(uint16_t fsType);
+const wchar_t* EmbeddingLevelName(EmbeddingLevel level);
+
+// fsType and vendor only; the strings come from the name table (or DirectWrite)
+FontLicense ReadFontLicense(ByteSpan os2);
@@ -0,0 +1,446 @@
+// arrow_test.cpp : The Arrow IPC file and stream layouts, read back with a minimal reader
+//
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+#include "../arrowwriter.h"
+#include "../catalog.h"
+#include "check.h"
+
+namespace
+{
+    // Rows as the reader sees them: each cell as text (numbers in decimal), or null
+    using Cell = std::optional<std::string>;
+    using Table = std::vector<std::vector<Cell>>;
+
+    const char* const kColumnNames[] = { "family", "postScriptFamily", "face", "postScriptName", "weight", "stretch",
+                                         "style", "path", "faceIndex", "contentHash", "tablesHash", "unitsPerEm" };
+    const size_t kColumnCount = std::size(kColumnNames);
+
+    // More fonts than one record batch holds, with non-ASCII names and a null in every
+    // nullable column
+    std::vector<FontFamily> BuildCatalog()
+    {
+        std::vector<FontFamily> families(7000);
+        for (size_t i = 0; i < families.size(); ++i)
+        {
+            FontFamily& family = families[i];
+            family.primaryName = (i % 3 == 0 ? L"Caf\u00E9 \u5B57\u4F53 " : L"Family ") + std::to_wstring(i);
+            if (i % 5 != 0)
+                family.postScriptFamilyName = NameText(L"PsFamily" + std::to_wstring(i / 2));
+            for (uint32_t face = 0; face < 10; ++face)
+            {
+                FontInfo font = {};
+                font.name = NameText(face % 2 ? L"Bold" : L"Regular \u00C6");
+                if (face != 3)
+                    font.postScriptName = NameText(L"Ps-" + std::to_wstring(i) + L"-" + std::to_wstring(face));
+                font.weight = DWRITE_FONT_WEIGHT(100 * (face % 9 + 1));
+                font.stretch = DWRITE_FONT_STRETCH_NORMAL;
+                font.style = face % 4 == 1 ? DWRITE_FONT_STYLE_ITALIC : DWRITE_FONT_STYLE_NORMAL;
+                if (face != 7)
+                    font.filePath = L"/fonts/f" + std::to_wstring(i) + (face < 5 ? L".ttc" : L"b.ttc");
+                font.faceIndex = face % 5;
+                font.contentHash = face == 8 ? 0 : 0x9E3779B97F4A7C15ull * (i + 1);
+                font.tablesHash = face == 9 ? 0 : i * 10 + face + 1;
+                font.metrics.unitsPerEm = face == 2 ? 0 : 1000;
+                font.metrics.flags = face == 2 ? 0 : METRICS_HEAD;
+                family.fonts.push_back(font);
+            }
+        }
+        return families;
+    }
+
+    Cell Text(const std::wstring& text)
+    {
+        return text.empty() ? Cell() : Cell(WideToUtf8(text));
+    }
+
+    Cell Text(const NameText& text)
+    {
+        std::string utf8;
+        text.AppendUtf8(utf8);
+        return text.Empty() ? Cell() : Cell(utf8);
+    }
+
+    Cell Number(uint64_t value, bool present = true)
+    {
+        return present ? Cell(std::to_string(value)) : Cell();
+    }
+
+    Table ExpectedTable(const std::vector<FontFamily>& families)
+    {
+        Table table;
+        for (const auto& family : families)
+        {
+            for (const auto& font : family.fonts)
+            {
+                table.push_back({ Text(family.primaryName), Text(family.postScriptFamilyName), Text(font.name),
+                                  Text(font.postScriptName), Number(font.weight), Number(font.stretch),
+                                  Number(font.style), Text(font.filePath), Number(font.faceIndex),
+                                  Number(font.contentHash, font.contentHash != 0),
+                                  Number(font.tablesHash, font.tablesHash != 0),
+                                  Number(font.metrics.unitsPerEm, (font.metrics.flags & METRICS_HEAD) != 0) });
+            }
+        }
+        return table;
+    }
+
+    // Bounds-checked little-endian reads; out of range reads fail the test and return 0
+    struct Bytes
+    {
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+
+        bool Has(size_t offset, size_t length) const { return offset <= size && length <= size - offset; }
+
+        template <typename T>
+        T Get(size_t offset) const
+        {
+            T value = 0;
+            if (CHECK(Has(offset, sizeof(T))))
+                memcpy(&value, data + offset, sizeof(T));
+            return value;
+        }
+
+        Bytes Sub(size_t offset, size_t length) const
+        {
+            return CHECK(Has(offset, length)) ? Bytes{ data + offset, length } : Bytes();
+        }
+    };
+
+    // A FlatBuffers table: fields are found through the vtable the table starts by pointing to
+    struct FlatTable
+    {
+        Bytes buffer;
+        size_t position = 0;
+
+        static FlatTable Root(Bytes buffer) { return { buffer, buffer.Get<uint32_t>(0) }; }
+
+        size_t Field(uint16_t id) const
+        {
+            size_t vtable = position - buffer.Get<int32_t>(position);
+            uint16_t vtableSize = buffer.Get<uint16_t>(vtable);
+            if (4 + 2 * size_t(id) >= vtableSize)
+                return 0;
+            uint16_t offset = buffer.Get<uint16_t>(vtable + 4 + 2 * size_t(id));
+            return offset ? position + offset : 0;
+        }
+
+        template <typename T>
+        T Scalar(uint16_t id) const
+        {
+            size_t field = Field(id);
+            return field ? buffer.Get<T>(field) : T();
+        }
+
+        size_t Target(uint16_t id) const
+        {
+            size_t field = Field(id);
+            return field ? field + buffer.Get<uint32_t>(field) : 0;
+        }
+
+        FlatTable Table(uint16_t id) const { return { buffer, Target(id) }; }
+        bool Has(uint16_t id) const { return Field(id) != 0; }
+
+        // Position of the first element and the count
+        std::pair<size_t, uint32_t> Vector(uint16_t id) const
+        {
+            size_t vector = Target(id);
+            return vector ? std::make_pair(vector + 4, buffer.Get<uint32_t>(vector)) : std::make_pair(size_t(0), 0u);
+        }
+
+        FlatTable TableAt(size_t element) const { return { buffer, element + buffer.Get<uint32_t>(element) }; }
+
+        std::string String(uint16_t id) const
+        {
+            auto [start, length] = Vector(id);
+            Bytes text = buffer.Sub(start, length);
+            return std::string(reinterpret_cast<const char*>(text.data), text.size);
+        }
+    };
+
+    // Arrow format enums (Schema.fbs, Message.fbs)
+    const int16_t kMetadataV5 = 4;
+    const uint8_t kHeaderSchema = 1;
+    const uint8_t kHeaderDictionaryBatch = 2;
+    const uint8_t kHeaderRecordBatch = 3;
+    const uint8_t kTypeInt = 2;
+    const uint8_t kTypeUtf8 = 5;
+
+    struct Field
+    {
+        bool utf8 = false;    // Utf8 values, or dictionary indices into dictionary
+        int bits = 0;         // Int values
+        bool isSigned = false;
+        int64_t dictionary = -1;
+    };
+
+    std::vector<Field> ReadSchema(FlatTable schema)
+    {
+        std::vector<Field> fields;
+        auto [start, count] = schema.Vector(1);
+        CHECK(count == kColumnCount);
+        for (uint32_t i = 0; i < count && i < kColumnCount; ++i)
+        {
+            FlatTable field = schema.TableAt(start + 4 * i);
+            CHECK(field.String(0) == kColumnNames[i]);
+            uint8_t type = field.Scalar<uint8_t>(2);
+            CHECK(type == kTypeInt || type == kTypeUtf8);
+            Field out;
+            out.utf8 = type == kTypeUtf8;
+            if (!out.utf8)
+            {
+                out.bits = field.Table(3).Scalar<int32_t>(0);
+                out.isSigned = field.Table(3).Scalar<uint8_t>(1) != 0;
+            }
+            if (field.Has(4))
+            {
+                FlatTable encoding = field.Table(4);
+                out.dictionary = encoding.Scalar<int64_t>(0);
+                CHECK(out.utf8 && encoding.Table(1).Scalar<int32_t>(0) == 32 && encoding.Table(1).Scalar<uint8_t>(1) != 0);
+            }
+            fields.push_back(out);
+        }
+        return fields;
+    }
+
+    // Columns of one record batch; dictionaries maps ids to their values
+    struct BatchReader
+    {
+        FlatTable batch;
+        Bytes body;
+        size_t node = 0;
+        size_t buffer = 0;
+
+        int64_t Length() const { return batch.Scalar<int64_t>(0); }
+
+        Bytes NextBuffer()
+        {
+            auto [start, count] = batch.Vector(2);
+            if (!CHECK(buffer < count))
+                return Bytes();
+            int64_t offset = batch.buffer.Get<int64_t>(start + 16 * buffer);
+            int64_t length = batch.buffer.Get<int64_t>(start + 16 * buffer + 8);
+            ++buffer;
+            CHECK(offset % 8 == 0);
+            return body.Sub((size_t)offset, (size_t)length);
+        }
+
+        // Validity, then the cells; a missing bitmap means no nulls
+        std::vector<Cell> Column(const Field& field, const std::map<int64_t, std::vector<Cell>>& dictionaries)
+        {
+            auto [start, count] = batch.Vector(1);
+            if (!CHECK(node < count))
+                return {};
+            int64_t length = batch.buffer.Get<int64_t>(start + 16 * node);
+            int64_t nulls = batch.buffer.Get<int64_t>(start + 16 * node + 8);
+            ++node;
+            CHECK(length == Length());
+            Bytes validity = NextBuffer();
+            CHECK(validity.size == (nulls ? size_t(length + 7) / 8 : 0));
+            std::vector<Cell> cells((size_t)length);
+            Bytes values = NextBuffer();
+            Bytes text = field.utf8 && field.dictionary < 0 ? NextBuffer() : Bytes();
+            int64_t nullsSeen = 0;
+            for (size_t i = 0; i < cells.size(); ++i)
+            {
+                if (validity.size && !(validity.Get<uint8_t>(i / 8) & (1 << (i % 8))))
+                {
+                    ++nullsSeen;
+                    continue;
+                }
+                if (field.dictionary >= 0)
+                {
+                    int32_t index = values.Get<int32_t>(i * 4);
+                    const std::vector<Cell>& dictionary = dictionaries.at(field.dictionary);
+                    if (CHECK(index >= 0 && size_t(index) < dictionary.size()))
+                        cells[i] = dictionary[index];
+                }
+                else if (field.utf8)
+                {
+                    int32_t begin = values.Get<int32_t>(i * 4), end = values.Get<int32_t>(i * 4 + 4);
+                    Bytes utf8 = text.Sub((size_t)begin, size_t(end - begin));
+                    cells[i] = std::string(reinterpret_cast<const char*>(utf8.data), utf8.size);
+                }
+                else
+                {
+                    CHECK(!field.isSigned);
+                    uint64_t value = field.bits == 8 ? values.Get<uint8_t>(i) : field.bits == 16 ? values.Get<uint16_t>(i * 2)
+                                   : field.bits == 32 ? values.Get<uint32_t>(i * 4) : values.Get<uint64_t>(i * 8);
+                    cells[i] = std::to_string(value);
+                }
+            }
+            CHECK(nullsSeen == nulls);
+            return cells;
+        }
+    };
+
+    struct Message
+    {
+        uint8_t headerType = 0;
+        FlatTable header;
+        Bytes body;
+        size_t offset = 0;
+        size_t metadataLength = 0;  // With marker and length, as a footer block counts it
+    };
+
+    // Continuation marker, metadata length, metadata padded to 8 bytes and the body;
+    // false at the end-of-stream marker
+    bool ReadMessage(Bytes file, size_t& offset, Message& message)
+    {
+        CHECK(offset % 8 == 0);
+        if (!CHECK(file.Get<uint32_t>(offset) == 0xFFFFFFFF))
+            return false;
+        uint32_t length = file.Get<uint32_t>(offset + 4);
+        if (length == 0)
+        {
+            offset += 8;
+            return false;
+        }
+        CHECK(length % 8 == 0);
+        FlatTable root = FlatTable::Root(file.Sub(offset + 8, length));
+        CHECK(root.Scalar<int16_t>(0) == kMetadataV5);
+        int64_t bodyLength = root.Scalar<int64_t>(3);
+        CHECK(bodyLength % 8 == 0);
+        message.offset = offset;
+        message.metadataLength = 8 + length;
+        message.headerType = root.Scalar<uint8_t>(1);
+        message.header = root.Table(2);
+        message.body = file.Sub(offset + 8 + length, (size_t)bodyLength);
+        offset += 8 + length + (size_t)bodyLength;
+        return true;
+    }
+
+    // Schema, dictionary batches, record batches and end-of-stream, as both formats have them
+    // from the first message on; messages gets each one's place for the footer check
+    Table ReadMessages(Bytes file, size_t offset, std::vector<Message>& messages)
+    {
+        Message message;
+        if (!CHECK(ReadMessage(file, offset, message) && message.headerType == kHeaderSchema))
+            return {};
+        messages.push_back(message);
+        std::vector<Field> fields = ReadSchema(message.header);
+
+        Table table;
+        std::map<int64_t, std::vector<Cell>> dictionaries;
+        while (ReadMessage(file, offset, message))
+        {
+            messages.push_back(message);
+            if (message.headerType == kHeaderDictionaryBatch)
+            {
+                // Every dictionary ahead of the first record batch, in id order
+                int64_t id = message.header.Scalar<int64_t>(0);
+                CHECK(table.empty() && id == (int64_t)dictionaries.size() && !message.header.Scalar<uint8_t>(2));
+                Field utf8;
+                utf8.utf8 = true;
+                BatchReader reader{ message.header.Table(1), message.body };
+                dictionaries[id] = reader.Column(utf8, dictionaries);
+                continue;
+            }
+            if (!CHECK(message.headerType == kHeaderRecordBatch))
+                break;
+            BatchReader reader{ message.header, message.body };
+            CHECK(reader.Length() > 0 && reader.Length() <= 65536);
+            std::vector<std::vector<Cell>> columns;
+            for (const Field& field : fields)
+                columns.push_back(reader.Column(field, dictionaries));
+            for (size_t row = 0; row < (size_t)reader.Length(); ++row)
+            {
+                table.emplace_back();
+                for (const auto& column : columns)
+                    table.back().push_back(row < column.size() ? column[row] : Cell());
+            }
+        }
+        CHECK(dictionaries.size() == 4);
+        messages.push_back(Message{ 0, FlatTable(), Bytes(), offset - 8, 8 });
+        return table;
+    }
+
+    // Footer blocks must locate the dictionary and record batch messages exactly
+    void CheckBlocks(FlatTable footer, uint16_t id, const std::vector<Message>& messages, uint8_t headerType)
+    {
+        std::vector<const Message*> expected;
+        for (const Message& message : messages)
+        {
+            if (message.headerType == headerType)
+                expected.push_back(&message);
+        }
+        auto [start, count] = footer.Vector(id);
+        if (!CHECK(count == expected.size()))
+            return;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            size_t block = start + 24 * size_t(i);
+            CHECK(footer.buffer.Get<int64_t>(block) == (int64_t)expected[i]->offset);
+            CHECK(footer.buffer.Get<int32_t>(block + 8) == (int32_t)expected[i]->metadataLength);
+            CHECK(footer.buffer.Get<int64_t>(block + 16) == (int64_t)expected[i]->body.size);
+        }
+    }
+
+    std::string ReadFile(const std::filesystem::path& path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        return std::string((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    }
+
+    Table ReadArrowFile(const std::string& bytes)
+    {
+        Bytes file{ reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size() };
+        if (!CHECK(file.size > 16 && memcmp(file.data, "ARROW1\0\0", 8) == 0 && memcmp(file.data + file.size - 6, "ARROW1", 6) == 0))
+            return {};
+        std::vector<Message> messages;
+        Table table = ReadMessages(file, 8, messages);
+
+        // Footer right after the end-of-stream marker: schema again, then the blocks
+        uint32_t footerLength = file.Get<uint32_t>(file.size - 10);
+        size_t footerStart = file.size - 10 - footerLength;
+        CHECK(footerStart == messages.back().offset + 8);
+        FlatTable footer = FlatTable::Root(file.Sub(footerStart, footerLength));
+        CHECK(footer.Scalar<int16_t>(0) == kMetadataV5);
+        CHECK(ReadSchema(footer.Table(1)).size() == kColumnCount);
+        CheckBlocks(footer, 2, messages, kHeaderDictionaryBatch);
+        CheckBlocks(footer, 3, messages, kHeaderRecordBatch);
+        return table;
+    }
+
+    Table ReadArrowStream(const std::string& bytes)
+    {
+        Bytes file{ reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size() };
+        std::vector<Message> messages;
+        Table table = ReadMessages(file, 0, messages);
+        CHECK(messages.back().offset + 8 == file.size);
+        return table;
+    }
+}
+
+int main()
+{
+    std::vector<FontFamily> families = BuildCatalog();
+    Table expected = ExpectedTable(families);
+
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / ("listfont_arrow_test_" + std::to_string(std::random_device()()));
+    std::filesystem::create_directories(directory);
+    std::filesystem::path file = directory / "catalog.arrow";
+    std::filesystem::path stream = directory / "catalog.arrows";
+    CHECK(WriteArrowCatalog(Utf8ToWide(file.string()), families));
+    CHECK(WriteArrowCatalog(Utf8ToWide(stream.string()), families));
+
+    std::string fileBytes = ReadFile(file);
+    std::string streamBytes = ReadFile(stream);
+    CHECK(ReadArrowFile(fileBytes) == expected);
+    CHECK(ReadArrowStream(streamBytes) == expected);
+    // The stream is the file's messages without the magic and the footer
+    CHECK(fileBytes.compare(8, streamBytes.size(), streamBytes) == 0);
+
+    std::error_code error;
+    std::filesystem::remove_all(directory, error);
+    return CheckResult();
+}
@@ -0,0 +1,32 @@
+// check.h : Minimal assertions for the test programs run by ctest
+//
+
+#pragma once
+
+#include <cstdio>
+
+// Failed checks are printed and counted; a test's main returns CheckResult()
+inline int& CheckFailures()
+{
+    static int failures = 0;
+    return failures;
+}
+
+inline bool Check(bool condition, const char* what, const char* file, int line)
+{
+    if (!condition)
+    {
+        fprintf(stderr, "%s(%d): check failed: %s\n", file, line, what);
+        ++CheckFailures();
+    }
+    return condition;
+}
+
+#define CHECK(condition) Check((condition), #condition, __FILE__, __LINE__)
+
+inline int CheckResult()
+{
+    if (CheckFailures())
+        fprintf(stderr, "%d check(s) failed\n", CheckFailures());
+    return CheckFailures() ? 1 : 0;
+}
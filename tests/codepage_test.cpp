@@ -0,0 +1,182 @@
+// codepage_test.cpp : Legacy name record encodings against Python's codecs
+//
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../catalog.h"
+#include "../codepage.h"
+#include "../sfnt.h"
+#include "check.h"
+#include "synthfont.h"
+
+namespace
+{
+    // Every single byte, and every lead byte from 0x81 with trail bytes 0x40-0xFF, in that
+    // order; sequences that decode without U+FFFD are hashed with their code points. Python
+    // decodes exactly the same sequences strictly, and the expected counts and hashes come
+    // from it (mac_roman, cp932, cp950, gb2312, euc_kr).
+    struct TableCheck
+    {
+        const char* codec;
+        NameEncoding encoding;
+        size_t sequences;
+        uint64_t hash;
+    };
+
+    const TableCheck kTables[] =
+    {
+        { "mac_roman", NameEncoding::MacRoman, 256, 0x172E1D7CB65AEB76 },
+        { "cp932", NameEncoding::ShiftJis, 18644, 0x8CF9856375B237B1 },
+        { "cp950", NameEncoding::Big5, 13880, 0x779B802D92DC5417 },
+        { "gb2312", NameEncoding::Gb2312, 7573, 0x0192FC18EC771158 },
+        { "euc_kr", NameEncoding::Wansung, 8353, 0xB48805C063CF9065 },
+    };
+
+    void Mix(uint64_t& hash, uint32_t value)
+    {
+        hash = (hash ^ value) * 0x100000001B3;
+    }
+
+    void CheckTable(const TableCheck& table)
+    {
+        size_t sequences = 0;
+        uint64_t hash = 0xCBF29CE484222325;
+        auto add = [&](const uint8_t* bytes, size_t length)
+        {
+            std::wstring text;
+            AppendCodepageText(text, table.encoding, ByteSpan(bytes, length), false);
+            if (text.find(L'\uFFFD') != std::wstring::npos)
+                return;
+            Mix(hash, length == 1 ? bytes[0] : uint32_t(bytes[0]) << 8 | bytes[1]);
+            for (wchar_t c : text)
+                Mix(hash, (uint32_t)c);
+            ++sequences;
+        };
+        for (uint32_t lead = 0; lead < 256; ++lead)
+        {
+            uint8_t bytes[2] = { (uint8_t)lead, 0 };
+            add(bytes, 1);
+            if (lead < 0x81 || table.encoding == NameEncoding::MacRoman)
+                continue;
+            for (uint32_t trail = 0x40; trail < 256; ++trail)
+            {
+                bytes[1] = (uint8_t)trail;
+                add(bytes, 2);
+            }
+        }
+        if (!CHECK(sequences == table.sequences && hash == table.hash))
+            fprintf(stderr, "  %s: %zu sequences, hash 0x%016llX\n", table.codec, sequences, (unsigned long long)hash);
+    }
+
+    // Font names as Mac records store them, with the text Python decodes from the bytes
+    struct Sample
+    {
+        uint16_t macEncodingId;
+        uint16_t windowsEncodingId;  // 0 for Mac Roman, which has no Windows form
+        NameEncoding encoding;
+        std::string bytes;
+        std::wstring text;
+    };
+
+    const Sample kSamples[] =
+    {
+        { 0, 0, NameEncoding::MacRoman,
+          "\x43\x61\x66\x8E\x20\x47\x72\x9A\xA7\x65\x20\xAE\xA9\xAA\xDE\x20\xA0\xB2\xB9",
+          L"Caf\u00E9 Gr\u00F6\u00DFe \u00C6\u00A9\u2122\uFB01 \u2020\u2264\u03C0" },
+        { 1, 2, NameEncoding::ShiftJis,
+          "\x83\x71\x83\x89\x83\x4D\x83\x6D\x8A\x70\x83\x53\x20\x50\x72\x6F\x20\x57\x33\x20\xB1\xB2",
+          L"\u30D2\u30E9\u30AE\u30CE\u89D2\u30B4 Pro W3 \uFF71\uFF72" },
+        { 2, 4, NameEncoding::Big5,
+          "\xB7\x73\xB2\xD3\xA9\xFA\xC5\xE9\x20\x4C\x69\x67\x68\x74",
+          L"\u65B0\u7D30\u660E\u9AD4 Light" },
+        { 3, 5, NameEncoding::Wansung,
+          "\xC0\xB1\xB0\xED\xB5\xF1\x20\x42\x6F\x6C\x64",
+          L"\uC724\uACE0\uB515 Bold" },
+        { 25, 3, NameEncoding::Gb2312,
+          "\xBB\xAA\xCE\xC4\xBA\xDA\xCC\xE5\x20\x52\x65\x67\x75\x6C\x61\x72",
+          L"\u534E\u6587\u9ED1\u4F53 Regular" },
+    };
+
+    bool IsLeadByte(NameEncoding encoding, uint8_t byte)
+    {
+        if (encoding == NameEncoding::ShiftJis)
+            return (byte >= 0x81 && byte <= 0x9F) || (byte >= 0xE0 && byte <= 0xFC);
+        return byte >= 0x81 && byte <= 0xFE;
+    }
+
+    // Windows records keep each character in 16 bits: double-byte characters as they are,
+    // single bytes after a zero byte
+    std::string WindowsBytes(const Sample& sample)
+    {
+        std::string out;
+        for (size_t i = 0; i < sample.bytes.size(); ++i)
+        {
+            if (IsLeadByte(sample.encoding, (uint8_t)sample.bytes[i]) && i + 1 < sample.bytes.size())
+            {
+                out += sample.bytes.substr(i, 2);
+                ++i;
+            }
+            else
+            {
+                out.push_back('\0');
+                out.push_back(sample.bytes[i]);
+            }
+        }
+        return out;
+    }
+
+    // The record read back from a name table decodes to the sample text on every path
+    void CheckRecord(const SynthName& name, const std::wstring& expected)
+    {
+        std::string table = BuildNameTable({ name });
+        std::vector<NameRecord> records = ParseNameTable(ByteSpan((const uint8_t*)table.data(), table.size()));
+        if (!CHECK(records.size() == 1))
+            return;
+        CHECK(NameRecordEncoding(records[0].platformId, records[0].encodingId) != NameEncoding::Unsupported);
+        CHECK(DecodeNameRecord(records[0]) == expected);
+        CHECK(FindName(records, NAME_FAMILY) == expected);
+        NameText text(records[0]);
+        CHECK(text.Text() == expected);
+        std::string utf8;
+        text.AppendUtf8(utf8);
+        CHECK(utf8 == WideToUtf8(expected));
+    }
+
+    void CheckSamples()
+    {
+        for (const Sample& sample : kSamples)
+        {
+            CheckRecord({ 1, sample.macEncodingId, 0, NAME_FAMILY, sample.bytes }, sample.text);
+            if (sample.windowsEncodingId != 0)
+                CheckRecord({ 3, sample.windowsEncodingId, 0x0411, NAME_FAMILY, WindowsBytes(sample) }, sample.text);
+        }
+    }
+
+    std::wstring Decode(NameEncoding encoding, const std::string& bytes)
+    {
+        std::wstring text;
+        AppendCodepageText(text, encoding, ByteSpan((const uint8_t*)bytes.data(), bytes.size()), false);
+        return text;
+    }
+
+    // A lead byte at the end, or before a byte that cannot trail, is one U+FFFD; the byte
+    // after it is decoded on its own
+    void CheckMalformed()
+    {
+        CHECK(Decode(NameEncoding::ShiftJis, "AB\x83") == L"AB\uFFFD");
+        CHECK(Decode(NameEncoding::ShiftJis, std::string("\x83\x20x", 3)) == L"\uFFFD x");
+        CHECK(Decode(NameEncoding::Big5, "\xB7") == L"\uFFFD");
+        CHECK(Decode(NameEncoding::Gb2312, std::string("\xBB\x0A", 2)) == L"\uFFFD\n");
+        CHECK(Decode(NameEncoding::Wansung, "ok\xC0") == L"ok\uFFFD");
+    }
+}
+
+int main()
+{
+    for (const TableCheck& table : kTables)
+        CheckTable(table);
+    CheckSamples();
+    CheckMalformed();
+    return CheckResult();
+}
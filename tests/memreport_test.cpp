@@ -0,0 +1,86 @@
+// memreport_test.cpp : The --mem-report estimate against the counting allocator
+//
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "../memreport.h"
+#include "check.h"
+
+namespace
+{
+    std::wstring LongText(const wchar_t* prefix, size_t index)
+    {
+        return prefix + std::wstring(40, L'x') + std::to_wstring(index);
+    }
+
+    // Families with heap in every measured structure: long names, alias sets, fonts
+    // sharing a layout, license strings and script lists
+    std::vector<FontFamily> BuildCatalog(size_t familyCount)
+    {
+        std::vector<FontFamily> families;
+        for (size_t i = 0; i < familyCount; ++i)
+        {
+            FontFamily family;
+            family.primaryName = LongText(L"Family ", i);
+            family.postScriptFamilyName = NameText(LongText(L"PsFamily", i));
+            family.allNames.insert(NameText(family.primaryName));
+            family.allNames.insert(NameText(L"Short"));
+            auto layout = std::make_shared<LayoutInfo>();
+            layout->scripts.resize(2);
+            layout->scripts[0].features = { 1, 2, 3 };
+            layout->scripts[1].languages = { 4 };
+            for (int face = 0; face < 3; ++face)
+            {
+                FontInfo font = {};
+                font.name = NameText(LongText(L"Font ", face));
+                font.postScriptName = NameText(L"Ps");
+                font.filePath = LongText(L"/fonts/", i);
+                font.license.url = LongText(L"https://", face);
+                font.layout = layout;
+                font.unicodeScripts = { MakeTag('L', 'a', 't', 'n'), MakeTag('G', 'r', 'e', 'k') };
+                family.fonts.push_back(std::move(font));
+            }
+            families.push_back(std::move(family));
+        }
+        return families;
+    }
+
+    uint64_t TotalBytes(const std::vector<MemoryPart>& parts)
+    {
+        uint64_t total = 0;
+        for (const MemoryPart& part : parts)
+            total += part.bytes;
+        return total;
+    }
+}
+
+int main()
+{
+    // Blocks from before counting started must not be subtracted when freed
+    auto early = new std::vector<char>(1000);
+    StartAllocationCounting();
+    delete early;
+    AllocationStats stats = GetAllocationStats();
+    CHECK(stats.frees == 0 && stats.liveBytes == 0);
+
+    // The estimate covers exactly what building the catalog left allocated
+    AllocationStats before = GetAllocationStats();
+    {
+        std::vector<FontFamily> families = BuildCatalog(50);
+        ScriptIndex index;
+        index.unicodeScripts[MakeTag('L', 'a', 't', 'n')] = { 0, 1, 2 };
+        index.layoutScripts[MakeTag('l', 'a', 't', 'n')] = { 0 };
+        index.languages[uint64_t(MakeTag('l', 'a', 't', 'n')) << 32 | MakeTag('T', 'R', 'K', ' ')] = { 1 };
+        index.languages[0] = {};
+        AllocationStats built = GetAllocationStats();
+        std::vector<MemoryPart> parts = MeasureCatalogMemory(families, index);
+        CHECK(TotalBytes(parts) == uint64_t(built.liveBytes - before.liveBytes));
+        CHECK(built.peakBytes >= built.liveBytes);
+        CHECK(MemoryReport(families, index).find(L"peak") != std::wstring::npos);
+    }
+    AllocationStats after = GetAllocationStats();
+    CHECK(after.allocations > before.allocations && after.frees > before.frees);
+    CHECK(after.liveBytes >= before.liveBytes && after.liveBytes < before.liveBytes + 4096);
+    return CheckResult();
+}
@@ -0,0 +1,80 @@
+// raster_test.cpp : Coverage of the rasterizer, including lines clipped at the canvas sides
+//
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include "../raster.h"
+#include "check.h"
+
+namespace
+{
+    // Every line adds its height within a row to that row's cells, wherever it lies
+    // horizontally; a write outside the row (or the canvas) breaks the sum
+    float RowSum(const Rasterizer& r, int y)
+    {
+        float sum = 0;
+        for (size_t x = 0; x < r.stride; ++x)
+            sum += r.area[size_t(y) * r.stride + x];
+        return sum;
+    }
+
+    float RowHeight(float y0, float y1, int y)
+    {
+        float top = std::max(std::min(y0, y1), float(y));
+        float bottom = std::min(std::max(y0, y1), float(y + 1));
+        return bottom > top ? bottom - top : 0;
+    }
+
+    void CheckRows(float x0, float y0, float x1, float y1)
+    {
+        Rasterizer r;
+        r.Reset(40, 20);
+        r.Line(x0, y0, x1, y1);
+        float direction = y1 > y0 ? 1.0f : -1.0f;
+        for (int y = 0; y < r.height; ++y)
+            CHECK(std::fabs(RowSum(r, y) - direction * RowHeight(y0, y1, y)) < 1e-4f);
+    }
+
+    // A closed rectangle covers its inside fully and nothing outside it
+    void CheckRectangle(float left, float top, float right, float bottom)
+    {
+        Rasterizer r;
+        r.Reset(40, 20);
+        r.Line(left, top, right, top);
+        r.Line(right, top, right, bottom);
+        r.Line(right, bottom, left, bottom);
+        r.Line(left, bottom, left, top);
+        std::vector<uint8_t> coverage(size_t(r.width) * r.height);
+        r.Accumulate(coverage.data(), size_t(r.width));
+        for (int y = 0; y < r.height; ++y)
+        {
+            for (int x = 0; x < r.width; ++x)
+            {
+                bool inside = x >= std::max(left, 0.0f) && x + 1 <= std::min(right, 40.0f) && y >= top && y + 1 <= bottom;
+                bool outside = x + 1 <= left || x >= right || y + 1 <= top || y >= bottom;
+                if (inside)
+                    CHECK(coverage[size_t(y) * r.width + x] == 255);
+                else if (outside)
+                    CHECK(coverage[size_t(y) * r.width + x] == 0);
+            }
+        }
+    }
+}
+
+int main()
+{
+    // Clipped at the left side above the canvas: the last row's end once rounded to a
+    // hair below x = 0 and wrote before the row (before the canvas on row 0)
+    CheckRows(32.8182755f, -1.20744729f, 0.0f, 0.79941988f);
+    CheckRows(0.0f, 0.79941988f, 32.8182755f, -1.20744729f);
+    CheckRows(-7.3f, 2.1f, 12.9f, 17.6f);
+    CheckRows(47.3f, -3.4f, -5.2f, 25.7f);
+    CheckRows(39.9999f, 0.5f, 41.0f, 19.5f);
+    CheckRows(3.25f, 4.5f, 3.75f, 4.75f);
+
+    CheckRectangle(4, 3, 12, 9);
+    CheckRectangle(-6, 2, 10, 18);
+    CheckRectangle(30, 5, 52, 15);
+    return CheckResult();
+}
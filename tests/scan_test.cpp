@@ -0,0 +1,291 @@
+// scan_test.cpp : File scanning and glyph decoding limits on a deliberately huge synthetic font
+//
+// Usage: scan_test [padding megabytes, default 64]
+// The font has 5,301 family-name records, a padding table of the given size, a simple
+// glyph with 65,536 points and composites that reach (or pass) the glyf decoder's limits
+// on total points, nesting depth and component count. It is written to the temp directory
+// and scanned like --top-slow does, with and without hashes, and through the batched
+// header scan; the directory walk is checked next to it.
+
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+#include "../dirwalk.h"
+#include "../fontfile.h"
+#include "../outline.h"
+#include "../thumbnail.h"
+#include "check.h"
+#include "synthfont.h"
+
+namespace
+{
+    const uint32_t kFamilyRecords = 5300;
+    const uint32_t kHugePoints = 65536;  // The most one simple glyph can have
+
+    // Glyph flags
+    const uint8_t kOnCurve = 0x01, kXShort = 0x02, kRepeat = 0x08, kXPositive = 0x10, kYSame = 0x20;
+    // Component flags
+    const uint16_t kArgWords = 0x0001, kArgsAreXY = 0x0002, kMoreComponents = 0x0020;
+
+    // One contour of points on a horizontal line, one byte per point
+    std::string SimpleGlyph(uint32_t points)
+    {
+        std::string out;
+        PutU16(out, 1);
+        out.append(8, '\0');
+        PutU16(out, points - 1);
+        PutU16(out, 0);
+        uint8_t flag = kOnCurve | kXShort | kXPositive | kYSame;
+        for (uint32_t done = 0; done < points;)
+        {
+            uint32_t run = std::min<uint32_t>(points - done, 256);
+            out.push_back(char(run > 1 ? flag | kRepeat : flag));
+            if (run > 1)
+                out.push_back(char(run - 1));
+            done += run;
+        }
+        out.append(points, '\x01');
+        return out;
+    }
+
+    std::string SquareGlyph()
+    {
+        std::string out;
+        PutU16(out, 1);
+        out.append(8, '\0');
+        PutU16(out, 3);
+        PutU16(out, 0);
+        out.append(4, char(kOnCurve));
+        for (int16_t x : { 100, 0, 400, 0 })
+            PutU16(out, uint16_t(x));
+        for (int16_t y : { 0, 500, 0, -500 })
+            PutU16(out, uint16_t(y));
+        return out;
+    }
+
+    std::string CompositeGlyph(uint16_t component, uint32_t count)
+    {
+        std::string out;
+        PutU16(out, 0xFFFF);
+        out.append(8, '\0');
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            PutU16(out, kArgWords | kArgsAreXY | (i + 1 < count ? kMoreComponents : 0));
+            PutU16(out, component);
+            PutU32(out, 0);
+        }
+        return out;
+    }
+
+    // Glyph numbers of the font below
+    enum : uint16_t
+    {
+        kHuge = 1,           // 65,536 points
+        kMaxPointsOk = 2,    // 16 x kHuge: exactly the 2^20 point limit
+        kTooManyPoints = 3,  // 17 x kHuge
+        kSquare = 4,
+        kChainStart = 5,     // 5 -> 6 -> ... -> 12 -> square: eight levels of composites
+        kTooDeep = 13,       // -> 5, nine levels
+        kCycle = 14,         // -> 14
+        kTooManyComponents = 15,  // 256 x glyph 16, each 256 x the empty glyph 0
+        kFanOut = 16,
+        kComponentsOk = 17,  // 255 x glyph 16: 65,535 components
+        kGlyphCount = 18,
+    };
+
+    std::string BuildHugeFont(size_t paddingBytes)
+    {
+        std::vector<std::string> glyphs(kGlyphCount);
+        glyphs[kHuge] = SimpleGlyph(kHugePoints);
+        glyphs[kMaxPointsOk] = CompositeGlyph(kHuge, 16);
+        glyphs[kTooManyPoints] = CompositeGlyph(kHuge, 17);
+        glyphs[kSquare] = SquareGlyph();
+        for (uint16_t glyph = kChainStart; glyph < kTooDeep; ++glyph)
+            glyphs[glyph] = CompositeGlyph(glyph + 1 < kTooDeep ? glyph + 1 : kSquare, 1);
+        glyphs[kTooDeep] = CompositeGlyph(kChainStart, 1);
+        glyphs[kCycle] = CompositeGlyph(kCycle, 1);
+        glyphs[kTooManyComponents] = CompositeGlyph(kFanOut, 256);
+        glyphs[kFanOut] = CompositeGlyph(0, 256);
+        glyphs[kComponentsOk] = CompositeGlyph(kFanOut, 255);
+
+        std::string glyf, loca, hmtx;
+        for (const auto& glyph : glyphs)
+        {
+            PutU32(loca, (uint32_t)glyf.size());
+            glyf += glyph;
+            glyf.resize((glyf.size() + 3) & ~size_t(3), '\0');
+            PutU16(hmtx, 600);
+            PutU16(hmtx, 0);
+        }
+        PutU32(loca, (uint32_t)glyf.size());
+
+        // Localized family names are distinct two-character windows of one description
+        // string, so their records share its storage
+        std::u16string ideographs;
+        for (uint32_t i = 0; i <= kFamilyRecords; ++i)
+            ideographs.push_back(char16_t(0x4E00 + i));
+        std::vector<SynthName> names;
+        names.push_back({ 3, 1, 0x0409, 10, Utf16BE(ideographs) });
+        for (uint32_t i = 0; i < kFamilyRecords; ++i)
+            names.push_back({ 3, 1, uint16_t(0x0800 + i), NAME_FAMILY, Utf16BE(ideographs.substr(i, 2)) });
+        names.push_back({ 3, 1, 0x0409, NAME_FAMILY, Utf16BE(u"Huge Synthetic") });
+        names.push_back({ 3, 1, 0x0409, NAME_SUBFAMILY, Utf16BE(u"Regular") });
+        names.push_back({ 3, 1, 0x0409, NAME_FULL, Utf16BE(u"Huge Synthetic Regular") });
+        names.push_back({ 3, 1, 0x0409, NAME_POSTSCRIPT, Utf16BE(u"HugeSynthetic-Regular") });
+
+        return BuildFont({
+            { MakeTag('c', 'm', 'a', 'p'), BuildCmap(U'A', kGlyphCount - 1) },
+            { MakeTag('g', 'l', 'y', 'f'), glyf },
+            { MakeTag('h', 'e', 'a', 'd'), BuildHead(1000, true) },
+            { MakeTag('h', 'h', 'e', 'a'), BuildHhea(kGlyphCount) },
+            { MakeTag('h', 'm', 't', 'x'), hmtx },
+            { MakeTag('l', 'o', 'c', 'a'), loca },
+            { MakeTag('m', 'a', 'x', 'p'), BuildMaxp(kGlyphCount) },
+            { MakeTag('n', 'a', 'm', 'e'), BuildNameTable(names) },
+            { MakeTag('z', 'P', 'A', 'D'), std::string(paddingBytes, '\x5A') },
+        });
+    }
+
+    void CheckGlyphLimits(const std::string& bytes)
+    {
+        FontContainer container;
+        OutlineFont font;
+        CHECK(container.Open(reinterpret_cast<const uint8_t*>(bytes.data()), bytes.size()) && container.SelectFace(0));
+        CHECK(font.Open(container) && font.format == OutlineFormat::TrueType);
+
+        OutlineArena arena;
+        GlyphOutline outline;
+        CHECK(font.glyf.Decode(kHuge, arena, outline) && outline.pointCount == kHugePoints && outline.contourCount == 1);
+        CHECK(font.glyf.Decode(kMaxPointsOk, arena, outline) && outline.pointCount == 16 * kHugePoints &&
+              outline.contourCount == 16 && outline.composite);
+        CHECK(outline.contourEnds[15] == 16 * kHugePoints);
+        CHECK(!font.glyf.Decode(kTooManyPoints, arena, outline));
+        CHECK(font.glyf.Decode(kChainStart, arena, outline) && outline.pointCount == 4);
+        CHECK(!font.glyf.Decode(kTooDeep, arena, outline));
+        CHECK(!font.glyf.Decode(kCycle, arena, outline));
+        CHECK(!font.glyf.Decode(kTooManyComponents, arena, outline));
+        CHECK(font.glyf.Decode(kComponentsOk, arena, outline) && outline.pointCount == 0);
+
+        // The arena keeps its size after failures and still decodes the largest glyph
+        size_t capacity = arena.points.capacity;
+        CHECK(capacity >= 16 * kHugePoints);
+        CHECK(font.glyf.Decode(kMaxPointsOk, arena, outline) && outline.pointCount == 16 * kHugePoints);
+        CHECK(arena.points.capacity == capacity);
+
+        GlyfIterator glyphs(font.glyf, arena);
+        size_t decoded = 0;
+        while (glyphs.Next(outline))
+            ++decoded;
+        CHECK(decoded == kGlyphCount - 4 && glyphs.failed == 4);
+
+        // Every glyph once in the sample line; the four over a limit are counted as failed
+        std::u32string text;
+        for (char32_t c = U'A'; c < U'A' + kGlyphCount - 1; ++c)
+            text.push_back(c);
+        GrayImage image;
+        SampleResult sample;
+        CHECK(RenderSample(container, text, 16, 4096, image, sample));
+        CHECK(sample.glyphs == kGlyphCount - 1 && sample.failed == 4);
+    }
+
+    void CheckScan(const std::wstring& path, size_t fileSize, size_t paddingBytes)
+    {
+        // Timed, with hashes: the whole file is read for the content hash, and again by
+        // the per-table hashes, padding included
+        ScanOptions options;
+        options.computeHashes = true;
+        std::vector<FontFamily> families;
+        std::vector<ScanTiming> timings;
+        CHECK(ScanFontFiles(nullptr, { path, path + L".missing" }, options, families, &timings) == 1);
+        CHECK(timings.size() == 2);
+        if (timings.size() == 2)
+        {
+            CHECK(timings[0].faces == 1 && timings[0].fileSize == fileSize);
+            CHECK(timings[0].bytesRead >= fileSize + paddingBytes);
+            CHECK(timings[0].tablesRead >= 9);
+            CHECK(timings[0].name == L"Huge Synthetic Regular");
+            CHECK(timings[1].faces == 0 && timings[1].bytesRead == 0);
+        }
+
+        // Timed, without hashes: only the tables the listing needs
+        options.computeHashes = false;
+        std::vector<FontFamily> plain;
+        timings.clear();
+        CHECK(ScanFontFiles(nullptr, { path }, options, plain, &timings) == 0);
+        CHECK(timings.size() == 1 && timings[0].bytesRead < 1024 * 1024);
+
+        // Untimed: the batched header scan, with the same result
+        std::vector<FontFamily> headers;
+        CHECK(ScanFontFiles(nullptr, { path }, options, headers) == 0);
+        for (const auto* scanned : { &families, &plain, &headers })
+        {
+            CHECK(scanned->size() == 1);
+            if (scanned->size() != 1 || (*scanned)[0].fonts.size() != 1)
+                continue;
+            const FontFamily& family = (*scanned)[0];
+            CHECK(family.primaryName == L"Huge Synthetic");
+            CHECK(family.allNames.size() == kFamilyRecords + 1);
+            CHECK(family.postScriptFamilyName.Text() == L"HugeSynthetic");
+            CHECK(family.fonts[0].name.Text() == L"Huge Synthetic Regular");
+            CHECK(family.fonts[0].filePath == path);
+        }
+        if (!families.empty() && !families[0].fonts.empty())
+            CHECK(families[0].fonts[0].contentHash != 0 && families[0].fonts[0].tablesHash != 0);
+    }
+
+    void WriteFile(const std::filesystem::path& path, const std::string& bytes)
+    {
+        std::ofstream out(path, std::ios::binary);
+        out.write(bytes.data(), (std::streamsize)bytes.size());
+        CHECK(out.good());
+    }
+
+    // The walk next to the font: extensions are matched case-insensitively, a wrong
+    // signature is rejected, a link back to the root is not listed twice, and a second
+    // walk with the cache reuses every listing
+    void CheckWalk(const std::filesystem::path& root, const std::string& font)
+    {
+        std::filesystem::create_directories(root / "sub");
+        WriteFile(root / "sub" / "Small.TTF", font.substr(0, 4096));
+        WriteFile(root / "fake.otf", "not a font");
+        WriteFile(root / "notes.txt", "");
+        std::filesystem::create_directory_symlink(root, root / "sub" / "loop");
+
+        DirectoryCache cache;
+        FontFileSearch search = FindFontFiles({ root.wstring() }, true, &cache);
+        std::set<std::wstring> found(search.files.begin(), search.files.end());
+        CHECK(search.files.size() == 2 && found.size() == 2);
+        CHECK(found.count((root / "huge.ttf").wstring()) == 1);
+        CHECK(found.count((root / "sub" / "Small.TTF").wstring()) == 1);
+        CHECK(search.rejected == 1);
+        CHECK(search.directories == 2);
+        CHECK(search.cachedDirectories == 0 && cache.size() == search.directories);
+
+        FontFileSearch again = FindFontFiles({ root.wstring() }, true, &cache);
+        CHECK(again.files == search.files);
+        CHECK(again.cachedDirectories == again.directories && again.rejected == 1);
+        for (bool unchanged : again.unchanged)
+            CHECK(unchanged);
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    size_t paddingBytes = size_t(argc > 1 ? atoi(argv[1]) : 64) * 1024 * 1024;
+    std::string bytes = BuildHugeFont(paddingBytes);
+    CheckGlyphLimits(bytes);
+
+    std::filesystem::path root = std::filesystem::temp_directory_path() / ("listfont_scan_test_" + std::to_string(std::random_device()()));
+    std::filesystem::create_directories(root);
+    WriteFile(root / "huge.ttf", bytes);
+    CheckScan((root / "huge.ttf").wstring(), bytes.size(), paddingBytes);
+    CheckWalk(root, bytes);
+    std::error_code error;
+    std::filesystem::remove_all(root, error);
+    return CheckResult();
+}
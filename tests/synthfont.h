@@ -0,0 +1,181 @@
+// synthfont.h : Synthetic sfnt fonts built in memory for the tests
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "../sfnt.h"
+
+struct SynthTable
+{
+    uint32_t tag;
+    std::string data;
+};
+
+struct SynthName
+{
+    uint16_t platformId;
+    uint16_t encodingId;
+    uint16_t languageId;
+    uint16_t nameId;
+    std::string bytes;  // As stored: UTF-16BE for Unicode and Windows records, legacy bytes otherwise
+};
+
+inline void PutU16(std::string& out, uint32_t value)
+{
+    out.push_back(char(value >> 8));
+    out.push_back(char(value));
+}
+
+inline void PutU32(std::string& out, uint32_t value)
+{
+    PutU16(out, value >> 16);
+    PutU16(out, value & 0xFFFF);
+}
+
+inline std::string Utf16BE(const std::u16string& text)
+{
+    std::string out;
+    for (char16_t unit : text)
+        PutU16(out, unit);
+    return out;
+}
+
+// A TrueType font file: table directory sorted by tag, tables padded to four bytes.
+// Checksums are left zero; the scanner does not check them.
+inline std::string BuildFont(std::vector<SynthTable> tables)
+{
+    std::sort(tables.begin(), tables.end(), [](const SynthTable& a, const SynthTable& b) { return a.tag < b.tag; });
+    uint16_t count = (uint16_t)tables.size();
+    uint16_t searchRange = 1, selector = 0;
+    while (searchRange * 2 <= count)
+    {
+        searchRange *= 2;
+        ++selector;
+    }
+    std::string out;
+    PutU32(out, 0x00010000);
+    PutU16(out, count);
+    PutU16(out, searchRange * 16);
+    PutU16(out, selector);
+    PutU16(out, count * 16 - searchRange * 16);
+    size_t offset = 12 + size_t(count) * 16;
+    for (const auto& table : tables)
+    {
+        PutU32(out, table.tag);
+        PutU32(out, 0);
+        PutU32(out, (uint32_t)offset);
+        PutU32(out, (uint32_t)table.data.size());
+        offset += (table.data.size() + 3) & ~size_t(3);
+    }
+    for (const auto& table : tables)
+    {
+        out += table.data;
+        out.resize((out.size() + 3) & ~size_t(3), '\0');
+    }
+    return out;
+}
+
+// name table format 0 with the records in the given order. A string that already occurs
+// at an even offset of the storage is shared, as fonts with many records do to stay within
+// the 16-bit offsets.
+inline std::string BuildNameTable(const std::vector<SynthName>& names)
+{
+    std::string out, strings;
+    PutU16(out, 0);
+    PutU16(out, (uint32_t)names.size());
+    PutU16(out, 6 + (uint32_t)names.size() * 12);
+    for (const auto& name : names)
+    {
+        size_t offset = strings.find(name.bytes);
+        while (offset != std::string::npos && offset % 2 != 0)
+            offset = strings.find(name.bytes, offset + 1);
+        if (offset == std::string::npos)
+        {
+            offset = strings.size();
+            strings += name.bytes;
+        }
+        PutU16(out, name.platformId);
+        PutU16(out, name.encodingId);
+        PutU16(out, name.languageId);
+        PutU16(out, name.nameId);
+        PutU16(out, (uint32_t)name.bytes.size());
+        PutU16(out, (uint32_t)offset);
+    }
+    return out + strings;
+}
+
+// head with the given units per em and loca format, and a fixed bounding box
+inline std::string BuildHead(uint16_t unitsPerEm, bool longLoca)
+{
+    std::string out;
+    PutU32(out, 0x00010000);   // version
+    PutU32(out, 0x00010000);   // fontRevision
+    PutU32(out, 0);            // checkSumAdjustment
+    PutU32(out, 0x5F0F3CF5);   // magicNumber
+    PutU16(out, 0);            // flags
+    PutU16(out, unitsPerEm);
+    out.append(16, '\0');      // created, modified
+    PutU16(out, 0);            // xMin
+    PutU16(out, 0xFF38);       // yMin (-200)
+    PutU16(out, unitsPerEm);   // xMax
+    PutU16(out, 800);          // yMax
+    PutU16(out, 0);            // macStyle
+    PutU16(out, 8);            // lowestRecPPEM
+    PutU16(out, 2);            // fontDirectionHint
+    PutU16(out, longLoca ? 1 : 0);
+    PutU16(out, 0);            // glyphDataFormat
+    return out;
+}
+
+// hhea with one advance per glyph
+inline std::string BuildHhea(uint16_t metricCount)
+{
+    std::string out;
+    PutU32(out, 0x00010000);
+    PutU16(out, 800);          // ascender
+    PutU16(out, 0xFF38);       // descender (-200)
+    out.append(26, '\0');      // lineGap through reserved fields and metricDataFormat
+    PutU16(out, metricCount);
+    return out;
+}
+
+inline std::string BuildMaxp(uint16_t glyphCount)
+{
+    std::string out;
+    PutU32(out, 0x00005000);   // Version 0.5 carries only the glyph count
+    PutU16(out, glyphCount);
+    return out;
+}
+
+// cmap with a format 4 subtable mapping first..first+count-1 to glyphs 1..count
+inline std::string BuildCmap(uint16_t first, uint16_t count)
+{
+    std::string out;
+    PutU16(out, 0);
+    PutU16(out, 1);
+    PutU16(out, 3);
+    PutU16(out, 1);
+    PutU32(out, 12);
+    // Two segments: the range and the final 0xFFFF
+    PutU16(out, 4);
+    PutU16(out, 16 + 2 * 8);
+    PutU16(out, 0);
+    PutU16(out, 4);            // segCountX2
+    PutU16(out, 4);
+    PutU16(out, 1);
+    PutU16(out, 0);
+    PutU16(out, uint16_t(first + count - 1));
+    PutU16(out, 0xFFFF);
+    PutU16(out, 0);            // reservedPad
+    PutU16(out, first);
+    PutU16(out, 0xFFFF);
+    PutU16(out, uint16_t(1 - first));
+    PutU16(out, 1);
+    PutU16(out, 0);
+    PutU16(out, 0);
+    return out;
+}
@@ -0,0 +1,235 @@
+// textformat.h : Compile-time checked text formats written straight into an output buffer
+//
+
+#pragma once
+
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+// Not constexpr: a constexpr TextFormat whose parse reaches this does not compile
+inline void MalformedTextFormat() {}
+
+// A format with {} placeholders, parsed when the constant is compiled. {:x} and {:X} write an
+// integer in hex, a number after them or after the colon alone (like {:X8} or {:2}) pads it with
+// zeros to that many digits. After < or > the number is a column width instead, filled with
+// spaces after or before any value ({:<18}, {:>9}). .N writes a floating-point value with N
+// decimals ({:.1}, {:>11.2}); without it, 6. Braces cannot be written literally.
+struct TextFormat
+{
+    static constexpr size_t kMaxFields = 12;
+    static constexpr uint8_t kMaxWidth = 40;
+    static constexpr uint8_t kMaxPrecision = 9;
+
+    struct Field
+    {
+        size_t literalEnd = 0;  // End of the literal text before the field
+        size_t next = 0;        // Where the literal text after the field starts
+        bool hex = false;
+        bool upper = false;
+        uint8_t width = 0;      // Minimum digits of an integer, or columns with align
+        wchar_t align = 0;      // '<' or '>': pad with spaces to width
+        int8_t precision = -1;  // Decimals of a floating-point value
+    };
+
+    const wchar_t* text = nullptr;
+    size_t length = 0;
+    size_t fieldCount = 0;
+    Field fields[kMaxFields] = {};
+
+    template <size_t N>
+    constexpr TextFormat(const wchar_t (&format)[N]) : text(format), length(N - 1)
+    {
+        for (size_t i = 0; i < length; ++i)
+        {
+            if (format[i] == L'}')
+                MalformedTextFormat();
+            if (format[i] != L'{')
+                continue;
+            if (fieldCount == kMaxFields)
+                MalformedTextFormat();
+            Field& field = fields[fieldCount++];
+            field.literalEnd = i;
+            size_t j = i + 1;
+            if (j < length && format[j] == L':')
+            {
+                ++j;
+                if (j < length && (format[j] == L'<' || format[j] == L'>'))
+                    field.align = format[j++];
+                if (j < length && (format[j] == L'x' || format[j] == L'X'))
+                {
+                    field.hex = true;
+                    field.upper = format[j] == L'X';
+                    ++j;
+                }
+                for (; j < length && format[j] >= L'0' && format[j] <= L'9'; ++j)
+                {
+                    field.width = (uint8_t)(field.width * 10 + (format[j] - L'0'));
+                    if (field.width > kMaxWidth)
+                        MalformedTextFormat();
+                }
+                if (j < length && format[j] == L'.')
+                {
+                    field.precision = 0;
+                    for (++j; j < length && format[j] >= L'0' && format[j] <= L'9'; ++j)
+                    {
+                        field.precision = (int8_t)(field.precision * 10 + (format[j] - L'0'));
+                        if (field.precision > kMaxPrecision)
+                            MalformedTextFormat();
+                    }
+                }
+            }
+            if (j >= length || format[j] != L'}')
+                MalformedTextFormat();
+            field.next = j + 1;
+            i = j;
+        }
+    }
+};
+
+// Repeated characters, for padding and bars
+struct RepeatedText
+{
+    wchar_t c;
+    size_t count;
+};
+
+inline void AppendText(std::wstring& out, const std::wstring& text) { out.append(text); }
+inline void AppendText(std::wstring& out, std::wstring_view text) { out.append(text.data(), text.size()); }
+inline void AppendText(std::wstring& out, const wchar_t* text) { out.append(text); }
+inline void AppendText(std::wstring& out, wchar_t c) { out.push_back(c); }
+inline void AppendText(std::wstring& out, RepeatedText text) { out.append(text.count, text.c); }
+
+// Bytes as Latin-1, for ASCII names such as glyph names
+inline void AppendText(std::wstring& out, std::string_view text)
+{
+    for (char c : text)
+        out.push_back((wchar_t)(uint8_t)c);
+}
+
+// A table, script, language or feature tag for FormatTo; bytes outside printable ASCII show as '?'
+struct TagText
+{
+    uint32_t tag;
+};
+
+inline void AppendText(std::wstring& out, TagText tag)
+{
+    for (int shift = 24; shift >= 0; shift -= 8)
+    {
+        wchar_t c = (wchar_t)((tag.tag >> shift) & 0xFF);
+        out += (c >= 0x20 && c < 0x7F) ? c : L'?';
+    }
+}
+
+// Two decimal digits at a time, from the lowest
+inline void AppendInteger(std::wstring& out, uint64_t value, bool negative, const TextFormat::Field& field)
+{
+    static constexpr char kDigitPairs[] =
+        "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+        "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+    static constexpr char kHexDigits[2][17] = { "0123456789abcdef", "0123456789ABCDEF" };
+
+    wchar_t digits[TextFormat::kMaxWidth + 4];
+    wchar_t* end = digits + sizeof(digits) / sizeof(digits[0]);
+    wchar_t* p = end;
+    if (field.hex)
+    {
+        const char* hexDigits = kHexDigits[field.upper];
+        do
+        {
+            *--p = (wchar_t)hexDigits[value & 0xF];
+            value >>= 4;
+        } while (value != 0);
+    }
+    else
+    {
+        while (value >= 100)
+        {
+            const char* pair = kDigitPairs + (value % 100) * 2;
+            value /= 100;
+            *--p = (wchar_t)pair[1];
+            *--p = (wchar_t)pair[0];
+        }
+        if (value >= 10)
+        {
+            *--p = (wchar_t)kDigitPairs[value * 2 + 1];
+            *--p = (wchar_t)kDigitPairs[value * 2];
+        }
+        else
+        {
+            *--p = (wchar_t)(L'0' + value);
+        }
+    }
+    while (!field.align && end - p < field.width)
+        *--p = L'0';
+    if (negative)
+        out.push_back(L'-');
+    out.append(p, end - p);
+}
+
+// Rounded to precision decimals as printf would, without its buffer and locale
+inline void AppendFixed(std::wstring& out, double value, int precision)
+{
+    // Fixed notation of values past 1e30 would not fit the buffer; they get the shortest form
+    char digits[64];
+    std::to_chars_result result = std::abs(value) < 1e30
+        ? std::to_chars(digits, digits + sizeof(digits), value, std::chars_format::fixed, precision)
+        : std::to_chars(digits, digits + sizeof(digits), value);
+    for (const char* p = digits; p < result.ptr; ++p)
+        out.push_back((wchar_t)*p);
+}
+
+template <typename T>
+void AppendField(std::wstring& out, const TextFormat::Field& field, const T& value)
+{
+    if constexpr (std::is_enum_v<T>)
+    {
+        AppendField(out, field, static_cast<std::underlying_type_t<T>>(value));
+    }
+    else if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, wchar_t>)
+    {
+        if constexpr (std::is_signed_v<T>)
+            AppendInteger(out, value < 0 ? 0 - (uint64_t)value : (uint64_t)value, value < 0, field);
+        else
+            AppendInteger(out, (uint64_t)value, false, field);
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+        AppendFixed(out, (double)value, field.precision < 0 ? 6 : field.precision);
+    }
+    else
+    {
+        // Other types provide an AppendText overload next to their definition
+        AppendText(out, value);
+    }
+}
+
+// Append the format with its placeholders replaced by args, in order. The format must be a
+// constexpr TextFormat with static storage; a placeholder count that does not match args
+// does not compile. Nothing is allocated once out has the capacity.
+template <const TextFormat& Format, typename... Args>
+void FormatTo(std::wstring& out, const Args&... args)
+{
+    static_assert(Format.fieldCount == sizeof...(Args), "Placeholders and arguments of a TextFormat differ");
+    size_t start = 0;
+    size_t index = 0;
+    auto appendField = [&](const auto& value)
+    {
+        const TextFormat::Field& field = Format.fields[index++];
+        out.append(Format.text + start, field.literalEnd - start);
+        size_t fieldStart = out.size();
+        AppendField(out, field, value);
+        size_t written = out.size() - fieldStart;
+        if (field.align && written < field.width)
+            out.insert(field.align == L'>' ? fieldStart : out.size(), field.width - written, L' ');
+        start = field.next;
+    };
+    (appendField(args), ...);
+    out.append(Format.text + start, Format.length - start);
+}
@@ -0,0 +1,269 @@
+// thumbnail.cpp : Sample-text thumbnails rendered with the built-in rasterizer, saved as PNG or PGM
+//
+
+#include "thumbnail.h"
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include "cmap.h"
+#include "outline.h"
+#include "raster.h"
+
+namespace
+{
+    constexpr int kPadding = 2;  // Pixels around the text line
+
+    // Horizontal advance in font units; glyphs past numberOfHMetrics repeat the last advance
+    uint16_t AdvanceWidth(ByteSpan hmtx, uint16_t metricCount, uint32_t glyph)
+    {
+        if (metricCount == 0) return 0;
+        size_t entry = size_t(std::min<uint32_t>(glyph, metricCount - 1u)) * 4;
+        return hmtx.Has(entry, 2) ? hmtx.U16(entry) : 0;
+    }
+
+    bool WriteFile(const std::wstring& path, const std::string& bytes)
+    {
+        std::ofstream file(std::filesystem::path(path), std::ios::out | std::ios::trunc | std::ios::binary);
+        if (!file.is_open())
+            return false;
+        file.write(bytes.data(), (std::streamsize)bytes.size());
+        return file.good();
+    }
+
+    void PutU32(std::string& out, uint32_t value)
+    {
+        out.push_back(char(value >> 24));
+        out.push_back(char(value >> 16));
+        out.push_back(char(value >> 8));
+        out.push_back(char(value));
+    }
+
+    uint32_t Crc32(const char* data, size_t length, uint32_t crc = 0)
+    {
+        static const auto table = []()
+        {
+            std::vector<uint32_t> values(256);
+            for (uint32_t n = 0; n < 256; ++n)
+            {
+                uint32_t c = n;
+                for (int k = 0; k < 8; ++k)
+                    c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                values[n] = c;
+            }
+            return values;
+        }();
+        crc = ~crc;
+        for (size_t i = 0; i < length; ++i)
+            crc = table[(crc ^ uint8_t(data[i])) & 0xFF] ^ (crc >> 8);
+        return ~crc;
+    }
+
+    uint32_t Adler32(const uint8_t* data, size_t length)
+    {
+        uint32_t a = 1, b = 0;
+        while (length > 0)
+        {
+            // 5552 bytes is the most that can be summed before b must be reduced
+            size_t block = std::min<size_t>(length, 5552);
+            for (size_t i = 0; i < block; ++i)
+            {
+                a += data[i];
+                b += a;
+            }
+            a %= 65521;
+            b %= 65521;
+            data += block;
+            length -= block;
+        }
+        return (b << 16) | a;
+    }
+
+    // Deflate bit stream: values are packed from the least significant bit,
+    // Huffman codes from their most significant bit
+    struct BitWriter
+    {
+        std::string& out;
+        uint32_t bits = 0;
+        int count = 0;
+
+        explicit BitWriter(std::string& target) : out(target) {}
+
+        void Put(uint32_t value, int length)
+        {
+            bits |= value << count;
+            count += length;
+            while (count >= 8)
+            {
+                out.push_back(char(bits));
+                bits >>= 8;
+                count -= 8;
+            }
+        }
+
+        void PutCode(uint32_t code, int length)
+        {
+            uint32_t reversed = 0;
+            for (int i = 0; i < length; ++i)
+                reversed |= ((code >> i) & 1) << (length - 1 - i);
+            Put(reversed, length);
+        }
+
+        // Fixed Huffman literal/length code
+        void PutSymbol(uint32_t symbol)
+        {
+            if (symbol < 144) PutCode(0x30 + symbol, 8);
+            else if (symbol < 256) PutCode(0x190 + symbol - 144, 9);
+            else if (symbol < 280) PutCode(symbol - 256, 7);
+            else PutCode(0xC0 + symbol - 280, 8);
+        }
+
+        // Copy of the previous byte, 3-258 times
+        void PutRun(uint32_t length)
+        {
+            static const uint16_t kBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                                35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+            static const uint8_t kExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                                3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+            int code = 28;
+            while (kBase[code] > length) --code;
+            PutSymbol(257 + code);
+            Put(length - kBase[code], kExtra[code]);
+            PutCode(0, 5);  // Distance code 0: distance 1
+        }
+
+        void Flush()
+        {
+            if (count > 0) out.push_back(char(bits));
+            bits = 0;
+            count = 0;
+        }
+    };
+
+    // zlib stream of a single fixed-Huffman block with distance-1 matches only
+    std::string CompressRuns(const std::vector<uint8_t>& data)
+    {
+        std::string out = "\x78\x01";
+        BitWriter writer(out);
+        writer.Put(1, 1);  // BFINAL
+        writer.Put(1, 2);  // BTYPE fixed Huffman
+        for (size_t i = 0; i < data.size();)
+        {
+            uint8_t value = data[i];
+            writer.PutSymbol(value);
+            size_t run = 0;
+            while (i + 1 + run < data.size() && data[i + 1 + run] == value) ++run;
+            i += 1 + run;
+            for (; run >= 3; )
+            {
+                // Never leave a tail of one or two bytes that would have to go out as literals
+                size_t length = std::min<size_t>(run, 258);
+                if (run - length > 0 && run - length < 3) length = run - 3;
+                writer.PutRun((uint32_t)length);
+                run -= length;
+            }
+            for (; run > 0; --run)
+                writer.PutSymbol(value);
+        }
+        writer.PutSymbol(256);
+        writer.Flush();
+        PutU32(out, Adler32(data.data(), data.size()));
+        return out;
+    }
+
+    void PutChunk(std::string& out, const char* type, const std::string& data)
+    {
+        PutU32(out, (uint32_t)data.size());
+        size_t start = out.size();
+        out.append(type, 4);
+        out += data;
+        PutU32(out, Crc32(out.data() + start, out.size() - start));
+    }
+}
+
+bool RenderSample(FontContainer& container, const std::u32string& text, float pixelSize, int maxWidth,
+                  GrayImage& image, SampleResult& result)
+{
+    image = GrayImage();
+    result = SampleResult();
+    OutlineFont font;
+    if (!font.Open(container) || pixelSize <= 0)
+        return false;
+
+    ByteSpan cmap = container.LoadTable(MakeTag('c', 'm', 'a', 'p'));
+    ByteSpan hhea = container.LoadTable(MakeTag('h', 'h', 'e', 'a'));
+    ByteSpan hmtx = container.LoadTable(MakeTag('h', 'm', 't', 'x'));
+    ByteSpan head = container.LoadTable(MakeTag('h', 'e', 'a', 'd'));
+    FontMetrics metrics = ReadFontMetrics(head, hhea, ByteSpan(), ByteSpan());
+    uint16_t metricCount = hhea.Has(0, 36) ? hhea.U16(34) : 0;
+    int ascender = metrics.ascender, descender = metrics.descender;
+    if (ascender <= descender)
+    {
+        ascender = metrics.yMax;
+        descender = metrics.yMin;
+    }
+
+    float scale = pixelSize / font.unitsPerEm;
+    std::vector<uint16_t> glyphs;
+    float lineWidth = 0;
+    for (char32_t c : text)
+    {
+        uint16_t glyph = LookupGlyph(cmap, c);
+        glyphs.push_back(glyph);
+        lineWidth += AdvanceWidth(hmtx, metricCount, glyph) * scale;
+    }
+
+    image.width = std::min(maxWidth, (int)std::ceil(lineWidth) + 2 * kPadding);
+    image.height = (int)std::ceil((ascender - descender) * scale) + 2 * kPadding;
+    if (image.width <= 0 || image.height <= 0)
+        return false;
+    image.pixels.resize(size_t(image.width) * image.height);
+
+    thread_local Rasterizer raster;
+    raster.Reset(image.width, image.height);
+    float penX = kPadding, baseline = kPadding + ascender * scale;
+    for (uint16_t glyph : glyphs)
+    {
+        if (penX >= image.width) break;
+        RasterSink sink(raster, scale, penX, baseline);
+        if (!font.Draw(glyph, sink)) ++result.failed;
+        sink.Close();
+        ++result.glyphs;
+        penX += AdvanceWidth(hmtx, metricCount, glyph) * scale;
+    }
+    raster.Accumulate(image.pixels.data(), image.width);
+    for (uint8_t& pixel : image.pixels)
+        pixel = uint8_t(255 - pixel);
+    return true;
+}
+
+bool WritePgm(const std::wstring& path, const GrayImage& image)
+{
+    std::string out = "P5\n" + std::to_string(image.width) + " " + std::to_string(image.height) + "\n255\n";
+    out.append(image.pixels.begin(), image.pixels.end());
+    return WriteFile(path, out);
+}
+
+bool WritePng(const std::wstring& path, const GrayImage& image)
+{
+    // Every row is preceded by its filter type (0, none)
+    std::vector<uint8_t> rows;
+    rows.reserve((size_t(image.width) + 1) * image.height);
+    for (int y = 0; y < image.height; ++y)
+    {
+        rows.push_back(0);
+        auto row = image.pixels.begin() + ptrdiff_t(y) * image.width;
+        rows.insert(rows.end(), row, row + image.width);
+    }
+
+    std::string header;
+    PutU32(header, (uint32_t)image.width);
+    PutU32(header, (uint32_t)image.height);
+    header += std::string("\x08\x00\x00\x00\x00", 5);  // 8-bit grayscale, deflate, no interlace
+
+    std::string out = "\x89PNG\r\n\x1A\n";
+    PutChunk(out, "IHDR", header);
+    PutChunk(out, "IDAT", CompressRuns(rows));
+    PutChunk(out, "IEND", std::string());
+    return WriteFile(path, out);
+}
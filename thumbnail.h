@@ -0,0 +1,44 @@
+// thumbnail.h : Sample-text thumbnails rendered with the built-in rasterizer, saved as PNG or PGM
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "sfnt.h"
+
+// 8-bit grayscale, rows of width bytes, 255 = white
+struct GrayImage
+{
+    int width = 0;
+    int height = 0;
+    std::vector<uint8_t> pixels;
+};
+
+struct ThumbnailOptions
+{
+    std::u32string text = U"The quick brown fox jumps over the lazy dog";
+    float pixelSize = 32;
+    int maxWidth = 2048;
+    bool png = true;  // Otherwise PGM
+};
+
+struct SampleResult
+{
+    size_t glyphs = 0;  // Glyphs drawn (missing characters draw .notdef)
+    size_t failed = 0;  // Glyphs whose outline data was malformed
+};
+
+// Black sample text on white for the selected face: one line at pixelSize pixels per
+// em, laid out with hmtx advances and cut off at maxWidth pixels. No shaping or
+// kerning. False if the face has no outlines the rasterizer can read.
+bool RenderSample(FontContainer& container, const std::u32string& text, float pixelSize, int maxWidth,
+                  GrayImage& image, SampleResult& result);
+
+// Binary PGM (P5)
+bool WritePgm(const std::wstring& path, const GrayImage& image);
+
+// Grayscale PNG; rows are run-length coded with the fixed Huffman code, which suits
+// the long runs of white and black in text thumbnails
+bool WritePng(const std::wstring& path, const GrayImage& image);
@@ -0,0 +1,199 @@
+// trace.cpp : Scoped phase timers for --trace (Chrome trace-event JSON and a summary table)
+//
+
+#include "trace.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+#include "catalog.h"
+#include "textformat.h"
+
+namespace
+{
+    struct TraceEvent
+    {
+        const char* name;
+        int64_t start;
+        int64_t end;
+    };
+
+    // Events of one thread; kept until the end of the run so buffers outlive their threads.
+    // Filled in fixed blocks, so recording never copies the events already taken.
+    struct ThreadTrace
+    {
+        static constexpr size_t kBlockEvents = 4096;
+
+        uint32_t id = 0;
+        std::vector<std::unique_ptr<TraceEvent[]>> blocks;
+        TraceEvent* next = nullptr;
+        TraceEvent* blockEnd = nullptr;
+
+        void Add(const TraceEvent& event)
+        {
+            if (next == blockEnd)
+            {
+                blocks.push_back(std::make_unique<TraceEvent[]>(kBlockEvents));
+                next = blocks.back().get();
+                blockEnd = next + kBlockEvents;
+            }
+            *next++ = event;
+        }
+
+        template <typename Visit>
+        void ForEach(Visit visit) const
+        {
+            for (const auto& block : blocks)
+            {
+                const TraceEvent* end = block.get() == blocks.back().get() ? next : block.get() + kBlockEvents;
+                for (const TraceEvent* event = block.get(); event != end; ++event)
+                    visit(*event);
+            }
+        }
+    };
+
+    bool traceEnabled = false;
+    int64_t traceStart = 0;
+    std::mutex threadsMutex;
+    std::vector<std::unique_ptr<ThreadTrace>> threads;
+
+    ThreadTrace& CurrentThread()
+    {
+        thread_local ThreadTrace* current = nullptr;
+        if (!current)
+        {
+            std::lock_guard<std::mutex> lock(threadsMutex);
+            threads.push_back(std::make_unique<ThreadTrace>());
+            current = threads.back().get();
+            current->id = static_cast<uint32_t>(threads.size());
+        }
+        return *current;
+    }
+
+    // Phases are keyed by name text: the same literal may have a different address in each file
+    struct NameLess
+    {
+        bool operator()(const char* a, const char* b) const { return strcmp(a, b) < 0; }
+    };
+
+    struct PhaseStats
+    {
+        const char* name = nullptr;
+        uint64_t calls = 0;
+        int64_t total = 0;
+        int64_t self = 0;
+        int64_t max = 0;
+    };
+
+    constexpr TextFormat kPhaseLine(L"{:<22} {:>9} {:>11.2} {:>11.2} {:>10.2} {:>10.2}\n");
+    constexpr TextFormat kWallTimeLine(L"Traced wall time {:.2} ms on {} threads\n");
+}
+
+void StartTrace()
+{
+    if (traceStart == 0)
+        traceStart = TraceClock();
+    traceEnabled = true;
+}
+
+void StopTrace()
+{
+    traceEnabled = false;
+}
+
+bool TraceEnabled()
+{
+    return traceEnabled;
+}
+
+void RecordTraceEvent(const char* name, int64_t start, int64_t end)
+{
+    CurrentThread().Add({ name, start, end });
+}
+
+bool WriteTraceFile(const std::wstring& path)
+{
+    std::ofstream file(FilePath(path), std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!file.is_open())
+        return false;
+
+    // Complete ("X") events with microsecond timestamps relative to StartTrace
+    std::string out = "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+    bool first = true;
+    for (const auto& thread : threads)
+    {
+        thread->ForEach([&](const TraceEvent& event)
+        {
+            char line[256];
+            snprintf(line, sizeof(line), "%s{\"name\": \"%s\", \"ph\": \"X\", \"pid\": 1, \"tid\": %u, \"ts\": %.3f, \"dur\": %.3f}",
+                     first ? "" : ",\n", event.name, thread->id, (event.start - traceStart) / 1000.0,
+                     (event.end - event.start) / 1000.0);
+            out += line;
+            first = false;
+            if (out.size() > (1 << 20))
+            {
+                file << out;
+                out.clear();
+            }
+        });
+    }
+    out += "\n]}\n";
+    file << out;
+    return file.good();
+}
+
+std::wstring TraceSummary()
+{
+    int64_t wall = TraceClock() - traceStart;
+    std::map<const char*, PhaseStats, NameLess> phases;
+    for (const auto& thread : threads)
+    {
+        // Events are recorded as scopes end; ordered by start (outer first) a stack gives each event its parent
+        std::vector<TraceEvent> events;
+        thread->ForEach([&](const TraceEvent& event) { events.push_back(event); });
+        std::sort(events.begin(), events.end(), [](const TraceEvent& a, const TraceEvent& b) {
+            return a.start != b.start ? a.start < b.start : a.end > b.end;
+        });
+        std::vector<PhaseStats*> stack;
+        std::vector<int64_t> stackEnds;
+        for (const TraceEvent& event : events)
+        {
+            while (!stackEnds.empty() && stackEnds.back() <= event.start)
+            {
+                stack.pop_back();
+                stackEnds.pop_back();
+            }
+            int64_t duration = event.end - event.start;
+            PhaseStats& phase = phases[event.name];
+            phase.name = event.name;
+            ++phase.calls;
+            phase.total += duration;
+            phase.self += duration;
+            phase.max = std::max(phase.max, duration);
+            if (!stack.empty())
+                stack.back()->self -= duration;
+            stack.push_back(&phase);
+            stackEnds.push_back(event.end);
+        }
+    }
+
+    std::vector<PhaseStats> sorted;
+    for (const auto& entry : phases)
+        sorted.push_back(entry.second);
+    std::sort(sorted.begin(), sorted.end(), [](const PhaseStats& a, const PhaseStats& b) { return a.self > b.self; });
+
+    std::wstring summary = L"Phase                      Calls    Total ms     Self ms    Mean us     Max us\n";
+    for (const PhaseStats& phase : sorted)
+    {
+        FormatTo<kPhaseLine>(summary, std::string_view(phase.name), phase.calls, phase.total / 1e6, phase.self / 1e6,
+                             phase.total / 1e3 / phase.calls, phase.max / 1e3);
+    }
+    FormatTo<kWallTimeLine>(summary, wall / 1e6, threads.size());
+    return summary;
+}
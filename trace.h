@@ -0,0 +1,53 @@
+// trace.h : Scoped phase timers for --trace (Chrome trace-event JSON and a summary table)
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+// Monotonic clock used for trace events, in nanoseconds
+inline int64_t TraceClock()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Start recording; call before any traced work and before worker threads start
+void StartTrace();
+// Pause recording between runs (no worker threads running); StartTrace resumes it and
+// timestamps stay relative to the first start
+void StopTrace();
+bool TraceEnabled();
+
+// Append an event to the calling thread's buffer (no locking after the first event of a thread).
+// name must be a string literal: it is stored as a pointer and written to JSON unescaped.
+void RecordTraceEvent(const char* name, int64_t start, int64_t end);
+
+// Times the enclosing scope while tracing is enabled; otherwise costs a single check.
+// Nested scopes are charged to their own phase, so the summary reports self time.
+class TraceScope
+{
+public:
+    explicit TraceScope(const char* name)
+        : name(TraceEnabled() ? name : nullptr), start(this->name ? TraceClock() : 0)
+    {
+    }
+    ~TraceScope()
+    {
+        if (name)
+            RecordTraceEvent(name, start, TraceClock());
+    }
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* name;
+    int64_t start;
+};
+
+// Write all events as Chrome trace-event JSON (chrome://tracing, Perfetto); call after worker threads have finished
+bool WriteTraceFile(const std::wstring& path);
+
+// Per-phase calls, total and self time, mean and max duration, slowest self time first
+std::wstring TraceSummary();
@@ -0,0 +1,294 @@
+// unicodescript.cpp : Unicode script (ISO 15924) coverage of a cmap
+//
+
+#include "unicodescript.h"
+#include <algorithm>
+
+namespace
+{
+    // Generated from Unicode 18.0 Scripts.txt; Common, Inherited and unassigned code points are omitted
+    const char kScriptCodes[][5] = {
+        "Adlm", "Aghb", "Ahom", "Arab", "Armi", "Armn", "Avst", "Bali", "Bamu", "Bass", "Batk", "Beng",
+        "Berf", "Bhks", "Bopo", "Brah", "Brai", "Bugi", "Buhd", "Cakm", "Cans", "Cari", "Cham", "Cher",
+        "Chrs", "Copt", "Cpmn", "Cprt", "Cyrl", "Deva", "Diak", "Dogr", "Dsrt", "Dupl", "Egyp", "Elba",
+        "Elym", "Ethi", "Gara", "Geor", "Glag", "Gong", "Gonm", "Goth", "Gran", "Grek", "Gujr", "Gukh",
+        "Guru", "Hang", "Hani", "Hano", "Hatr", "Hebr", "Hira", "Hluw", "Hmng", "Hmnp", "Hung", "Ital",
+        "Java", "Jurc", "Kali", "Kana", "Kawi", "Khar", "Khmr", "Khoj", "Kits", "Knda", "Krai", "Kthi",
+        "Lana", "Laoo", "Latn", "Lepc", "Limb", "Lina", "Linb", "Lisu", "Lyci", "Lydi", "Mahj", "Maka",
+        "Mand", "Mani", "Marc", "Medf", "Mend", "Merc", "Mero", "Mlym", "Modi", "Mong", "Mroo", "Mtei",
+        "Mult", "Mymr", "Nagm", "Nand", "Narb", "Nbat", "Newa", "Nkoo", "Nshu", "Ogam", "Olck", "Onao",
+        "Orkh", "Orya", "Osge", "Osma", "Ougr", "Palm", "Pauc", "Pcun", "Perm", "Phag", "Phli", "Phlp",
+        "Phnx", "Plrd", "Prti", "Rjng", "Rohg", "Runr", "Samr", "Sarb", "Saur", "Seal", "Sgnw", "Shaw",
+        "Shrd", "Sidd", "Sidt", "Sind", "Sinh", "Sogd", "Sogo", "Sora", "Soyo", "Sund", "Sunu", "Sylo",
+        "Syrc", "Tagb", "Takr", "Tale", "Talu", "Taml", "Tang", "Tavt", "Tayo", "Telu", "Tfng", "Tglg",
+        "Thaa", "Thai", "Tibt", "Tirh", "Tnsa", "Todr", "Tols", "Toto", "Tutg", "Ugar", "Vaii", "Vith",
+        "Wara", "Wcho", "Xpeo", "Xsux", "Yezi", "Yiii", "Zanb",
+    };
+
+    struct ScriptRange
+    {
+        uint32_t first;
+        uint32_t last;
+        uint8_t script;  // Index into kScriptCodes
+    };
+
+    const ScriptRange kScriptRanges[] = {
+        { 0x41, 0x5A, 74 }, { 0x61, 0x7A, 74 }, { 0xAA, 0xAA, 74 }, { 0xBA, 0xBA, 74 }, { 0xC0, 0xD6, 74 },
+        { 0xD8, 0xF6, 74 }, { 0xF8, 0x2B8, 74 }, { 0x2E0, 0x2E4, 74 }, { 0x2EA, 0x2EB, 14 },
+        { 0x370, 0x373, 45 }, { 0x375, 0x377, 45 }, { 0x37A, 0x37D, 45 }, { 0x37F, 0x37F, 45 },
+        { 0x384, 0x384, 45 }, { 0x386, 0x386, 45 }, { 0x388, 0x38A, 45 }, { 0x38C, 0x38C, 45 },
+        { 0x38E, 0x3A1, 45 }, { 0x3A3, 0x3E1, 45 }, { 0x3E2, 0x3EF, 25 }, { 0x3F0, 0x3FF, 45 },
+        { 0x400, 0x484, 28 }, { 0x487, 0x52F, 28 }, { 0x531, 0x556, 5 }, { 0x558, 0x58F, 5 },
+        { 0x591, 0x5C9, 53 }, { 0x5D0, 0x5EA, 53 }, { 0x5EF, 0x5F4, 53 }, { 0x600, 0x604, 3 },
+        { 0x606, 0x60B, 3 }, { 0x60D, 0x61A, 3 }, { 0x61C, 0x61E, 3 }, { 0x620, 0x63F, 3 },
+        { 0x641, 0x64A, 3 }, { 0x656, 0x66F, 3 }, { 0x671, 0x6DC, 3 }, { 0x6DE, 0x6FF, 3 },
+        { 0x700, 0x70D, 144 }, { 0x70F, 0x74A, 144 }, { 0x74D, 0x74F, 144 }, { 0x750, 0x77F, 3 },
+        { 0x780, 0x7B1, 156 }, { 0x7C0, 0x7FA, 103 }, { 0x7FD, 0x7FF, 103 }, { 0x800, 0x82D, 126 },
+        { 0x830, 0x83E, 126 }, { 0x840, 0x85B, 84 }, { 0x85E, 0x85E, 84 }, { 0x860, 0x86A, 144 },
+        { 0x870, 0x891, 3 }, { 0x897, 0x8E1, 3 }, { 0x8E3, 0x8FF, 3 }, { 0x900, 0x950, 29 },
+        { 0x955, 0x963, 29 }, { 0x966, 0x97F, 29 }, { 0x980, 0x983, 11 }, { 0x985, 0x98C, 11 },
+        { 0x98F, 0x990, 11 }, { 0x993, 0x9A8, 11 }, { 0x9AA, 0x9B0, 11 }, { 0x9B2, 0x9B2, 11 },
+        { 0x9B6, 0x9B9, 11 }, { 0x9BC, 0x9C4, 11 }, { 0x9C7, 0x9C8, 11 }, { 0x9CB, 0x9CE, 11 },
+        { 0x9D7, 0x9D7, 11 }, { 0x9DC, 0x9DD, 11 }, { 0x9DF, 0x9E3, 11 }, { 0x9E6, 0x9FE, 11 },
+        { 0xA01, 0xA03, 48 }, { 0xA05, 0xA0A, 48 }, { 0xA0F, 0xA10, 48 }, { 0xA13, 0xA28, 48 },
+        { 0xA2A, 0xA30, 48 }, { 0xA32, 0xA33, 48 }, { 0xA35, 0xA36, 48 }, { 0xA38, 0xA39, 48 },
+        { 0xA3C, 0xA3C, 48 }, { 0xA3E, 0xA42, 48 }, { 0xA47, 0xA48, 48 }, { 0xA4B, 0xA4D, 48 },
+        { 0xA51, 0xA51, 48 }, { 0xA59, 0xA5C, 48 }, { 0xA5E, 0xA5E, 48 }, { 0xA66, 0xA76, 48 },
+        { 0xA81, 0xA83, 46 }, { 0xA85, 0xA8D, 46 }, { 0xA8F, 0xA91, 46 }, { 0xA93, 0xAA8, 46 },
+        { 0xAAA, 0xAB0, 46 }, { 0xAB2, 0xAB3, 46 }, { 0xAB5, 0xAB9, 46 }, { 0xABC, 0xAC5, 46 },
+        { 0xAC7, 0xAC9, 46 }, { 0xACB, 0xACD, 46 }, { 0xAD0, 0xAD0, 46 }, { 0xAE0, 0xAE3, 46 },
+        { 0xAE6, 0xAF1, 46 }, { 0xAF9, 0xAFF, 46 }, { 0xB01, 0xB03, 109 }, { 0xB05, 0xB0C, 109 },
+        { 0xB0F, 0xB10, 109 }, { 0xB13, 0xB28, 109 }, { 0xB2A, 0xB30, 109 }, { 0xB32, 0xB33, 109 },
+        { 0xB35, 0xB39, 109 }, { 0xB3C, 0xB44, 109 }, { 0xB47, 0xB48, 109 }, { 0xB4B, 0xB4D, 109 },
+        { 0xB53, 0xB57, 109 }, { 0xB5C, 0xB5D, 109 }, { 0xB5F, 0xB63, 109 }, { 0xB66, 0xB77, 109 },
+        { 0xB82, 0xB83, 149 }, { 0xB85, 0xB8A, 149 }, { 0xB8E, 0xB90, 149 }, { 0xB92, 0xB95, 149 },
+        { 0xB99, 0xB9A, 149 }, { 0xB9C, 0xB9C, 149 }, { 0xB9E, 0xB9F, 149 }, { 0xBA3, 0xBA4, 149 },
+        { 0xBA8, 0xBAA, 149 }, { 0xBAE, 0xBB9, 149 }, { 0xBBE, 0xBC2, 149 }, { 0xBC6, 0xBC8, 149 },
+        { 0xBCA, 0xBCD, 149 }, { 0xBD0, 0xBD0, 149 }, { 0xBD7, 0xBD7, 149 }, { 0xBE6, 0xBFA, 149 },
+        { 0xC00, 0xC0C, 153 }, { 0xC0E, 0xC10, 153 }, { 0xC12, 0xC28, 153 }, { 0xC2A, 0xC39, 153 },
+        { 0xC3C, 0xC44, 153 }, { 0xC46, 0xC48, 153 }, { 0xC4A, 0xC4D, 153 }, { 0xC55, 0xC56, 153 },
+        { 0xC58, 0xC5A, 153 }, { 0xC5C, 0xC5D, 153 }, { 0xC60, 0xC63, 153 }, { 0xC66, 0xC6F, 153 },
+        { 0xC77, 0xC7F, 153 }, { 0xC80, 0xC8C, 69 }, { 0xC8E, 0xC90, 69 }, { 0xC92, 0xCA8, 69 },
+        { 0xCAA, 0xCB3, 69 }, { 0xCB5, 0xCB9, 69 }, { 0xCBC, 0xCC4, 69 }, { 0xCC6, 0xCC8, 69 },
+        { 0xCCA, 0xCCD, 69 }, { 0xCD5, 0xCD6, 69 }, { 0xCDC, 0xCDE, 69 }, { 0xCE0, 0xCE3, 69 },
+        { 0xCE6, 0xCEF, 69 }, { 0xCF1, 0xCF3, 69 }, { 0xD00, 0xD0C, 91 }, { 0xD0E, 0xD10, 91 },
+        { 0xD12, 0xD44, 91 }, { 0xD46, 0xD48, 91 }, { 0xD4A, 0xD4F, 91 }, { 0xD54, 0xD63, 91 },
+        { 0xD66, 0xD7F, 91 }, { 0xD81, 0xD83, 136 }, { 0xD85, 0xD96, 136 }, { 0xD9A, 0xDB1, 136 },
+        { 0xDB3, 0xDBB, 136 }, { 0xDBD, 0xDBD, 136 }, { 0xDC0, 0xDC6, 136 }, { 0xDCA, 0xDCA, 136 },
+        { 0xDCF, 0xDD4, 136 }, { 0xDD6, 0xDD6, 136 }, { 0xDD8, 0xDDF, 136 }, { 0xDE6, 0xDEF, 136 },
+        { 0xDF2, 0xDF4, 136 }, { 0xE01, 0xE3A, 157 }, { 0xE40, 0xE5B, 157 }, { 0xE81, 0xE82, 73 },
+        { 0xE84, 0xE84, 73 }, { 0xE86, 0xE8A, 73 }, { 0xE8C, 0xEA3, 73 }, { 0xEA5, 0xEA5, 73 },
+        { 0xEA7, 0xEBD, 73 }, { 0xEC0, 0xEC4, 73 }, { 0xEC6, 0xEC6, 73 }, { 0xEC8, 0xECE, 73 },
+        { 0xED0, 0xED9, 73 }, { 0xEDC, 0xEDF, 73 }, { 0xF00, 0xF47, 158 }, { 0xF49, 0xF6C, 158 },
+        { 0xF71, 0xF97, 158 }, { 0xF99, 0xFBC, 158 }, { 0xFBE, 0xFCC, 158 }, { 0xFCE, 0xFD4, 158 },
+        { 0xFD9, 0xFDA, 158 }, { 0x1000, 0x109F, 97 }, { 0x10A0, 0x10C5, 39 }, { 0x10C7, 0x10C7, 39 },
+        { 0x10CD, 0x10CD, 39 }, { 0x10D0, 0x10FA, 39 }, { 0x10FC, 0x10FF, 39 }, { 0x1100, 0x11FF, 49 },
+        { 0x1200, 0x1248, 37 }, { 0x124A, 0x124D, 37 }, { 0x1250, 0x1256, 37 }, { 0x1258, 0x1258, 37 },
+        { 0x125A, 0x125D, 37 }, { 0x1260, 0x1288, 37 }, { 0x128A, 0x128D, 37 }, { 0x1290, 0x12B0, 37 },
+        { 0x12B2, 0x12B5, 37 }, { 0x12B8, 0x12BE, 37 }, { 0x12C0, 0x12C0, 37 }, { 0x12C2, 0x12C5, 37 },
+        { 0x12C8, 0x12D6, 37 }, { 0x12D8, 0x1310, 37 }, { 0x1312, 0x1315, 37 }, { 0x1318, 0x135A, 37 },
+        { 0x135D, 0x137C, 37 }, { 0x1380, 0x1399, 37 }, { 0x13A0, 0x13F5, 23 }, { 0x13F8, 0x13FD, 23 },
+        { 0x1400, 0x167F, 20 }, { 0x1680, 0x169C, 105 }, { 0x16A0, 0x16EA, 125 }, { 0x16EE, 0x16F8, 125 },
+        { 0x1700, 0x1715, 155 }, { 0x171F, 0x171F, 155 }, { 0x1720, 0x1734, 51 }, { 0x1740, 0x1753, 18 },
+        { 0x1760, 0x176C, 145 }, { 0x176E, 0x1770, 145 }, { 0x1772, 0x1773, 145 }, { 0x1780, 0x17DD, 66 },
+        { 0x17E0, 0x17E9, 66 }, { 0x17F0, 0x17F9, 66 }, { 0x1800, 0x1801, 93 }, { 0x1804, 0x1804, 93 },
+        { 0x1806, 0x1819, 93 }, { 0x1820, 0x1878, 93 }, { 0x1880, 0x18AA, 93 }, { 0x18B0, 0x18F5, 20 },
+        { 0x1900, 0x191E, 76 }, { 0x1920, 0x192B, 76 }, { 0x1930, 0x193B, 76 }, { 0x1940, 0x1940, 76 },
+        { 0x1944, 0x194F, 76 }, { 0x1950, 0x196D, 147 }, { 0x1970, 0x1974, 147 }, { 0x1980, 0x19AB, 148 },
+        { 0x19B0, 0x19C9, 148 }, { 0x19D0, 0x19DA, 148 }, { 0x19DE, 0x19DF, 148 }, { 0x19E0, 0x19FF, 66 },
+        { 0x1A00, 0x1A1B, 17 }, { 0x1A1E, 0x1A1F, 17 }, { 0x1A20, 0x1A5E, 72 }, { 0x1A60, 0x1A7C, 72 },
+        { 0x1A7F, 0x1A89, 72 }, { 0x1A90, 0x1A99, 72 }, { 0x1AA0, 0x1AAD, 72 }, { 0x1B00, 0x1B4C, 7 },
+        { 0x1B4E, 0x1B7F, 7 }, { 0x1B80, 0x1BBF, 141 }, { 0x1BC0, 0x1BF3, 10 }, { 0x1BFC, 0x1BFF, 10 },
+        { 0x1C00, 0x1C37, 75 }, { 0x1C3B, 0x1C49, 75 }, { 0x1C4D, 0x1C4F, 75 }, { 0x1C50, 0x1C7F, 106 },
+        { 0x1C80, 0x1C8A, 28 }, { 0x1C90, 0x1CBA, 39 }, { 0x1CBD, 0x1CBF, 39 }, { 0x1CC0, 0x1CC7, 141 },
+        { 0x1D00, 0x1D25, 74 }, { 0x1D26, 0x1D2A, 45 }, { 0x1D2B, 0x1D2B, 28 }, { 0x1D2C, 0x1D5C, 74 },
+        { 0x1D5D, 0x1D61, 45 }, { 0x1D62, 0x1D65, 74 }, { 0x1D66, 0x1D6A, 45 }, { 0x1D6B, 0x1D77, 74 },
+        { 0x1D78, 0x1D78, 28 }, { 0x1D79, 0x1DBE, 74 }, { 0x1DBF, 0x1DBF, 45 }, { 0x1E00, 0x1EFF, 74 },
+        { 0x1F00, 0x1F15, 45 }, { 0x1F18, 0x1F1D, 45 }, { 0x1F20, 0x1F45, 45 }, { 0x1F48, 0x1F4D, 45 },
+        { 0x1F50, 0x1F57, 45 }, { 0x1F59, 0x1F59, 45 }, { 0x1F5B, 0x1F5B, 45 }, { 0x1F5D, 0x1F5D, 45 },
+        { 0x1F5F, 0x1F7D, 45 }, { 0x1F80, 0x1FB4, 45 }, { 0x1FB6, 0x1FC4, 45 }, { 0x1FC6, 0x1FD3, 45 },
+        { 0x1FD6, 0x1FDB, 45 }, { 0x1FDD, 0x1FEF, 45 }, { 0x1FF2, 0x1FF4, 45 }, { 0x1FF6, 0x1FFE, 45 },
+        { 0x2071, 0x2071, 74 }, { 0x207F, 0x207F, 74 }, { 0x2090, 0x209F, 74 }, { 0x2126, 0x2126, 45 },
+        { 0x212A, 0x212B, 74 }, { 0x2132, 0x2132, 74 }, { 0x214E, 0x214E, 74 }, { 0x2160, 0x2188, 74 },
+        { 0x2800, 0x28FF, 16 }, { 0x2C00, 0x2C5F, 40 }, { 0x2C60, 0x2C7F, 74 }, { 0x2C80, 0x2CF3, 25 },
+        { 0x2CF9, 0x2CFF, 25 }, { 0x2D00, 0x2D25, 39 }, { 0x2D27, 0x2D27, 39 }, { 0x2D2D, 0x2D2D, 39 },
+        { 0x2D30, 0x2D67, 154 }, { 0x2D6F, 0x2D70, 154 }, { 0x2D7F, 0x2D7F, 154 }, { 0x2D80, 0x2D96, 37 },
+        { 0x2DA0, 0x2DA6, 37 }, { 0x2DA8, 0x2DAE, 37 }, { 0x2DB0, 0x2DB6, 37 }, { 0x2DB8, 0x2DBE, 37 },
+        { 0x2DC0, 0x2DC6, 37 }, { 0x2DC8, 0x2DCE, 37 }, { 0x2DD0, 0x2DD6, 37 }, { 0x2DD8, 0x2DDE, 37 },
+        { 0x2DE0, 0x2DFF, 28 }, { 0x2E80, 0x2E99, 50 }, { 0x2E9B, 0x2EF3, 50 }, { 0x2F00, 0x2FD5, 50 },
+        { 0x3005, 0x3005, 50 }, { 0x3007, 0x3007, 50 }, { 0x3021, 0x3029, 50 }, { 0x302E, 0x302F, 49 },
+        { 0x3038, 0x303B, 50 }, { 0x3041, 0x3096, 54 }, { 0x309D, 0x309F, 54 }, { 0x30A1, 0x30FA, 63 },
+        { 0x30FD, 0x30FF, 63 }, { 0x3105, 0x312F, 14 }, { 0x3131, 0x318E, 49 }, { 0x31A0, 0x31BF, 14 },
+        { 0x31F0, 0x31FF, 63 }, { 0x3200, 0x321E, 49 }, { 0x3260, 0x327E, 49 }, { 0x32D0, 0x32FE, 63 },
+        { 0x3300, 0x3357, 63 }, { 0x3400, 0x4DBF, 50 }, { 0x4E00, 0x9FFF, 50 }, { 0xA000, 0xA48C, 173 },
+        { 0xA490, 0xA4C6, 173 }, { 0xA4D0, 0xA4FF, 79 }, { 0xA500, 0xA62B, 166 }, { 0xA640, 0xA69F, 28 },
+        { 0xA6A0, 0xA6F7, 8 }, { 0xA722, 0xA787, 74 }, { 0xA78B, 0xA7DD, 74 }, { 0xA7E2, 0xA7E2, 74 },
+        { 0xA7F1, 0xA7FF, 74 }, { 0xA800, 0xA82C, 143 }, { 0xA840, 0xA877, 117 }, { 0xA880, 0xA8C5, 128 },
+        { 0xA8CE, 0xA8D9, 128 }, { 0xA8E0, 0xA8FF, 29 }, { 0xA900, 0xA92D, 62 }, { 0xA92F, 0xA92F, 62 },
+        { 0xA930, 0xA953, 123 }, { 0xA95F, 0xA95F, 123 }, { 0xA960, 0xA97C, 49 }, { 0xA980, 0xA9CD, 60 },
+        { 0xA9D0, 0xA9D9, 60 }, { 0xA9DE, 0xA9DF, 60 }, { 0xA9E0, 0xA9FE, 97 }, { 0xAA00, 0xAA36, 22 },
+        { 0xAA40, 0xAA4D, 22 }, { 0xAA50, 0xAA59, 22 }, { 0xAA5C, 0xAA5F, 22 }, { 0xAA60, 0xAA7F, 97 },
+        { 0xAA80, 0xAAC2, 151 }, { 0xAADB, 0xAADF, 151 }, { 0xAAE0, 0xAAF6, 95 }, { 0xAB01, 0xAB06, 37 },
+        { 0xAB09, 0xAB0E, 37 }, { 0xAB11, 0xAB16, 37 }, { 0xAB20, 0xAB26, 37 }, { 0xAB28, 0xAB2E, 37 },
+        { 0xAB30, 0xAB5A, 74 }, { 0xAB5C, 0xAB64, 74 }, { 0xAB65, 0xAB65, 45 }, { 0xAB66, 0xAB69, 74 },
+        { 0xAB6C, 0xAB6D, 74 }, { 0xAB70, 0xABBF, 23 }, { 0xABC0, 0xABED, 95 }, { 0xABF0, 0xABF9, 95 },
+        { 0xAC00, 0xD7A3, 49 }, { 0xD7B0, 0xD7C6, 49 }, { 0xD7CB, 0xD7FB, 49 }, { 0xF900, 0xFA6D, 50 },
+        { 0xFA70, 0xFAD9, 50 }, { 0xFB00, 0xFB06, 74 }, { 0xFB13, 0xFB17, 5 }, { 0xFB1D, 0xFB36, 53 },
+        { 0xFB38, 0xFB3C, 53 }, { 0xFB3E, 0xFB3E, 53 }, { 0xFB40, 0xFB41, 53 }, { 0xFB43, 0xFB44, 53 },
+        { 0xFB46, 0xFB4F, 53 }, { 0xFB50, 0xFD3D, 3 }, { 0xFD40, 0xFDCF, 3 }, { 0xFDF0, 0xFDFF, 3 },
+        { 0xFE2E, 0xFE2F, 28 }, { 0xFE70, 0xFE74, 3 }, { 0xFE76, 0xFEFC, 3 }, { 0xFF21, 0xFF3A, 74 },
+        { 0xFF41, 0xFF5A, 74 }, { 0xFF66, 0xFF6F, 63 }, { 0xFF71, 0xFF9D, 63 }, { 0xFFA0, 0xFFBE, 49 },
+        { 0xFFC2, 0xFFC7, 49 }, { 0xFFCA, 0xFFCF, 49 }, { 0xFFD2, 0xFFD7, 49 }, { 0xFFDA, 0xFFDC, 49 },
+        { 0x10000, 0x1000B, 78 }, { 0x1000D, 0x10026, 78 }, { 0x10028, 0x1003A, 78 },
+        { 0x1003C, 0x1003D, 78 }, { 0x1003F, 0x1004D, 78 }, { 0x10050, 0x1005D, 78 },
+        { 0x10080, 0x100FA, 78 }, { 0x10140, 0x1018E, 45 }, { 0x101A0, 0x101A0, 45 },
+        { 0x10280, 0x1029C, 80 }, { 0x102A0, 0x102D0, 21 }, { 0x10300, 0x10323, 59 },
+        { 0x1032D, 0x1032F, 59 }, { 0x10330, 0x1034A, 43 }, { 0x10350, 0x1037A, 116 },
+        { 0x10380, 0x1039D, 165 }, { 0x1039F, 0x1039F, 165 }, { 0x103A0, 0x103C3, 170 },
+        { 0x103C8, 0x103D5, 170 }, { 0x10400, 0x1044F, 32 }, { 0x10450, 0x1047F, 131 },
+        { 0x10480, 0x1049D, 111 }, { 0x104A0, 0x104A9, 111 }, { 0x104B0, 0x104D3, 110 },
+        { 0x104D8, 0x104FB, 110 }, { 0x10500, 0x10527, 35 }, { 0x10530, 0x10563, 1 }, { 0x1056F, 0x1056F, 1 },
+        { 0x10570, 0x1057A, 167 }, { 0x1057C, 0x1058A, 167 }, { 0x1058C, 0x10592, 167 },
+        { 0x10594, 0x10595, 167 }, { 0x10597, 0x105A1, 167 }, { 0x105A3, 0x105B1, 167 },
+        { 0x105B3, 0x105B9, 167 }, { 0x105BB, 0x105BC, 167 }, { 0x105C0, 0x105F3, 161 },
+        { 0x10600, 0x10736, 77 }, { 0x10740, 0x10755, 77 }, { 0x10760, 0x10767, 77 },
+        { 0x10780, 0x10785, 74 }, { 0x10787, 0x107B0, 74 }, { 0x107B2, 0x107BF, 74 },
+        { 0x10800, 0x10805, 27 }, { 0x10808, 0x10808, 27 }, { 0x1080A, 0x10835, 27 },
+        { 0x10837, 0x10838, 27 }, { 0x1083C, 0x1083C, 27 }, { 0x1083F, 0x1083F, 27 }, { 0x10840, 0x10855, 4 },
+        { 0x10857, 0x1085F, 4 }, { 0x10860, 0x1087F, 113 }, { 0x10880, 0x1089E, 101 },
+        { 0x108A7, 0x108AF, 101 }, { 0x108E0, 0x108F2, 52 }, { 0x108F4, 0x108F5, 52 },
+        { 0x108FB, 0x108FF, 52 }, { 0x10900, 0x1091B, 120 }, { 0x1091F, 0x1091F, 120 },
+        { 0x10920, 0x10939, 81 }, { 0x1093F, 0x1093F, 81 }, { 0x10940, 0x10959, 134 },
+        { 0x10980, 0x1099F, 90 }, { 0x109A0, 0x109B7, 89 }, { 0x109BC, 0x109CF, 89 },
+        { 0x109D2, 0x109FF, 89 }, { 0x10A00, 0x10A03, 65 }, { 0x10A05, 0x10A06, 65 },
+        { 0x10A0C, 0x10A13, 65 }, { 0x10A15, 0x10A17, 65 }, { 0x10A19, 0x10A35, 65 },
+        { 0x10A38, 0x10A3A, 65 }, { 0x10A3F, 0x10A48, 65 }, { 0x10A50, 0x10A58, 65 },
+        { 0x10A60, 0x10A7F, 127 }, { 0x10A80, 0x10A9F, 100 }, { 0x10AC0, 0x10AE6, 85 },
+        { 0x10AEB, 0x10AF6, 85 }, { 0x10B00, 0x10B35, 6 }, { 0x10B39, 0x10B3F, 6 }, { 0x10B40, 0x10B55, 122 },
+        { 0x10B58, 0x10B5F, 122 }, { 0x10B60, 0x10B72, 118 }, { 0x10B78, 0x10B7F, 118 },
+        { 0x10B80, 0x10B91, 119 }, { 0x10B99, 0x10B9C, 119 }, { 0x10BA9, 0x10BAF, 119 },
+        { 0x10C00, 0x10C48, 108 }, { 0x10C80, 0x10CB2, 58 }, { 0x10CC0, 0x10CF2, 58 },
+        { 0x10CFA, 0x10CFF, 58 }, { 0x10D00, 0x10D27, 124 }, { 0x10D30, 0x10D39, 124 },
+        { 0x10D40, 0x10D65, 38 }, { 0x10D69, 0x10D85, 38 }, { 0x10D8E, 0x10D8F, 38 }, { 0x10E60, 0x10E7E, 3 },
+        { 0x10E80, 0x10EA9, 172 }, { 0x10EAB, 0x10EAD, 172 }, { 0x10EB0, 0x10EB1, 172 },
+        { 0x10EC2, 0x10EC7, 3 }, { 0x10EC9, 0x10EEE, 3 }, { 0x10EF0, 0x10EFF, 3 }, { 0x10F00, 0x10F27, 138 },
+        { 0x10F30, 0x10F59, 137 }, { 0x10F70, 0x10F89, 112 }, { 0x10FB0, 0x10FCB, 24 },
+        { 0x10FE0, 0x10FF6, 36 }, { 0x11000, 0x1104D, 15 }, { 0x11052, 0x11075, 15 },
+        { 0x1107F, 0x1107F, 15 }, { 0x11080, 0x110C2, 71 }, { 0x110CD, 0x110CD, 71 },
+        { 0x110D0, 0x110E8, 139 }, { 0x110F0, 0x110F9, 139 }, { 0x11100, 0x11134, 19 },
+        { 0x11136, 0x11147, 19 }, { 0x11150, 0x11176, 82 }, { 0x11180, 0x111DF, 132 },
+        { 0x111E1, 0x111F4, 136 }, { 0x11200, 0x11211, 67 }, { 0x11213, 0x11241, 67 },
+        { 0x11280, 0x11286, 96 }, { 0x11288, 0x11288, 96 }, { 0x1128A, 0x1128D, 96 },
+        { 0x1128F, 0x1129D, 96 }, { 0x1129F, 0x112A9, 96 }, { 0x112B0, 0x112EA, 135 },
+        { 0x112F0, 0x112F9, 135 }, { 0x11300, 0x11303, 44 }, { 0x11305, 0x1130C, 44 },
+        { 0x1130F, 0x11310, 44 }, { 0x11313, 0x11328, 44 }, { 0x1132A, 0x11330, 44 },
+        { 0x11332, 0x11333, 44 }, { 0x11335, 0x11339, 44 }, { 0x1133C, 0x11344, 44 },
+        { 0x11347, 0x11348, 44 }, { 0x1134B, 0x1134D, 44 }, { 0x11350, 0x11350, 44 },
+        { 0x11357, 0x11357, 44 }, { 0x1135D, 0x11363, 44 }, { 0x11366, 0x1136C, 44 },
+        { 0x11370, 0x11374, 44 }, { 0x11380, 0x11389, 164 }, { 0x1138B, 0x1138B, 164 },
+        { 0x1138E, 0x1138E, 164 }, { 0x11390, 0x113B5, 164 }, { 0x113B7, 0x113C0, 164 },
+        { 0x113C2, 0x113C2, 164 }, { 0x113C5, 0x113C5, 164 }, { 0x113C7, 0x113CA, 164 },
+        { 0x113CC, 0x113D5, 164 }, { 0x113D7, 0x113D8, 164 }, { 0x113E1, 0x113E2, 164 },
+        { 0x11400, 0x1145B, 102 }, { 0x1145D, 0x11461, 102 }, { 0x11480, 0x114C7, 159 },
+        { 0x114D0, 0x114D9, 159 }, { 0x11580, 0x115B5, 133 }, { 0x115B8, 0x115DD, 133 },
+        { 0x11600, 0x11644, 92 }, { 0x11650, 0x11659, 92 }, { 0x11660, 0x1166C, 93 },
+        { 0x11680, 0x116B9, 146 }, { 0x116C0, 0x116C9, 146 }, { 0x116D0, 0x116E3, 97 },
+        { 0x11700, 0x1171A, 2 }, { 0x1171D, 0x1172B, 2 }, { 0x11730, 0x11746, 2 }, { 0x11800, 0x1183B, 31 },
+        { 0x118A0, 0x118F2, 168 }, { 0x118FF, 0x118FF, 168 }, { 0x11900, 0x11906, 30 },
+        { 0x11909, 0x11909, 30 }, { 0x1190C, 0x11913, 30 }, { 0x11915, 0x11916, 30 },
+        { 0x11918, 0x11935, 30 }, { 0x11937, 0x11938, 30 }, { 0x1193B, 0x11946, 30 },
+        { 0x11950, 0x11959, 30 }, { 0x119A0, 0x119A7, 99 }, { 0x119AA, 0x119D7, 99 },
+        { 0x119DA, 0x119E4, 99 }, { 0x11A00, 0x11A47, 174 }, { 0x11A50, 0x11AA2, 140 },
+        { 0x11AB0, 0x11ABF, 20 }, { 0x11AC0, 0x11AF8, 114 }, { 0x11B00, 0x11B0A, 29 },
+        { 0x11B60, 0x11B67, 132 }, { 0x11BC0, 0x11BE1, 142 }, { 0x11BF0, 0x11BF9, 142 },
+        { 0x11C00, 0x11C08, 13 }, { 0x11C0A, 0x11C36, 13 }, { 0x11C38, 0x11C45, 13 },
+        { 0x11C50, 0x11C6C, 13 }, { 0x11C70, 0x11C8F, 86 }, { 0x11C92, 0x11CA7, 86 },
+        { 0x11CA9, 0x11CB6, 86 }, { 0x11D00, 0x11D06, 42 }, { 0x11D08, 0x11D09, 42 },
+        { 0x11D0B, 0x11D36, 42 }, { 0x11D3A, 0x11D3A, 42 }, { 0x11D3C, 0x11D3D, 42 },
+        { 0x11D3F, 0x11D47, 42 }, { 0x11D50, 0x11D59, 42 }, { 0x11D60, 0x11D65, 41 },
+        { 0x11D67, 0x11D68, 41 }, { 0x11D6A, 0x11D8E, 41 }, { 0x11D90, 0x11D91, 41 },
+        { 0x11D93, 0x11D98, 41 }, { 0x11DA0, 0x11DA9, 41 }, { 0x11DB0, 0x11DDB, 162 },
+        { 0x11DE0, 0x11DE9, 162 }, { 0x11DF0, 0x11DF1, 11 }, { 0x11EE0, 0x11EF8, 83 },
+        { 0x11F00, 0x11F10, 64 }, { 0x11F12, 0x11F3A, 64 }, { 0x11F3E, 0x11F5A, 64 },
+        { 0x11FB0, 0x11FB0, 79 }, { 0x11FC0, 0x11FF1, 149 }, { 0x11FFF, 0x11FFF, 149 },
+        { 0x12000, 0x12399, 171 }, { 0x12400, 0x12543, 171 }, { 0x12550, 0x125A7, 171 },
+        { 0x125A8, 0x1264B, 115 }, { 0x1264C, 0x12686, 171 }, { 0x12F90, 0x12FF2, 26 },
+        { 0x13000, 0x13455, 34 }, { 0x13460, 0x143FA, 34 }, { 0x14400, 0x14646, 55 },
+        { 0x16100, 0x16139, 47 }, { 0x16800, 0x16A38, 8 }, { 0x16A40, 0x16A5E, 94 }, { 0x16A60, 0x16A69, 94 },
+        { 0x16A6E, 0x16A6F, 94 }, { 0x16A70, 0x16ABE, 160 }, { 0x16AC0, 0x16AC9, 160 },
+        { 0x16AD0, 0x16AED, 9 }, { 0x16AF0, 0x16AF5, 9 }, { 0x16B00, 0x16B45, 56 }, { 0x16B50, 0x16B59, 56 },
+        { 0x16B5B, 0x16B61, 56 }, { 0x16B63, 0x16B77, 56 }, { 0x16B7D, 0x16B8F, 56 },
+        { 0x16D40, 0x16D79, 70 }, { 0x16E40, 0x16E9A, 87 }, { 0x16EA0, 0x16EB8, 12 },
+        { 0x16EBB, 0x16ED3, 12 }, { 0x16F00, 0x16F4A, 121 }, { 0x16F4F, 0x16F87, 121 },
+        { 0x16F8F, 0x16F9F, 121 }, { 0x16FE0, 0x16FE0, 150 }, { 0x16FE1, 0x16FE1, 104 },
+        { 0x16FE2, 0x16FE3, 50 }, { 0x16FE4, 0x16FE4, 68 }, { 0x16FF0, 0x16FF6, 50 },
+        { 0x17000, 0x18AFF, 150 }, { 0x18B00, 0x18CDA, 68 }, { 0x18CFF, 0x18CFF, 68 },
+        { 0x18D00, 0x18D20, 150 }, { 0x18D80, 0x18DF2, 150 }, { 0x18E00, 0x19191, 61 },
+        { 0x191A0, 0x191D2, 61 }, { 0x1AFF0, 0x1AFF3, 63 }, { 0x1AFF5, 0x1AFFB, 63 },
+        { 0x1AFFD, 0x1AFFE, 63 }, { 0x1B000, 0x1B000, 63 }, { 0x1B001, 0x1B11F, 54 },
+        { 0x1B120, 0x1B122, 63 }, { 0x1B123, 0x1B123, 54 }, { 0x1B124, 0x1B128, 63 },
+        { 0x1B132, 0x1B132, 54 }, { 0x1B150, 0x1B152, 54 }, { 0x1B155, 0x1B155, 63 },
+        { 0x1B164, 0x1B168, 63 }, { 0x1B170, 0x1B2FB, 104 }, { 0x1BC00, 0x1BC6A, 33 },
+        { 0x1BC70, 0x1BC7C, 33 }, { 0x1BC80, 0x1BC88, 33 }, { 0x1BC90, 0x1BC99, 33 },
+        { 0x1BC9C, 0x1BC9F, 33 }, { 0x1D200, 0x1D245, 45 }, { 0x1D800, 0x1DA8B, 130 },
+        { 0x1DA9B, 0x1DA9F, 130 }, { 0x1DAA1, 0x1DAAF, 130 }, { 0x1DF00, 0x1DF81, 74 },
+        { 0x1DF90, 0x1DF96, 74 }, { 0x1DFCD, 0x1DFF2, 74 }, { 0x1DFF3, 0x1DFF4, 45 },
+        { 0x1DFF5, 0x1DFFF, 74 }, { 0x1E000, 0x1E006, 40 }, { 0x1E008, 0x1E018, 40 },
+        { 0x1E01B, 0x1E021, 40 }, { 0x1E023, 0x1E024, 40 }, { 0x1E026, 0x1E02A, 40 },
+        { 0x1E030, 0x1E06D, 28 }, { 0x1E08F, 0x1E08F, 28 }, { 0x1E100, 0x1E12C, 57 },
+        { 0x1E130, 0x1E13D, 57 }, { 0x1E140, 0x1E149, 57 }, { 0x1E14E, 0x1E14F, 57 },
+        { 0x1E290, 0x1E2AE, 163 }, { 0x1E2C0, 0x1E2F9, 169 }, { 0x1E2FF, 0x1E2FF, 169 },
+        { 0x1E4D0, 0x1E4F9, 98 }, { 0x1E5D0, 0x1E5FA, 107 }, { 0x1E5FF, 0x1E5FF, 107 },
+        { 0x1E6C0, 0x1E6DE, 152 }, { 0x1E6E0, 0x1E6F5, 152 }, { 0x1E6FE, 0x1E6FF, 152 },
+        { 0x1E7E0, 0x1E7E6, 37 }, { 0x1E7E8, 0x1E7EB, 37 }, { 0x1E7ED, 0x1E7EE, 37 },
+        { 0x1E7F0, 0x1E7FE, 37 }, { 0x1E800, 0x1E8C4, 88 }, { 0x1E8C7, 0x1E8D6, 88 }, { 0x1E900, 0x1E94B, 0 },
+        { 0x1E950, 0x1E959, 0 }, { 0x1E95E, 0x1E95F, 0 }, { 0x1EE00, 0x1EE03, 3 }, { 0x1EE05, 0x1EE1F, 3 },
+        { 0x1EE21, 0x1EE22, 3 }, { 0x1EE24, 0x1EE24, 3 }, { 0x1EE27, 0x1EE27, 3 }, { 0x1EE29, 0x1EE32, 3 },
+        { 0x1EE34, 0x1EE37, 3 }, { 0x1EE39, 0x1EE39, 3 }, { 0x1EE3B, 0x1EE3B, 3 }, { 0x1EE42, 0x1EE42, 3 },
+        { 0x1EE47, 0x1EE47, 3 }, { 0x1EE49, 0x1EE49, 3 }, { 0x1EE4B, 0x1EE4B, 3 }, { 0x1EE4D, 0x1EE4F, 3 },
+        { 0x1EE51, 0x1EE52, 3 }, { 0x1EE54, 0x1EE54, 3 }, { 0x1EE57, 0x1EE57, 3 }, { 0x1EE59, 0x1EE59, 3 },
+        { 0x1EE5B, 0x1EE5B, 3 }, { 0x1EE5D, 0x1EE5D, 3 }, { 0x1EE5F, 0x1EE5F, 3 }, { 0x1EE61, 0x1EE62, 3 },
+        { 0x1EE64, 0x1EE64, 3 }, { 0x1EE67, 0x1EE6A, 3 }, { 0x1EE6C, 0x1EE72, 3 }, { 0x1EE74, 0x1EE77, 3 },
+        { 0x1EE79, 0x1EE7C, 3 }, { 0x1EE7E, 0x1EE7E, 3 }, { 0x1EE80, 0x1EE89, 3 }, { 0x1EE8B, 0x1EE9B, 3 },
+        { 0x1EEA1, 0x1EEA3, 3 }, { 0x1EEA5, 0x1EEA9, 3 }, { 0x1EEAB, 0x1EEBB, 3 }, { 0x1EEF0, 0x1EEF1, 3 },
+        { 0x1F200, 0x1F200, 54 }, { 0x20000, 0x2A6DF, 50 }, { 0x2A700, 0x2B81E, 50 },
+        { 0x2B820, 0x2CEAD, 50 }, { 0x2CEB0, 0x2EBE0, 50 }, { 0x2EBF0, 0x2EE5D, 50 },
+        { 0x2F800, 0x2FA1D, 50 }, { 0x30000, 0x3134A, 50 }, { 0x31350, 0x33479, 50 },
+        { 0x3D000, 0x3FC3F, 129 },
+    };
+}
+
+std::vector<uint32_t> SupportedUnicodeScripts(const std::vector<CodePointRange>& mapped)
+{
+    const size_t scriptCount = sizeof(kScriptCodes) / sizeof(kScriptCodes[0]);
+    uint32_t assigned[scriptCount] = {};
+    uint32_t covered[scriptCount] = {};
+    for (const auto& range : kScriptRanges)
+        assigned[range.script] += range.last - range.first + 1;
+
+    // Both lists are sorted and non-overlapping: sweep them together
+    size_t s = 0;
+    for (const auto& range : mapped)
+    {
+        while (s < sizeof(kScriptRanges) / sizeof(kScriptRanges[0]) && kScriptRanges[s].last < range.first)
+            ++s;
+        for (size_t t = s; t < sizeof(kScriptRanges) / sizeof(kScriptRanges[0]) && kScriptRanges[t].first <= range.last; ++t)
+        {
+            uint32_t first = std::max(range.first, kScriptRanges[t].first);
+            uint32_t last = std::min(range.last, kScriptRanges[t].last);
+            covered[kScriptRanges[t].script] += last - first + 1;
+        }
+    }
+
+    std::vector<uint32_t> scripts;
+    for (size_t i = 0; i < scriptCount; ++i)
+    {
+        uint32_t needed = std::min<uint32_t>(32, (assigned[i] + 1) / 2);
+        if (covered[i] >= needed && covered[i] > 0)
+        {
+            const char* code = kScriptCodes[i];
+            scripts.push_back(MakeTag(code[0], code[1], code[2], code[3]));
+        }
+    }
+    return scripts;
+}
@@ -0,0 +1,13 @@
+// unicodescript.h : Unicode script (ISO 15924) coverage of a cmap
+//
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "cmap.h"
+#include "sfnt.h"
+
+// ISO 15924 codes as tags (e.g. 'Latn', 'Deva') of the scripts a font covers: at least
+// half of a script's assigned characters, or 32 of them for larger scripts. Sorted.
+std::vector<uint32_t> SupportedUnicodeScripts(const std::vector<CodePointRange>& mapped);
@@ -0,0 +1,156 @@
+// verify.cpp : sfnt table checksum and head.checkSumAdjustment verification
+//
+
+#include "verify.h"
+#include <cstring>
+#include "sfnt.h"
+#include "woff.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define LISTFONT_VERIFY_SSE2 1
+#else
+#define LISTFONT_VERIFY_SSE2 0
+#endif
+
+#if LISTFONT_VERIFY_SSE2
+static inline __m128i ByteSwap32(__m128i x)
+{
+    x = _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+    x = _mm_shufflelo_epi16(x, _MM_SHUFFLE(2, 3, 0, 1));
+    return _mm_shufflehi_epi16(x, _MM_SHUFFLE(2, 3, 0, 1));
+}
+#endif
+
+uint32_t CalcTableChecksum(const uint8_t* data, size_t length)
+{
+    uint32_t sum = 0;
+    size_t i = 0;
+#if LISTFONT_VERIFY_SSE2
+    if (length >= 64)
+    {
+        // Four independent accumulators of 4 lanes each; wraparound matches uint32 arithmetic
+        __m128i acc0 = _mm_setzero_si128(), acc1 = acc0, acc2 = acc0, acc3 = acc0;
+        const __m128i* p = reinterpret_cast<const __m128i*>(data);
+        for (; i + 64 <= length; i += 64, p += 4)
+        {
+            acc0 = _mm_add_epi32(acc0, ByteSwap32(_mm_loadu_si128(p)));
+            acc1 = _mm_add_epi32(acc1, ByteSwap32(_mm_loadu_si128(p + 1)));
+            acc2 = _mm_add_epi32(acc2, ByteSwap32(_mm_loadu_si128(p + 2)));
+            acc3 = _mm_add_epi32(acc3, ByteSwap32(_mm_loadu_si128(p + 3)));
+        }
+        __m128i acc = _mm_add_epi32(_mm_add_epi32(acc0, acc1), _mm_add_epi32(acc2, acc3));
+        acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+        acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2, 3, 0, 1)));
+        sum = (uint32_t)_mm_cvtsi128_si32(acc);
+    }
+#endif
+    ByteSpan bytes(data, length);
+    for (; i + 4 <= length; i += 4)
+        sum += bytes.U32(i);
+    if (i < length)
+    {
+        uint8_t tail[4] = {};
+        memcpy(tail, data + i, length - i);
+        sum += ByteSpan(tail, 4).U32(0);
+    }
+    return sum;
+}
+
+// Checksum of a table, treating head.checkSumAdjustment as zero
+static uint32_t TableChecksum(uint32_t tag, ByteSpan table)
+{
+    uint32_t sum = CalcTableChecksum(table.data, table.size);
+    if (tag == MakeTag('h', 'e', 'a', 'd') && table.Has(8, 4))
+        sum -= table.U32(8);
+    return sum;
+}
+
+static void CheckTable(FontContainer& container, const TableEntry& entry, FaceCheck& check)
+{
+    if (container.kind != ContainerKind::Woff2 && !container.file.Has(entry.offset, entry.storedLength))
+    {
+        check.problems.push_back({ entry.tag, TableIssue::OutOfBounds, 0, 0 });
+        return;
+    }
+    if (container.kind == ContainerKind::Woff2 && entry.transformed)
+    {
+        // Transformed tables have no stored checksum to compare against
+        return;
+    }
+
+    ByteSpan table = container.LoadTable(entry.tag);
+    if (!table)
+    {
+        check.problems.push_back({ entry.tag, TableIssue::DecodeFailed, 0, 0 });
+        return;
+    }
+    ++check.tablesChecked;
+
+    // WOFF2 drops table checksums; a successful decode is all that can be checked
+    if (container.kind == ContainerKind::Woff2)
+        return;
+
+    uint32_t actual = TableChecksum(entry.tag, table);
+    if (actual != entry.checksum)
+        check.problems.push_back({ entry.tag, TableIssue::ChecksumMismatch, entry.checksum, actual });
+}
+
+// head.checkSumAdjustment = 0xB1B0AFBA - checksum of the whole file with the field zeroed
+static void CheckHeadAdjustment(const FontContainer& container, FaceCheck& check)
+{
+    const TableEntry* head = container.FindTable(MakeTag('h', 'e', 'a', 'd'));
+    if (!head || head->length < 12 || (head->offset & 3) || !container.file.Has(head->offset, 12))
+        return;
+
+    uint32_t stored = container.file.U32(head->offset + 8);
+    uint32_t fileSum = CalcTableChecksum(container.file.data, container.file.size) - stored;
+    uint32_t expected = 0xB1B0AFBA - fileSum;
+    if (stored != expected)
+        check.problems.push_back({ head->tag, TableIssue::HeadAdjustment, stored, expected });
+}
+
+FileCheck VerifyFontData(const uint8_t* data, size_t size)
+{
+    FileCheck result;
+    FontContainer container;
+    if (!container.Open(data, size))
+        return result;
+    result.readable = true;
+
+    uint32_t faceCount = container.FaceCount();
+    for (uint32_t face = 0; face < faceCount; ++face)
+    {
+        FaceCheck check;
+        check.faceIndex = face;
+        if (!container.SelectFace(face))
+        {
+            // Table directory itself is cut off
+            check.problems.push_back({ 0, TableIssue::OutOfBounds, 0, 0 });
+            result.faces.push_back(std::move(check));
+            continue;
+        }
+
+        for (const auto& entry : container.tables)
+            CheckTable(container, entry, check);
+
+        // The adjustment is only defined for a standalone sfnt file
+        if (container.kind == ContainerKind::Sfnt)
+            CheckHeadAdjustment(container, check);
+
+        result.faces.push_back(std::move(check));
+    }
+    return result;
+}
+
+const wchar_t* TableIssueName(TableIssue issue)
+{
+    switch (issue)
+    {
+    case TableIssue::OutOfBounds: return L"out of bounds";
+    case TableIssue::DecodeFailed: return L"decode failed";
+    case TableIssue::ChecksumMismatch: return L"checksum mismatch";
+    case TableIssue::HeadAdjustment: return L"checkSumAdjustment mismatch";
+    }
+    return L"unknown";
+}
@@ -0,0 +1,45 @@
+// verify.h : sfnt table checksum and head.checkSumAdjustment verification
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+// Sum of big-endian uint32 words, the final partial word zero-padded (OpenType table checksum)
+uint32_t CalcTableChecksum(const uint8_t* data, size_t length);
+
+enum class TableIssue
+{
+    OutOfBounds,       // Table record points outside the file (truncated file)
+    DecodeFailed,      // WOFF/WOFF2 data could not be decompressed
+    ChecksumMismatch,  // Stored checksum differs from the computed one
+    HeadAdjustment,    // head.checkSumAdjustment does not match the whole-file sum
+};
+
+struct TableProblem
+{
+    uint32_t tag;
+    TableIssue issue;
+    uint32_t expected;  // Stored value (checksum issues only)
+    uint32_t actual;    // Computed value (checksum issues only)
+};
+
+struct FaceCheck
+{
+    uint32_t faceIndex = 0;
+    uint32_t tablesChecked = 0;
+    std::vector<TableProblem> problems;
+};
+
+struct FileCheck
+{
+    bool readable = false;  // Recognized as sfnt/collection/WOFF/WOFF2
+    std::vector<FaceCheck> faces;
+};
+
+// Check every table of every face. Works on the raw file bytes of any supported container.
+FileCheck VerifyFontData(const uint8_t* data, size_t size);
+
+const wchar_t* TableIssueName(TableIssue issue);
@@ -0,0 +1,547 @@
+// woff.cpp : WOFF (zlib per table) and WOFF2 (Brotli stream) container decoding
+//
+
+#include "woff.h"
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include "trace.h"
+
+#if !defined(LISTFONT_NO_BROTLI) && __has_include(<brotli/decode.h>)
+#include <brotli/decode.h>
+#define LISTFONT_HAVE_BROTLI 1
+#ifdef _MSC_VER
+#pragma comment(lib, "brotlidec.lib")
+#endif
+#else
+#define LISTFONT_HAVE_BROTLI 0
+#endif
+
+// ---------------------------------------------------------------------------
+// Inflate (RFC 1950/1951)
+// ---------------------------------------------------------------------------
+
+namespace
+{
+    struct BitReader
+    {
+        const uint8_t* src;
+        const uint8_t* end;
+        uint32_t bits = 0;
+        int count = 0;
+        bool overrun = false;
+
+        uint32_t Get(int n)
+        {
+            while (count < n)
+            {
+                if (src < end)
+                {
+                    bits |= uint32_t(*src++) << count;
+                }
+                else
+                {
+                    overrun = true;
+                }
+                count += 8;
+            }
+            uint32_t value = bits & ((1u << n) - 1);
+            bits >>= n;
+            count -= n;
+            return value;
+        }
+
+        void AlignToByte()
+        {
+            bits >>= count & 7;
+            count -= count & 7;
+        }
+    };
+
+    // Canonical Huffman table: codes are decoded by walking code lengths
+    struct Huffman
+    {
+        uint16_t counts[16];
+        uint16_t symbols[288];
+
+        bool Build(const uint8_t* lengths, int n)
+        {
+            uint16_t offsets[16];
+            for (int i = 0; i < 16; ++i) counts[i] = 0;
+            for (int i = 0; i < n; ++i) counts[lengths[i]]++;
+            counts[0] = 0;
+
+            int left = 1;
+            for (int len = 1; len < 16; ++len)
+            {
+                left <<= 1;
+                left -= counts[len];
+                if (left < 0) return false;  // over-subscribed
+            }
+
+            offsets[1] = 0;
+            for (int len = 1; len < 15; ++len)
+                offsets[len + 1] = offsets[len] + counts[len];
+            for (int i = 0; i < n; ++i)
+            {
+                if (lengths[i])
+                    symbols[offsets[lengths[i]]++] = (uint16_t)i;
+            }
+            return true;
+        }
+
+        int Decode(BitReader& in) const
+        {
+            int code = 0, first = 0, index = 0;
+            for (int len = 1; len < 16; ++len)
+            {
+                code |= (int)in.Get(1);
+                int count = counts[len];
+                if (code - count < first)
+                    return symbols[index + (code - first)];
+                index += count;
+                first += count;
+                first <<= 1;
+                code <<= 1;
+            }
+            return -1;
+        }
+    };
+
+    const uint16_t kLengthBase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                       35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    const uint8_t kLengthExtra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                       3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    const uint16_t kDistBase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+                                     257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    const uint8_t kDistExtra[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+                                     7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+    enum class BlockResult
+    {
+        Error,
+        End,   // End-of-block code reached
+        Full,  // Output buffer filled; only valid when decoding a prefix
+    };
+
+    BlockResult InflateBlock(BitReader& in, const Huffman& lengthCodes, const Huffman& distCodes,
+                             uint8_t* out, size_t& pos, size_t outSize)
+    {
+        for (;;)
+        {
+            int symbol = lengthCodes.Decode(in);
+            if (symbol < 0 || in.overrun) return BlockResult::Error;
+            if (symbol < 256)
+            {
+                if (pos >= outSize) return BlockResult::Full;
+                out[pos++] = (uint8_t)symbol;
+                continue;
+            }
+            if (symbol == 256) return BlockResult::End;
+
+            symbol -= 257;
+            if (symbol >= 29) return BlockResult::Error;
+            size_t length = kLengthBase[symbol] + in.Get(kLengthExtra[symbol]);
+
+            int distSymbol = distCodes.Decode(in);
+            if (distSymbol < 0 || distSymbol >= 30) return BlockResult::Error;
+            size_t distance = kDistBase[distSymbol] + in.Get(kDistExtra[distSymbol]);
+            if (distance > pos || in.overrun) return BlockResult::Error;
+
+            bool full = length > outSize - pos;
+            if (full) length = outSize - pos;
+            const uint8_t* from = out + pos - distance;
+            for (size_t i = 0; i < length; ++i)
+                out[pos + i] = from[i];
+            pos += length;
+            if (full) return BlockResult::Full;
+        }
+    }
+
+    bool BuildFixedCodes(Huffman& lengthCodes, Huffman& distCodes)
+    {
+        uint8_t lengths[288];
+        int i = 0;
+        for (; i < 144; ++i) lengths[i] = 8;
+        for (; i < 256; ++i) lengths[i] = 9;
+        for (; i < 280; ++i) lengths[i] = 7;
+        for (; i < 288; ++i) lengths[i] = 8;
+        if (!lengthCodes.Build(lengths, 288)) return false;
+        for (i = 0; i < 30; ++i) lengths[i] = 5;
+        return distCodes.Build(lengths, 30);
+    }
+
+    bool BuildDynamicCodes(BitReader& in, Huffman& lengthCodes, Huffman& distCodes)
+    {
+        static const uint8_t order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+        int hlit = (int)in.Get(5) + 257;
+        int hdist = (int)in.Get(5) + 1;
+        int hclen = (int)in.Get(4) + 4;
+        if (hlit > 286 || hdist > 30) return false;
+
+        uint8_t lengths[288 + 32] = {};
+        for (int i = 0; i < hclen; ++i)
+            lengths[order[i]] = (uint8_t)in.Get(3);
+        Huffman codeLengthCodes;
+        if (!codeLengthCodes.Build(lengths, 19)) return false;
+
+        uint8_t codeLengths[288 + 32] = {};
+        int n = 0;
+        while (n < hlit + hdist)
+        {
+            int symbol = codeLengthCodes.Decode(in);
+            if (symbol < 0 || in.overrun) return false;
+            if (symbol < 16)
+            {
+                codeLengths[n++] = (uint8_t)symbol;
+                continue;
+            }
+            uint8_t value = 0;
+            int repeat;
+            if (symbol == 16)
+            {
+                if (n == 0) return false;
+                value = codeLengths[n - 1];
+                repeat = 3 + (int)in.Get(2);
+            }
+            else if (symbol == 17)
+            {
+                repeat = 3 + (int)in.Get(3);
+            }
+            else
+            {
+                repeat = 11 + (int)in.Get(7);
+            }
+            if (n + repeat > hlit + hdist) return false;
+            while (repeat--) codeLengths[n++] = value;
+        }
+        if (codeLengths[256] == 0) return false;
+
+        return lengthCodes.Build(codeLengths, hlit) && distCodes.Build(codeLengths + hlit, hdist);
+    }
+}
+
+bool Inflate(const uint8_t* src, size_t srcSize, std::vector<uint8_t>& out, size_t expectedSize)
+{
+    return InflatePrefix(src, srcSize, out, expectedSize, expectedSize);
+}
+
+bool InflatePrefix(const uint8_t* src, size_t srcSize, std::vector<uint8_t>& out, size_t expectedSize, size_t prefixSize)
+{
+    if (srcSize < 2) return false;
+    uint8_t cmf = src[0], flg = src[1];
+    if ((cmf & 0x0F) != 8 || ((cmf << 8) | flg) % 31 != 0 || (flg & 0x20)) return false;
+    // Deflate cannot expand beyond ~1032:1, so larger claims are rejected before allocating
+    if (expectedSize / 1032 > srcSize) return false;
+
+    // Output beyond the prefix means the stream is done for our purposes; beyond the
+    // whole expected size it is corrupt
+    size_t outSize = prefixSize < expectedSize ? prefixSize : expectedSize;
+    bool partial = outSize < expectedSize;
+    out.resize(outSize);
+    BitReader in{ src + 2, src + srcSize };
+    size_t pos = 0;
+    Huffman lengthCodes, distCodes;
+
+    bool last = false;
+    while (!last)
+    {
+        last = in.Get(1) != 0;
+        uint32_t type = in.Get(2);
+        BlockResult result = BlockResult::End;
+        if (type == 0)
+        {
+            in.AlignToByte();
+            // Drain any whole bytes still buffered in the bit reader
+            in.src -= in.count / 8;
+            in.bits = 0;
+            in.count = 0;
+            if (in.end - in.src < 4) return false;
+            uint16_t len = uint16_t(in.src[0] | (in.src[1] << 8));
+            uint16_t nlen = uint16_t(in.src[2] | (in.src[3] << 8));
+            if (len != uint16_t(~nlen)) return false;
+            in.src += 4;
+            if ((size_t)(in.end - in.src) < len) return false;
+            size_t copy = len;
+            if (copy > outSize - pos)
+            {
+                copy = outSize - pos;
+                result = BlockResult::Full;
+            }
+            for (size_t i = 0; i < copy; ++i) out[pos++] = in.src[i];
+            in.src += len;
+        }
+        else if (type == 1)
+        {
+            if (!BuildFixedCodes(lengthCodes, distCodes)) return false;
+            result = InflateBlock(in, lengthCodes, distCodes, out.data(), pos, outSize);
+        }
+        else if (type == 2)
+        {
+            if (!BuildDynamicCodes(in, lengthCodes, distCodes)) return false;
+            result = InflateBlock(in, lengthCodes, distCodes, out.data(), pos, outSize);
+        }
+        else
+        {
+            return false;
+        }
+        if (result == BlockResult::Error || in.overrun) return false;
+        if (result == BlockResult::Full) return partial;
+    }
+    return pos == outSize;
+}
+
+// ---------------------------------------------------------------------------
+// WOFF 1.0
+// ---------------------------------------------------------------------------
+
+bool ParseWoffHeader(FontContainer& container)
+{
+    ByteSpan header = container.file.Sub(0, 44);
+    if (header.Empty()) return false;
+
+    container.flavor = header.U32(4);
+    uint16_t numTables = header.U16(12);
+    ByteSpan records = container.file.Array(44, numTables, 20);
+    if (records.Empty() && numTables > 0) return false;
+
+    container.tables.clear();
+    for (uint16_t i = 0; i < numTables; ++i)
+    {
+        size_t record = size_t(i) * 20;
+        TableEntry entry;
+        entry.tag = records.U32(record);
+        entry.offset = records.U32(record + 4);
+        entry.storedLength = records.U32(record + 8);
+        entry.length = records.U32(record + 12);
+        entry.checksum = records.U32(record + 16);
+        // Out-of-range entries are kept so integrity checks can report them; loading them fails
+        container.tables.push_back(entry);
+    }
+    return true;
+}
+
+bool DecodeWoffTable(const FontContainer& container, const TableEntry& entry, std::vector<uint8_t>& out,
+                     size_t prefixSize)
+{
+    TraceScope trace("InflateWoff");
+    ByteSpan compressed = container.file.Sub(entry.offset, entry.storedLength);
+    if (!compressed || entry.storedLength > entry.length)
+        return false;
+    return InflatePrefix(compressed.data, compressed.size, out, entry.length, prefixSize);
+}
+
+// ---------------------------------------------------------------------------
+// WOFF 2.0
+// ---------------------------------------------------------------------------
+
+struct Woff2Stream
+{
+    size_t compressedOffset = 0;
+    size_t compressedSize = 0;
+    size_t totalSize = 0;                 // Sum of all (transformed) table lengths
+    std::unique_ptr<uint8_t[]> buffer;    // Grown as far as reads reach
+    size_t capacity = 0;
+    std::vector<std::unique_ptr<uint8_t[]>> retired;  // Outgrown buffers, kept so returned views stay valid
+    size_t produced = 0;
+    bool failed = false;
+#if LISTFONT_HAVE_BROTLI
+    BrotliDecoderState* state = nullptr;
+    size_t consumed = 0;
+
+    ~Woff2Stream()
+    {
+        if (state) BrotliDecoderDestroyInstance(state);
+    }
+#endif
+};
+
+namespace
+{
+    const uint32_t kWoff2KnownTags[63] = {
+        MakeTag('c', 'm', 'a', 'p'), MakeTag('h', 'e', 'a', 'd'), MakeTag('h', 'h', 'e', 'a'), MakeTag('h', 'm', 't', 'x'),
+        MakeTag('m', 'a', 'x', 'p'), MakeTag('n', 'a', 'm', 'e'), MakeTag('O', 'S', '/', '2'), MakeTag('p', 'o', 's', 't'),
+        MakeTag('c', 'v', 't', ' '), MakeTag('f', 'p', 'g', 'm'), MakeTag('g', 'l', 'y', 'f'), MakeTag('l', 'o', 'c', 'a'),
+        MakeTag('p', 'r', 'e', 'p'), MakeTag('C', 'F', 'F', ' '), MakeTag('V', 'O', 'R', 'G'), MakeTag('E', 'B', 'D', 'T'),
+        MakeTag('E', 'B', 'L', 'C'), MakeTag('g', 'a', 's', 'p'), MakeTag('h', 'd', 'm', 'x'), MakeTag('k', 'e', 'r', 'n'),
+        MakeTag('L', 'T', 'S', 'H'), MakeTag('P', 'C', 'L', 'T'), MakeTag('V', 'D', 'M', 'X'), MakeTag('v', 'h', 'e', 'a'),
+        MakeTag('v', 'm', 't', 'x'), MakeTag('B', 'A', 'S', 'E'), MakeTag('G', 'D', 'E', 'F'), MakeTag('G', 'P', 'O', 'S'),
+        MakeTag('G', 'S', 'U', 'B'), MakeTag('E', 'B', 'S', 'C'), MakeTag('J', 'S', 'T', 'F'), MakeTag('M', 'A', 'T', 'H'),
+        MakeTag('C', 'B', 'D', 'T'), MakeTag('C', 'B', 'L', 'C'), MakeTag('C', 'O', 'L', 'R'), MakeTag('C', 'P', 'A', 'L'),
+        MakeTag('S', 'V', 'G', ' '), MakeTag('s', 'b', 'i', 'x'), MakeTag('a', 'c', 'n', 't'), MakeTag('a', 'v', 'a', 'r'),
+        MakeTag('b', 'd', 'a', 't'), MakeTag('b', 'l', 'o', 'c'), MakeTag('b', 's', 'l', 'n'), MakeTag('c', 'v', 'a', 'r'),
+        MakeTag('f', 'd', 's', 'c'), MakeTag('f', 'e', 'a', 't'), MakeTag('f', 'm', 't', 'x'), MakeTag('f', 'v', 'a', 'r'),
+        MakeTag('g', 'v', 'a', 'r'), MakeTag('h', 's', 't', 'y'), MakeTag('j', 'u', 's', 't'), MakeTag('l', 'c', 'a', 'r'),
+        MakeTag('m', 'o', 'r', 't'), MakeTag('m', 'o', 'r', 'x'), MakeTag('o', 'p', 'b', 'd'), MakeTag('p', 'r', 'o', 'p'),
+        MakeTag('t', 'r', 'a', 'k'), MakeTag('Z', 'a', 'p', 'f'), MakeTag('S', 'i', 'l', 'f'), MakeTag('G', 'l', 'a', 't'),
+        MakeTag('G', 'l', 'o', 'c'), MakeTag('F', 'e', 'a', 't'), MakeTag('S', 'i', 'l', 'l'),
+    };
+
+    uint32_t ReadBase128(SpanCursor& in)
+    {
+        uint32_t value = 0;
+        for (int i = 0; i < 5; ++i)
+        {
+            uint8_t byte = in.U8();
+            if ((i == 0 && byte == 0x80) || (value & 0xFE000000))
+            {
+                // Leading zeros or overflow
+                in.failed = true;
+                return 0;
+            }
+            value = (value << 7) | (byte & 0x7F);
+            if (!(byte & 0x80)) return value;
+        }
+        in.failed = true;
+        return 0;
+    }
+
+    // The table lengths only claim a stream size; a small file claiming a huge one is refused
+    // before anything is allocated. Real fonts compress by well under this.
+    const uint64_t kMaxWoff2Expansion = 100;
+    const uint64_t kMaxWoff2Stream = 0x10000000;
+
+    // Smallest first buffer, so a few small tables do not each cause a reallocation
+    const size_t kMinWoff2Buffer = 64 * 1024;
+
+    uint16_t Read255UInt16(SpanCursor& in)
+    {
+        uint8_t code = in.U8();
+        if (code == 253) return in.U16();
+        if (code == 254) return uint16_t(in.U8() + 506);
+        if (code == 255) return uint16_t(in.U8() + 253);
+        return code;
+    }
+}
+
+bool ParseWoff2Header(FontContainer& container)
+{
+    ByteSpan header = container.file.Sub(0, 48);
+    if (header.Empty()) return false;
+
+    container.flavor = header.U32(4);
+    uint16_t numTables = header.U16(12);
+    uint32_t compressedSize = header.U32(20);
+
+    SpanCursor in(container.file, 48);
+    uint64_t streamOffset = 0;
+    container.woff2Tables.clear();
+    for (uint16_t i = 0; i < numTables && in.Ok(); ++i)
+    {
+        uint8_t flags = in.U8();
+        TableEntry entry;
+        entry.tag = (flags & 0x3F) == 0x3F ? in.U32() : kWoff2KnownTags[flags & 0x3F];
+        entry.length = ReadBase128(in);
+
+        uint8_t version = flags >> 6;
+        bool glyfOrLoca = entry.tag == MakeTag('g', 'l', 'y', 'f') || entry.tag == MakeTag('l', 'o', 'c', 'a');
+        entry.transformed = glyfOrLoca ? version != 3 : version != 0;
+        entry.storedLength = entry.transformed ? ReadBase128(in) : entry.length;
+
+        entry.offset = (uint32_t)streamOffset;
+        streamOffset += entry.storedLength;
+        if (streamOffset > kMaxWoff2Stream) return false;
+        container.woff2Tables.push_back(entry);
+    }
+
+    container.woff2Faces.clear();
+    if (container.flavor == MakeTag('t', 't', 'c', 'f'))
+    {
+        in.Skip(4);  // collection version
+        uint16_t numFonts = Read255UInt16(in);
+        for (uint16_t f = 0; f < numFonts && in.Ok(); ++f)
+        {
+            uint16_t faceTables = Read255UInt16(in);
+            in.Skip(4);  // face flavor
+            std::vector<uint16_t> indices;
+            for (uint16_t t = 0; t < faceTables && in.Ok(); ++t)
+            {
+                uint16_t index = Read255UInt16(in);
+                if (index >= numTables) return false;
+                indices.push_back(index);
+            }
+            container.woff2Faces.push_back(std::move(indices));
+        }
+    }
+    else
+    {
+        std::vector<uint16_t> indices(numTables);
+        for (uint16_t t = 0; t < numTables; ++t) indices[t] = t;
+        container.woff2Faces.push_back(std::move(indices));
+    }
+    if (!in.Ok()) return false;
+
+    auto stream = std::make_shared<Woff2Stream>();
+    stream->compressedOffset = in.pos;
+    stream->compressedSize = compressedSize;
+    stream->totalSize = (size_t)streamOffset;
+    if (!container.file.Has(stream->compressedOffset, stream->compressedSize)) return false;
+    if (streamOffset > (uint64_t)compressedSize * kMaxWoff2Expansion) return false;
+    container.woff2 = stream;
+    return true;
+}
+
+bool Woff2DecoderAvailable()
+{
+    return LISTFONT_HAVE_BROTLI != 0;
+}
+
+ByteSpan DecodeWoff2Range(FontContainer& container, uint32_t offset, uint32_t length)
+{
+    TraceScope trace("DecodeWoff2");
+    ByteSpan result;
+    Woff2Stream* stream = container.woff2.get();
+    if (!stream || stream->failed) return result;
+    size_t needed = size_t(offset) + length;
+    if (needed > stream->totalSize) return result;
+
+#if LISTFONT_HAVE_BROTLI
+    if (!stream->state)
+    {
+        stream->state = BrotliDecoderCreateInstance(nullptr, nullptr, nullptr);
+        if (!stream->state)
+        {
+            stream->failed = true;
+            return result;
+        }
+    }
+    if (needed > stream->capacity)
+    {
+        // Double, so the copies add up to less than the stream; views into the old buffer stay valid
+        size_t capacity = std::min(stream->totalSize, std::max({ needed, stream->capacity * 2, kMinWoff2Buffer }));
+        std::unique_ptr<uint8_t[]> buffer(new uint8_t[capacity]);
+        if (stream->produced > 0)
+            memcpy(buffer.get(), stream->buffer.get(), stream->produced);
+        if (stream->buffer)
+            stream->retired.push_back(std::move(stream->buffer));
+        stream->buffer = std::move(buffer);
+        stream->capacity = capacity;
+    }
+
+    // Decompress only until the requested range is available
+    while (stream->produced < needed)
+    {
+        size_t availableIn = stream->compressedSize - stream->consumed;
+        const uint8_t* nextIn = container.file.data + stream->compressedOffset + stream->consumed;
+        size_t availableOut = needed - stream->produced;
+        uint8_t* nextOut = stream->buffer.get() + stream->produced;
+
+        BrotliDecoderResult status = BrotliDecoderDecompressStream(stream->state, &availableIn, &nextIn,
+                                                                   &availableOut, &nextOut, nullptr);
+        stream->consumed = stream->compressedSize - availableIn;
+        stream->produced = (size_t)(nextOut - stream->buffer.get());
+        if (status == BROTLI_DECODER_RESULT_ERROR ||
+            (status != BROTLI_DECODER_RESULT_NEEDS_MORE_OUTPUT && stream->produced < needed))
+        {
+            stream->failed = true;
+            return result;
+        }
+    }
+
+    result = ByteSpan(stream->buffer.get() + offset, length);
+#else
+    (void)container;
+#endif
+    return result;
+}
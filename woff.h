@@ -0,0 +1,27 @@
+// woff.h : WOFF (zlib per table) and WOFF2 (Brotli stream) container decoding
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "sfnt.h"
+
+// zlib stream decoder used for WOFF tables. Fails unless exactly expectedSize bytes are produced.
+bool Inflate(const uint8_t* src, size_t srcSize, std::vector<uint8_t>& out, size_t expectedSize);
+
+// Only the first prefixSize bytes of such a stream; decoding stops once they are produced
+bool InflatePrefix(const uint8_t* src, size_t srcSize, std::vector<uint8_t>& out, size_t expectedSize, size_t prefixSize);
+
+bool ParseWoffHeader(FontContainer& container);
+bool DecodeWoffTable(const FontContainer& container, const TableEntry& entry, std::vector<uint8_t>& out,
+                     size_t prefixSize = SIZE_MAX);
+
+bool ParseWoff2Header(FontContainer& container);
+
+// True when this build can decompress WOFF2 streams itself (Brotli available)
+bool Woff2DecoderAvailable();
+
+// View of [offset, offset + length) in the WOFF2 stream, decompressing only up to its end
+ByteSpan DecodeWoff2Range(FontContainer& container, uint32_t offset, uint32_t length);